@@ -0,0 +1,113 @@
+# ######################################################################## #
+# File:     /cmake/ClaspAmalgamate.cmake
+#
+# Purpose:  CMake script that generates the amalgamated source clasp_all.c
+#
+# Created:  19th October 2026
+# Updated:  19th October 2026
+#
+# ######################################################################## #
+
+
+# Invoked (at build-time) as:
+#
+#   cmake -DSOURCE_DIR=<dir> -DSOURCES=<name>,<name>,... -DOUTPUT=<file>
+#     -P ClaspAmalgamate.cmake
+#
+# Concatenates the internal header and the given core sources into a
+# single translation unit. The preprocessor directives that precede each
+# source's inclusion of the internal header - feature-test macros, etc. -
+# are hoisted to the start of the output, and the inclusions themselves
+# are removed.
+
+if(NOT SOURCE_DIR OR NOT SOURCES OR NOT OUTPUT)
+
+	message(FATAL_ERROR "SOURCE_DIR, SOURCES, and OUTPUT must be defined")
+endif()
+
+string(REPLACE "," ";" SOURCES "${SOURCES}")
+
+set(INTERNAL_HEADER_NAME "clasp.internal.h")
+set(INTERNAL_HEADER_INCLUSION "#include \"${INTERNAL_HEADER_NAME}\"")
+set(BANNER_END " * ////////////////////////////////////////////////////////////////////// */\n")
+
+
+# strips the banner comment from the given text
+function(clasp_amalgamate_strip_banner_ text_var)
+
+	string(FIND "${${text_var}}" "${BANNER_END}" pos)
+
+	if(NOT pos EQUAL -1)
+
+		string(LENGTH "${BANNER_END}" len)
+		math(EXPR pos "${pos} + ${len}")
+		string(SUBSTRING "${${text_var}}" ${pos} -1 text)
+
+		set(${text_var} "${text}" PARENT_SCOPE)
+	endif()
+endfunction()
+
+
+set(prologue "")
+set(body "")
+
+foreach(source ${SOURCES})
+
+	file(READ "${SOURCE_DIR}/${source}" text)
+
+	clasp_amalgamate_strip_banner_(text)
+
+	string(FIND "${text}" "${INTERNAL_HEADER_INCLUSION}" pos)
+
+	if(NOT pos EQUAL -1)
+
+		string(SUBSTRING "${text}" 0 ${pos} head)
+		string(LENGTH "${INTERNAL_HEADER_INCLUSION}" len)
+		math(EXPR pos "${pos} + ${len}")
+		string(SUBSTRING "${text}" ${pos} -1 text)
+
+		# hoist the directives, including any continuation lines, which are
+		# first replaced so as not to escape the list separators
+		string(REPLACE "\\\n" "@CLASP_CONTINUATION@" head "${head}")
+		string(REGEX MATCHALL "(^|\n)#[^\n]*" directives "\n${head}")
+
+		foreach(directive ${directives})
+
+			string(STRIP "${directive}" directive)
+			string(REPLACE "@CLASP_CONTINUATION@" "\\\n" directive "${directive}")
+			string(APPEND prologue "${directive}\n")
+		endforeach()
+	endif()
+
+	string(APPEND body "\n\n/* /////////////////////////////////////////////////////////////////////////\n * ${source}\n */\n${text}")
+endforeach()
+
+file(READ "${SOURCE_DIR}/${INTERNAL_HEADER_NAME}" internal_header)
+
+clasp_amalgamate_strip_banner_(internal_header)
+
+file(WRITE "${OUTPUT}" "/* /////////////////////////////////////////////////////////////////////////
+ * File:    clasp_all.c
+ *
+ * Purpose: Amalgamation of the CLASP core library sources.
+ *
+ * This file is generated by ClaspAmalgamate.cmake: do not edit.
+ *
+ * Home:    https://github.com/synesissoftware/CLASP/
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * hoisted directives
+ */
+
+${prologue}
+
+/* /////////////////////////////////////////////////////////////////////////
+ * ${INTERNAL_HEADER_NAME}
+ */
+${internal_header}${body}")
+
+
+# ############################## end of file ############################# #
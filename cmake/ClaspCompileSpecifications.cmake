@@ -0,0 +1,87 @@
+
+# ######################################################################## #
+# File:     /cmake/ClaspCompileSpecifications.cmake
+#
+# Purpose:  CMake module file (for clasp_compile_specifications())
+#
+# Created:  19th October 2026
+# Updated:  19th October 2026
+#
+# ######################################################################## #
+
+
+# clasp_compile_specifications(<target> <specs-file>
+#   [NAME <identifier>]
+#   [USAGE_FLAGS <flags>]
+#   [CONSOLE_WIDTH <width>]
+#   [TAB_SIZE <tab-size>]
+#   [BLANKS_BETWEEN_ITEMS <number>]
+# )
+#
+# Generates, by the clasp.specc tool, a C source file from the given
+# specifications description, and adds it to the sources of the given
+# target. The source defines a clasp_compiled_specifications_t instance -
+# named by NAME, or else by the stem of the description followed by
+# "_specifications" - for use with clasp_parseArgumentsCompiled() and
+# clasp_showBodyCompiled(); the remaining arguments specify the layout for
+# which the usage body is pre-rendered.
+function(clasp_compile_specifications target specs_file)
+
+	cmake_parse_arguments(PARSE_ARGV 2 ARG "" "NAME;USAGE_FLAGS;CONSOLE_WIDTH;TAB_SIZE;BLANKS_BETWEEN_ITEMS" "")
+
+	if(TARGET clasp.specc)
+
+		set(tool_ clasp.specc)
+	elseif(TARGET CLASP::clasp.specc)
+
+		set(tool_ CLASP::clasp.specc)
+	else()
+
+		message(FATAL_ERROR "clasp_compile_specifications(): the clasp.specc tool is not available - define BUILD_TOOLS to build it")
+	endif()
+
+	get_filename_component(specs_path_ "${specs_file}" ABSOLUTE)
+	get_filename_component(specs_stem_ "${specs_file}" NAME_WE)
+
+	set(output_path_ "${CMAKE_CURRENT_BINARY_DIR}/${specs_stem_}.specs.c")
+
+	set(tool_args_ "")
+
+	if(DEFINED ARG_NAME)
+
+		list(APPEND tool_args_ "--name=${ARG_NAME}")
+	endif()
+	if(DEFINED ARG_USAGE_FLAGS)
+
+		list(APPEND tool_args_ "--usage-flags=${ARG_USAGE_FLAGS}")
+	endif()
+	if(DEFINED ARG_CONSOLE_WIDTH)
+
+		list(APPEND tool_args_ "--console-width=${ARG_CONSOLE_WIDTH}")
+	endif()
+	if(DEFINED ARG_TAB_SIZE)
+
+		list(APPEND tool_args_ "--tab-size=${ARG_TAB_SIZE}")
+	endif()
+	if(DEFINED ARG_BLANKS_BETWEEN_ITEMS)
+
+		list(APPEND tool_args_ "--blanks-between-items=${ARG_BLANKS_BETWEEN_ITEMS}")
+	endif()
+
+	add_custom_command(
+		OUTPUT "${output_path_}"
+		COMMAND ${tool_} ${tool_args_} "${specs_path_}" "${output_path_}"
+		DEPENDS "${specs_path_}" ${tool_}
+		COMMENT "Compiling CLASP specifications ${specs_file}"
+		VERBATIM
+	)
+
+	target_sources(${target}
+		PRIVATE
+			"${output_path_}"
+	)
+endfunction(clasp_compile_specifications)
+
+
+# ############################## end of file ############################# #
+
@@ -1,13 +1,26 @@
 
+# define_automated_test_program(<program-name> <entry-point-source>
+#   [LIBRARY <target>]
+# )
+#
+# LIBRARY specifies the CLASP library target against which the program is
+# linked, which defaults to core.
 function(define_automated_test_program program_name entry_point_source_name)
 
+	cmake_parse_arguments(PARSE_ARGV 2 ARG "" "LIBRARY" "")
+
+	if(NOT ARG_LIBRARY)
+
+		set(ARG_LIBRARY core)
+	endif()
+
 	add_executable(${program_name}
 		${entry_point_source_name}
 	)
 
 	target_link_libraries(${program_name}
 		PRIVATE
-			core
+			${ARG_LIBRARY}
 			$<$<STREQUAL:${STLSOFT_INCLUDE_DIR},>:STLSoft::STLSoft>
 			$<IF:$<VERSION_LESS:${xTests_VERSION},"0.23">,xTests::xTests.core,xTests::core>
 	)
@@ -114,5 +127,14 @@ function(define_example_program program_name entry_point_source_name)
 endfunction(define_example_program)
 
 
+# define_performance_test_program(<program-name> <entry-point-source>)
+#
+# Performance-test programs are built as are examples - linked only to
+# core (and STLSoft) - and are not run as part of the automated tests.
+function(define_performance_test_program program_name entry_point_source_name)
+
+	define_example_program(${program_name} ${entry_point_source_name})
+endfunction(define_performance_test_program)
+
 # ############################## end of file ############################# #
 
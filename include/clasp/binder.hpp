@@ -0,0 +1,864 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    clasp/binder.hpp
+ *
+ * Purpose: Declarative, single-pass binding of flags and options.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * Home:    https://github.com/synesissoftware/CLASP/
+ *
+ * Copyright (c) 2026, Matthew Wilson
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer;
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution;
+ * - Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/** \file clasp/binder.hpp
+ *
+ * \brief [C++-only] Declarative, single-pass binding of flags and options.
+ */
+
+#ifndef CLASP_INCL_CLASP_HPP_BINDER
+#define CLASP_INCL_CLASP_HPP_BINDER
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * version information
+ */
+
+#ifndef CLASP_DOCUMENTATION_SKIP_SECTION
+# define CLASP_VER_CLASP_HPP_BINDER_MAJOR       1
+# define CLASP_VER_CLASP_HPP_BINDER_MINOR       0
+# define CLASP_VER_CLASP_HPP_BINDER_REVISION    1
+# define CLASP_VER_CLASP_HPP_BINDER_EDIT        1
+#endif /* !CLASP_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* CLASP header files */
+#include <clasp/clasp.hpp>
+
+/* Standard header files */
+#include <algorithm>
+#include <string>
+#include <vector>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+namespace clasp
+{
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * exception classes
+ */
+
+/// Thrown by binder::bind() if any bindings fail, carrying all failures
+class binding_exception
+    : public argument_exception
+{
+public: // types
+    typedef argument_exception                              parent_class_type;
+    typedef binding_exception                               class_type;
+    /// A single binding failure
+    struct error_type
+    {
+        /// The failure message, e.g. "required option is not found"
+        message_string_type message;
+        /// The name of the flag/option to which the failure pertains
+        string_type         optionName;
+    };
+    /// The collection of failures
+    typedef std::vector<error_type>                         errors_type;
+
+public: // construction
+    explicit binding_exception(errors_type const& errors)
+        : parent_class_type(calc_message_(errors), string_type())
+        , errors(errors)
+    {}
+    virtual ~binding_exception() stlsoft_throw_0()
+    {}
+private:
+    class_type& operator =(class_type const&);
+
+public:
+    /// All failures: conversion failures, in argument order, followed by
+    /// missing required options, in declaration order
+    const errors_type errors;
+
+private:
+    static
+    message_string_type
+    calc_message_(
+        errors_type const& errors
+    )
+    {
+        message_string_type m;
+
+        { for (size_t i = 0; i != errors.size(); ++i)
+        {
+            if (0 != i)
+            {
+                m.append("; ");
+            }
+
+            m.append(errors[i].message);
+            m.append(": ");
+#ifdef CLASP_USE_WIDE_STRINGS
+
+            m.append(stlsoft::w2m(errors[i].optionName));
+#else /* ? CLASP_USE_WIDE_STRINGS */
+
+            m.append(errors[i].optionName);
+#endif /* CLASP_USE_WIDE_STRINGS */
+        }}
+
+        return m;
+    }
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+
+#ifndef CLASP_DOCUMENTATION_SKIP_SECTION
+
+namespace ximpl
+{
+    template <typename T>
+    struct binder_identity_
+    {
+        typedef T                                           type;
+    };
+
+    /* Converters for the value types supported by binder::option() and
+     * binder::required_option(): all integral types (via the general
+     * template), float, double, bool, C-style strings and clasp_string_t.
+     */
+
+    template <typename T>
+    struct binder_value_converter_
+    {
+        static conversion_status_ convert(clasp_slice_t const& value, T* result)
+        {
+            return integer_conversion_traits_<T>::convert(value, result);
+        }
+
+        static char const* invalid_format_message()
+        {
+            return "value is not an integer for option";
+        }
+    };
+
+    STLSOFT_TEMPLATE_SPECIALISATION
+    struct binder_value_converter_<float>
+    {
+        static conversion_status_ convert(clasp_slice_t const& value, float* result)
+        {
+            return real_conversion_traits_<float>::convert(value, result);
+        }
+
+        static char const* invalid_format_message()
+        {
+            return "value is not a real number for option";
+        }
+    };
+
+    STLSOFT_TEMPLATE_SPECIALISATION
+    struct binder_value_converter_<double>
+    {
+        static conversion_status_ convert(clasp_slice_t const& value, double* result)
+        {
+            return real_conversion_traits_<double>::convert(value, result);
+        }
+
+        static char const* invalid_format_message()
+        {
+            return "value is not a real number for option";
+        }
+    };
+
+    STLSOFT_TEMPLATE_SPECIALISATION
+    struct binder_value_converter_<bool>
+    {
+        static conversion_status_ convert(clasp_slice_t const& value, bool* result)
+        {
+            bool        wasStrictlyCorrect;
+            bool const  b = boolean_conversion_traits_::convert(value, &wasStrictlyCorrect);
+
+            if (!wasStrictlyCorrect)
+            {
+                return conversion_invalidFormat_;
+            }
+
+            *result = b;
+
+            return conversion_succeeded_;
+        }
+
+        static char const* invalid_format_message()
+        {
+            return "option value must be a boolean";
+        }
+    };
+
+    STLSOFT_TEMPLATE_SPECIALISATION
+    struct binder_value_converter_<clasp_char_t const*>
+    {
+        static conversion_status_ convert(clasp_slice_t const& value, clasp_char_t const** result)
+        {
+            *result = value.ptr;
+
+            return conversion_succeeded_;
+        }
+
+        static char const* invalid_format_message()
+        {
+            return "invalid value for option";
+        }
+    };
+
+    STLSOFT_TEMPLATE_SPECIALISATION
+    struct binder_value_converter_<clasp_string_t>
+    {
+        static conversion_status_ convert(clasp_slice_t const& value, clasp_string_t* result)
+        {
+            result->assign(value.ptr, value.len);
+
+            return conversion_succeeded_;
+        }
+
+        static char const* invalid_format_message()
+        {
+            return "invalid value for option";
+        }
+    };
+
+} /* namespace ximpl */
+#endif /* !CLASP_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** Binds flags and options to variables, declaratively, and extracts them
+ * all in a single pass over the parsed arguments
+ *
+ * Each flag/option is declared - by (resolved) name, along with the
+ * address of the variable to receive it, and its default value or whether
+ * it is required - with flag(), option(), or required_option(); then
+ * bind() walks <code>args->flagsAndOptions</code> once, resolving each
+ * argument to its binding via the argument's <code>aliasIndex</code> (each
+ * specification being looked up only on its first occurrence), converting
+ * and assigning values, and marking bound arguments as used. All
+ * conversion failures and missing required options are collected, and
+ * reported together by a single binding_exception.
+ *
+ * As with check_option(), the first occurrence of a given flag/option
+ * is bound, and subsequent ones are left unused.
+ *
+ * \code
+  int         verbosity;
+  std::string output;
+  bool        force;
+
+  clasp::binder()
+    .option("--verbosity", &verbosity, 1)
+    .required_option("--output", &output)
+    .flag("--force", &force)
+    .bind(args);
+ * \endcode
+ *
+ * \note The binder holds the addresses of the declared variables, so they
+ *   must outlive the call to bind()
+ */
+class binder
+{
+public: // types
+    /// This type
+    typedef binder                                          class_type;
+    /// The character type
+    typedef clasp_char_t                                    char_type;
+    /// The string type
+    typedef clasp_string_t                                  string_type;
+    /// The exception type
+    typedef binding_exception                               exception_type;
+private:
+    enum binding_kind_
+    {
+        bindingKind_boolFlag_
+    ,   bindingKind_bitmaskFlag_
+    ,   bindingKind_option_
+    };
+
+    typedef ximpl::conversion_status_ (*pfn_convert_t_)(
+        clasp_argument_t const& arg
+    ,   void*                   result
+    ,   void*                   param
+    ,   void                  (*pfnCustom)()
+    );
+
+    struct binding_
+    {
+        string_type     name;
+        binding_kind_   kind;
+        bool            isRequired;
+        bool            isFound;
+        void*           result;
+        int             flagValue;
+        pfn_convert_t_  pfnConvert;
+        char const*     invalidFormatMessage;
+        void*           param;
+        void          (*pfnCustom)();
+    };
+    typedef std::vector<binding_>                           bindings_type_;
+
+public: // construction
+    binder()
+    {}
+private:
+    binder(class_type const&);
+    class_type& operator =(class_type const&);
+
+public: // declaration
+    /** Binds a flag to a boolean variable, which is set to
+     * <code>false</code> now, and to <code>true</code> if the flag is
+     * found (or an option of the same name with a true boolean value)
+     */
+    template <typename S>
+    class_type&
+    flag(
+        S const&    name
+    ,   bool*       result
+    )
+    {
+        STLSOFT_ASSERT(NULL != result);
+
+        *result = false;
+
+        return add_flag_(make_name_(name), bindingKind_boolFlag_, result, 0);
+    }
+
+    /** Binds a flag to a bit in a bitmask, which is set if the flag is
+     * found (or cleared if given as an option with a false boolean value)
+     */
+    template <typename S>
+    class_type&
+    flag(
+        S const&    name
+    ,   int*        bitmask
+    ,   int         flagValue
+    )
+    {
+        STLSOFT_ASSERT(NULL != bitmask);
+
+        return add_flag_(make_name_(name), bindingKind_bitmaskFlag_, bitmask, flagValue);
+    }
+
+    /** Binds an option to a variable, which is set to the given default
+     * value now, and to the option's converted value if it is found
+     *
+     * \param name The resolved name of the option
+     * \param result Pointer to the variable. May not be NULL
+     * \param defaultValue The value used if the option is not found
+     *
+     * \note <code>T</code> may be any integral type, <code>float</code>,
+     *   <code>double</code>, <code>bool</code>,
+     *   <code>clasp_char_t const*</code>, or <code>clasp_string_t</code>
+     */
+    template <typename S, typename T>
+    class_type&
+    option(
+        S const&                                                name
+    ,   T*                                                      result
+    ,   ss_typename_type_k ximpl::binder_identity_<T>::type const& defaultValue
+    )
+    {
+        STLSOFT_ASSERT(NULL != result);
+
+        *result = defaultValue;
+
+        return add_option_(make_name_(name), false, result, &convert_value_<T>, ximpl::binder_value_converter_<T>::invalid_format_message(), NULL, NULL);
+    }
+
+    /** Binds an option to a variable via a custom conversion function,
+     * setting it to the given default value now
+     *
+     * \param name The resolved name of the option
+     * \param result Pointer to the variable. May not be NULL
+     * \param pfn The conversion function, which returns <code>false</code>
+     *   if the value cannot be converted
+     * \param param Parameter passed to <code>pfn</code>
+     * \param defaultValue The value used if the option is not found
+     */
+    template <typename S, typename R>
+    class_type&
+    option(
+        S const&                                                name
+    ,   R*                                                      result
+    ,   bool                                                  (*pfn)(void* param, clasp_char_t const* parsedValue, R* result)
+    ,   void*                                                   param
+    ,   ss_typename_type_k ximpl::binder_identity_<R>::type const& defaultValue
+    )
+    {
+        STLSOFT_ASSERT(NULL != result);
+        STLSOFT_ASSERT(NULL != pfn);
+
+        *result = defaultValue;
+
+        return add_option_(make_name_(name), false, result, &convert_custom_<R>, "invalid value for option", param, reinterpret_cast<void (*)()>(pfn));
+    }
+
+    /** Binds a required option to a variable
+     *
+     * \param name The resolved name of the option
+     * \param result Pointer to the variable. May not be NULL
+     *
+     * If the option is not found, or has an empty value, a failure is
+     * reported by bind()
+     */
+    template <typename S, typename T>
+    class_type&
+    required_option(
+        S const&    name
+    ,   T*          result
+    )
+    {
+        STLSOFT_ASSERT(NULL != result);
+
+        return add_option_(make_name_(name), true, result, &convert_value_<T>, ximpl::binder_value_converter_<T>::invalid_format_message(), NULL, NULL);
+    }
+
+    /** Binds a required option to a variable via a custom conversion
+     * function
+     */
+    template <typename S, typename R>
+    class_type&
+    required_option(
+        S const&    name
+    ,   R*          result
+    ,   bool      (*pfn)(void* param, clasp_char_t const* parsedValue, R* result)
+    ,   void*       param
+    )
+    {
+        STLSOFT_ASSERT(NULL != result);
+        STLSOFT_ASSERT(NULL != pfn);
+
+        return add_option_(make_name_(name), true, result, &convert_custom_<R>, "invalid value for option", param, reinterpret_cast<void (*)()>(pfn));
+    }
+
+public: // operations
+    /** Extracts all bound flags and options from the arguments, in a
+     * single pass
+     *
+     * \param args Non-mutating pointer to the arguments structure, obtained
+     *   from call to parseArguments() / clasp_parseArguments(). May not be NULL
+     *
+     * \exception binding_exception Thrown if one or more options cannot be
+     *   converted, or one or more required options are not found, carrying
+     *   all such failures
+     */
+    void
+    bind(
+        clasp_arguments_t const* args
+    )
+    {
+        STLSOFT_ASSERT(NULL != args);
+
+        enum { unresolved = -2 };
+
+        std::vector<size_t>         byName(m_bindings.size());
+        std::vector<int>            bySpecIndex;
+        binding_exception::errors_type  errors;
+
+        { for (size_t i = 0; i != m_bindings.size(); ++i)
+        {
+            m_bindings[i].isFound = false;
+
+            byName[i] = i;
+        }}
+
+        std::sort(byName.begin(), byName.end(), name_less_(m_bindings));
+
+        { for (size_t i = 0; i != args->numFlagsAndOptions; ++i)
+        {
+            clasp_argument_t const& arg = args->flagsAndOptions[i];
+            int                     bi;
+
+            if (arg.aliasIndex >= 0)
+            {
+                size_t const ix = static_cast<size_t>(arg.aliasIndex);
+
+                if (ix >= bySpecIndex.size())
+                {
+                    bySpecIndex.resize(ix + 1, unresolved);
+                }
+
+                if (unresolved == bySpecIndex[ix])
+                {
+                    bySpecIndex[ix] = find_(byName, arg.resolvedName);
+                }
+
+                bi = bySpecIndex[ix];
+            }
+            else
+            {
+                bi = find_(byName, arg.resolvedName);
+            }
+
+            if (bi < 0)
+            {
+                continue;
+            }
+
+            binding_& b = m_bindings[static_cast<size_t>(bi)];
+
+            if (b.isFound)
+            {
+                continue;
+            }
+
+            if (bindingKind_option_ == b.kind)
+            {
+                if (CLASP_ARGTYPE_OPTION != arg.type)
+                {
+                    continue;
+                }
+
+                b.isFound = true;
+
+                clasp_useArgument(args, &arg);
+
+                if (0 == arg.value.len &&
+                    b.isRequired)
+                {
+                    add_error_(errors, "value is missing for option", b.name);
+
+                    continue;
+                }
+
+                switch (b.pfnConvert(arg, b.result, b.param, b.pfnCustom))
+                {
+                case ximpl::conversion_succeeded_:
+
+                    break;
+                case ximpl::conversion_negativeValue_:
+
+                    add_error_(errors, "value may not be negative for option", b.name);
+                    break;
+                case ximpl::conversion_outOfRange_:
+
+                    add_error_(errors, "value is out of range for option", b.name);
+                    break;
+                default:
+
+                    add_error_(errors, b.invalidFormatMessage, b.name);
+                    break;
+                }
+            }
+            else
+            {
+                bool isOn = true;
+
+                if (CLASP_ARGTYPE_OPTION == arg.type)
+                {
+                    bool wasStrictlyCorrect;
+
+                    isOn = ximpl::boolean_conversion_traits_::convert(arg.value, &wasStrictlyCorrect);
+
+                    if (!isOn &&
+                        !wasStrictlyCorrect)
+                    {
+                        b.isFound = true;
+
+                        clasp_useArgument(args, &arg);
+
+                        add_error_(errors, "option value must be a boolean", b.name);
+
+                        continue;
+                    }
+                }
+
+                b.isFound = true;
+
+                clasp_useArgument(args, &arg);
+
+                if (bindingKind_boolFlag_ == b.kind)
+                {
+                    *static_cast<bool*>(b.result) = isOn;
+                }
+                else
+                if (isOn)
+                {
+                    *static_cast<int*>(b.result) |= b.flagValue;
+                }
+                else
+                {
+                    *static_cast<int*>(b.result) &= ~b.flagValue;
+                }
+            }
+        }}
+
+        { for (size_t i = 0; i != m_bindings.size(); ++i)
+        {
+            binding_ const& b = m_bindings[i];
+
+            if (b.isRequired &&
+                !b.isFound)
+            {
+                add_error_(errors, "required option is not found", b.name);
+            }
+        }}
+
+        if (!errors.empty())
+        {
+            throw binding_exception(errors);
+        }
+    }
+
+private: // implementation
+    template <typename S>
+    static
+    string_type
+    make_name_(
+        S const& name
+    )
+    {
+        CLASP_DECLARE_c_str_datalen_PAIR_();
+
+        return string_type(CLASP_INVOKE_c_str_data_(name), CLASP_INVOKE_c_str_len_(name));
+    }
+
+    template <typename T>
+    static
+    ximpl::conversion_status_
+    convert_value_(
+        clasp_argument_t const& arg
+    ,   void*                   result
+    ,   void*                   /* param */
+    ,   void                  (*/* pfnCustom */)()
+    )
+    {
+        return ximpl::binder_value_converter_<T>::convert(arg.value, static_cast<T*>(result));
+    }
+
+    template <typename R>
+    static
+    ximpl::conversion_status_
+    convert_custom_(
+        clasp_argument_t const& arg
+    ,   void*                   result
+    ,   void*                   param
+    ,   void                  (*pfnCustom)()
+    )
+    {
+        typedef bool (*pfn_t)(void* param, clasp_char_t const* parsedValue, R* result);
+
+        pfn_t const pfn = reinterpret_cast<pfn_t>(pfnCustom);
+
+        return (*pfn)(param, arg.value.ptr, static_cast<R*>(result)) ? ximpl::conversion_succeeded_ : ximpl::conversion_invalidFormat_;
+    }
+
+    class_type&
+    add_flag_(
+        string_type const&  name
+    ,   binding_kind_       kind
+    ,   void*               result
+    ,   int                 flagValue
+    )
+    {
+        binding_ b;
+
+        b.name                  =   name;
+        b.kind                  =   kind;
+        b.isRequired            =   false;
+        b.isFound               =   false;
+        b.result                =   result;
+        b.flagValue             =   flagValue;
+        b.pfnConvert            =   NULL;
+        b.invalidFormatMessage  =   NULL;
+        b.param                 =   NULL;
+        b.pfnCustom             =   NULL;
+
+        m_bindings.push_back(b);
+
+        return *this;
+    }
+
+    class_type&
+    add_option_(
+        string_type const&  name
+    ,   bool                isRequired
+    ,   void*               result
+    ,   pfn_convert_t_      pfnConvert
+    ,   char const*         invalidFormatMessage
+    ,   void*               param
+    ,   void              (*pfnCustom)()
+    )
+    {
+        binding_ b;
+
+        b.name                  =   name;
+        b.kind                  =   bindingKind_option_;
+        b.isRequired            =   isRequired;
+        b.isFound               =   false;
+        b.result                =   result;
+        b.flagValue             =   0;
+        b.pfnConvert            =   pfnConvert;
+        b.invalidFormatMessage  =   invalidFormatMessage;
+        b.param                 =   param;
+        b.pfnCustom             =   pfnCustom;
+
+        m_bindings.push_back(b);
+
+        return *this;
+    }
+
+    static
+    int
+    compare_(
+        string_type const&      name
+    ,   clasp_slice_t const&    slice
+    )
+    {
+        return name.compare(0, string_type::npos, slice.ptr, slice.len);
+    }
+
+    struct name_less_
+    {
+    public:
+        explicit name_less_(bindings_type_ const& bindings)
+            : m_bindings(bindings)
+        {}
+
+    public:
+        bool operator ()(size_t lhs, size_t rhs) const
+        {
+            return m_bindings[lhs].name < m_bindings[rhs].name;
+        }
+
+    private:
+        bindings_type_ const& m_bindings;
+    };
+
+    int
+    find_(
+        std::vector<size_t> const&  byName
+    ,   clasp_slice_t const&        name
+    ) const
+    {
+        size_t lo = 0;
+        size_t hi = byName.size();
+
+        for (; lo != hi; )
+        {
+            size_t const    mid =   lo + (hi - lo) / 2;
+            int const       r   =   compare_(m_bindings[byName[mid]].name, name);
+
+            if (r < 0)
+            {
+                lo = mid + 1;
+            }
+            else
+            if (r > 0)
+            {
+                hi = mid;
+            }
+            else
+            {
+                // Where a name is bound more than once, the earliest
+                // declaration wins
+
+                size_t first = byName[mid];
+
+                { for (size_t i = mid; 0 != i && 0 == compare_(m_bindings[byName[i - 1]].name, name); --i)
+                {
+                    first = std::min(first, byName[i - 1]);
+                }}
+                { for (size_t i = mid + 1; i != byName.size() && 0 == compare_(m_bindings[byName[i]].name, name); ++i)
+                {
+                    first = std::min(first, byName[i]);
+                }}
+
+                return static_cast<int>(first);
+            }
+        }
+
+        return -1;
+    }
+
+    static
+    void
+    add_error_(
+        binding_exception::errors_type& errors
+    ,   char const*                     message
+    ,   string_type const&              optionName
+    )
+    {
+        binding_exception::error_type error;
+
+        error.message       =   message;
+        error.optionName    =   optionName;
+
+        errors.push_back(error);
+    }
+
+private: // fields
+    bindings_type_  m_bindings;
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+} /* namespace clasp */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !CLASP_INCL_CLASP_HPP_BINDER */
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
@@ -4,7 +4,7 @@
  * Purpose: The CLASP library API.
  *
  * Created: 4th June 2008
- * Updated: 11th March 2025
+ * Updated: 19th October 2026
  *
  * Home:    https://github.com/synesissoftware/CLASP/
  *
@@ -55,7 +55,7 @@
 # define CLASP_VER_CLASP_H_CLASP_MAJOR      3
 # define CLASP_VER_CLASP_H_CLASP_MINOR      3
 # define CLASP_VER_CLASP_H_CLASP_REVISION   3
-# define CLASP_VER_CLASP_H_CLASP_EDIT       109
+# define CLASP_VER_CLASP_H_CLASP_EDIT       131
 #endif /* !CLASP_DOCUMENTATION_SKIP_SECTION */
 
 /**
@@ -76,9 +76,9 @@
 #define CLASP_VER_MINOR     15
 #define CLASP_VER_PATCH     0
 #define CLASP_VER_REVISION  CLASP_VER_PATCH
-#define CLASP_VER_AB        0x46
+#define CLASP_VER_AB        0x47
 
-#define CLASP_VER           0x000f0046
+#define CLASP_VER           0x000f0047
 
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -218,6 +218,42 @@
     rt \
     CLASP_CALLCONV
 
+/** \def CLASP_HEADER_ONLY
+ *
+ * If defined before inclusion of this file, the argument query functions
+ * clasp_useArgument(), clasp_argumentIsUsed(), and clasp_checkValue() are
+ * defined in this file as <code>static inline</code> functions, rather
+ * than declared as library functions, so that they may be inlined into
+ * their callers (including the templates of the C++ API). It is defined
+ * for all users of the amalgamated library target, which is built from
+ * the generated single source file <b>clasp_all.c</b>.
+ *
+ * \note The inline definitions do not log to the diagnostic context.
+ *
+ * \ingroup group__utility
+ */
+
+#ifndef CLASP_DOCUMENTATION_SKIP_SECTION
+# if 0
+# elif defined(__cplusplus) || \
+       (   defined(__STDC_VERSION__) && \
+           __STDC_VERSION__ >= 199901L)
+
+#  define CLASP_INLINE_                                     inline
+# elif defined(__GNUC__)
+
+#  define CLASP_INLINE_                                     __inline__
+# elif defined(_MSC_VER)
+
+#  define CLASP_INLINE_                                     __inline
+# else
+
+#  define CLASP_INLINE_
+# endif
+
+# define CLASP_INLINE_CALL_(rt)                             static CLASP_INLINE_ rt
+#endif /* !CLASP_DOCUMENTATION_SKIP_SECTION */
+
 
 /* /////////////////////////////////////////////////////////////////////////
  * platform recognition
@@ -617,11 +653,16 @@ struct clasp_argument_t
     int                         numGivenHyphens;    /*!< The number of hyphens present in the original argument */
     int                         aliasIndex;         /*!< The index of the matching specification, if any; otherwise -1 */
     int                         flags;              /*!< Internal use only */
+    int                         source;             /*!< The source of the argument: 0 for the command-line that was parsed, otherwise the source given to clasp_appendArguments() */
 };
 #ifndef __cplusplus
 typedef struct clasp_argument_t                             clasp_argument_t;
 #endif /* !__cplusplus */
 
+#ifndef CLASP_DOCUMENTATION_SKIP_SECTION
+# define CLASP_ARG_F_USED_                                  (0x0002)
+#endif /* !CLASP_DOCUMENTATION_SKIP_SECTION */
+
 /** Structure returned to the caller of clasp_parseArguments(), providing
  *   access to all the arguments - flags, options and values - after
  *   pre-processing and sorting.
@@ -646,6 +687,53 @@ struct clasp_arguments_t
 typedef struct clasp_arguments_t                            clasp_arguments_t;
 #endif /* !__cplusplus */
 
+/** The kinds of argument error that are collected, without recourse to
+ * exceptions, into a clasp_argument_errors_t buffer.
+ *
+ * \see clasp_argument_error_t
+ * \see clasp_verifyArguments
+ */
+enum clasp_argerr_t
+{
+        CLASP_ARGERR_MISSING_OPTION         =   1   /*!< A required option is not specified */
+    ,   CLASP_ARGERR_MISSING_OPTION_VALUE   =   2   /*!< An option is specified without a value */
+    ,   CLASP_ARGERR_INVALID_OPTION_VALUE   =   3   /*!< An option's value is of the wrong form, or out of range */
+    ,   CLASP_ARGERR_UNUSED_ARGUMENT        =   4   /*!< A flag or option has not been used */
+    ,   CLASP_ARGERR_UNRECOGNISED_ARGUMENT  =   5   /*!< A flag or option is not recognised */
+    ,   CLASP_ARGERR_REPEATED_ARGUMENT      =   6   /*!< A flag or option whose schema specifies \c CLASP_SCHEMA_F_SINGLE is specified more than once */
+};
+#ifndef __cplusplus
+typedef enum clasp_argerr_t clasp_argerr_t;
+#endif /* !__cplusplus */
+
+/** A collected argument error.
+ */
+struct clasp_argument_error_t
+{
+    clasp_argerr_t              kind;               /*!< The kind of error */
+    int                         cmdLineIndex;       /*!< The command-line index of the erroneous argument, or -1 if it is not specified */
+    clasp_slice_t               name;               /*!< The given name of the erroneous argument, or the name of the missing option */
+};
+#ifndef __cplusplus
+typedef struct clasp_argument_error_t                       clasp_argument_error_t;
+#endif /* !__cplusplus */
+
+/** A caller-supplied buffer into which argument errors are collected.
+ *
+ * Errors are recorded until \c capacity is reached, but all are counted,
+ * so that <code>numErrors > capacity</code> indicates that some were
+ * discarded. Recording an error involves no memory allocation.
+ */
+struct clasp_argument_errors_t
+{
+    clasp_argument_error_t*     errors;             /*!< Pointer to an array of \c capacity errors */
+    size_t                      capacity;           /*!< The number of elements in \c errors */
+    size_t                      numErrors;          /*!< The number of errors found, which may exceed \c capacity */
+};
+#ifndef __cplusplus
+typedef struct clasp_argument_errors_t                      clasp_argument_errors_t;
+#endif /* !__cplusplus */
+
 /** Structure that defines a specification for a short option or flag; also
  *   used to define help information for all flags and options
  *
@@ -670,6 +758,19 @@ typedef struct clasp_specification_t                        clasp_alias_t;
 typedef clasp_specification_t                               clasp_alias_t;
 #endif /* !__cplusplus */
 
+/** A "did you mean" suggestion for an unrecognised name, obtained via
+ *   clasp_findSuggestions().
+ */
+struct clasp_suggestion_t
+{
+    clasp_specification_t const*    specification;  /*!< The suggested specification */
+    clasp_slice_t                   name;           /*!< The suggested name - the alias, or the long name (without any value) - of the specification */
+    size_t                          distance;       /*!< The edit distance from the unrecognised name to \c name */
+};
+#ifndef __cplusplus
+typedef struct clasp_suggestion_t                           clasp_suggestion_t;
+#endif /* !__cplusplus */
+
 /** \def CLASP_FLAG(alias, mappedArgument, help)
  *
  * Defines a flag specification in the specification array.
@@ -768,6 +869,382 @@ typedef clasp_specification_t                               clasp_alias_t;
  */
 # define CLASP_ALIAS_ARRAY_TERMINATOR                       CLASP_SPECIFICATION_ARRAY_TERMINATOR
 
+/** The kinds of value that may be declared in a value schema, into which
+ *   the value of an option is decoded by clasp_parseArgumentsWithSchema()
+ *
+ * \see clasp_value_schema_t
+ * \see clasp_typed_value_t
+ */
+enum clasp_valuekind_t
+{
+        CLASP_VALUEKIND_NONE                =   0   /*!< The value is not decoded */
+    ,   CLASP_VALUEKIND_INT                 =   1   /*!< A signed integer - decimal or, with a leading <code>"0x"</code>, hexadecimal - decoded into \c value.integer */
+    ,   CLASP_VALUEKIND_UINT                =   2   /*!< An unsigned integer - decimal or, with a leading <code>"0x"</code>, hexadecimal - decoded into \c value.uinteger */
+    ,   CLASP_VALUEKIND_DOUBLE              =   3   /*!< A real number, decoded into \c value.real */
+    ,   CLASP_VALUEKIND_BOOL                =   4   /*!< One of <code>"true"</code>/<code>"false"</code>, <code>"yes"</code>/<code>"no"</code>, <code>"on"</code>/<code>"off"</code>, or <code>"1"</code>/<code>"0"</code> (without regard to case), decoded into \c value.boolean */
+    ,   CLASP_VALUEKIND_SIZE                =   5   /*!< A decimal number of bytes, with an optional binary multiplier suffix - <code>"k"</code>, <code>"M"</code>, <code>"G"</code> or <code>"T"</code>, optionally followed by <code>"iB"</code> or <code>"B"</code> - e.g. <code>"64k"</code> or <code>"2GiB"</code>, decoded into \c value.uinteger */
+    ,   CLASP_VALUEKIND_DURATION            =   6   /*!< A decimal number, with an optional unit suffix - <code>"ms"</code>, <code>"s"</code> (the default), <code>"m"</code>, <code>"h"</code> or <code>"d"</code> - e.g. <code>"1.5s"</code> or <code>"250ms"</code>, decoded, in seconds, into \c value.real */
+    ,   CLASP_VALUEKIND_ENUM                =   7   /*!< One of the members of the \c valueSet of the specification, whose index is decoded into \c value.index */
+};
+#ifndef __cplusplus
+typedef enum clasp_valuekind_t clasp_valuekind_t;
+#endif /* !__cplusplus */
+
+/** Schema flag, which indicates that the \c minimum and \c maximum of a
+ * value schema are to be applied to the (decoded) value
+ */
+#define CLASP_SCHEMA_F_BOUNDED                              (0x00000001)
+/** Schema flag, which indicates that the flag/option may be specified at
+ * most once
+ */
+#define CLASP_SCHEMA_F_SINGLE                               (0x00000002)
+
+/** Structure that declares the kind, bounds and repeatability of the value
+ *   of a flag/option, in an array parallel to - i.e. indexed by the
+ *   position of the entries in - an array of specifications
+ *
+ * \see clasp_parseArgumentsWithSchema
+ */
+struct clasp_value_schema_t
+{
+    clasp_valuekind_t   kind;           /*!< The kind of the value. Must be CLASP_VALUEKIND_NONE for a flag */
+    unsigned            schemaFlags;    /*!< A combination of the \c CLASP_SCHEMA_F_* flags */
+    double              minimum;        /*!< The minimum (decoded) value, if \c CLASP_SCHEMA_F_BOUNDED is specified */
+    double              maximum;        /*!< The maximum (decoded) value, if \c CLASP_SCHEMA_F_BOUNDED is specified */
+};
+#ifndef __cplusplus
+typedef struct clasp_value_schema_t                         clasp_value_schema_t;
+#endif /* !__cplusplus */
+
+/** \def CLASP_VALUE_SCHEMA(kind, schemaFlags)
+ *
+ * Defines an unbounded entry in a value schema array
+ *
+ * \param kind The kind of the value, e.g. CLASP_VALUEKIND_INT
+ * \param schemaFlags A combination of the \c CLASP_SCHEMA_F_* flags
+ */
+# define CLASP_VALUE_SCHEMA(kind, schemaFlags)              { kind, schemaFlags, 0.0, 0.0 }
+
+/** \def CLASP_VALUE_SCHEMA_RANGE(kind, schemaFlags, minimum, maximum)
+ *
+ * Defines a bounded entry in a value schema array
+ *
+ * \param kind The kind of the value, e.g. CLASP_VALUEKIND_INT
+ * \param schemaFlags A combination of the \c CLASP_SCHEMA_F_* flags, to
+ *   which is added \c CLASP_SCHEMA_F_BOUNDED
+ * \param minimum The minimum (decoded) value
+ * \param maximum The maximum (decoded) value
+ */
+# define CLASP_VALUE_SCHEMA_RANGE(kind, schemaFlags, minimum, maximum)  { kind, (schemaFlags) | CLASP_SCHEMA_F_BOUNDED, minimum, maximum }
+
+/** \def CLASP_VALUE_SCHEMA_NONE
+ *
+ * Defines an entry in a value schema array for a specification whose
+ * value is not decoded, or which is not a flag/option
+ */
+# define CLASP_VALUE_SCHEMA_NONE                            CLASP_VALUE_SCHEMA(CLASP_VALUEKIND_NONE, 0)
+
+/** The decoded value of a flag/option, obtained via clasp_getTypedValue()
+ */
+struct clasp_typed_value_t
+{
+    clasp_valuekind_t   kind;               /*!< The kind of the value */
+    int                 error;              /*!< 0 if the value is valid; otherwise the clasp_argerr_t that describes why not */
+    int                 specIndex;          /*!< The index of the specification - and of its schema - against which the value was decoded */
+    union
+    {
+        long            integer;            /*!< The value of a CLASP_VALUEKIND_INT */
+        unsigned long   uinteger;           /*!< The value of a CLASP_VALUEKIND_UINT or CLASP_VALUEKIND_SIZE */
+        double          real;               /*!< The value of a CLASP_VALUEKIND_DOUBLE or CLASP_VALUEKIND_DURATION */
+        int             boolean;            /*!< The value of a CLASP_VALUEKIND_BOOL: 0 or 1 */
+        int             index;              /*!< The value of a CLASP_VALUEKIND_ENUM: the index of the member, or -1 for any other value where the value set permits it */
+    }                   value;              /*!< The value, if valid */
+};
+#ifndef __cplusplus
+typedef struct clasp_typed_value_t                          clasp_typed_value_t;
+#endif /* !__cplusplus */
+
+/** \def CLASP_SHORT_FLAG_TABLE_SIZE
+ *
+ * The number of entries in the direct table of single-character keys
+ * held by clasp_specification_index_t
+ */
+#define CLASP_SHORT_FLAG_TABLE_SIZE                         (256)
+
+/** Structure that maps a single-character key whose character lies beyond
+ *   the direct table of clasp_specification_index_t to its specification
+ */
+struct clasp_short_flag_t
+{
+    clasp_char_t    character;  /*!< The character, as in <code>"-c"</code> */
+    int             specIndex;  /*!< The index of the specification */
+};
+#ifndef __cplusplus
+typedef struct clasp_short_flag_t                           clasp_short_flag_t;
+#endif /* !__cplusplus */
+
+/** Structure that describes a node of the compressed (radix) prefix trie,
+ *   held by clasp_specification_index_t, of the distinct long names - the
+ *   mapped arguments of the flag and option specifications, less the
+ *   leading <code>"--"</code>, up to any <code>'='</code> - by which
+ *   CLASP_F_ALLOW_UNIQUE_PREFIXES resolves abbreviated names
+ *
+ * The label of each node comprises the \c labelLength characters at
+ * \c labelOffset within the long name of the specification
+ * \c labelSpecIndex. Node 0 is the root, whose label is empty. A trie of
+ * the long names of \c n specifications has at most <code>2 * n</code>
+ * nodes.
+ */
+struct clasp_prefix_trie_node_t
+{
+    int             labelSpecIndex; /*!< The index of the specification whose long name holds the label, or -1 for the root */
+    int             labelOffset;    /*!< The offset of the label within the long name */
+    int             labelLength;    /*!< The number of characters in the label */
+    int             parent;         /*!< The index of the parent node, or -1 for the root */
+    int             firstChild;     /*!< The index of the first child node, or -1 */
+    int             nextSibling;    /*!< The index of the next sibling node, or -1 */
+    int             specIndex;      /*!< The index of the specification whose long name ends at this node, or -1 */
+    int             numNames;       /*!< The number of long names that end in the subtree rooted at this node */
+    int             anySpecIndex;   /*!< The index of the specification of a long name that ends in the subtree, or -1 */
+};
+#ifndef __cplusplus
+typedef struct clasp_prefix_trie_node_t                     clasp_prefix_trie_node_t;
+#endif /* !__cplusplus */
+
+/** Structure that holds a perfect-hash index over the names and mapped
+ *   arguments of a specifications array, for use with
+ *   clasp_parseArgumentsWithIndex()
+ *
+ * Each key - a non-empty name, and a mapped argument up to any
+ * <code>'='</code> - is assigned to the bucket
+ * <code>clasp_hashSpecificationKey(key, len, 0) & (numBuckets - 1)</code>,
+ * and occupies the slot
+ * <code>clasp_hashSpecificationKey(key, len, seeds[bucket]) & (numSlots - 1)</code>;
+ * where two specifications have the same key, the slot holds the one that
+ * would be found by clasp_parseArguments(). The single-character keys -
+ * <code>"-c"</code> - are additionally held in a direct table, indexed by
+ * character, so that each character of a flag cluster, such as
+ * <code>"-abc"</code>, is looked up by a single load, and the long names
+ * are held in a prefix trie (see clasp_prefix_trie_node_t), so that
+ * CLASP_F_ALLOW_UNIQUE_PREFIXES requires no set-up per parse. Instances
+ * are not normally written by hand, but are baked at compile-time by
+ * <code>clasp::static_specifications</code> (see
+ * <b>clasp/static_specifications.hpp</b>), generated at build-time by the
+ * <b>clasp.specc</b> tool, or created at runtime by
+ * clasp_createSpecificationIndex().
+ */
+struct clasp_specification_index_t
+{
+    clasp_specification_t const*    specifications;     /*!< The (terminated) specifications array */
+    size_t                          numBuckets;         /*!< The number of buckets. Must be a power of 2 */
+    unsigned long const*            seeds;              /*!< The per-bucket seeds; 0 denotes an empty bucket */
+    size_t                          numSlots;           /*!< The number of slots. Must be a power of 2 */
+    int const*                      slots;              /*!< The per-slot specification index, or -1 for an empty slot */
+    int const*                      shortFlags;         /*!< The CLASP_SHORT_FLAG_TABLE_SIZE entries, indexed by character, of the specification index of each single-character key, or -1. May be NULL, in which case such keys are looked up via the slots */
+    size_t                          numWideShortFlags;  /*!< The number of elements in wideShortFlags */
+    clasp_short_flag_t const*       wideShortFlags;     /*!< The single-character keys whose characters lie beyond the direct table, sorted by character. May be NULL if numWideShortFlags is 0 */
+    size_t                          numTrieNodes;       /*!< The number of elements in trieNodes */
+    clasp_prefix_trie_node_t const* trieNodes;          /*!< The prefix trie of the long names. May be NULL, in which case the trie is built by each parse that requires it */
+};
+#ifndef __cplusplus
+typedef struct clasp_specification_index_t                  clasp_specification_index_t;
+#endif /* !__cplusplus */
+
+/** Structure that holds a specifications array together with its index,
+ *   and its usage body pre-rendered for a given layout, as generated at
+ *   build-time by the <b>clasp.specc</b> tool (see the CMake function
+ *   <code>clasp_compile_specifications()</code>)
+ *
+ * \see clasp_parseArgumentsCompiled
+ * \see clasp_showBodyCompiled
+ * \see CLASP_DECLARE_COMPILED_SPECIFICATIONS
+ */
+struct clasp_compiled_specifications_t
+{
+    clasp_specification_index_t index;              /*!< The index, which also refers to the specifications array */
+    clasp_char_t const*         usageBody;          /*!< The pre-rendered usage body. May be NULL */
+    size_t                      cchUsageBody;       /*!< The number of characters in usageBody */
+    int                         usageFlags;         /*!< The flags with which usageBody was rendered */
+    int                         consoleWidth;       /*!< The console width with which usageBody was rendered */
+    int                         tabSize;            /*!< The tab size with which usageBody was rendered */
+    int                         blanksBetweenItems; /*!< The number of blank lines between items with which usageBody was rendered */
+};
+#ifndef __cplusplus
+typedef struct clasp_compiled_specifications_t              clasp_compiled_specifications_t;
+#endif /* !__cplusplus */
+
+/** \def CLASP_DECLARE_COMPILED_SPECIFICATIONS(name)
+ *
+ * Declares an instance of clasp_compiled_specifications_t generated by
+ * the <b>clasp.specc</b> tool, with the appropriate linkage for C and C++
+ *
+ * \param name The name given to the tool, e.g. <code>mytool_specifications</code>
+ */
+#ifdef __cplusplus
+# define CLASP_DECLARE_COMPILED_SPECIFICATIONS(name)        extern "C" clasp_compiled_specifications_t const name
+#else /* ? __cplusplus */
+# define CLASP_DECLARE_COMPILED_SPECIFICATIONS(name)        extern clasp_compiled_specifications_t const name
+#endif /* __cplusplus */
+
+/** Job function prototype, as invoked by clasp_batch_pool_t */
+typedef void (CLASP_CALLCONV *clasp_batch_job_fn_t)(
+    void*       param
+,   size_t      job
+);
+
+/** Structure that describes a worker pool, over which
+ *   clasp_parseArgumentsBatch() spreads its work
+ *
+ * \see clasp_parseArgumentsBatch
+ */
+struct clasp_batch_pool_t
+{
+    void*   context;    /*!< The pool's context, passed to pfnForEach */
+    /** Invokes <code>pfnJob(param, job)</code> for each \c job in
+     * <code>[0, numJobs)</code>, in any order and possibly concurrently,
+     * and returns only when all invocations have completed
+     */
+    void    (CLASP_CALLCONV *pfnForEach)(
+        void*                   context
+    ,   size_t                  numJobs
+    ,   clasp_batch_job_fn_t    pfnJob
+    ,   void*                   param
+    );
+};
+#ifndef __cplusplus
+typedef struct clasp_batch_pool_t                           clasp_batch_pool_t;
+#endif /* !__cplusplus */
+
+/** Structure that receives the result of parsing one command-line in a
+ *   call to clasp_parseArgumentsBatch()
+ *
+ * \see clasp_parseArgumentsBatch
+ */
+struct clasp_batch_result_t
+{
+    int                         result; /*!< The error code of the parse: 0 on success */
+    clasp_arguments_t const*    args;   /*!< The parsed results, or NULL if result is non-0 */
+};
+#ifndef __cplusplus
+typedef struct clasp_batch_result_t                         clasp_batch_result_t;
+#endif /* !__cplusplus */
+
+/** Structure that describes one subcommand - the verb, such as
+ *   <code>"build"</code> in <code>tool build ...</code> - of a
+ *   subcommand table
+ *
+ * \see clasp_createSubcommandTable
+ * \see CLASP_SUBCOMMAND
+ * \see CLASP_SUBCOMMAND_INDEXED
+ */
+struct clasp_subcommand_t
+{
+    clasp_char_t const*                 name;           /*!< The verb. May not be NULL or empty */
+    clasp_specification_t const*        specifications; /*!< The (terminated) specifications of the subcommand, which are validated and indexed when the subcommand is first selected. Ignored if index is not NULL. May be NULL */
+    clasp_specification_index_t const*  index;          /*!< An index - e.g. of compiled specifications - of the specifications of the subcommand. May be NULL */
+    clasp_char_t const*                 help;           /*!< The help string. May be NULL */
+};
+#ifndef __cplusplus
+typedef struct clasp_subcommand_t                           clasp_subcommand_t;
+#endif /* !__cplusplus */
+
+/** \def CLASP_SUBCOMMAND(name, specifications, help)
+ *
+ * Defines a subcommand whose specifications are indexed on first use
+ */
+#define CLASP_SUBCOMMAND(name, specifications, help)        { name, specifications, NULL, help }
+
+/** \def CLASP_SUBCOMMAND_INDEXED(name, index, help)
+ *
+ * Defines a subcommand whose specifications are given by an index, e.g.
+ * <code>&mytool_build_specifications.index</code>
+ */
+#define CLASP_SUBCOMMAND_INDEXED(name, index, help)         { name, NULL, index, help }
+
+/** \def CLASP_SUBCOMMAND_ARRAY_TERMINATOR
+ *
+ * Terminates an array of clasp_subcommand_t
+ */
+#define CLASP_SUBCOMMAND_ARRAY_TERMINATOR                   { NULL, NULL, NULL, NULL }
+
+/** Opaque type of a subcommand table, which maps verbs - via a hash table
+ *   - to their subcommands, and holds the index of the global
+ *   specifications and of each subcommand selected so far.
+ *
+ * \see clasp_createSubcommandTable
+ * \see clasp_parseSubcommand
+ */
+struct clasp_subcommand_table_t;
+#ifndef __cplusplus
+typedef struct clasp_subcommand_table_t                     clasp_subcommand_table_t;
+#endif /* !__cplusplus */
+
+/** Structure that receives the results of clasp_parseSubcommand()
+ *
+ * \see clasp_parseSubcommand
+ * \see clasp_releaseSubcommandResults
+ */
+struct clasp_subcommand_results_t
+{
+    clasp_arguments_t const*    globalArgs;     /*!< The results of parsing the global options - those preceding the verb - against the global specifications */
+    int                         verbIndex;      /*!< The command-line index of the verb, or argc if there is none */
+    clasp_subcommand_t const*   subcommand;     /*!< The selected subcommand, or NULL if there is no verb, or it is not recognised */
+    clasp_arguments_t const*    args;           /*!< The results of parsing the verb and its arguments - the verb being treated as the program name - against the specifications of the subcommand, or NULL if subcommand is NULL */
+};
+#ifndef __cplusplus
+typedef struct clasp_subcommand_results_t                   clasp_subcommand_results_t;
+#endif /* !__cplusplus */
+
+/** Structure that describes one applet of a multi-call program - one
+ *   whose behaviour is selected by the name under which it is invoked,
+ *   such as <code>ls</code> in a symbolic link <code>ls -> toolbox</code>
+ *
+ * \see clasp_createAppletRegistry
+ * \see CLASP_APPLET
+ * \see CLASP_APPLET_INDEXED
+ */
+struct clasp_applet_t
+{
+    clasp_char_t const*                 name;           /*!< The program name - without directory or, on Windows, extension - that selects the applet. May not be NULL or empty */
+    clasp_specification_t const*        specifications; /*!< The (terminated) specifications of the applet, which are validated and indexed when the applet is selected. Ignored if index is not NULL. May be NULL */
+    clasp_specification_index_t const*  index;          /*!< An index - e.g. of compiled specifications - of the specifications of the applet. May be NULL */
+    int                               (*pfnMain)(clasp_arguments_t const* args); /*!< The entry function of the applet. May be NULL if the caller dispatches by other means */
+};
+#ifndef __cplusplus
+typedef struct clasp_applet_t                               clasp_applet_t;
+#endif /* !__cplusplus */
+
+/** \def CLASP_APPLET(name, specifications, pfnMain)
+ *
+ * Defines an applet whose specifications are indexed on selection
+ */
+#define CLASP_APPLET(name, specifications, pfnMain)         { name, specifications, NULL, pfnMain }
+
+/** \def CLASP_APPLET_INDEXED(name, index, pfnMain)
+ *
+ * Defines an applet whose specifications are given by an index, e.g.
+ * <code>&toolbox_ls_specifications.index</code>
+ */
+#define CLASP_APPLET_INDEXED(name, index, pfnMain)          { name, NULL, index, pfnMain }
+
+/** \def CLASP_APPLET_ARRAY_TERMINATOR
+ *
+ * Terminates an array of clasp_applet_t
+ */
+#define CLASP_APPLET_ARRAY_TERMINATOR                       { NULL, NULL, NULL, NULL }
+
+/** Opaque type of an applet registry, which maps program names - via a
+ *   hash table - to their applets, and holds the index of each applet
+ *   selected so far.
+ *
+ * \see clasp_createAppletRegistry
+ * \see clasp_parseApplet
+ */
+struct clasp_applet_registry_t;
+#ifndef __cplusplus
+typedef struct clasp_applet_registry_t                      clasp_applet_registry_t;
+#endif /* !__cplusplus */
+
 /** Log function prototype. */
 typedef void (CLASP_CALLCONV *clasp_log_fn_t)(
     void*               context
@@ -793,12 +1270,124 @@ typedef void (CLASP_CALLCONV *clasp_free_fn_t)(
 ,   void*       pv
 );
 
+/** The sites of the allocations made by CLASP, as reported to the trace
+ *   function of the diagnostic context.
+ *
+ * \see clasp_trace_fn_t
+ */
+enum clasp_alloc_site_t
+{
+        CLASP_ALLOC_SITE_ARGUMENTS          =   1   /*!< The block holding the results of a parse */
+    ,   CLASP_ALLOC_SITE_APPEND_VECTOR      =   2   /*!< The (temporary) argument vector of clasp_appendArguments() */
+    ,   CLASP_ALLOC_SITE_BATCH_SIZES        =   3   /*!< The (temporary) sizes of the command-lines of clasp_parseArgumentsBatch() */
+    ,   CLASP_ALLOC_SITE_BATCH_ARENA        =   4   /*!< The block holding the results of clasp_parseArgumentsBatch() */
+    ,   CLASP_ALLOC_SITE_WILDCARD_VECTOR    =   5   /*!< The (temporary) argument vector of wildcard expansion */
+    ,   CLASP_ALLOC_SITE_WILDCARD_STRING    =   6   /*!< A (temporary) argument string of wildcard expansion */
+    ,   CLASP_ALLOC_SITE_PREFIX_TRIE        =   7   /*!< The (temporary) prefix trie of CLASP_F_ALLOW_UNIQUE_PREFIXES, when parsing without an index */
+    ,   CLASP_ALLOC_SITE_INDEX              =   8   /*!< A specification index, created by clasp_createSpecificationIndex() */
+    ,   CLASP_ALLOC_SITE_INDEX_SCRATCH      =   9   /*!< The (temporary) working memory of clasp_createSpecificationIndex() */
+    ,   CLASP_ALLOC_SITE_USAGE_BUFFER       =   10  /*!< The text of rendered usage - header, body, value-sets, etc. */
+    ,   CLASP_ALLOC_SITE_USAGE_MODEL        =   11  /*!< The (temporary) grouping of specifications of the usage body */
+    ,   CLASP_ALLOC_SITE_USAGE_CACHE        =   12  /*!< A usage cache, its entries, and its file paths */
+    ,   CLASP_ALLOC_SITE_DIAGNOSTIC         =   13  /*!< The (temporary) text of a diagnostic message */
+    ,   CLASP_ALLOC_SITE_SUBCOMMAND_TABLE   =   14  /*!< A subcommand table, created by clasp_createSubcommandTable(), or an applet registry, created by clasp_createAppletRegistry() */
+    ,   CLASP_ALLOC_SITE_COMPLETION         =   15  /*!< The (temporary) completion trie, and the candidates and scripts rendered by the completion functions */
+    ,   CLASP_ALLOC_SITE_SUGGESTIONS        =   16  /*!< The (temporary) working row of clasp_findSuggestions(), for a name too long for its bit-parallel comparison */
+    ,   CLASP_ALLOC_SITE_STREAM_CHUNK       =   17  /*!< A chunk of the values read by clasp_appendValuesFromStream(), held until the results are released, or the (temporary) buffer and paths of the stream functions */
+};
+#ifndef __cplusplus
+typedef enum clasp_alloc_site_t clasp_alloc_site_t;
+#endif /* !__cplusplus */
+
+/** The operations reported to the trace function of the diagnostic
+ *   context.
+ *
+ * \see clasp_trace_fn_t
+ */
+enum clasp_alloc_op_t
+{
+        CLASP_ALLOC_OP_MALLOC               =   1   /*!< A block was allocated */
+    ,   CLASP_ALLOC_OP_REALLOC              =   2   /*!< A block was reallocated */
+    ,   CLASP_ALLOC_OP_FREE                 =   3   /*!< A block is to be freed */
+};
+#ifndef __cplusplus
+typedef enum clasp_alloc_op_t clasp_alloc_op_t;
+#endif /* !__cplusplus */
+
+/** Allocation trace function prototype.
+ *
+ * Invoked for every allocation, reallocation, and freeing (of a non-NULL
+ * block) made by CLASP via the diagnostic context, after the allocation
+ * or reallocation, and before the freeing.
+ *
+ * \param context The context member of the diagnostic context
+ * \param op The operation
+ * \param site The site of the operation
+ * \param pvOld The block reallocated or freed; NULL for an allocation
+ * \param pvNew The block allocated or reallocated, which is NULL if the
+ *  operation failed; NULL for a freeing
+ * \param cb The number of bytes requested; 0 for a freeing
+ */
+typedef void (CLASP_CALLCONV *clasp_trace_fn_t)(
+    void*               context
+,   clasp_alloc_op_t    op
+,   clasp_alloc_site_t  site
+,   void*               pvOld
+,   void*               pvNew
+,   size_t              cb
+);
+
 struct clasp_diagnostic_context_t;
 #ifndef __cplusplus
 typedef struct clasp_diagnostic_context_t                   clasp_diagnostic_context_t;
 #endif /* !__cplusplus */
 
-/** Initialises a diagnostic context */
+/** Causes the parsing functions to collect statistics about each parse,
+ * which may be obtained from the results by clasp_getParseStatistics()
+ *
+ * \ingroup group__clasp__api_parsing
+ *
+ * Collection is off by default; when it is off, the parse does no timing
+ * and no counting.
+ */
+#define CLASP_DC_F_COLLECT_STATISTICS                       (0x00000001)
+
+/** Statistics of a single call to clasp_parseArguments() (or
+ *   clasp_parseArgumentsWithIndex()), collected when the diagnostic context
+ *   specifies \c CLASP_DC_F_COLLECT_STATISTICS
+ *
+ * \ingroup group__clasp__api_parsing
+ *
+ * Times are measured in nanoseconds, with the resolution of the platform's
+ * monotonic clock.
+ *
+ * \see clasp_getParseStatistics
+ */
+struct clasp_parse_statistics_t
+{
+    double  nsValidation;           /*!< Time taken to validate the specifications, excluding nsDuplicateChecking */
+    double  nsDuplicateChecking;    /*!< Time taken to check the specifications for duplicate aliases */
+    double  nsSizing;               /*!< Time taken to calculate the size of the results */
+    double  nsFilling;              /*!< Time taken to fill in the results, excluding nsSorting */
+    double  nsSorting;              /*!< Time taken to sort the arguments */
+    double  nsWildcardExpansion;    /*!< Time taken to expand wildcards (0 on platforms on which this is not done) */
+
+    size_t  numAliasLookups;        /*!< Number of lookups of flags/options in the specifications */
+    size_t  numStringComparisons;   /*!< Number of string comparisons made by those lookups */
+    size_t  numBytesAllocated;      /*!< Total number of bytes requested by the parse's allocations */
+    size_t  numAllocations;         /*!< Number of allocations made by the parse */
+};
+#ifndef __cplusplus
+typedef struct clasp_parse_statistics_t                     clasp_parse_statistics_t;
+#endif /* !__cplusplus */
+
+/** Initialises a diagnostic context
+ *
+ * \note This - or one of the C++ constructors, which call it - is the only
+ *   way in which a context should be initialised, since it records the
+ *   size of the structure in the \c cb member, without which the members
+ *   \c context, \c flags, and \c pfnTrace are ignored
+ */
 CLASP_CALL(void)
 clasp_init_diagnostic_context(
     clasp_diagnostic_context_t* dc
@@ -824,6 +1413,12 @@ struct clasp_diagnostic_context_t
 
     void*               param;  /*!< user-specified parameter */
 
+    unsigned            flags;  /*!< Combination of CLASP_DC_F_* flags */
+
+    clasp_trace_fn_t    pfnTrace;   /*!< Optional allocation trace function */
+
+    size_t              cb;     /*!< The size of the structure, as set by clasp_init_diagnostic_context(). Unless it is large enough to include them, \c context, \c flags, and \c pfnTrace are treated as \c NULL, 0, and \c NULL */
+
 #ifdef __cplusplus
 
 public: /** Construction */
@@ -910,34 +1505,717 @@ clasp_parseArguments(
 ,   clasp_arguments_t const**           args
 );
 
-/** Releases all resources associated with the command-line
+/** Equivalent to clasp_parseArguments(), but also decodes, and checks, the
+ * value of each flag/option against the entry of the given schema at the
+ * position of its specification
  *
  * \ingroup group__clasp__api_parsing
  *
- * \param args The clasp-arguments structure pointer allocated by a previous
- *   call to clasp_parseArguments()
- */
-CLASP_CALL(void)
-clasp_releaseArguments(
-    clasp_arguments_t const*            args
-);
-
-/** Obtains the specifications given in the call to clasp_parseArguments(),
- *   which may be NULL.
+ * \param schema Array of clasp_value_schema_t entries parallel to - and
+ *   with (at least) as many entries as - \c specifications. May not be
+ *   \c NULL
  *
- * \pre NULL != args
+ * Each value is decoded just once, as part of the parse, into a typed value
+ * held with the results, and obtained by clasp_getTypedValue(). A value
+ * that is missing, invalid, out of range, or repeated does not cause the
+ * parse to fail: it is logged (at \c CLASP_SEVIX_DEBUG), recorded in the
+ * \c error member of its typed value, and may be collected by
+ * clasp_verifyArguments() with \c CLASP_VERIFY_F_ALL_VALID.
+ *
+ * \note No more than (<code>INT_MAX >> 8</code>) values are decoded; those
+ *   of any further flags/options have no typed value.
+ *
+ * A flag/option given by an alias specification is decoded against the
+ * schema of the alias, unless that is CLASP_VALUE_SCHEMA_NONE, in which
+ * case it is decoded against that of the specification that the alias
+ * names.
+ *
+ * \retval 0 The function succeeded
+ * \retval EINVAL The schema is invalid: it declares a value for a flag, a
+ *   CLASP_VALUEKIND_ENUM for a specification without a value set, an
+ *   unknown kind, or a minimum greater than its maximum
+ * \retval !0 Any other standard error code, indicating the reason that the
+ *   function failed, e.g. <code>ENOMEM</code>
+ *
+ * \note Arguments appended by clasp_appendArguments() are decoded against
+ *   the same schema - which must therefore remain valid for as long as the
+ *   results - whereas values appended by clasp_appendValuesFromStream()
+ *   are not decoded
  */
-CLASP_CALL(clasp_specification_t const*)
-clasp_getSpecifications(
-    clasp_arguments_t const*            args
+CLASP_CALL(int)
+clasp_parseArgumentsWithSchema(
+    unsigned                            flags
+,   int                                 argc
+,   clasp_char_t*                       argv[]
+,   clasp_specification_t const         specifications[]
+,   clasp_value_schema_t const          schema[]
+,   clasp_diagnostic_context_t const*   ctxt
+,   clasp_arguments_t const**           args
 );
 
-/** Reports how many flags/options are not recognised relative to the
- * given \c specifications array, and returns a pointer to the \c nSkip'th
- * unrecognised instance.
+/** Equivalent to clasp_parseArguments(), but uses a precomputed index to
+ * look up flags and options, and omits the validation of the
+ * specifications, which is assumed to have been done when the index was
+ * created
  *
- * \pre NULL != args
- * \pre NULL != specifications
+ * \ingroup group__clasp__api_parsing
+ *
+ * \param flags Flags that control the parsing behaviour
+ * \param argc The <code>argc</code> argument passed to main(). Must be 1 or
+ *   more; undefined behaviour otherwise
+ * \param argv The <code>argv</code>
+ * \param index The index. May not be \c NULL
+ * \param args Receives a pointer to the parsed results structure
+ *
+ * \note Names are matched exactly, whereas clasp_parseArguments() will
+ *   also match a name of which the argument is a leading part
+ */
+CLASP_CALL(int)
+clasp_parseArgumentsWithIndex(
+    unsigned                            flags
+,   int                                 argc
+,   clasp_char_t*                       argv[]
+,   clasp_specification_index_t const*  index
+,   clasp_diagnostic_context_t const*   ctxt
+,   clasp_arguments_t const**           args
+);
+
+/** Equivalent to clasp_parseArgumentsWithIndex(), using the index of the
+ * given compiled specifications
+ *
+ * \ingroup group__clasp__api_parsing
+ *
+ * \param compiled The compiled specifications. May not be \c NULL
+ */
+CLASP_CALL(int)
+clasp_parseArgumentsCompiled(
+    unsigned                                flags
+,   int                                     argc
+,   clasp_char_t*                           argv[]
+,   clasp_compiled_specifications_t const*  compiled
+,   clasp_diagnostic_context_t const*       ctxt
+,   clasp_arguments_t const**               args
+);
+
+/** Creates, at runtime, an index over the given specifications, for use
+ * with clasp_parseArgumentsWithIndex()
+ *
+ * \ingroup group__clasp__api_parsing
+ *
+ * \param ctxt Pointer to a diagnostic context, via which the memory for
+ *  the index is acquired. May be NULL, in which case the stock context is
+ *  used
+ * \param specifications The specifications, which must outlive the index.
+ *  May not be NULL
+ * \param pindex Pointer to a variable to receive the index, which must be
+ *  released by clasp_destroySpecificationIndex(). May not be NULL
+ *
+ * \retval 0 The index was created
+ * \retval EINVAL The specifications are invalid, as for
+ *  clasp_parseArguments()
+ * \retval ENOMEM The memory for the index could not be allocated
+ */
+CLASP_CALL(int)
+clasp_createSpecificationIndex(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_specification_t const         specifications[]
+,   clasp_specification_index_t const** pindex
+);
+
+/** Destroys an index created by clasp_createSpecificationIndex()
+ *
+ * \ingroup group__clasp__api_parsing
+ *
+ * \param index The index. May be NULL
+ */
+CLASP_CALL(void)
+clasp_destroySpecificationIndex(
+    clasp_specification_index_t const*  index
+);
+
+/** Calculates the hash of a specification key, as used in
+ * clasp_specification_index_t
+ *
+ * \ingroup group__clasp__api_parsing
+ *
+ * The hash is a 32-bit FNV-1a over the characters of the key, with the
+ * offset basis perturbed by the seed, and a final fold of the upper bits
+ * into the lower.
+ */
+CLASP_CALL(unsigned long)
+clasp_hashSpecificationKey(
+    clasp_char_t const*                 key
+,   size_t                              cchKey
+,   unsigned long                       seed
+);
+
+/** Parses, in one call, many independent command-lines against a single
+ * index
+ *
+ * \ingroup group__clasp__api_parsing
+ *
+ * Each command-line is parsed exactly as by clasp_parseArgumentsWithIndex()
+ * (with the exception that wildcard expansion is not performed), but the
+ * results of all of them are held in a single allocation. The work is done
+ * in two passes - sizing, then parsing - each of which is spread over the
+ * given pool, if any.
+ *
+ * \param flags Flags that control the parsing behaviour
+ * \param numCommandLines The number of command-lines
+ * \param argcs Array of \c numCommandLines <code>argc</code> values
+ * \param argvs Array of \c numCommandLines <code>argv</code> arrays
+ * \param index The index, e.g. as created by
+ *  clasp_createSpecificationIndex(). May not be \c NULL
+ * \param ctxt Pointer to a diagnostic context, via which the memory for
+ *  the results is acquired, and which must be safe for concurrent use if
+ *  \c pool is not \c NULL. May be NULL, in which case the stock context is
+ *  used
+ * \param results Array of \c numCommandLines entries, each of which
+ *  receives the error code and (on success) the parsed results of the
+ *  corresponding command-line. The results must be released, together,
+ *  by clasp_releaseArgumentsBatch()
+ * \param pool The pool over which the work is spread. May be \c NULL, in
+ *  which case all the work is done on the calling thread
+ *
+ * \retval 0 The batch was processed, and the error code of each
+ *  command-line - e.g. \c EINVAL for an <code>argc</code> less than 1 - is
+ *  given in its result
+ * \retval ENOMEM The memory for the results could not be allocated, in
+ *  which case no result holds parsed results
+ */
+CLASP_CALL(int)
+clasp_parseArgumentsBatch(
+    unsigned                            flags
+,   size_t                              numCommandLines
+,   int const                           argcs[]
+,   clasp_char_t** const                argvs[]
+,   clasp_specification_index_t const*  index
+,   clasp_diagnostic_context_t const*   ctxt
+,   clasp_batch_result_t                results[]
+,   clasp_batch_pool_t const*           pool
+);
+
+/** Releases all the results obtained from a call to
+ * clasp_parseArgumentsBatch()
+ *
+ * \ingroup group__clasp__api_parsing
+ *
+ * \param numCommandLines The number of elements in \c results
+ * \param results The results array passed to clasp_parseArgumentsBatch()
+ *
+ * \note The individual results must not be passed to
+ *  clasp_releaseArguments()
+ */
+CLASP_CALL(void)
+clasp_releaseArgumentsBatch(
+    size_t                              numCommandLines
+,   clasp_batch_result_t const          results[]
+);
+
+/** Appends to the results of a parse the arguments of a further source -
+ * e.g. an environment variable, or a configuration file - as if they had
+ * been given on the command-line
+ *
+ * \ingroup group__clasp__api_parsing
+ *
+ * The arguments are classified with the flags, specifications, index,
+ * and schema of the original parse - which must remain valid for as long
+ * as the results - and each is tagged with the given \c source. The
+ * values of the new flags/options are decoded, against that schema (if
+ * any), when appended, so that \c CLASP_SCHEMA_F_SINGLE applies within
+ * each source, but not across sources. The existing arguments are not
+ * parsed again: all are copied into a new
+ * results structure in which the arguments of each group - flags, options,
+ * values - are followed by the new arguments of that group. Since searches
+ * (such as by clasp_findFlagOrOption()) find the earliest match, the
+ * arguments of the command-line take precedence over those of any
+ * appended source, and those of an earlier-appended source over those of
+ * a later one.
+ *
+ * \param args Pointer to the variable holding the results of
+ *  clasp_parseArguments() (or of an earlier call to this function), which,
+ *  on success, is released and the variable updated to the new results. May
+ *  not be \c NULL
+ * \param source The (caller-defined) identifier of the source, recorded in
+ *  the \c source member of each new argument. Must be greater than 0
+ * \param argc The number of arguments in \c argv
+ * \param argv The arguments, which - unlike those passed to
+ *  clasp_parseArguments() - do not include a program name. The
+ *  \c cmdLineIndex member of each new argument is its index in \c argv
+ *
+ * \retval 0 The arguments were appended (or \c argc was 0)
+ * \retval EINVAL \c source is less than 1, \c argc is negative, or the
+ *  results were obtained from clasp_parseArgumentsBatch() or
+ *  clasp_mapArguments()
+ * \retval ENOMEM The memory for the results could not be allocated, in
+ *  which case the variable pointed to by \c args is unchanged
+ *
+ * \note All pointers into the original results are invalidated by a
+ *  successful call
+ */
+CLASP_CALL(int)
+clasp_appendArguments(
+    clasp_arguments_t const**           args
+,   int                                 source
+,   int                                 argc
+,   clasp_char_t*                       argv[]
+);
+
+#ifndef CLASP_USE_WIDE_STRINGS
+
+/** Stream flag, which causes the values of a stream to be delimited by
+ * NUL characters - as written by <code>find -print0</code> - rather than
+ * by newlines.
+ */
+# define CLASP_STREAM_F_NUL_DELIMITED                       (0x00000001)
+
+/** Callback function for values read by clasp_forEachStreamedValue()
+ *
+ * \param param The parameter given to clasp_forEachStreamedValue()
+ * \param value The value, which is nul-terminated, and valid only for
+ *  the duration of the call
+ * \param cchValue The number of characters in \c value
+ * \param index The index of the value among all those streamed
+ *
+ * \return 0 to continue; any other value stops the streaming, and is
+ *  returned by clasp_forEachStreamedValue()
+ */
+typedef int (CLASP_CALLCONV *clasp_stream_value_fn_t)(
+    void*               param
+,   clasp_char_t const* value
+,   size_t              cchValue
+,   size_t              index
+);
+
+/** Appends to the results of a parse, as values, the values listed in the
+ * stream(s) designated by an option - e.g. <code>"--files-from"</code>
+ * in <code>find . -print0 | tool --null --files-from=-</code> - so that
+ * programs may accept lists that exceed the limits of the command-line
+ *
+ * \ingroup group__clasp__api_parsing
+ *
+ * The value of each instance of the option, in order, is the path of a
+ * file, or <code>"-"</code> for the standard input, whose contents are
+ * read, in large chunks, into memory held with the results. The values
+ * are delimited by newlines (with any carriage-return removed) or, with
+ * \ref CLASP_STREAM_F_NUL_DELIMITED, by NUL characters, and empty values
+ * are skipped. The values are not copied: each is terminated in place,
+ * and referenced, by a new value argument - tagged with \c source, and
+ * whose \c cmdLineIndex member is its index among the values streamed -
+ * that follows the existing values, as by clasp_appendArguments().
+ *
+ * Each instance of the option is marked as used.
+ *
+ * \param args Pointer to the variable holding the results of
+ *  clasp_parseArguments() (or of an earlier call to this function, or to
+ *  clasp_appendArguments()), which, on success, if there are any streamed
+ *  values, is released and the variable updated to the new results. May
+ *  not be \c NULL
+ * \param optionName The (resolved) name of the option, e.g.
+ *  <code>"--files-from"</code>. May not be \c NULL
+ * \param streamFlags A combination of the \c CLASP_STREAM_F_* flags
+ * \param source The (caller-defined) identifier of the source, recorded
+ *  in the \c source member of each new argument. Must be greater than 0
+ *
+ * \retval 0 The values were appended (or the option is not specified, or
+ *  its streams hold no values)
+ * \retval EINVAL \c source is less than 1, an instance of the option has
+ *  no value, or the results were obtained from
+ *  clasp_parseArgumentsBatch() or clasp_mapArguments()
+ * \retval ENOMEM The memory for the values or results could not be
+ *  allocated
+ * \retval EIO A stream could not be read
+ * \retval (other) The \c errno of a file that could not be opened
+ *
+ * In the event of failure, the variable pointed to by \c args is
+ * unchanged.
+ *
+ * \note All pointers into the original results are invalidated by a
+ *  successful call
+ *
+ * \note Available only with multibyte strings
+ */
+CLASP_CALL(int)
+clasp_appendValuesFromStream(
+    clasp_arguments_t const**           args
+,   clasp_char_t const*                 optionName
+,   unsigned                            streamFlags
+,   int                                 source
+);
+
+/** Delivers to a callback, one by one, the values listed in the stream(s)
+ * designated by an option, as described for
+ * clasp_appendValuesFromStream(), without retaining them, so that lists of
+ * any length may be processed in bounded memory
+ *
+ * \ingroup group__clasp__api_parsing
+ *
+ * Each stream is read in large chunks into a single buffer, in which each
+ * value is terminated in place before it is delivered.
+ *
+ * \param args The results. May not be \c NULL
+ * \param optionName The (resolved) name of the option. May not be \c NULL
+ * \param streamFlags A combination of the \c CLASP_STREAM_F_* flags
+ * \param pfn The callback. May not be \c NULL
+ * \param param A parameter passed to \c pfn
+ *
+ * \retval 0 All values were delivered (or there were none)
+ * \retval EINVAL An instance of the option has no value
+ * \retval ENOMEM The memory for the buffer could not be allocated
+ * \retval EIO A stream could not be read
+ * \retval (other) The \c errno of a file that could not be opened, or
+ *  the (non-0) value returned by \c pfn to stop the streaming
+ *
+ * \note Available only with multibyte strings
+ */
+CLASP_CALL(int)
+clasp_forEachStreamedValue(
+    clasp_arguments_t const*            args
+,   clasp_char_t const*                 optionName
+,   unsigned                            streamFlags
+,   clasp_stream_value_fn_t             pfn
+,   void*                               param
+);
+#endif /* !CLASP_USE_WIDE_STRINGS */
+
+/** Releases all resources associated with the command-line
+ *
+ * \ingroup group__clasp__api_parsing
+ *
+ * \param args The clasp-arguments structure pointer allocated by a previous
+ *   call to clasp_parseArguments()
+ */
+CLASP_CALL(void)
+clasp_releaseArguments(
+    clasp_arguments_t const*            args
+);
+
+/** Obtains the statistics collected by the call to clasp_parseArguments()
+ *   (or clasp_parseArgumentsWithIndex()) that obtained the results
+ *
+ * \ingroup group__clasp__api_parsing
+ *
+ * \param args The results. May not be \c NULL
+ *
+ * \return A pointer to the statistics, which remain valid until the
+ *  results are released, or \c NULL if the diagnostic context of the parse
+ *  did not specify \c CLASP_DC_F_COLLECT_STATISTICS. Results obtained by
+ *  clasp_parseArgumentsBatch(), clasp_appendArguments(), or
+ *  clasp_mapArguments() have no statistics
+ *
+ * \pre NULL != args
+ */
+CLASP_CALL(clasp_parse_statistics_t const*)
+clasp_getParseStatistics(
+    clasp_arguments_t const*            args
+);
+
+/** Obtains the value of the given flag/option, as decoded by the call to
+ *   clasp_parseArgumentsWithSchema() that obtained the results
+ *
+ * \ingroup group__clasp__api_parsing
+ *
+ * \param args The results. May not be \c NULL
+ * \param arg The flag/option. May not be \c NULL
+ *
+ * \return A pointer to the typed value, which remains valid until the
+ *  results are released, or \c NULL if the argument was not decoded - as
+ *  is the case for a value, for an argument whose schema is
+ *  CLASP_VALUE_SCHEMA_NONE, and for all arguments of results obtained other
+ *  than by clasp_parseArgumentsWithSchema()
+ */
+CLASP_CALL(clasp_typed_value_t const*)
+clasp_getTypedValue(
+    clasp_arguments_t const*            args
+,   clasp_argument_t const*             arg
+);
+
+/** Serializes the results of a parse into a self-contained block of memory
+ *   - e.g. a memfd or shared memory - from which they may be used in place,
+ *   by this or another process, via clasp_mapArguments()
+ *
+ * \ingroup group__clasp__api_parsing
+ *
+ * The block comprises a header - holding the version, the character and
+ * pointer sizes, and a fingerprint of the specifications of the parse -
+ * followed by a copy of the results and of the argument vector. All the
+ * pointers within the block are relative to a base address recorded in the
+ * header, so the block may be copied, or mapped at any address, without
+ * being parsed again.
+ *
+ * \param args The results. May not be \c NULL
+ * \param buffer The buffer into which the results are serialized, which
+ *  must be aligned on a 16-byte boundary (as is memory obtained from
+ *  <code>mmap()</code>, and from <code>malloc()</code> on most 64-bit
+ *  platforms). May be \c NULL, in which case only the required size is
+ *  obtained
+ * \param cbBuffer The size, in bytes, of \c buffer
+ * \param pcbRequired Pointer to a variable that receives the required size,
+ *  in bytes. May be \c NULL
+ *
+ * \retval 0 The results were serialized (or \c buffer is \c NULL)
+ * \retval EINVAL \c buffer is not suitably aligned, or the results hold
+ *  values appended by clasp_appendValuesFromStream()
+ * \retval ERANGE \c cbBuffer is less than the required size
+ *
+ * \pre NULL != args
+ */
+CLASP_CALL(int)
+clasp_serializeArguments(
+    clasp_arguments_t const*            args
+,   void*                               buffer
+,   size_t                              cbBuffer
+,   size_t*                             pcbRequired
+);
+
+/** Maps results serialized by clasp_serializeArguments()
+ *
+ * \ingroup group__clasp__api_parsing
+ *
+ * No parsing is performed, and the blob is only read, so that one blob -
+ * e.g. a shared mapping of a memfd - may be mapped concurrently by any
+ * number of users, at any address: the head of the results (their members
+ * and arguments array) and the argument vector are copied into memory
+ * allocated via \c ctxt, and each of their pointers is relocated by a
+ * single addition, while the strings remain in the blob.
+ *
+ * \param blob The serialized results, aligned as required by
+ *  clasp_serializeArguments(). May not be \c NULL
+ * \param cbBlob The size, in bytes, of \c blob
+ * \param specifications The specifications with which the results were
+ *  parsed, or an equivalent array. May be \c NULL only if they were
+ *  parsed without specifications
+ * \param ctxt Pointer to a diagnostic context. May be NULL, in which case
+ *  the stock context is used
+ * \param args Pointer to a variable that receives the results, which
+ *  remain valid until released by clasp_unmapArguments(), and the blob is
+ *  unmapped (or freed). May not be \c NULL
+ *
+ * \retval 0 The results were mapped
+ * \retval EINVAL The blob is misaligned, truncated, or not a serialization
+ *  by this version of CLASP with the same character and pointer sizes, or
+ *  its fingerprint does not match that of \c specifications, or any of
+ *  its counts or offsets lies beyond its end
+ * \retval ENOMEM Memory could not be allocated
+ *
+ * \note The results must be released by clasp_unmapArguments(), and must
+ *  not be passed to clasp_releaseArguments(), clasp_appendArguments(), or
+ *  clasp_appendValuesFromStream()
+ */
+CLASP_CALL(int)
+clasp_mapArguments(
+    void const*                         blob
+,   size_t                              cbBlob
+,   clasp_specification_t const         specifications[]
+,   clasp_diagnostic_context_t const*   ctxt
+,   clasp_arguments_t const**           args
+);
+
+/** Releases results obtained from clasp_mapArguments(), leaving the blob
+ *   unchanged
+ *
+ * \ingroup group__clasp__api_parsing
+ *
+ * \param args The results. May be \c NULL
+ */
+CLASP_CALL(void)
+clasp_unmapArguments(
+    clasp_arguments_t const*            args
+);
+
+/** Creates a subcommand table, for use with clasp_parseSubcommand()
+ *
+ * \ingroup group__clasp__api_parsing
+ *
+ * The global specifications are validated and indexed immediately; those
+ * of each subcommand only when it is first selected, so that the cost of a
+ * parse is proportional to the specifications of the selected subcommand,
+ * not to those of all of them.
+ *
+ * \param ctxt Pointer to a diagnostic context, via which the memory for
+ *  the table and its indexes is acquired. May be NULL, in which case the
+ *  stock context is used
+ * \param globalSpecifications The specifications of the global options,
+ *  which must outlive the table. May be NULL
+ * \param subcommands The (terminated) subcommands, which must outlive the
+ *  table. May not be NULL
+ * \param ptable Pointer to a variable to receive the table, which must be
+ *  released by clasp_destroySubcommandTable(). May not be NULL
+ *
+ * \retval 0 The table was created
+ * \retval EINVAL The global specifications are invalid, or a verb is
+ *  empty or duplicated
+ * \retval ENOMEM The memory for the table could not be allocated
+ */
+CLASP_CALL(int)
+clasp_createSubcommandTable(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_specification_t const         globalSpecifications[]
+,   clasp_subcommand_t const            subcommands[]
+,   clasp_subcommand_table_t const**    ptable
+);
+
+/** Destroys a subcommand table created by clasp_createSubcommandTable()
+ *
+ * \ingroup group__clasp__api_parsing
+ *
+ * \param table The table. May be NULL
+ */
+CLASP_CALL(void)
+clasp_destroySubcommandTable(
+    clasp_subcommand_table_t const*     table
+);
+
+/** Parses a command-line of the form
+ *   <code>tool [global-options] verb [arguments]</code>
+ *
+ * \ingroup group__clasp__api_parsing
+ *
+ * The verb is the first argument that is neither a flag or option, nor
+ * the value of a (separately given) global option. The global options are
+ * parsed, once, against the global specifications, and are available to
+ * every subcommand via the \c globalArgs member of the results; the verb
+ * and its arguments are parsed against the specifications of the
+ * subcommand only.
+ *
+ * \param flags Flags that control the parsing behaviour, as for
+ *  clasp_parseArguments()
+ * \param argc The <code>argc</code> argument passed to main(). Must be 1
+ *  or more; undefined behaviour otherwise
+ * \param argv The <code>argv</code>
+ * \param table The table. May not be \c NULL
+ * \param ctxt Pointer to a diagnostic context. May be NULL, in which case
+ *  the stock context is used
+ * \param results Pointer to the structure that receives the results,
+ *  which must be released by clasp_releaseSubcommandResults() - as may be
+ *  done whatever the return value. May not be \c NULL
+ *
+ * \retval 0 The command-line was parsed; if there is no verb, the
+ *  \c subcommand member of the results is NULL
+ * \retval ENOENT The verb is not recognised, in which case the global
+ *  options, and the index of the verb, are available in the results
+ * \retval EINVAL The specifications of the selected subcommand are invalid
+ * \retval ENOMEM The memory for the results could not be allocated
+ *
+ * \note Since the index of a subcommand is created on its first
+ *  selection, calls on a table whose subcommands are not all given by
+ *  \c index must not be made concurrently
+ */
+CLASP_CALL(int)
+clasp_parseSubcommand(
+    unsigned                            flags
+,   int                                 argc
+,   clasp_char_t*                       argv[]
+,   clasp_subcommand_table_t const*     table
+,   clasp_diagnostic_context_t const*   ctxt
+,   clasp_subcommand_results_t*         results
+);
+
+/** Releases the results obtained from clasp_parseSubcommand()
+ *
+ * \ingroup group__clasp__api_parsing
+ *
+ * \param results Pointer to the results. May not be \c NULL
+ */
+CLASP_CALL(void)
+clasp_releaseSubcommandResults(
+    clasp_subcommand_results_t const*   results
+);
+
+/** Creates a registry of the applets of a multi-call program
+ *
+ * \ingroup group__clasp__api_parsing
+ *
+ * \param ctxt Pointer to a diagnostic context, via which the memory for
+ *  the registry and its indexes is acquired. May be NULL, in which case
+ *  the stock context is used
+ * \param applets The (terminated) applets, which must outlive the
+ *  registry. May not be NULL
+ * \param pregistry Pointer to a variable to receive the registry, which
+ *  must be released by clasp_destroyAppletRegistry(). May not be NULL
+ *
+ * \retval 0 The registry was created
+ * \retval EINVAL An applet name is empty or duplicated
+ * \retval ENOMEM The memory for the registry could not be allocated
+ */
+CLASP_CALL(int)
+clasp_createAppletRegistry(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_applet_t const                applets[]
+,   clasp_applet_registry_t const**     pregistry
+);
+
+/** Destroys an applet registry created by clasp_createAppletRegistry()
+ *
+ * \ingroup group__clasp__api_parsing
+ *
+ * \param registry The registry. May be NULL
+ */
+CLASP_CALL(void)
+clasp_destroyAppletRegistry(
+    clasp_applet_registry_t const*      registry
+);
+
+/** Selects the applet named by the program name - <code>argv[0]</code>,
+ *   without directory or, on Windows, extension - and parses the
+ *   command-line against its specifications
+ *
+ * \ingroup group__clasp__api_parsing
+ *
+ * The applet is found in constant time, and only its specifications are
+ * validated and indexed, so the cost of startup does not grow with the
+ * number of applets.
+ *
+ * \param flags Flags that control the parsing behaviour, as for
+ *  clasp_parseArguments()
+ * \param argc The <code>argc</code> argument passed to main(). Must be 1
+ *  or more; undefined behaviour otherwise
+ * \param argv The <code>argv</code>
+ * \param registry The registry. May not be \c NULL
+ * \param ctxt Pointer to a diagnostic context. May be NULL, in which case
+ *  the stock context is used
+ * \param papplet Pointer to a variable to receive the selected applet, or
+ *  NULL on failure. May not be \c NULL
+ * \param args Pointer to a variable to receive the parsed arguments, which
+ *  must be released by clasp_releaseArguments(), or NULL on failure. May
+ *  not be \c NULL
+ *
+ * \retval 0 The applet was selected and the command-line was parsed
+ * \retval ENOENT The program name does not name an applet
+ * \retval EINVAL The specifications of the selected applet are invalid
+ * \retval ENOMEM The memory for the results could not be allocated
+ *
+ * \note Since the index of an applet is created on its first selection,
+ *  calls on a registry whose applets are not all given by \c index must
+ *  not be made concurrently
+ */
+CLASP_CALL(int)
+clasp_parseApplet(
+    unsigned                            flags
+,   int                                 argc
+,   clasp_char_t*                       argv[]
+,   clasp_applet_registry_t const*      registry
+,   clasp_diagnostic_context_t const*   ctxt
+,   clasp_applet_t const**              papplet
+,   clasp_arguments_t const**           args
+);
+
+/** Obtains the specifications given in the call to clasp_parseArguments(),
+ *   which may be NULL.
+ *
+ * \pre NULL != args
+ */
+CLASP_CALL(clasp_specification_t const*)
+clasp_getSpecifications(
+    clasp_arguments_t const*            args
+);
+
+/** Reports how many flags/options are not recognised relative to the
+ * given \c specifications array, and returns a pointer to the \c nSkip'th
+ * unrecognised instance.
+ *
+ * \pre NULL != args
+ * \pre NULL != specifications
  */
 CLASP_CALL(size_t)
 clasp_reportUnrecognisedFlagsAndOptions(
@@ -947,6 +2225,155 @@ clasp_reportUnrecognisedFlagsAndOptions(
 ,   unsigned                    nSkip /* = 0 */
 );
 
+/** Verify flag, which causes clasp_verifyArguments() to collect flags and
+ * options that are not recognised.
+ */
+#define CLASP_VERIFY_F_ALL_RECOGNISED                       (0x00000001)
+/** Verify flag, which causes clasp_verifyArguments() to collect flags and
+ * options that have not been used.
+ */
+#define CLASP_VERIFY_F_ALL_USED                             (0x00000002)
+/** Verify flag, which causes clasp_verifyArguments() to collect the flags
+ * and options whose values - as decoded by clasp_parseArgumentsWithSchema()
+ * - are missing, invalid, out of range, or repeated.
+ */
+#define CLASP_VERIFY_F_ALL_VALID                            (0x00000004)
+
+/** Initialises an argument errors buffer over the given storage.
+ *
+ * \pre NULL != errors
+ * \pre NULL != storage || 0 == capacity
+ */
+CLASP_CALL(void)
+clasp_initArgumentErrors(
+    clasp_argument_errors_t*    errors
+,   clasp_argument_error_t*     storage
+,   size_t                      capacity
+);
+
+/** Records an argument error, if there is room, and counts it regardless.
+ *
+ * \param errors The buffer
+ * \param kind The kind of error
+ * \param cmdLineIndex The command-line index of the erroneous argument,
+ *   or -1
+ * \param name Pointer to the name. Must remain valid for as long as the
+ *   error is used
+ * \param cchName The number of characters in the name
+ *
+ * \pre NULL != errors
+ */
+CLASP_CALL(void)
+clasp_addArgumentError(
+    clasp_argument_errors_t*    errors
+,   clasp_argerr_t              kind
+,   int                         cmdLineIndex
+,   clasp_char_t const*         name
+,   size_t                      cchName
+);
+
+/** Collects, in a single pass over the flags and options, all those that
+ * are not recognised, have invalid values, and/or have not been used,
+ * without throwing or allocating memory.
+ *
+ * Each argument is reported at most once: as not recognised, then as
+ * having an invalid value, then as unused.
+ *
+ * \param args The clasp-arguments structure pointer allocated by a previous
+ *   call to clasp_parseArguments()
+ * \param specifications The specifications against which to check
+ *   recognition. If NULL, those given to clasp_parseArguments() are used
+ * \param verifyFlags A combination of \c CLASP_VERIFY_F_ALL_RECOGNISED,
+ *   \c CLASP_VERIFY_F_ALL_USED and \c CLASP_VERIFY_F_ALL_VALID
+ * \param errors The buffer into which errors are collected. May be NULL,
+ *   in which case they are only counted
+ *
+ * \return The number of errors found
+ *
+ * \pre NULL != args
+ */
+CLASP_CALL(size_t)
+clasp_verifyArguments(
+    clasp_arguments_t const*    args
+,   clasp_specification_t const specifications[]
+,   unsigned                    verifyFlags
+,   clasp_argument_errors_t*    errors
+);
+
+/** Obtains the specifications whose long names begin with the given
+ * name - e.g. <code>"--verbose"</code> and <code>"--version"</code> for
+ * <code>"--ver"</code> - such as may be used to report an ambiguous
+ * abbreviation when parsing with \ref CLASP_F_ALLOW_UNIQUE_PREFIXES.
+ *
+ * \param args The arguments
+ * \param specifications The specifications. If NULL, those given in the
+ *   call to clasp_parseArguments() are used
+ * \param name The name, including its leading <code>"--"</code>
+ * \param cchName The number of characters in \c name
+ * \param candidates Array into which up to \c maxCandidates candidate
+ *   specifications are written. May be NULL if \c maxCandidates is 0
+ * \param maxCandidates The number of elements in \c candidates
+ *
+ * \return The total number of candidates, which may exceed
+ *   \c maxCandidates
+ *
+ * \pre NULL != args
+ * \pre NULL != name
+ */
+CLASP_CALL(size_t)
+clasp_findPrefixCandidates(
+    clasp_arguments_t const*        args
+,   clasp_specification_t const     specifications[]
+,   clasp_char_t const*             name
+,   size_t                          cchName
+,   clasp_specification_t const**   candidates
+,   size_t                          maxCandidates
+);
+
+/** Obtains "did you mean" suggestions for an unrecognised name - e.g.
+ * <code>"--verbose"</code> for <code>"--verbsoe"</code> - being those
+ * flags and options whose name (alias) or long name is within the given
+ * edit distance of it.
+ *
+ * Each flag/option is suggested at most once, by the closer of its names,
+ * and the suggestions are ordered by distance and then by their order in
+ * the specifications. Any value in \c name - e.g. <code>"=10"</code> in
+ * <code>"--widht=10"</code> - is ignored.
+ *
+ * Names whose lengths differ by more than the distance are rejected
+ * without comparison, and the remainder are compared by Myers'
+ * bit-parallel edit distance, so that suggestions may be sought from large
+ * (e.g. generated) specification arrays. No memory is allocated unless
+ * \c name is longer than the bits of an <code>unsigned long</code>.
+ *
+ * \param args The arguments. May be NULL if \c specifications is not
+ * \param specifications The specifications. If NULL, those given in the
+ *   call to clasp_parseArguments() are used
+ * \param name The unrecognised name, including its leading hyphen(s)
+ * \param cchName The number of characters in \c name
+ * \param maxDistance The greatest edit distance of a suggestion. If 0, a
+ *   third of the length of the name without its leading hyphens is used
+ * \param suggestions Array into which the best \c maxSuggestions
+ *   suggestions are written. May be NULL if \c maxSuggestions is 0
+ * \param maxSuggestions The number of elements in \c suggestions
+ *
+ * \return The total number of suggestions, which may exceed
+ *   \c maxSuggestions
+ *
+ * \pre NULL != args || NULL != specifications
+ * \pre NULL != name
+ */
+CLASP_CALL(size_t)
+clasp_findSuggestions(
+    clasp_arguments_t const*        args
+,   clasp_specification_t const     specifications[]
+,   clasp_char_t const*             name
+,   size_t                          cchName
+,   size_t                          maxDistance
+,   clasp_suggestion_t*             suggestions
+,   size_t                          maxSuggestions
+);
+
 /** Reports how many flags arguments were not used by the
  * application, and returns a pointer to the first unused flag
  * argument.
@@ -1078,11 +2505,26 @@ clasp_reportUnusedArguments(
  * \pre NULL != args
  * \pre NULL != usedArg
  */
+#ifndef CLASP_HEADER_ONLY
+
 CLASP_CALL(void)
 clasp_useArgument(
     clasp_arguments_t const*  args
 ,   clasp_argument_t const*   usedArg
 );
+#else /* ? !CLASP_HEADER_ONLY */
+
+CLASP_INLINE_CALL_(void)
+clasp_useArgument(
+    clasp_arguments_t const*  args
+,   clasp_argument_t const*   usedArg
+)
+{
+    ((void)args);
+
+    ((clasp_argument_t*)usedArg)->flags |= CLASP_ARG_F_USED_;
+}
+#endif /* !CLASP_HEADER_ONLY */
 
 /** Indicates whether the given argument is marked as used.
  *
@@ -1092,11 +2534,26 @@ clasp_useArgument(
  * \pre NULL != args
  * \pre NULL != usedArg
  */
+#ifndef CLASP_HEADER_ONLY
+
 CLASP_CALL(int)
 clasp_argumentIsUsed(
     clasp_arguments_t const*    args
 ,   clasp_argument_t const*     arg
 );
+#else /* ? !CLASP_HEADER_ONLY */
+
+CLASP_INLINE_CALL_(int)
+clasp_argumentIsUsed(
+    clasp_arguments_t const*    args
+,   clasp_argument_t const*     arg
+)
+{
+    ((void)args);
+
+    return 0 != (arg->flags & CLASP_ARG_F_USED_);
+}
+#endif /* !CLASP_HEADER_ONLY */
 
 /** Indicates whether a given set of command-line arguments contains the
  * given flag.
@@ -1222,6 +2679,7 @@ clasp_findFlagOrOption(
  *
  * \pre (NULL != args)
  */
+#ifndef CLASP_HEADER_ONLY
 
 CLASP_CALL(int)
 clasp_checkValue(
@@ -1231,6 +2689,44 @@ clasp_checkValue(
 ,   size_t*                     plen
 ,   clasp_argument_t const**    parg
 );
+#else /* ? !CLASP_HEADER_ONLY */
+
+CLASP_INLINE_CALL_(int)
+clasp_checkValue(
+    clasp_arguments_t const*    args
+,   size_t                      index
+,   clasp_char_t const**        pptr
+,   size_t*                     plen
+,   clasp_argument_t const**    parg
+)
+{
+    if (index < args->numValues)
+    {
+        clasp_argument_t const* const arg = &args->values[index];
+
+        if (NULL != pptr)
+        {
+            *pptr = arg->value.ptr;
+        }
+
+        if (NULL != plen)
+        {
+            *plen = arg->value.len;
+        }
+
+        if (NULL != parg)
+        {
+            *parg = arg;
+        }
+
+        clasp_useArgument(args, arg);
+
+        return 1;
+    }
+
+    return 0;
+}
+#endif /* !CLASP_HEADER_ONLY */
 
 
 #ifdef CLASP_DOCUMENTATION_SKIP_SECTION
@@ -1337,6 +2833,28 @@ clasp_valueIsTreatedHyphen(
  */
 #define CLASP_F_PRESERVE_ORIGINAL_ARGUMENT_ORDER            (0x00000400)
 
+/** \def CLASP_F_ALLOW_UNIQUE_PREFIXES
+ *
+ * \ingroup group__clasp__api_parsing
+ *
+ * clasp_parseArguments() flag that causes a long (double-hyphen) flag or
+ * option that does not match any specification to be accepted as an
+ * abbreviation - e.g. <code>"--verb"</code> for <code>"--verbose"</code> -
+ * if it is a prefix of exactly one of the long names in the
+ * specifications.
+ *
+ * An ambiguous prefix - e.g. <code>"--ver"</code> when both
+ * <code>"--verbose"</code> and <code>"--version"</code> are specified -
+ * remains unrecognised, and the ambiguity, along with all the candidates,
+ * is logged via the diagnostic context. The candidates may also be
+ * obtained via clasp_findPrefixCandidates().
+ *
+ * \note The abbreviation is available in the argument's
+ *   <code>givenName</code> member, and the full name in its
+ *   <code>resolvedName</code> member
+ */
+#define CLASP_F_ALLOW_UNIQUE_PREFIXES                       (0x00000800)
+
 
 /* /////////////////////////////////////////////////////////////////////////
  * usage API
@@ -1596,6 +3114,341 @@ clasp_showVersion(
 );
 
 
+/** Renders usage (aka help) information for the program - header and body
+ * - into a single buffer, according to the given parameters.
+ *
+ * \param args The arguments obtained from parsing the command-line. May not
+ *  be NULL;
+ * \param specifications The specifications used in parsing the
+ *  command-line. May be NULL, in which case it will be inferred from args;
+ * \param toolName The program name. May be NULL, in which case it will be
+ *  inferred from the process-name (via args);
+ * \param summary A string to stand as a summary line. May be NULL;
+ * \param copyright A string to stand as a copyright line. May be NULL;
+ * \param description A string to stand as a description line. May be
+ *  NULL;
+ * \param usage A string to stand as a usage line. May be NULL, and may
+ *  contain the string ":program:", as for clasp_showUsage();
+ * \param major The major version number;
+ * \param minor The minor version number;
+ * \param revision The patch/revision version number;
+ * \param flags Flags that moderate the behaviour of the function;
+ * \param consoleWidth The width, in characters, of the console;
+ * \param tabSize The size of tabs on the console. If less than 1 then <code>-tabSize</code> spaces are used instead of a tab character;
+ * \param blanksBetweenItems The number of blank lines to insert between each item;
+ * \param pbuffer Pointer to a variable that will receive a pointer to the
+ *  (nul-terminated) rendered text, which must be released by a call to
+ *  clasp_releaseUsageBuffer(). May not be NULL;
+ * \param pcchBuffer Pointer to a variable that will receive the length of
+ *  the rendered text. May be NULL;
+ *
+ * \retval 0 The operation completed successfully;
+ * \retval ENOMEM The memory for the rendered text could not be allocated;
+ *
+ * \note The memory for the rendered text is acquired via the diagnostic
+ *  context with which \c args was parsed
+ */
+CLASP_CALL(int)
+clasp_showUsageToBuffer(
+    clasp_arguments_t const*        args
+,   clasp_specification_t const     specifications[]
+,   clasp_char_t const*             toolName
+,   clasp_char_t const*             summary
+,   clasp_char_t const*             copyright
+,   clasp_char_t const*             description
+,   clasp_char_t const*             usage
+,   int                             major
+,   int                             minor
+,   int                             revision
+,   int                             flags
+,   int                             consoleWidth
+,   int                             tabSize
+,   int                             blanksBetweenItems
+,   clasp_char_t**                  pbuffer
+,   size_t*                         pcchBuffer
+);
+
+/** Releases a buffer obtained from clasp_showUsageToBuffer()
+ *
+ * \param args The arguments passed to clasp_showUsageToBuffer(). May not be
+ *  NULL;
+ * \param buffer The buffer to release. May be NULL;
+ */
+CLASP_CALL(void)
+clasp_releaseUsageBuffer(
+    clasp_arguments_t const*        args
+,   clasp_char_t*                   buffer
+);
+
+
+/** Writes the body part of the usage (aka help) information for the
+ * program, from the given compiled specifications, to a stream.
+ *
+ * If the given layout - \c flags, \c consoleWidth, \c tabSize,
+ * \c blanksBetweenItems - is that with which the compiled body was
+ * rendered, it is written directly; otherwise the body is rendered, as for
+ * clasp_showBody() with clasp_showBodyByFILE()
+ *
+ * \param args The arguments obtained from parsing the command-line. May not
+ *  be NULL;
+ * \param compiled The compiled specifications. May not be NULL;
+ * \param stm The stream - a <code>FILE*</code>, such as stdout. May not be
+ *  NULL;
+ *
+ * All other parameters are as for clasp_showBody().
+ *
+ * \retval 0 The operation completed successfully;
+ */
+CLASP_CALL(int)
+clasp_showBodyCompiled(
+    clasp_arguments_t const*                args
+,   clasp_compiled_specifications_t const*  compiled
+,   void*                                   stm
+,   int                                     flags
+,   int                                     consoleWidth
+,   int                                     tabSize
+,   int                                     blanksBetweenItems
+);
+
+
+/** Opaque type of a usage cache, which memoises rendered usage text,
+ * keyed by a fingerprint of the specifications, the usage information and
+ * the console width.
+ *
+ * \see clasp_createUsageCache
+ * \see clasp_showUsageCached
+ */
+struct clasp_usage_cache_t;
+#ifndef __cplusplus
+typedef struct clasp_usage_cache_t                          clasp_usage_cache_t;
+#endif /* !__cplusplus */
+
+/** Creates a usage cache
+ *
+ * \param ctxt Pointer to a diagnostic context, via which all memory for the
+ *  cache and its entries will be acquired. May be NULL, in which case the
+ *  stock context is used;
+ * \param cacheFile Name or path of a file in which the most recently
+ *  rendered usage text is persisted between processes. May be NULL, in
+ *  which case the cache is held only in memory. If it contains no
+ *  path-name separator, the file is located in <code>$XDG_CACHE_HOME</code>
+ *  (or, if that is not defined, in <code>$HOME/.cache</code>);
+ * \param pcache Pointer to a variable to receive the cache. May not be
+ *  NULL;
+ *
+ * \retval 0 The operation completed successfully;
+ * \retval ENOMEM The memory for the cache could not be allocated;
+ *
+ * \note On UNIX platforms, a persisted file is memory-mapped when it
+ *  matches the fingerprint of a requested rendering
+ *
+ * \note The file is written only on UNIX and Windows platforms, which
+ *  provide the means to write it via a process-unique temporary file
+ */
+CLASP_CALL(int)
+clasp_createUsageCache(
+    clasp_diagnostic_context_t const*   ctxt
+,   char const*                         cacheFile
+,   clasp_usage_cache_t**               pcache
+);
+
+/** Destroys a usage cache, releasing all its entries
+ *
+ * \param cache The cache. May be NULL;
+ */
+CLASP_CALL(void)
+clasp_destroyUsageCache(
+    clasp_usage_cache_t*    cache
+);
+
+/** Obtains usage (aka help) information for the program, according to
+ * the given parameters, from the given cache, rendering it (as for
+ * clasp_showUsageToBuffer()) and adding it to the cache only if there is
+ * not already an entry for the same specifications, information, and
+ * width
+ *
+ * \param cache The cache. May not be NULL;
+ * \param args The arguments obtained from parsing the command-line. May not
+ *  be NULL;
+ * \param stm The stream - a <code>FILE*</code>, such as stdout - to which
+ *  to write the usage information. May be NULL;
+ * \param ptext Pointer to a variable to receive a pointer to the
+ *  (nul-terminated) text, which is owned by the cache and remains valid
+ *  until it is destroyed. May be NULL;
+ * \param pcchText Pointer to a variable to receive the length of the
+ *  text. May be NULL;
+ *
+ * All other parameters are as for clasp_showUsage().
+ *
+ * \retval 0 The operation completed successfully;
+ * \retval ENOMEM The memory for the rendered text could not be allocated;
+ */
+CLASP_CALL(int)
+clasp_showUsageCached(
+    clasp_usage_cache_t*            cache
+,   clasp_arguments_t const*        args
+,   clasp_specification_t const     specifications[]
+,   clasp_char_t const*             toolName
+,   clasp_char_t const*             summary
+,   clasp_char_t const*             copyright
+,   clasp_char_t const*             description
+,   clasp_char_t const*             usage
+,   int                             major
+,   int                             minor
+,   int                             revision
+,   void*                           stm
+,   int                             flags
+,   int                             consoleWidth
+,   int                             tabSize
+,   int                             blanksBetweenItems
+,   clasp_char_t const**            ptext
+,   size_t*                         pcchText
+);
+
+
+/** \def CLASP_COMPLETION_ENVIRONMENT_VARIABLE
+ *
+ * The name of the environment variable that, when set - by the glue
+ * written by clasp_showCompletionScript() - to the index of the word being
+ * completed, requests that clasp_handleCompletionRequest() answer a
+ * completion query
+ */
+#define CLASP_COMPLETION_ENVIRONMENT_VARIABLE               "CLASP_COMPLETE"
+
+/** The shells for which clasp_showCompletionScript() writes glue
+ */
+enum clasp_completion_shell_t
+{
+        CLASP_COMPLETION_SHELL_BASH         =   1   /*!< bash, via <code>complete -F</code> */
+    ,   CLASP_COMPLETION_SHELL_ZSH          =   2   /*!< zsh, via <code>compdef</code> */
+};
+#ifndef __cplusplus
+typedef enum clasp_completion_shell_t clasp_completion_shell_t;
+#endif /* !__cplusplus */
+
+/** Obtains the candidates for completion of word \c wordIndex of a
+ * (partial) command-line, directly from the specifications, without
+ * parsing the command-line
+ *
+ * The candidates are drawn from a trie of the names (aliases) of the
+ * flags and options, their mapped arguments, and the members of the
+ * value-sets of the options. If the word is the value of a preceding
+ * option - <code>--format js</code>, or, as separated by bash,
+ * <code>--format = js</code> - the candidates are the members of its
+ * value-set; if it begins with a hyphen, they are the matching names, or,
+ * if it contains '=', the matching <code>name=value</code> words;
+ * otherwise - including any word following "--" - there are none, and the
+ * shell is expected to fall back to its default completion.
+ *
+ * \param flags Flags that control the parsing behaviour, as for
+ *  clasp_parseArguments()
+ * \param argc The number of words
+ * \param argv The words, of which argv[0] is the program
+ * \param wordIndex The index of the word to be completed, which must be
+ *  in the range [1, argc]; if it is argc, the word is empty
+ * \param specifications The specifications. May be NULL
+ * \param ctxt Pointer to a diagnostic context. May be NULL, in which case
+ *  the stock context is used
+ * \param pbuffer Pointer to a variable that will receive a pointer to the
+ *  (nul-terminated) candidates, each followed by a newline, which must be
+ *  released by a call to clasp_releaseCompletionBuffer(). May not be NULL
+ * \param pcchBuffer Pointer to a variable that will receive the length of
+ *  the candidates. May be NULL
+ * \param pnumCandidates Pointer to a variable that will receive the number
+ *  of candidates. May be NULL
+ *
+ * \retval 0 The operation completed successfully
+ * \retval EINVAL wordIndex is out of range
+ * \retval ENOMEM The memory for the trie or candidates could not be
+ *  allocated
+ */
+CLASP_CALL(int)
+clasp_completeArguments(
+    unsigned                            flags
+,   int                                 argc
+,   clasp_char_t*                       argv[]
+,   int                                 wordIndex
+,   clasp_specification_t const        specifications[]
+,   clasp_diagnostic_context_t const*   ctxt
+,   clasp_char_t**                      pbuffer
+,   size_t*                             pcchBuffer
+,   size_t*                             pnumCandidates
+);
+
+/** Releases a buffer obtained from clasp_completeArguments()
+ *
+ * \param ctxt The diagnostic context passed to clasp_completeArguments().
+ *  May be NULL
+ * \param buffer The buffer to release. May be NULL
+ */
+CLASP_CALL(void)
+clasp_releaseCompletionBuffer(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_char_t*                       buffer
+);
+
+/** Answers a completion query, if one is requested by the environment
+ *   variable CLASP_COMPLETION_ENVIRONMENT_VARIABLE
+ *
+ * Intended to be called at the start of <code>main()</code>, before the
+ * command-line is parsed:
+ *
+ * <pre>
+ *   if (clasp_handleCompletionRequest(0, argc, argv, specifications, NULL))
+ *   {
+ *     return EXIT_SUCCESS;
+ *   }
+ * </pre>
+ *
+ * \param flags Flags that control the parsing behaviour, as for
+ *  clasp_parseArguments()
+ * \param argc The <code>argc</code> argument passed to main()
+ * \param argv The <code>argv</code> argument passed to main()
+ * \param specifications The specifications. May be NULL
+ * \param ctxt Pointer to a diagnostic context. May be NULL, in which case
+ *  the stock context is used
+ *
+ * \retval 0 No completion is requested
+ * \retval !0 The candidates - as obtained from clasp_completeArguments()
+ *  - have been written, in a single write, to the standard output stream,
+ *  and the program should exit
+ */
+CLASP_CALL(int)
+clasp_handleCompletionRequest(
+    unsigned                            flags
+,   int                                 argc
+,   clasp_char_t*                       argv[]
+,   clasp_specification_t const        specifications[]
+,   clasp_diagnostic_context_t const*   ctxt
+);
+
+/** Writes shell glue that registers completion of the given program by
+ *   completion queries answered by clasp_handleCompletionRequest()
+ *
+ * \param programName The name of the program, as invoked. May not be NULL
+ * \param shell The shell, one of CLASP_COMPLETION_SHELL_BASH or
+ *  CLASP_COMPLETION_SHELL_ZSH
+ * \param stm The stream - a <code>FILE*</code>, such as stdout. May not be
+ *  NULL
+ * \param ctxt Pointer to a diagnostic context. May be NULL, in which case
+ *  the stock context is used
+ *
+ * \retval 0 The operation completed successfully
+ * \retval EINVAL The shell is not recognised
+ * \retval ENOMEM The memory for the script could not be allocated
+ *
+ * \note The glue is typically installed by, e.g., <code>eval "$(mytool
+ *  --completion=bash)"</code>
+ */
+CLASP_CALL(int)
+clasp_showCompletionScript(
+    clasp_char_t const*                 programName
+,   int                                 shell
+,   void*                               stm
+,   clasp_diagnostic_context_t const*   ctxt
+);
+
+
 /** Evaluates the number of specifications in the array
  *
  * \ingroup group__clasp__api_usage
@@ -1779,13 +3632,31 @@ namespace clasp
 #  include <clasp/internal/shim_macros.h>
 # endif /* CLASP_DOCUMENTATION_SKIP_SECTION */
 
-    typedef ::clasp_alias_t                 alias_t;
-    typedef ::clasp_argtype_t               argtype_t;
-    typedef ::clasp_argument_t              argument_t;
-    typedef ::clasp_arguments_t             arguments_t;
-    typedef ::clasp_diagnostic_context_t    diagnostic_context_t;
-    typedef ::clasp_slice_t                 slice_t;
-    typedef ::clasp_specification_t         specification_t;
+    typedef ::clasp_alias_t                     alias_t;
+    typedef ::clasp_alloc_op_t                  alloc_op_t;
+    typedef ::clasp_alloc_site_t                alloc_site_t;
+    typedef ::clasp_applet_t                    applet_t;
+    typedef ::clasp_argerr_t                    argerr_t;
+    typedef ::clasp_argtype_t                   argtype_t;
+    typedef ::clasp_argument_t                  argument_t;
+    typedef ::clasp_argument_error_t            argument_error_t;
+    typedef ::clasp_arguments_t                 arguments_t;
+    typedef ::clasp_batch_pool_t                batch_pool_t;
+    typedef ::clasp_batch_result_t              batch_result_t;
+    typedef ::clasp_compiled_specifications_t   compiled_specifications_t;
+    typedef ::clasp_completion_shell_t          completion_shell_t;
+    typedef ::clasp_diagnostic_context_t        diagnostic_context_t;
+    typedef ::clasp_parse_statistics_t          parse_statistics_t;
+    typedef ::clasp_short_flag_t                short_flag_t;
+    typedef ::clasp_slice_t                     slice_t;
+    typedef ::clasp_specification_t             specification_t;
+    typedef ::clasp_specification_index_t       specification_index_t;
+    typedef ::clasp_subcommand_t                subcommand_t;
+    typedef ::clasp_subcommand_results_t        subcommand_results_t;
+    typedef ::clasp_suggestion_t                suggestion_t;
+    typedef ::clasp_typed_value_t               typed_value_t;
+    typedef ::clasp_value_schema_t              value_schema_t;
+    typedef ::clasp_valuekind_t                 valuekind_t;
 
     inline
     int
@@ -4,7 +4,7 @@
  * Purpose: C++ layer for the CLASP library.
  *
  * Created: 31st July 2008
- * Updated: 11th March 2025
+ * Updated: 19th October 2026
  *
  * Home:    https://github.com/synesissoftware/CLASP/
  *
@@ -56,7 +56,7 @@
 # define CLASP_VER_CLASP_HPP_CLASP_MAJOR    3
 # define CLASP_VER_CLASP_HPP_CLASP_MINOR    1
 # define CLASP_VER_CLASP_HPP_CLASP_REVISION 1
-# define CLASP_VER_CLASP_HPP_CLASP_EDIT     70
+# define CLASP_VER_CLASP_HPP_CLASP_EDIT     72
 #endif /* !CLASP_DOCUMENTATION_SKIP_SECTION */
 
 
@@ -92,8 +92,15 @@
 # include <stlsoft/shims/access/string.hpp>
 #endif
 
+#include <limits>
 #include <stdexcept>
 #include <string>
+#include <vector>
+
+#include <errno.h>
+#include <locale.h>
+#include <math.h>
+#include <stdlib.h>
 
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -110,10 +117,13 @@ namespace clasp
 
 #if 0
 #elif 0 || \
+      __cplusplus >= 201103L || \
+      defined(_MSC_VER) || \
       defined(_WIN64) || \
-      defined(__LP64__) || \
+      (   defined(__GNUC__) && \
+          !defined(__STRICT_ANSI__)) || \
       0
-# define CLASP_HPP_INTERNAL_unsigned_OVERLOADS_
+# define CLASP_HPP_INTERNAL_long_long_OVERLOADS_
 #endif
 
 #if 0 || \
@@ -174,6 +184,11 @@ public: // construction
     argument_exception(class_type const&) = default;
 #endif
     virtual ~argument_exception() stlsoft_throw_0() = 0;
+protected:
+    argument_exception(message_string_type const& message, string_type const& optionName, message_string_type const& qualifier)
+        : parent_class_type(calc_message_(message, optionName).append(qualifier))
+        , optionName(optionName)
+    {}
 private:
     class_type& operator =(class_type const&);
 
@@ -283,11 +298,63 @@ class unrecognised_argument_exception
 public: // types
     typedef argument_exception                              parent_class_type;
     typedef unrecognised_argument_exception                 class_type;
+    typedef std::vector<string_type>                        suggestions_type;
 
 public: // construction
     explicit unrecognised_argument_exception(message_string_type const& message, string_type const& optionName)
         : parent_class_type(message, optionName)
     {}
+    /// Constructs an instance whose message concludes with the given
+    /// "did you mean" suggestions, if any
+    unrecognised_argument_exception(message_string_type const& message, string_type const& optionName, suggestions_type const& suggestions)
+        : parent_class_type(message, optionName, calc_qualifier_(suggestions))
+        , suggestions(suggestions)
+    {}
+
+public:
+    /// The names suggested for the (first) unrecognised argument, which may
+    /// be empty
+    const suggestions_type  suggestions;
+
+private:
+    static
+    message_string_type
+    calc_qualifier_(
+        suggestions_type const& suggestions
+    )
+    {
+        message_string_type q;
+
+        for (size_t i = 0; i != suggestions.size(); ++i)
+        {
+            if (0 == i)
+            {
+                q.append("; did you mean ");
+            }
+            else if (suggestions.size() == i + 1)
+            {
+                q.append(" or ");
+            }
+            else
+            {
+                q.append(", ");
+            }
+#ifdef CLASP_USE_WIDE_STRINGS
+
+            q.append(stlsoft::w2m(suggestions[i]));
+#else /* ? CLASP_USE_WIDE_STRINGS */
+
+            q.append(suggestions[i]);
+#endif /* CLASP_USE_WIDE_STRINGS */
+        }
+
+        if (!q.empty())
+        {
+            q.append(1u, '?');
+        }
+
+        return q;
+    }
 };
 
 
@@ -313,124 +380,417 @@ argument_exception::~argument_exception() stlsoft_throw_0() /* = 0 */
 
 namespace ximpl
 {
-    /* The atoi_helper and atol_helper classes were removed from
-     * STLSoft 1.12+, as they are superceded by the flecxx project's
-     * facilities; but rather than introduce another dependency the
-     * original classes are borrowed into CLASP here with permission
-     * (which was easy to get, since I am the author of both).
+    /* Numeric conversion
+     *
+     * Option values are converted directly from their slices - so they do
+     * not rely on NUL-termination - without reference to the current
+     * locale, and with strict checking of both format and range:
+     *
+     * - integers are decimal or, with a leading "0x" / "0X", hexadecimal,
+     *   with an optional sign, and must fit the target type;
+     * - real numbers are decimal, with optional fraction and exponent, or
+     *   one of "inf", "infinity" or "nan" (case-insensitive).
+     *
+     * Real numbers that are exactly representable from no more than 15
+     * significant digits and a power of ten no greater than 22 in magnitude
+     * (the vast majority of those given on a command-line) are computed
+     * directly, and correctly rounded; all others are passed to strtod(),
+     * with the decimal point translated to that of the current locale.
      */
 
-    struct atoi_helper
+    enum conversion_status_
     {
-        static int call(char const* s)
+        conversion_succeeded_
+    ,   conversion_invalidFormat_
+    ,   conversion_negativeValue_
+    ,   conversion_outOfRange_
+    };
+
+    inline
+    int
+    digit_value_(
+        clasp_char_t    ch
+    ,   int             base
+    )
+    {
+        int v;
+
+        if (ch >= '0' && ch <= '9')
+        {
+            v = static_cast<int>(ch - '0');
+        }
+        else if (ch >= 'a' && ch <= 'f')
         {
-            return ::atoi(s);
+            v = 10 + static_cast<int>(ch - 'a');
         }
-        static int call(wchar_t const* s)
+        else if (ch >= 'A' && ch <= 'F')
         {
-#ifdef STLSOFT_STD_CSTDLIB_WTOI_SUPPORTED
+            v = 10 + static_cast<int>(ch - 'A');
+        }
+        else
+        {
+            return -1;
+        }
 
-            return ::_wtoi(s);
-#else /* ? STLSOFT_STD_CSTDLIB_WTOI_SUPPORTED */
+        return (v < base) ? v : -1;
+    }
 
-            return static_cast<int>(::wcstol(s, NULL, 0));
-#endif /* STLSOFT_STD_CSTDLIB_WTOI_SUPPORTED */
+    template <typename I>
+    struct integer_conversion_traits_
+    {
+    public:
+        static conversion_status_ convert(clasp_slice_t const& str, I* result)
+        {
+            typedef std::numeric_limits<I>                  limits_t;
+
+            clasp_char_t const*         p       =   str.ptr;
+            clasp_char_t const* const   e       =   p + str.len;
+            bool                        isNeg   =   false;
+            int                         base    =   10;
+
+            if (p != e)
+            {
+                if ('+' == *p)
+                {
+                    ++p;
+                }
+                else
+                if ('-' == *p)
+                {
+                    if (!limits_t::is_signed)
+                    {
+                        return conversion_negativeValue_;
+                    }
+
+                    isNeg = true;
+                    ++p;
+                }
+            }
+
+            if (e - p > 2 &&
+                '0' == p[0] &&
+                ('x' == p[1] || 'X' == p[1]))
+            {
+                base = 16;
+                p += 2;
+            }
+
+            if (p == e)
+            {
+                return conversion_invalidFormat_;
+            }
+
+            // Accumulation is towards the limit in the direction of the
+            // sign, so that the most negative value is representable
+
+            I const     radix   =   static_cast<I>(base);
+            I const     limit   =   isNeg ? limits_t::min() : limits_t::max();
+            I const     cutoff  =   static_cast<I>(limit / radix);
+            int const   cutlim  =   isNeg ? -static_cast<int>(limit % radix) : static_cast<int>(limit % radix);
+            I           value   =   0;
+
+            for (; p != e; ++p)
+            {
+                int const d = digit_value_(*p, base);
+
+                if (d < 0)
+                {
+                    return conversion_invalidFormat_;
+                }
+
+                if (isNeg)
+                {
+                    if (value < cutoff ||
+                        (value == cutoff && d > cutlim))
+                    {
+                        return conversion_outOfRange_;
+                    }
+
+                    value = static_cast<I>(value * radix - static_cast<I>(d));
+                }
+                else
+                {
+                    if (value > cutoff ||
+                        (value == cutoff && d > cutlim))
+                    {
+                        return conversion_outOfRange_;
+                    }
+
+                    value = static_cast<I>(value * radix + static_cast<I>(d));
+                }
+            }
+
+            *result = value;
+
+            return conversion_succeeded_;
         }
     };
 
-    struct atol_helper
+    inline
+    bool
+    matches_word_ci_(
+        clasp_char_t const* p
+    ,   clasp_char_t const* e
+    ,   char const*         word
+    )
     {
-        static long call(char const* s)
+        for (; '\0' != *word; ++p, ++word)
         {
-            return ::atol(s);
-        }
-        static long call(wchar_t const* s)
-        {
-#ifdef STLSOFT_STD_CSTDLIB_WTOL_SUPPORTED
+            if (p == e)
+            {
+                return false;
+            }
 
-            return ::_wtol(s);
-#else /* ? STLSOFT_STD_CSTDLIB_WTOL_SUPPORTED */
+            clasp_char_t const ch = (*p >= 'A' && *p <= 'Z') ? static_cast<clasp_char_t>(*p + ('a' - 'A')) : *p;
 
-            return ::wcstol(s, NULL, 0);
-#endif /* STLSOFT_STD_CSTDLIB_WTOL_SUPPORTED */
+            if (ch != *word)
+            {
+                return false;
+            }
         }
-    };
 
-    struct atoul_helper
+        return p == e;
+    }
+
+    inline
+    conversion_status_
+    parse_real_(
+        clasp_slice_t const&    str
+    ,   double*                 result
+    )
     {
-        static unsigned long call(char const* s)
+        static double const s_powersOf10[] =
         {
-            return ::strtoul(s, NULL, 0);
-        }
-        static long call(wchar_t const* s)
+            1e0,    1e1,    1e2,    1e3,    1e4,    1e5,    1e6,    1e7
+        ,   1e8,    1e9,    1e10,   1e11,   1e12,   1e13,   1e14,   1e15
+        ,   1e16,   1e17,   1e18,   1e19,   1e20,   1e21,   1e22
+        };
+        int const maxExactPower = static_cast<int>(STLSOFT_NUM_ELEMENTS(s_powersOf10)) - 1;
+
+        clasp_char_t const*         p               =   str.ptr;
+        clasp_char_t const* const   e               =   p + str.len;
+        bool                        isNeg           =   false;
+        double                      mantissa        =   0.0;
+        int                         numSignificant  =   0;
+        int                         numDigits       =   0;
+        long                        exp10           =   0;
+        bool                        isExact         =   true;
+
+        if (p != e &&
+            ('+' == *p || '-' == *p))
         {
-            return ::wcstoul(s, NULL, 0);
+            isNeg = ('-' == *p);
+            ++p;
         }
-    };
 
-    struct strtod_helper
-    {
-        static double call(char const* s, char** endptr)
+        if (matches_word_ci_(p, e, "inf") ||
+            matches_word_ci_(p, e, "infinity"))
         {
-            return ::strtod(s, endptr);
+            *result = isNeg ? -std::numeric_limits<double>::infinity() : std::numeric_limits<double>::infinity();
+
+            return conversion_succeeded_;
         }
-        static double call(wchar_t const* s, wchar_t** endptr)
+        if (matches_word_ci_(p, e, "nan"))
         {
-            return ::wcstod(s, endptr);
+            *result = std::numeric_limits<double>::quiet_NaN();
+
+            return conversion_succeeded_;
         }
-    };
 
+        // Up to 15 significant digits are accumulated exactly; any further
+        // digits are dropped, with the exponent adjusted to suit, and make
+        // the value inexact only if they are non-zero
 
+        { for (bool inFraction = false; p != e; ++p)
+        {
+            if ('.' == *p &&
+                !inFraction)
+            {
+                inFraction = true;
 
+                continue;
+            }
 
-    template <typename I>
-    struct integer_conversion_traits_;
+            if (*p < '0' ||
+                *p > '9')
+            {
+                break;
+            }
 
-    STLSOFT_TEMPLATE_SPECIALISATION
-    struct integer_conversion_traits_<int>
-    {
-    public:
-        static int convert(clasp_char_t const* str)
+            int const d = static_cast<int>(*p - '0');
+
+            ++numDigits;
+
+            if (numSignificant < 15)
+            {
+                mantissa = mantissa * 10 + d;
+
+                if (0 != numSignificant ||
+                    0 != d)
+                {
+                    ++numSignificant;
+                }
+
+                if (inFraction)
+                {
+                    --exp10;
+                }
+            }
+            else
+            {
+                if (0 != d)
+                {
+                    isExact = false;
+                }
+
+                if (!inFraction)
+                {
+                    ++exp10;
+                }
+            }
+        }}
+
+        if (0 == numDigits)
         {
-            return atoi_helper::call(str);
+            return conversion_invalidFormat_;
         }
-    };
 
-#ifdef CLASP_HPP_INTERNAL_unsigned_OVERLOADS_
+        if (p != e &&
+            ('e' == *p || 'E' == *p))
+        {
+            bool    expIsNeg    =   false;
+            long    expValue    =   0;
+
+            ++p;
 
-    STLSOFT_TEMPLATE_SPECIALISATION
-    struct integer_conversion_traits_<unsigned>
-    {
-    public:
-        static unsigned convert(clasp_char_t const* str)
+            if (p != e &&
+                ('+' == *p || '-' == *p))
+            {
+                expIsNeg = ('-' == *p);
+                ++p;
+            }
+
+            if (p == e)
+            {
+                return conversion_invalidFormat_;
+            }
+
+            for (; p != e && *p >= '0' && *p <= '9'; ++p)
+            {
+                if (expValue < 100000)
+                {
+                    expValue = expValue * 10 + static_cast<long>(*p - '0');
+                }
+            }
+
+            exp10 += expIsNeg ? -expValue : expValue;
+        }
+
+        if (p != e)
         {
-            return atol_helper::call(str);
+            return conversion_invalidFormat_;
         }
-    };
-#endif
 
-    STLSOFT_TEMPLATE_SPECIALISATION
-    struct integer_conversion_traits_<long>
-    {
-    public:
-        static int convert(clasp_char_t const* str)
+        if (isExact)
         {
-            return atol_helper::call(str);
+            if (0.0 == mantissa)
+            {
+                *result = isNeg ? -0.0 : 0.0;
+
+                return conversion_succeeded_;
+            }
+            if (exp10 >= 0 &&
+                exp10 <= maxExactPower)
+            {
+                mantissa *= s_powersOf10[exp10];
+
+                *result = isNeg ? -mantissa : mantissa;
+
+                return conversion_succeeded_;
+            }
+            if (exp10 < 0 &&
+                exp10 >= -maxExactPower)
+            {
+                mantissa /= s_powersOf10[-exp10];
+
+                *result = isNeg ? -mantissa : mantissa;
+
+                return conversion_succeeded_;
+            }
         }
-    };
 
-    STLSOFT_TEMPLATE_SPECIALISATION
-    struct integer_conversion_traits_<size_t>
+        // The (validated) value is narrowed and passed to strtod(), with
+        // the decimal point translated to that of the current locale
+
+        char const* const   decimalPoint    =   ::localeconv()->decimal_point;
+        std::string         s;
+
+        s.reserve(str.len + 4);
+
+        { for (size_t i = 0; i != str.len; ++i)
+        {
+            if ('.' == str.ptr[i])
+            {
+                s.append(decimalPoint);
+            }
+            else
+            {
+                s.append(1u, static_cast<char>(str.ptr[i]));
+            }
+        }}
+
+        int const   savedErrno  =   errno;
+        double      d;
+
+        errno = 0;
+
+        d = ::strtod(s.c_str(), NULL);
+
+        if (ERANGE == errno &&
+            (HUGE_VAL == d || -HUGE_VAL == d))
+        {
+            errno = savedErrno;
+
+            return conversion_outOfRange_;
+        }
+
+        errno = savedErrno;
+
+        *result = d;
+
+        return conversion_succeeded_;
+    }
+
+    template <typename R>
+    struct real_conversion_traits_
     {
     public:
-        static size_t convert(clasp_char_t const* str)
+        static conversion_status_ convert(clasp_slice_t const& str, R* result)
         {
-            return atoul_helper::call(str);
+            typedef std::numeric_limits<R>                  limits_t;
+
+            double                      d;
+            conversion_status_ const    status  =   parse_real_(str, &d);
+
+            if (conversion_succeeded_ != status)
+            {
+                return status;
+            }
+
+            if ((d > limits_t::max() || d < -limits_t::max()) &&
+                d != std::numeric_limits<double>::infinity() &&
+                d != -std::numeric_limits<double>::infinity())
+            {
+                return conversion_outOfRange_;
+            }
+
+            *result = static_cast<R>(d);
+
+            return conversion_succeeded_;
         }
     };
 
 
-
     struct boolean_conversion_traits_
     {
         static bool convert(clasp_slice_t const& str, bool* wasStrictlyCorrect = NULL)
@@ -636,25 +996,33 @@ namespace ximpl
         throw invalid_option_value_exception(message, optionName);
     }
 
-    template <int N_allowNegatives>
     inline
     void
-    throw_invalid_option_value_exception_if_(
-        char const*         message
+    throw_if_conversion_failed_(
+        conversion_status_  status
+    ,   char const*         invalidFormatMessage
     ,   clasp_char_t const* optionName
     )
     {
-        throw_invalid_option_value_exception_(message, optionName);
-    }
+        switch (status)
+        {
+        case conversion_succeeded_:
 
-    template <>
-    inline
-    void
-    throw_invalid_option_value_exception_if_<0>(
-        char const*         /*message*/
-    ,   clasp_char_t const* /*optionName*/
-    )
-    {}
+            break;
+        case conversion_negativeValue_:
+
+            throw_invalid_option_value_exception_("value may not be negative for option", optionName);
+            break;
+        case conversion_outOfRange_:
+
+            throw_invalid_option_value_exception_("value is out of range for option", optionName);
+            break;
+        default:
+
+            throw_invalid_option_value_exception_(invalidFormatMessage, optionName);
+            break;
+        }
+    }
 
     template <typename I>
     bool check_option_integer_(
@@ -681,32 +1049,9 @@ namespace ximpl
             {
                 clasp_useArgument(args, &arg);
 
-                switch (arg.value.ptr[0])
-                {
-                case '-':
+                throw_if_conversion_failed_(integer_conversion_traits_<I>::convert(arg.value, result), "value is not an integer for option", optionName);
 
-                    throw_invalid_option_value_exception_if_<0 == stlsoft::is_signed_type<I>::value>("value may not be negative for option", optionName);
-                    break;
-                case '0':
-                case '1':
-                case '2':
-                case '3':
-                case '4':
-                case '5':
-                case '6':
-                case '7':
-                case '8':
-                case '9':
-                case '+':
-
-                    *result = integer_conversion_traits_<I>::convert(arg.value.ptr);
-
-                    return true;
-                default:
-
-                    throw_invalid_option_value_exception_("value is not an integer for option", optionName);
-                    break;
-                }
+                return true;
             }
         }}
 
@@ -740,32 +1085,9 @@ namespace ximpl
                 }
                 else
                 {
-                    switch (arg.value.ptr[0])
-                    {
-                    case '-':
+                    throw_if_conversion_failed_(integer_conversion_traits_<I>::convert(arg.value, result), "value is not an integer for option", optionName);
 
-                        throw_invalid_option_value_exception_if_<0 == stlsoft::is_signed_type<I>::value>("value may not be negative for option", optionName);
-                        break;
-                    case '0':
-                    case '1':
-                    case '2':
-                    case '3':
-                    case '4':
-                    case '5':
-                    case '6':
-                    case '7':
-                    case '8':
-                    case '9':
-                    case '+':
-
-                        *result = integer_conversion_traits_<I>::convert(arg.value.ptr);
-
-                        return;
-                    default:
-
-                        throw_invalid_option_value_exception_("value is not an integer for option", optionName);
-                        break;
-                    }
+                    return;
                 }
             }
         }}
@@ -773,15 +1095,15 @@ namespace ximpl
         throw_missing_option_exception_(optionName, missingMessage);
     }
 
-    inline
+    template <typename R>
     bool
     check_option_real_(
         clasp_arguments_t const*    args
     ,   bool                        ignoreUsed
     ,   clasp_char_t const*         optionName
     ,   size_t                      optionNameLen
-    ,   double*                     result
-    ,   double const&               defaultValue
+    ,   R*                          result
+    ,   R const&                    defaultValue
     )
     {
         { for (size_t i = 0; i != args->numOptions; ++i)
@@ -805,16 +1127,7 @@ namespace ximpl
                 }
                 else
                 {
-                    clasp_char_t*   endptr;
-                    double          res = strtod_helper::call(arg.value.ptr, &endptr);
-
-                    if (NULL != endptr &&
-                        endptr != arg.value.ptr + arg.value.len)
-                    {
-                        throw_invalid_option_value_exception_("value is not a real number for option", optionName);
-                    }
-
-                    *result = res;
+                    throw_if_conversion_failed_(real_conversion_traits_<R>::convert(arg.value, result), "value is not a real number for option", optionName);
 
                     return true;
                 }
@@ -826,13 +1139,13 @@ namespace ximpl
         return false;
     }
 
-    inline
+    template <typename R>
     void
     require_option_real_(
         clasp_arguments_t const*    args
     ,   clasp_char_t const*         optionName
     ,   size_t                      optionNameLen
-    ,   double*                     result
+    ,   R*                          result
     ,   char const*                 missingMessage
     )
     {
@@ -851,16 +1164,7 @@ namespace ximpl
                 }
                 else
                 {
-                    clasp_char_t*   endptr;
-                    double          res = strtod_helper::call(arg.value.ptr, &endptr);
-
-                    if (NULL != endptr &&
-                        endptr != arg.value.ptr + arg.value.len)
-                    {
-                        throw_invalid_option_value_exception_("value is not a real number for option", optionName);
-                    }
-
-                    *result = res;
+                    throw_if_conversion_failed_(real_conversion_traits_<R>::convert(arg.value, result), "value is not a real number for option", optionName);
 
                     return;
                 }
@@ -1458,6 +1762,7 @@ namespace ximpl
         throw_missing_option_exception_(optionName, missingMessage);
     }
 
+    template <typename I>
     inline
     void
     require_option_dispatch_(
@@ -1465,15 +1770,13 @@ namespace ximpl
     ,   clasp_arguments_t const*    args
     ,   clasp_char_t const*         optionName
     ,   size_t                      optionNameLen
-    ,   int*                        result
+    ,   I*                          result
     ,   char const*                 missingMessage
     )
     {
         ::clasp::ximpl::require_option_integer_(args, optionName, optionNameLen, result, missingMessage);
     }
 
-#ifdef CLASP_HPP_INTERNAL_unsigned_OVERLOADS_
-
     inline
     void
     require_option_dispatch_(
@@ -1481,26 +1784,11 @@ namespace ximpl
     ,   clasp_arguments_t const*    args
     ,   clasp_char_t const*         optionName
     ,   size_t                      optionNameLen
-    ,   unsigned*                   result
-    ,   char const*                 missingMessage
-    )
-    {
-        ::clasp::ximpl::require_option_integer_(args, optionName, optionNameLen, result, missingMessage);
-    }
-#endif
-
-    inline
-    void
-        require_option_dispatch_(
-        ::stlsoft::yes_type
-    ,   clasp_arguments_t const*    args
-    ,   clasp_char_t const*         optionName
-    ,   size_t                      optionNameLen
-    ,   long*                       result
+    ,   bool*                       result
     ,   char const*                 missingMessage
     )
     {
-        ::clasp::ximpl::require_option_integer_(args, optionName, optionNameLen, result, missingMessage);
+        ::clasp::ximpl::require_option_boolean_(args, optionName, optionNameLen, result, missingMessage);
     }
 
     inline
@@ -1510,11 +1798,11 @@ namespace ximpl
     ,   clasp_arguments_t const*    args
     ,   clasp_char_t const*         optionName
     ,   size_t                      optionNameLen
-    ,   size_t*                     result
+    ,   float*                      result
     ,   char const*                 missingMessage
     )
     {
-        ::clasp::ximpl::require_option_integer_(args, optionName, optionNameLen, result, missingMessage);
+        ::clasp::ximpl::require_option_real_(args, optionName, optionNameLen, result, missingMessage);
     }
 
     inline
@@ -1707,9 +1995,151 @@ namespace ximpl
 #endif /* !CLASP_DOCUMENTATION_SKIP_SECTION */
 
 
-/* /////////////////////////////////////////////////////////////////////////
- * API functions
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+/** Checks whether the given option exists, and elicits its value if so; if
+ * not, sets the result to be the given default value
+ *
+ * \param args Non-mutating pointer to the arguments structure, obtained
+ *   from call to parseArguments() / clasp_parseArguments(). May not be NULL
+ * \param optionName Name of the option. Must be of a type which may be
+ *   interpreted as a string. May not be NULL or empty
+ * \param result Pointer to a variable into which to write the result, if
+ *   found, or the default value, if not. May not be NULL
+ * \param defaultValue The default value to be written into
+ *   <code>*result</code> if the named option does not exist
+ *
+ * \pre (NULL != args)
+ * \pre (NULL != result)
+ */
+template <typename S>
+bool
+check_option(
+    clasp_arguments_t const*    args
+,   S const&                    optionName
+,   short*                      result
+,   short                       defaultValue
+)
+{
+    CLASP_DECLARE_c_str_datalen_PAIR_();
+
+    return ::clasp::ximpl::check_option_integer_(
+        args
+    ,   false
+    ,   CLASP_INVOKE_c_str_data_(optionName), CLASP_INVOKE_c_str_len_(optionName)
+    ,   result
+    ,   defaultValue
+    );
+}
+
+/** Checks whether the given option exists in one of the as-yet unused
+ * arguments, and elicits its value if so; if not, sets the result to be the
+ * given default value
+ *
+ * \param args Non-mutating pointer to the arguments structure, obtained
+ *   from call to parseArguments() / clasp_parseArguments(). May not be NULL
+ * \param optionName Name of the option. Must be of a type which may be
+ *   interpreted as a string. May not be NULL or empty
+ * \param result Pointer to a variable into which to write the result, if
+ *   found, or the default value, if not. May not be NULL
+ * \param defaultValue The default value to be written into
+ *   <code>*result</code> if the named option does not exist
+ *
+ * \pre (NULL != args)
+ * \pre (NULL != result)
+ */
+template <typename S>
+bool
+check_next_option(
+    clasp_arguments_t const*    args
+,   S const&                    optionName
+,   short*                      result
+,   short                       defaultValue
+)
+{
+    CLASP_DECLARE_c_str_datalen_PAIR_();
+
+    return ::clasp::ximpl::check_option_integer_(
+        args
+    ,   true
+    ,   CLASP_INVOKE_c_str_data_(optionName), CLASP_INVOKE_c_str_len_(optionName)
+    ,   result
+    ,   defaultValue
+    );
+}
+
+/** Checks whether the given option exists, and elicits its value if so; if
+ * not, sets the result to be the given default value
+ *
+ * \param args Non-mutating pointer to the arguments structure, obtained
+ *   from call to parseArguments() / clasp_parseArguments(). May not be NULL
+ * \param optionName Name of the option. Must be of a type which may be
+ *   interpreted as a string. May not be NULL or empty
+ * \param result Pointer to a variable into which to write the result, if
+ *   found, or the default value, if not. May not be NULL
+ * \param defaultValue The default value to be written into
+ *   <code>*result</code> if the named option does not exist
+ *
+ * \pre (NULL != args)
+ * \pre (NULL != result)
+ */
+template <typename S>
+bool
+check_option(
+    clasp_arguments_t const*    args
+,   S const&                    optionName
+,   unsigned short*             result
+,   unsigned short              defaultValue
+)
+{
+    CLASP_DECLARE_c_str_datalen_PAIR_();
+
+    return ::clasp::ximpl::check_option_integer_(
+        args
+    ,   false
+    ,   CLASP_INVOKE_c_str_data_(optionName), CLASP_INVOKE_c_str_len_(optionName)
+    ,   result
+    ,   defaultValue
+    );
+}
+
+/** Checks whether the given option exists in one of the as-yet unused
+ * arguments, and elicits its value if so; if not, sets the result to be the
+ * given default value
+ *
+ * \param args Non-mutating pointer to the arguments structure, obtained
+ *   from call to parseArguments() / clasp_parseArguments(). May not be NULL
+ * \param optionName Name of the option. Must be of a type which may be
+ *   interpreted as a string. May not be NULL or empty
+ * \param result Pointer to a variable into which to write the result, if
+ *   found, or the default value, if not. May not be NULL
+ * \param defaultValue The default value to be written into
+ *   <code>*result</code> if the named option does not exist
+ *
+ * \pre (NULL != args)
+ * \pre (NULL != result)
  */
+template <typename S>
+bool
+check_next_option(
+    clasp_arguments_t const*    args
+,   S const&                    optionName
+,   unsigned short*             result
+,   unsigned short              defaultValue
+)
+{
+    CLASP_DECLARE_c_str_datalen_PAIR_();
+
+    return ::clasp::ximpl::check_option_integer_(
+        args
+    ,   true
+    ,   CLASP_INVOKE_c_str_data_(optionName), CLASP_INVOKE_c_str_len_(optionName)
+    ,   result
+    ,   defaultValue
+    );
+}
 
 /** Checks whether the given option exists, and elicits its value if so; if
  * not, sets the result to be the given default value
@@ -1782,8 +2212,6 @@ check_next_option(
     );
 }
 
-#ifdef CLASP_HPP_INTERNAL_unsigned_OVERLOADS_
-
 /** Checks whether the given option exists, and elicits its value if so; if
  * not, sets the result to be the given default value
  *
@@ -1808,8 +2236,6 @@ check_option(
 ,   unsigned                    defaultValue
 )
 {
-    STLSOFT_MESSAGE_STATIC_ASSERT(sizeof(unsigned) != sizeof(std::size_t), "cannot overload when unsigned types same size");
-
     CLASP_DECLARE_c_str_datalen_PAIR_();
 
     return ::clasp::ximpl::check_option_integer_(
@@ -1856,7 +2282,6 @@ check_next_option(
     ,   defaultValue
     );
 }
-#endif
 
 /** Checks whether the given option exists, and elicits its value if so; if
  * not, sets the result to be the given default value
@@ -1949,8 +2374,152 @@ bool
 check_option(
     clasp_arguments_t const*    args
 ,   S const&                    optionName
-,   size_t*                     result
-,   size_t                      defaultValue
+,   unsigned long*              result
+,   unsigned long               defaultValue
+)
+{
+    CLASP_DECLARE_c_str_datalen_PAIR_();
+
+    return ::clasp::ximpl::check_option_integer_(
+        args
+    ,   false
+    ,   CLASP_INVOKE_c_str_data_(optionName), CLASP_INVOKE_c_str_len_(optionName)
+    ,   result
+    ,   defaultValue
+    );
+}
+
+/** Checks whether the given option exists in one of the as-yet unused
+ * arguments, and elicits its value if so; if not, sets the result to be the
+ * given default value
+ *
+ * \param args Non-mutating pointer to the arguments structure, obtained
+ *   from call to parseArguments() / clasp_parseArguments(). May not be NULL
+ * \param optionName Name of the option. Must be of a type which may be
+ *   interpreted as a string. May not be NULL or empty
+ * \param result Pointer to a variable into which to write the result, if
+ *   found, or the default value, if not. May not be NULL
+ * \param defaultValue The default value to be written into
+ *   <code>*result</code> if the named option does not exist
+ *
+ * \pre (NULL != args)
+ * \pre (NULL != result)
+ */
+template <typename S>
+bool
+check_next_option(
+    clasp_arguments_t const*    args
+,   S const&                    optionName
+,   unsigned long*              result
+,   unsigned long               defaultValue
+)
+{
+    CLASP_DECLARE_c_str_datalen_PAIR_();
+
+    return ::clasp::ximpl::check_option_integer_(
+        args
+    ,   true
+    ,   CLASP_INVOKE_c_str_data_(optionName), CLASP_INVOKE_c_str_len_(optionName)
+    ,   result
+    ,   defaultValue
+    );
+}
+
+#ifdef CLASP_HPP_INTERNAL_long_long_OVERLOADS_
+
+/** Checks whether the given option exists, and elicits its value if so; if
+ * not, sets the result to be the given default value
+ *
+ * \param args Non-mutating pointer to the arguments structure, obtained
+ *   from call to parseArguments() / clasp_parseArguments(). May not be NULL
+ * \param optionName Name of the option. Must be of a type which may be
+ *   interpreted as a string. May not be NULL or empty
+ * \param result Pointer to a variable into which to write the result, if
+ *   found, or the default value, if not. May not be NULL
+ * \param defaultValue The default value to be written into
+ *   <code>*result</code> if the named option does not exist
+ *
+ * \pre (NULL != args)
+ * \pre (NULL != result)
+ */
+template <typename S>
+bool
+check_option(
+    clasp_arguments_t const*    args
+,   S const&                    optionName
+,   long long*                  result
+,   long long                   defaultValue
+)
+{
+    CLASP_DECLARE_c_str_datalen_PAIR_();
+
+    return ::clasp::ximpl::check_option_integer_(
+        args
+    ,   false
+    ,   CLASP_INVOKE_c_str_data_(optionName), CLASP_INVOKE_c_str_len_(optionName)
+    ,   result
+    ,   defaultValue
+    );
+}
+
+/** Checks whether the given option exists in one of the as-yet unused
+ * arguments, and elicits its value if so; if not, sets the result to be the
+ * given default value
+ *
+ * \param args Non-mutating pointer to the arguments structure, obtained
+ *   from call to parseArguments() / clasp_parseArguments(). May not be NULL
+ * \param optionName Name of the option. Must be of a type which may be
+ *   interpreted as a string. May not be NULL or empty
+ * \param result Pointer to a variable into which to write the result, if
+ *   found, or the default value, if not. May not be NULL
+ * \param defaultValue The default value to be written into
+ *   <code>*result</code> if the named option does not exist
+ *
+ * \pre (NULL != args)
+ * \pre (NULL != result)
+ */
+template <typename S>
+bool
+check_next_option(
+    clasp_arguments_t const*    args
+,   S const&                    optionName
+,   long long*                  result
+,   long long                   defaultValue
+)
+{
+    CLASP_DECLARE_c_str_datalen_PAIR_();
+
+    return ::clasp::ximpl::check_option_integer_(
+        args
+    ,   true
+    ,   CLASP_INVOKE_c_str_data_(optionName), CLASP_INVOKE_c_str_len_(optionName)
+    ,   result
+    ,   defaultValue
+    );
+}
+
+/** Checks whether the given option exists, and elicits its value if so; if
+ * not, sets the result to be the given default value
+ *
+ * \param args Non-mutating pointer to the arguments structure, obtained
+ *   from call to parseArguments() / clasp_parseArguments(). May not be NULL
+ * \param optionName Name of the option. Must be of a type which may be
+ *   interpreted as a string. May not be NULL or empty
+ * \param result Pointer to a variable into which to write the result, if
+ *   found, or the default value, if not. May not be NULL
+ * \param defaultValue The default value to be written into
+ *   <code>*result</code> if the named option does not exist
+ *
+ * \pre (NULL != args)
+ * \pre (NULL != result)
+ */
+template <typename S>
+bool
+check_option(
+    clasp_arguments_t const*    args
+,   S const&                    optionName
+,   unsigned long long*         result
+,   unsigned long long          defaultValue
 )
 {
     CLASP_DECLARE_c_str_datalen_PAIR_();
@@ -1985,8 +2554,8 @@ bool
 check_next_option(
     clasp_arguments_t const*    args
 ,   S const&                    optionName
-,   size_t*                     result
-,   size_t                      defaultValue
+,   unsigned long long*         result
+,   unsigned long long          defaultValue
 )
 {
     CLASP_DECLARE_c_str_datalen_PAIR_();
@@ -1999,6 +2568,78 @@ check_next_option(
     ,   defaultValue
     );
 }
+#endif /* CLASP_HPP_INTERNAL_long_long_OVERLOADS_ */
+
+/** Checks whether the given option exists, and elicits its value if so; if
+ * not, sets the result to be the given default value
+ *
+ * \param args Non-mutating pointer to the arguments structure, obtained
+ *   from call to parseArguments() / clasp_parseArguments(). May not be NULL
+ * \param optionName Name of the option. Must be of a type which may be
+ *   interpreted as a string. May not be NULL or empty
+ * \param result Pointer to a variable into which to write the result, if
+ *   found, or the default value, if not. May not be NULL
+ * \param defaultValue The default value to be written into
+ *   <code>*result</code> if the named option does not exist
+ *
+ * \pre (NULL != args)
+ * \pre (NULL != result)
+ */
+template <typename S>
+bool
+check_option(
+    clasp_arguments_t const*    args
+,   S const&                    optionName
+,   float*                      result
+,   float                       defaultValue
+)
+{
+    CLASP_DECLARE_c_str_datalen_PAIR_();
+
+    return ::clasp::ximpl::check_option_real_(
+        args
+    ,   false
+    ,   CLASP_INVOKE_c_str_data_(optionName), CLASP_INVOKE_c_str_len_(optionName)
+    ,   result
+    ,   defaultValue
+    );
+}
+
+/** Checks whether the given option exists in one of the as-yet unused
+ * arguments, and elicits its value if so; if not, sets the result to be the
+ * given default value
+ *
+ * \param args Non-mutating pointer to the arguments structure, obtained
+ *   from call to parseArguments() / clasp_parseArguments(). May not be NULL
+ * \param optionName Name of the option. Must be of a type which may be
+ *   interpreted as a string. May not be NULL or empty
+ * \param result Pointer to a variable into which to write the result, if
+ *   found, or the default value, if not. May not be NULL
+ * \param defaultValue The default value to be written into
+ *   <code>*result</code> if the named option does not exist
+ *
+ * \pre (NULL != args)
+ * \pre (NULL != result)
+ */
+template <typename S>
+bool
+check_next_option(
+    clasp_arguments_t const*    args
+,   S const&                    optionName
+,   float*                      result
+,   float                       defaultValue
+)
+{
+    CLASP_DECLARE_c_str_datalen_PAIR_();
+
+    return ::clasp::ximpl::check_option_real_(
+        args
+    ,   true
+    ,   CLASP_INVOKE_c_str_data_(optionName), CLASP_INVOKE_c_str_len_(optionName)
+    ,   result
+    ,   defaultValue
+    );
+}
 
 /** Checks whether the given option exists, and elicits its value if so; if
  * not, sets the result to be the given default value
@@ -2028,6 +2669,7 @@ check_option(
 
     return ::clasp::ximpl::check_option_real_(
         args
+    ,   false
     ,   CLASP_INVOKE_c_str_data_(optionName), CLASP_INVOKE_c_str_len_(optionName)
     ,   result
     ,   defaultValue
@@ -3022,7 +3664,8 @@ use_flag_or_option(
  *   May not be NULL.
  *
  * \exception clasp::unrecognised_argument_exception Thrown if an argument is
- *   unrecognised
+ *   unrecognised, whose message includes the closest names, if any, from
+ *   \c specifications, obtained via clasp_findSuggestions()
  */
 inline
 void
@@ -3038,9 +3681,25 @@ verify_all_flags_and_options_are_recognised(
     {
         static char const s_prefix[] = "unrecognised argument(s)";
 
+        clasp_suggestion_t                                  suggestions[3];
+        size_t const                                        numSuggestions = clasp_findSuggestions(args, specifications, firstUnrecognisedArg->givenName.ptr, firstUnrecognisedArg->givenName.len, 0, suggestions, STLSOFT_NUM_ELEMENTS(suggestions));
+        unrecognised_argument_exception::suggestions_type   names;
+
+        // only the closest suggestions are given
+        for (size_t i = 0; i != numSuggestions && i != STLSOFT_NUM_ELEMENTS(suggestions); ++i)
+        {
+            if (suggestions[i].distance != suggestions[0].distance)
+            {
+                break;
+            }
+
+            names.push_back(unrecognised_argument_exception::string_type(suggestions[i].name.ptr, suggestions[i].name.len));
+        }
+
         throw unrecognised_argument_exception(
                   unrecognised_argument_exception::message_string_type(s_prefix, STLSOFT_NUM_ELEMENTS(s_prefix) - (1 + 3 * (1u == n)))
               ,   unrecognised_argument_exception::string_type(firstUnrecognisedArg->givenName.ptr, firstUnrecognisedArg->givenName.len)
+              ,   names
               );
     }
 }
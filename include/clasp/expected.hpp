@@ -0,0 +1,406 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    clasp/expected.hpp
+ *
+ * Purpose: Non-throwing, error-collecting extraction of options.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * Home:    https://github.com/synesissoftware/CLASP/
+ *
+ * Copyright (c) 2026, Matthew Wilson
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer;
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution;
+ * - Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/** \file clasp/expected.hpp
+ *
+ * \brief [C++17-only] Non-throwing, error-collecting extraction of
+ *   options.
+ *
+ * The functions in this file report argument errors - missing options,
+ * missing or invalid option values, and unrecognised and unused arguments
+ * - by returning a clasp::expected and recording them in a
+ * caller-supplied clasp_argument_errors_t buffer (such as an instance of
+ * clasp::argument_errors), rather than by throwing exceptions, so that
+ * all errors in a command-line may be collected in a single pass, and
+ * rejecting it involves neither stack unwinding nor memory allocation.
+ */
+
+#ifndef CLASP_INCL_CLASP_HPP_EXPECTED
+#define CLASP_INCL_CLASP_HPP_EXPECTED
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * version information
+ */
+
+#ifndef CLASP_DOCUMENTATION_SKIP_SECTION
+# define CLASP_VER_CLASP_HPP_EXPECTED_MAJOR     1
+# define CLASP_VER_CLASP_HPP_EXPECTED_MINOR     0
+# define CLASP_VER_CLASP_HPP_EXPECTED_REVISION  1
+# define CLASP_VER_CLASP_HPP_EXPECTED_EDIT      1
+#endif /* !CLASP_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* CLASP header files */
+#include <clasp/string_view.hpp>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+namespace clasp
+{
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** A fixed-capacity argument errors buffer, whose storage is part of the
+ * instance
+ *
+ * \tparam N The maximum number of errors recorded; further errors are
+ *   counted, but discarded
+ */
+template <size_t N>
+class argument_errors
+    : public clasp_argument_errors_t
+{
+public: // types
+    typedef clasp_argument_errors_t                         parent_class_type;
+    typedef argument_errors<N>                              class_type;
+    typedef clasp_argument_error_t                          value_type;
+    typedef clasp_argument_error_t const*                   const_iterator;
+    typedef size_t                                          size_type;
+
+public: // construction
+    argument_errors() noexcept
+    {
+        clasp_initArgumentErrors(this, m_storage, N);
+    }
+private:
+    argument_errors(class_type const&) = delete;
+    class_type& operator =(class_type const&) = delete;
+
+public: // operations
+    /// Discards all errors
+    void clear() noexcept
+    {
+        numErrors = 0;
+    }
+
+public: // accessors
+    /// Indicates whether no errors have been found
+    bool        empty() const noexcept
+    {
+        return 0 == numErrors;
+    }
+    /// The number of errors recorded, which is at most N
+    size_type   size() const noexcept
+    {
+        return (numErrors < N) ? numErrors : N;
+    }
+    /// The number of errors found, including those discarded
+    size_type   num_errors() const noexcept
+    {
+        return numErrors;
+    }
+    /// Indicates whether any errors have been discarded
+    bool        overflowed() const noexcept
+    {
+        return numErrors > N;
+    }
+    /// The error at the given index, which must be less than size()
+    value_type const& operator [](size_type index) const noexcept
+    {
+        return m_storage[index];
+    }
+
+public: // iteration
+    const_iterator begin() const noexcept
+    {
+        return m_storage;
+    }
+    const_iterator end() const noexcept
+    {
+        return m_storage + size();
+    }
+
+private: // fields
+    clasp_argument_error_t  m_storage[N];
+};
+
+/** Holds either a value or the argument error that prevented it from being
+ * obtained, in the manner of <code>std::expected<T, argument_error_t></code>
+ */
+template <typename T>
+class expected
+{
+public: // types
+    typedef T                                               value_type;
+    typedef clasp_argument_error_t                          error_type;
+    typedef expected<T>                                     class_type;
+
+public: // construction
+    /// Constructs an instance holding the given value
+    expected(value_type const& value) noexcept(std::is_nothrow_copy_constructible<value_type>::value)
+        : m_value(value)
+        , m_error()
+    {}
+    /// Constructs an instance holding the given error
+    expected(error_type const& error) noexcept
+        : m_value()
+        , m_error(error)
+    {}
+
+public: // accessors
+    /// Indicates whether the instance holds a value
+    bool has_value() const noexcept
+    {
+        return m_value.has_value();
+    }
+    /// Indicates whether the instance holds a value
+    explicit operator bool() const noexcept
+    {
+        return has_value();
+    }
+    /// The value; has_value() must be true
+    value_type const& value() const noexcept
+    {
+        return *m_value;
+    }
+    /// The value; has_value() must be true
+    value_type const& operator *() const noexcept
+    {
+        return *m_value;
+    }
+    /// The value, if held, or the given default
+    value_type value_or(value_type const& defaultValue) const
+    {
+        return m_value.value_or(defaultValue);
+    }
+    /// The error; has_value() must be false
+    error_type const& error() const noexcept
+    {
+        return m_error;
+    }
+
+private: // fields
+    std::optional<value_type>   m_value;
+    error_type                  m_error;
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+
+#ifndef CLASP_DOCUMENTATION_SKIP_SECTION
+
+namespace ximpl
+{
+    inline
+    clasp_argument_error_t
+    expected_error_(
+        clasp_argument_errors_t&    errors
+    ,   clasp_argerr_t              kind
+    ,   int                         cmdLineIndex
+    ,   string_view_t               name
+    ) noexcept
+    {
+        clasp_argument_error_t error;
+
+        error.kind          =   kind;
+        error.cmdLineIndex  =   cmdLineIndex;
+        error.name.len      =   name.size();
+        error.name.ptr      =   name.data();
+
+        clasp_addArgumentError(&errors, kind, cmdLineIndex, name.data(), name.size());
+
+        return error;
+    }
+
+    template <typename T>
+    expected<T>
+    expected_get_option_(
+        clasp_arguments_t const*    args
+    ,   string_view_t               optionName
+    ,   T const*                    defaultValue
+    ,   clasp_argument_errors_t&    errors
+    )
+    {
+        { for (size_t i = 0; i != args->numOptions; ++i)
+        {
+            clasp_argument_t const& arg = args->options[i];
+
+            if (to_string_view(arg.resolvedName) == optionName)
+            {
+                clasp_useArgument(args, &arg);
+
+                if (0 == arg.value.len)
+                {
+                    if (NULL != defaultValue)
+                    {
+                        return *defaultValue;
+                    }
+
+                    return expected_error_(errors, CLASP_ARGERR_MISSING_OPTION_VALUE, arg.cmdLineIndex, optionName);
+                }
+                else
+                {
+                    T           result;
+                    char const* invalidFormatMessage;
+
+                    if (conversion_succeeded_ != string_view_convert_(arg.value, &result, &invalidFormatMessage))
+                    {
+                        return expected_error_(errors, CLASP_ARGERR_INVALID_OPTION_VALUE, arg.cmdLineIndex, optionName);
+                    }
+
+                    return result;
+                }
+            }
+        }}
+
+        if (NULL != defaultValue)
+        {
+            return *defaultValue;
+        }
+
+        return expected_error_(errors, CLASP_ARGERR_MISSING_OPTION, -1, optionName);
+    }
+} /* namespace ximpl */
+
+#endif /* !CLASP_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+/** Obtains the value of the required option of the given name, recording
+ * any error in the given buffer rather than throwing an exception
+ *
+ * \tparam T The result type, as for clasp::check_option()
+ *
+ * \param args The arguments structure
+ * \param optionName The (resolved) name of the option. If the option is
+ *   missing, the recorded error refers to this name, which must therefore
+ *   remain valid for as long as the error is used
+ * \param errors The buffer into which any error is recorded
+ *
+ * \return The (converted) value, or the error:
+ *   \c CLASP_ARGERR_MISSING_OPTION, \c CLASP_ARGERR_MISSING_OPTION_VALUE,
+ *   or \c CLASP_ARGERR_INVALID_OPTION_VALUE
+ */
+template <typename T = string_view_t>
+expected<T>
+require_option(
+    clasp_arguments_t const*    args
+,   string_view_t               optionName
+,   clasp_argument_errors_t&    errors
+)
+{
+    return ::clasp::ximpl::expected_get_option_<T>(args, optionName, NULL, errors);
+}
+
+/** Obtains the value of the option of the given name, or the given default
+ * if it is not specified (or is specified without a value), recording any
+ * error in the given buffer rather than throwing an exception
+ *
+ * \param args The arguments structure
+ * \param optionName The (resolved) name of the option
+ * \param defaultValue The value to be used if the option is not
+ *   specified
+ * \param errors The buffer into which any error is recorded
+ *
+ * \return The (converted) value, or the error
+ *   \c CLASP_ARGERR_INVALID_OPTION_VALUE
+ */
+template <typename T>
+expected<T>
+check_option(
+    clasp_arguments_t const*    args
+,   string_view_t               optionName
+,   T const&                    defaultValue
+,   clasp_argument_errors_t&    errors
+)
+{
+    return ::clasp::ximpl::expected_get_option_<T>(args, optionName, &defaultValue, errors);
+}
+
+/** Collects all flags and options that are not recognised relative to
+ * the given specifications, or that have not been used, in a single pass
+ *
+ * This is the non-throwing counterpart of
+ * clasp::verify_all_flags_and_options_are_recognised() and
+ * clasp::verify_all_flags_and_options_used().
+ *
+ * \return \c true if there are no such flags or options
+ *
+ * \see clasp_verifyArguments()
+ */
+inline
+bool
+verify_all_flags_and_options(
+    clasp_arguments_t const*    args
+,   clasp_specification_t const specifications[]
+,   clasp_argument_errors_t&    errors
+) noexcept
+{
+    return 0 == clasp_verifyArguments(args, specifications, CLASP_VERIFY_F_ALL_RECOGNISED | CLASP_VERIFY_F_ALL_USED, &errors);
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+} /* namespace clasp */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !CLASP_INCL_CLASP_HPP_EXPECTED */
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
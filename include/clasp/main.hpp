@@ -4,11 +4,11 @@
  * Purpose: main() entry-point helper functions.
  *
  * Created: 29th December 2010
- * Updated: 12th July 2024
+ * Updated: 19th October 2026
  *
  * Home:    https://github.com/synesissoftware/CLASP/
  *
- * Copyright (c) 2010-2024, Matthew Wilson
+ * Copyright (c) 2010-2026, Matthew Wilson
  * All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
@@ -56,7 +56,7 @@
 # define CLASP_VER_CLASP_HPP_MAIN_MAJOR     2
 # define CLASP_VER_CLASP_HPP_MAIN_MINOR     0
 # define CLASP_VER_CLASP_HPP_MAIN_REVISION  2
-# define CLASP_VER_CLASP_HPP_MAIN_EDIT      43
+# define CLASP_VER_CLASP_HPP_MAIN_EDIT      44
 #endif /* !CLASP_DOCUMENTATION_SKIP_SECTION */
 
 
@@ -104,6 +104,7 @@
 
 /* Standard C header files */
 #include <assert.h>
+#include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -150,16 +151,17 @@ namespace main
 namespace ximpl
 {
 
-inline
+/* Invokes the main function - of whatever calling convention - with the
+ * parsed arguments, which it releases, and reports any CLASP exception
+ */
+template <typename F>
 int
-invoke_(
+invoke_main_(
     int                                 argc
 ,   clasp_char_t const* const*          argv
-,   int (STLSOFT_CDECL*                 pfnMain)(clasp::arguments_t const* args)
+,   F                                   pfnMain
+,   clasp::arguments_t const*           clargs
 ,   clasp_char_t const*                 programName
-,   clasp::specification_t const        specifications[]
-,   unsigned                            flags
-,   clasp::diagnostic_context_t const*  ctxt
 ,   clasp_char_t const*                 usageHelpSuffix
 )
 {
@@ -177,6 +179,68 @@ invoke_(
 # endif /* !PANTHEIOS_NO_NAMESPACE */
 #endif /* Pantheios C++ API */
 
+    ((void)argc);
+    ((void)argv);
+
+    stlsoft::scoped_handle<clasp::arguments_t const*> scoper(clargs, clasp::releaseArguments);
+
+    try
+    {
+#ifdef PANTHEIOS_INCL_PANTHEIOS_HPP_PANTHEIOS
+
+        log_DEBUG(PANTHEIOS_LITERAL_STRING("entering main("), args(argc, argv, args::arg0FileOnly), PANTHEIOS_LITERAL_STRING(")"));
+
+#endif /* Pantheios C++ API */
+
+        return pfnMain(clargs);
+    }
+    catch(clasp::clasp_exception &x)
+    {
+        /* Diagnostic log statement */
+#ifdef PANTHEIOS_INCL_PANTHEIOS_H_PANTHEIOS
+# ifdef STLSOFT_CF_RTTI_SUPPORT
+        pantheios_logprintf(PANTHEIOS_SEV_DEBUG, PANTHEIOS_LITERAL_STRING("%s: invalid-command-line (%s): %s"), programName, typeid(x).name(), x.what());
+# else /* ? STLSOFT_CF_RTTI_SUPPORT */
+        pantheios_logprintf(PANTHEIOS_SEV_DEBUG, PANTHEIOS_LITERAL_STRING("%s: invalid-command-line: %s"), programName, x.what());
+# endif /* STLSOFT_CF_RTTI_SUPPORT */
+#endif /* PANTHEIOS_INCL_PANTHEIOS_H_PANTHEIOS */
+
+        /* Contingent report */
+        if (NULL != usageHelpSuffix &&
+            '\0' != usageHelpSuffix[0])
+        {
+            ::fprintf(stderr, "%s: invalid command-line: %s; %s\n", programName, x.what(), usageHelpSuffix);
+        }
+        else
+        {
+            ::fprintf(stderr, "%s: invalid command-line: %s\n", programName, x.what());
+        }
+    }
+
+    return EXIT_FAILURE;
+}
+
+inline
+int
+invoke_(
+    int                                 argc
+,   clasp_char_t const* const*          argv
+,   int (STLSOFT_CDECL*                 pfnMain)(clasp::arguments_t const* args)
+,   clasp_char_t const*                 programName
+,   clasp::specification_t const        specifications[]
+,   unsigned                            flags
+,   clasp::diagnostic_context_t const*  ctxt
+,   clasp_char_t const*                 usageHelpSuffix
+)
+{
+    /* Using declarations */
+
+#ifdef PANTHEIOS_INCL_PANTHEIOS_H_PANTHEIOS
+# ifndef PANTHEIOS_NO_NAMESPACE
+    using pantheios::pantheios_logprintf;
+# endif /* !PANTHEIOS_NO_NAMESPACE */
+#endif /* PANTHEIOS_INCL_PANTHEIOS_H_PANTHEIOS */
+
     /* Preconditions */
 
     assert(argc > 0);
@@ -204,42 +268,7 @@ invoke_(
     }
     else
     {
-        stlsoft::scoped_handle<clasp::arguments_t const*> scoper(clargs, clasp::releaseArguments);
-
-        try
-        {
-#ifdef PANTHEIOS_INCL_PANTHEIOS_HPP_PANTHEIOS
-
-            log_DEBUG(PANTHEIOS_LITERAL_STRING("entering main("), args(argc, argv, args::arg0FileOnly), PANTHEIOS_LITERAL_STRING(")"));
-
-#endif /* Pantheios C++ API */
-
-            return pfnMain(clargs);
-        }
-        catch(clasp::clasp_exception &x)
-        {
-            /* Diagnostic log statement */
-#ifdef PANTHEIOS_INCL_PANTHEIOS_H_PANTHEIOS
-# ifdef STLSOFT_CF_RTTI_SUPPORT
-            pantheios_logprintf(PANTHEIOS_SEV_DEBUG, PANTHEIOS_LITERAL_STRING("%s: invalid-command-line (%s): %s"), programName, typeid(x).name(), x.what());
-# else /* ? STLSOFT_CF_RTTI_SUPPORT */
-            pantheios_logprintf(PANTHEIOS_SEV_DEBUG, PANTHEIOS_LITERAL_STRING("%s: invalid-command-line: %s"), programName, x.what());
-# endif /* STLSOFT_CF_RTTI_SUPPORT */
-#endif /* PANTHEIOS_INCL_PANTHEIOS_H_PANTHEIOS */
-
-            /* Contingent report */
-            if (NULL != usageHelpSuffix &&
-                '\0' != usageHelpSuffix[0])
-            {
-                ::fprintf(stderr, "%s: invalid command-line: %s; %s\n", programName, x.what(), usageHelpSuffix);
-            }
-            else
-            {
-                ::fprintf(stderr, "%s: invalid command-line: %s\n", programName, x.what());
-            }
-        }
-
-        return EXIT_FAILURE;
+        return invoke_main_(argc, argv, pfnMain, clargs, programName, usageHelpSuffix);
     }
 }
 
@@ -347,6 +376,94 @@ invoke(
     return ximpl::invoke_(argc, argv, pfnMain, programName, specifications, flags, ctxt, usageHelpSuffix);
 }
 
+/** Selects, from the given registry, the applet named by the program name
+ * - <code>argv[0]</code>, without directory or, on Windows, extension -
+ * parses the command-line against its specifications, and invokes its
+ * main function.
+ *
+ * \param argc \c argc passed to <code>main()</code>
+ * \param argv \c argv passed to <code>main()</code>
+ * \param registry The registry, obtained from clasp_createAppletRegistry()
+ * \param flags Flags that will be passed to clasp_parseApplet()
+ * \param ctxt
+ * \param usageHelpSuffix Suffix such as "use --help for usage" that will be
+ *   semicolon-space appended after the exception information, or NULL for
+ *   no suffix
+ *
+ * \note The name of the applet is used as the program name in contingent
+ *   reports.
+ *
+ * \exceptions * All exceptions not derived from clasp::clasp_exception are
+ *   passed through to the caller uncaught.
+ *
+ * \pre argc > 0
+ * \pre NULL != argv
+ * \pre NULL != registry
+ */
+inline
+int
+invoke(
+    int                                 argc
+,   clasp_char_t const* const*          argv
+,   clasp_applet_registry_t const*      registry
+,   unsigned                            flags
+,   clasp::diagnostic_context_t const*  ctxt            =   NULL
+,   clasp_char_t const*                 usageHelpSuffix =   NULL
+)
+{
+    /* Using declarations */
+
+#ifdef PANTHEIOS_INCL_PANTHEIOS_H_PANTHEIOS
+# ifndef PANTHEIOS_NO_NAMESPACE
+    using pantheios::pantheios_logprintf;
+# endif /* !PANTHEIOS_NO_NAMESPACE */
+#endif /* PANTHEIOS_INCL_PANTHEIOS_H_PANTHEIOS */
+
+    /* Preconditions */
+
+    assert(argc > 0);
+    assert(NULL != argv);
+    assert(NULL != registry);
+
+    clasp::applet_t const*      applet;
+    clasp::arguments_t const*   clargs;
+
+    int r = ::clasp_parseApplet(flags, argc, const_cast<clasp_char_t**>(argv), registry, ctxt, &applet, &clargs);
+
+    if (ENOENT == r)
+    {
+        /* Diagnostic log statement */
+#ifdef PANTHEIOS_INCL_PANTHEIOS_H_PANTHEIOS
+        pantheios_logprintf(PANTHEIOS_SEV_ALERT, PANTHEIOS_LITERAL_STRING("%s: could not start program: unrecognised applet"), argv[0]);
+#endif /* PANTHEIOS_INCL_PANTHEIOS_H_PANTHEIOS */
+
+        /* Contingent report */
+        fprintf(stderr, "%s: could not start program: unrecognised applet\n", argv[0]);
+
+        return EXIT_FAILURE;
+    }
+    else if (r != 0)
+    {
+        stlsoft::error_desc e(r);
+
+        /* Diagnostic log statement */
+#ifdef PANTHEIOS_INCL_PANTHEIOS_H_PANTHEIOS
+        pantheios_logprintf(PANTHEIOS_SEV_ALERT, PANTHEIOS_LITERAL_STRING("%s: could not start program: applet selection failed: %s"), argv[0], e.c_str());
+#endif /* PANTHEIOS_INCL_PANTHEIOS_H_PANTHEIOS */
+
+        /* Contingent report */
+        fprintf(stderr, "%s: could not start program: applet selection failed: %.*s\n", argv[0], int(e.size()), e.c_str());
+
+        return EXIT_FAILURE;
+    }
+    else
+    {
+        assert(NULL != applet->pfnMain);
+
+        return ximpl::invoke_main_(argc, argv, applet->pfnMain, clargs, applet->name, usageHelpSuffix);
+    }
+}
+
 
 /* /////////////////////////////////////////////////////////////////////////
  * namespace
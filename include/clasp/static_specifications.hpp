@@ -0,0 +1,870 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    clasp/static_specifications.hpp
+ *
+ * Purpose: Compile-time validated and perfect-hashed specifications.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * Home:    https://github.com/synesissoftware/CLASP/
+ *
+ * Copyright (c) 2026, Matthew Wilson
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer;
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution;
+ * - Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/** \file clasp/static_specifications.hpp
+ *
+ * \brief [C++17-only] Compile-time validated and perfect-hashed
+ *   specifications.
+ */
+
+#ifndef CLASP_INCL_CLASP_HPP_STATIC_SPECIFICATIONS
+#define CLASP_INCL_CLASP_HPP_STATIC_SPECIFICATIONS
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * version information
+ */
+
+#ifndef CLASP_DOCUMENTATION_SKIP_SECTION
+# define CLASP_VER_CLASP_HPP_STATIC_SPECIFICATIONS_MAJOR    1
+# define CLASP_VER_CLASP_HPP_STATIC_SPECIFICATIONS_MINOR    1
+# define CLASP_VER_CLASP_HPP_STATIC_SPECIFICATIONS_REVISION 1
+# define CLASP_VER_CLASP_HPP_STATIC_SPECIFICATIONS_EDIT     2
+#endif /* !CLASP_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef __cplusplus
+# error This file is only compatible with C++ compilation
+#endif /* !__cplusplus */
+
+#if __cplusplus < 201703L && \
+    (   !defined(_MSVC_LANG) || \
+        _MSVC_LANG < 201703L)
+# error This file requires C++17 or later
+#endif
+
+/* CLASP header files */
+#include <clasp/clasp.h>
+
+/* Standard header files */
+#include <stdexcept>
+#include <type_traits>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+namespace clasp
+{
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+
+#ifndef CLASP_DOCUMENTATION_SKIP_SECTION
+namespace ximpl
+{
+    /* The following are deliberately not constexpr, so that a failure of
+     * validation during constant evaluation is reported by the compiler
+     * in terms of the function's name.
+     */
+
+    inline void static_specifications_duplicate_alias()
+    {
+        throw std::invalid_argument("duplicate argument alias in specifications");
+    }
+
+    inline void static_specifications_invalid_type()
+    {
+        throw std::invalid_argument("invalid argument type in specifications");
+    }
+
+    inline void static_specifications_not_terminated()
+    {
+        throw std::invalid_argument("specifications not terminated by CLASP_SPECIFICATION_ARRAY_TERMINATOR");
+    }
+
+    inline void static_specifications_no_perfect_hash()
+    {
+        throw std::invalid_argument("could not compute perfect hash of specifications");
+    }
+
+    constexpr
+    size_t
+    static_specifications_next_power_of_2_(
+        size_t n
+    )
+    {
+        size_t r = 1;
+
+        for (; r < n; r <<= 1)
+        {}
+
+        return r;
+    }
+
+    constexpr
+    size_t
+    static_specifications_strlen_(
+        clasp_char_t const* s
+    )
+    {
+        size_t n = 0;
+
+        for (; '\0' != s[n]; ++n)
+        {}
+
+        return n;
+    }
+
+    constexpr
+    bool
+    static_specifications_equal_(
+        clasp_char_t const* lhs
+    ,   size_t              cchLhs
+    ,   clasp_char_t const* rhs
+    ,   size_t              cchRhs
+    )
+    {
+        if (cchLhs != cchRhs)
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i != cchLhs; ++i)
+        {
+            if (lhs[i] != rhs[i])
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /* Obtains the length of the mapped argument up to any '=' (or ':'), as
+     * per clasp_strchreq_(), and whether it has one
+     */
+    constexpr
+    size_t
+    static_specifications_mapped_length_(
+        clasp_char_t const* mappedArgument
+    ,   bool*               hasDefault
+    )
+    {
+        size_t n = 0;
+
+        for (; '\0' != mappedArgument[n]; ++n)
+        {
+            if ('=' == mappedArgument[n] ||
+                ':' == mappedArgument[n])
+            {
+                *hasDefault = true;
+
+                return n;
+            }
+        }
+
+        *hasDefault = false;
+
+        return n;
+    }
+
+    /* Must be kept in step with clasp_hashSpecificationKey() */
+    constexpr
+    unsigned long
+    static_specifications_hash_(
+        clasp_char_t const* key
+    ,   size_t              cchKey
+    ,   unsigned long       seed
+    )
+    {
+        unsigned long h = (2166136261UL ^ (seed * 0x9e3779b1UL)) & 0xffffffffUL;
+
+        for (size_t i = 0; i != cchKey; ++i)
+        {
+            h ^= static_cast<unsigned long>(key[i]);
+            h = (h * 16777619UL) & 0xffffffffUL;
+        }
+
+        return h ^ (h >> 16);
+    }
+
+    /* Must be kept in step with clasp_char_code_() */
+    constexpr
+    unsigned long
+    static_specifications_char_code_(
+        clasp_char_t ch
+    )
+    {
+        return static_cast<unsigned long>(static_cast<std::make_unsigned_t<clasp_char_t>>(ch));
+    }
+
+    constexpr
+    bool
+    static_specifications_is_valid_type_(
+        clasp_argtype_t type
+    )
+    {
+        int const i = static_cast<int>(type);
+
+        switch (type)
+        {
+        case CLASP_ARGTYPE_FLAG:
+        case CLASP_ARGTYPE_OPTION:
+        case CLASP_ARGTYPE_TACIT_:
+        case CLASP_ARGTYPE_GAP_:
+
+            return true;
+        default:
+
+            /* as per clasp_is_valid_alias_section_range_() */
+            return 1 <= i && 1000 >= i;
+        }
+    }
+
+} /* namespace ximpl */
+#endif /* !CLASP_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** A specifications array that is validated, and indexed by a perfect
+ * hash over its names and mapped arguments, at compile-time.
+ *
+ * \param N The number of elements in the specifications array, including
+ *   the terminator
+ *
+ * When declared <code>constexpr</code>, a duplicate alias, an invalid
+ * argument type, or a missing terminator are compile-time errors, and the
+ * index is baked into the program image, so that parsing via
+ * clasp::parseArguments() (or clasp_parseArgumentsWithIndex()) involves
+ * no validation or set-up at runtime:
+ *
+ * \code
+  static constexpr clasp::specification_t Specifications[] =
+  {
+    CLASP_FLAG("-v", "--verbose", "makes output verbose"),
+    CLASP_OPTION("-w", "--width", "the output width", ""),
+
+    CLASP_SPECIFICATION_ARRAY_TERMINATOR
+  };
+  static constexpr clasp::static_specifications StaticSpecifications(Specifications);
+
+  . . .
+
+  int r = clasp::parseArguments(0, argc, argv, StaticSpecifications, NULL, &args);
+ * \endcode
+ *
+ * \note Names are matched exactly, or, with CLASP_F_ALLOW_UNIQUE_PREFIXES,
+ *   by unique prefix via the (also baked) prefix trie; see
+ *   clasp_parseArgumentsWithIndex()
+ *
+ * \note The grouping of specifications by long name for usage is not
+ *   baked, since the usage functions take only the specifications array;
+ *   it is computed in a single hashed pass when usage is rendered
+ */
+template <size_t N>
+class static_specifications
+{
+public: // types
+    typedef static_specifications<N>                        class_type;
+
+public: // constants
+    /// The maximum number of keys - names and mapped arguments
+    static constexpr size_t max_keys        =   2 * N;
+    /// The number of buckets
+    static constexpr size_t num_buckets     =   ximpl::static_specifications_next_power_of_2_(N);
+    /// The number of slots, such that the load is at most one half
+    static constexpr size_t num_slots       =   ximpl::static_specifications_next_power_of_2_(2 * max_keys);
+    /// The maximum number of nodes of the prefix trie
+    static constexpr size_t max_trie_nodes  =   2 * N;
+
+public: // construction
+    /// Validates and indexes the given specifications array
+    constexpr
+    explicit
+    static_specifications(
+        clasp_specification_t const (&specifications)[N]
+    )
+        : m_specifications(specifications)
+        , m_seeds()
+        , m_slots()
+        , m_shortFlags()
+        , m_numWideShortFlags(0)
+        , m_wideShortFlags()
+        , m_numTrieNodes(0)
+        , m_trieNodes()
+    {
+        validate_(specifications);
+        build_(specifications);
+        build_trie_(specifications);
+    }
+
+public: // accessors
+    /// The specifications array
+    constexpr
+    clasp_specification_t const*
+    specifications() const noexcept
+    {
+        return m_specifications;
+    }
+
+    /// The index, for use with clasp_parseArgumentsWithIndex()
+    constexpr
+    clasp_specification_index_t
+    index() const noexcept
+    {
+        return clasp_specification_index_t{ m_specifications, num_buckets, m_seeds, num_slots, m_slots, m_shortFlags, m_numWideShortFlags, m_wideShortFlags, m_numTrieNodes, m_trieNodes };
+    }
+
+private: // implementation
+    static
+    constexpr
+    void
+    validate_(
+        clasp_specification_t const (&specifications)[N]
+    )
+    {
+        if (CLASP_ARGTYPE_INVALID != specifications[N - 1].type)
+        {
+            ximpl::static_specifications_not_terminated();
+        }
+
+        for (size_t i = 0; CLASP_ARGTYPE_INVALID != specifications[i].type; ++i)
+        {
+            if (!ximpl::static_specifications_is_valid_type_(specifications[i].type))
+            {
+                ximpl::static_specifications_invalid_type();
+            }
+        }
+    }
+
+    constexpr
+    void
+    build_(
+        clasp_specification_t const (&specifications)[N]
+    )
+    {
+        clasp_char_t const* keys[max_keys]      =   {};
+        size_t              lengths[max_keys]   =   {};
+        unsigned long       hashes[max_keys]    =   {};
+        int                 indexes[max_keys]   =   {};
+        size_t              buckets[max_keys]   =   {};
+        size_t              numKeys             =   0;
+
+        /* 1. gather the keys in the order in which clasp_lookup_alias_len_()
+         * searches - names, then non-defaulted mapped arguments, then
+         * defaulted mapped arguments - so that the first specification of
+         * any given key wins. Keys already gathered are found via the
+         * slots, which serve meanwhile as an open-addressed set keyed by
+         * the (seed 0) hash; a name found thus is a duplicate alias, as per
+         * clasp_check_alias_duplicates_()
+         */
+
+        for (size_t i = 0; i != num_slots; ++i)
+        {
+            m_slots[i] = -1;
+        }
+
+        for (int pass = 0; 3 != pass; ++pass)
+        {
+            for (size_t i = 0; CLASP_ARGTYPE_INVALID != specifications[i].type; ++i)
+            {
+                clasp_char_t const* key         =   nullptr;
+                size_t              cchKey      =   0;
+
+                if (0 == pass)
+                {
+                    key = specifications[i].name;
+
+                    if (nullptr != key)
+                    {
+                        cchKey = ximpl::static_specifications_strlen_(key);
+                    }
+                }
+                else
+                if (nullptr != specifications[i].mappedArgument)
+                {
+                    bool hasDefault = false;
+
+                    cchKey = ximpl::static_specifications_mapped_length_(specifications[i].mappedArgument, &hasDefault);
+
+                    if (hasDefault == (2 == pass))
+                    {
+                        key = specifications[i].mappedArgument;
+                    }
+                }
+
+                if (nullptr == key ||
+                    0 == cchKey)
+                {
+                    continue;
+                }
+
+                unsigned long const hash    =   ximpl::static_specifications_hash_(key, cchKey, 0);
+                size_t              slot    =   hash & (num_slots - 1);
+                bool                found   =   false;
+
+                for (; !found && -1 != m_slots[slot]; slot = (slot + 1) & (num_slots - 1))
+                {
+                    size_t const k = static_cast<size_t>(m_slots[slot]);
+
+                    found = hash == hashes[k] && ximpl::static_specifications_equal_(keys[k], lengths[k], key, cchKey);
+                }
+
+                if (found)
+                {
+                    if (0 == pass)
+                    {
+                        ximpl::static_specifications_duplicate_alias();
+                    }
+                }
+                else
+                {
+                    m_slots[slot]       =   static_cast<int>(numKeys);
+                    keys[numKeys]       =   key;
+                    lengths[numKeys]    =   cchKey;
+                    hashes[numKeys]     =   hash;
+                    indexes[numKeys]    =   static_cast<int>(i);
+                    buckets[numKeys]    =   hash & (num_buckets - 1);
+                    ++numKeys;
+                }
+            }
+        }
+
+        /* 2. enter the single-character keys - "-c" - which are already in
+         * order of precedence, in the direct table, or else insert them,
+         * in order of character, into the wide table
+         */
+
+        for (size_t i = 0; i != CLASP_SHORT_FLAG_TABLE_SIZE; ++i)
+        {
+            m_shortFlags[i] = -1;
+        }
+
+        for (size_t i = 0; i != max_keys; ++i)
+        {
+            m_wideShortFlags[i] = clasp_short_flag_t{ 0, -1 };
+        }
+
+        for (size_t k = 0; k != numKeys; ++k)
+        {
+            if (2 != lengths[k] ||
+                '-' != keys[k][0])
+            {
+                continue;
+            }
+
+            unsigned long const code = ximpl::static_specifications_char_code_(keys[k][1]);
+
+            if (code < CLASP_SHORT_FLAG_TABLE_SIZE)
+            {
+                m_shortFlags[code] = indexes[k];
+            }
+            else
+            {
+                size_t w = m_numWideShortFlags++;
+
+                for (; 0 != w && ximpl::static_specifications_char_code_(m_wideShortFlags[w - 1].character) > code; --w)
+                {
+                    m_wideShortFlags[w] = m_wideShortFlags[w - 1];
+                }
+
+                m_wideShortFlags[w] = clasp_short_flag_t{ keys[k][1], indexes[k] };
+            }
+        }
+
+        /* 3. order the keys by bucket, and the buckets by decreasing size
+         * (and then by increasing index), both by counting sort, as per
+         * clasp_createSpecificationIndex()
+         */
+
+        size_t  starts[num_buckets + 1]     =   {};
+        size_t  order[max_keys]             =   {};
+        size_t  sizeStarts[max_keys + 2]    =   {};
+        size_t  bucketOrder[num_buckets]    =   {};
+
+        for (size_t k = 0; k != numKeys; ++k)
+        {
+            ++starts[buckets[k] + 1];
+        }
+        for (size_t b = 0; b != num_buckets; ++b)
+        {
+            starts[b + 1] += starts[b];
+        }
+        for (size_t b = 0; b != num_buckets; ++b)
+        {
+            ++sizeStarts[numKeys - (starts[b + 1] - starts[b]) + 1];
+        }
+        for (size_t k = 0; k != numKeys; ++k)
+        {
+            order[starts[buckets[k]]++] = k;
+        }
+        for (size_t b = num_buckets; 0 != b; --b)
+        {
+            starts[b] = starts[b - 1];
+        }
+        starts[0] = 0;
+        for (size_t z = 0; z != numKeys + 1; ++z)
+        {
+            sizeStarts[z + 1] += sizeStarts[z];
+        }
+        for (size_t b = 0; b != num_buckets; ++b)
+        {
+            bucketOrder[sizeStarts[numKeys - (starts[b + 1] - starts[b])]++] = b;
+        }
+
+        /* 4. place the non-empty buckets, largest first, finding for each
+         * the first seed that maps all its keys to distinct empty slots
+         */
+
+        for (size_t i = 0; i != num_slots; ++i)
+        {
+            m_slots[i] = -1;
+        }
+
+        for (size_t o = 0; o != num_buckets; ++o)
+        {
+            size_t const b      =   bucketOrder[o];
+            size_t const first  =   starts[b];
+            size_t const last   =   starts[b + 1];
+
+            if (first == last)
+            {
+                break;
+            }
+
+            unsigned long seed = 1;
+
+            for (;; ++seed)
+            {
+                size_t j = first;
+
+                for (; j != last; ++j)
+                {
+                    size_t const k      =   order[j];
+                    size_t const slot   =   ximpl::static_specifications_hash_(keys[k], lengths[k], seed) & (num_slots - 1);
+
+                    if (-1 != m_slots[slot])
+                    {
+                        break;
+                    }
+
+                    m_slots[slot] = indexes[k];
+                }
+
+                if (last == j)
+                {
+                    break;
+                }
+
+                /* undo the placements thus far */
+                for (; first != j; --j)
+                {
+                    size_t const k = order[j - 1];
+
+                    m_slots[ximpl::static_specifications_hash_(keys[k], lengths[k], seed) & (num_slots - 1)] = -1;
+                }
+
+                if (0xffffUL == seed)
+                {
+                    ximpl::static_specifications_no_perfect_hash();
+                }
+            }
+
+            m_seeds[b] = seed;
+        }
+    }
+
+    /* Must be kept in step with clasp_prefix_trie_build_() */
+    constexpr
+    void
+    build_trie_(
+        clasp_specification_t const (&specifications)[N]
+    )
+    {
+        for (size_t i = 0; max_trie_nodes != i; ++i)
+        {
+            m_trieNodes[i] = clasp_prefix_trie_node_t{ -1, 0, 0, -1, -1, -1, -1, 0, -1 };
+        }
+        m_numTrieNodes = 1;
+
+        for (size_t i = 0; CLASP_ARGTYPE_INVALID != specifications[i].type; ++i)
+        {
+            bool                        hasDefault  =   false;
+            clasp_char_t const* const   name        =   trie_name_(specifications[i]);
+            size_t const                cchName     =   (nullptr == name) ? 0 : ximpl::static_specifications_mapped_length_(name, &hasDefault);
+            int const                   spec    =   static_cast<int>(i);
+            int                         node    =   0;
+            size_t                      pos     =   0;
+
+            if (0 == cchName)
+            {
+                continue;
+            }
+
+            for (;;)
+            {
+                int                 child   =   m_trieNodes[node].firstChild;
+                int                 prev    =   -1;
+                clasp_char_t const* label   =   nullptr;
+
+                if (cchName == pos)
+                {
+                    set_trie_terminal_(specifications, node, spec);
+
+                    break;
+                }
+
+                for (; -1 != child; prev = child, child = m_trieNodes[child].nextSibling)
+                {
+                    label = trie_label_(specifications, m_trieNodes[child]);
+
+                    if (name[pos] == label[0])
+                    {
+                        break;
+                    }
+                }
+
+                if (-1 == child)
+                {
+                    child = static_cast<int>(m_numTrieNodes++);
+
+                    m_trieNodes[child] = clasp_prefix_trie_node_t{ spec, static_cast<int>(pos), static_cast<int>(cchName - pos), node, -1, -1, -1, 0, -1 };
+
+                    (-1 == prev ? m_trieNodes[node].firstChild : m_trieNodes[prev].nextSibling) = child;
+
+                    set_trie_terminal_(specifications, child, spec);
+
+                    break;
+                }
+
+                size_t m = 1;
+
+                for (; m != static_cast<size_t>(m_trieNodes[child].labelLength) && pos + m != cchName && name[pos + m] == label[m]; ++m)
+                {}
+
+                if (m != static_cast<size_t>(m_trieNodes[child].labelLength))
+                {
+                    int const mid = static_cast<int>(m_numTrieNodes++);
+
+                    m_trieNodes[mid] = clasp_prefix_trie_node_t{ m_trieNodes[child].labelSpecIndex, m_trieNodes[child].labelOffset, static_cast<int>(m), node, child, m_trieNodes[child].nextSibling, -1, m_trieNodes[child].numNames, m_trieNodes[child].anySpecIndex };
+
+                    (-1 == prev ? m_trieNodes[node].firstChild : m_trieNodes[prev].nextSibling) = mid;
+
+                    m_trieNodes[child].parent       =   mid;
+                    m_trieNodes[child].labelOffset  +=  static_cast<int>(m);
+                    m_trieNodes[child].labelLength  -=  static_cast<int>(m);
+                    m_trieNodes[child].nextSibling  =   -1;
+
+                    child = mid;
+                }
+
+                node    =   child;
+                pos     +=  m;
+            }
+        }
+    }
+
+    /* as per clasp_prefix_trie_get_name_() */
+    static
+    constexpr
+    clasp_char_t const*
+    trie_name_(
+        clasp_specification_t const& specification
+    )
+    {
+        clasp_char_t const* const ma = specification.mappedArgument;
+
+        if ((   CLASP_ARGTYPE_FLAG == specification.type ||
+                CLASP_ARGTYPE_OPTION == specification.type) &&
+            nullptr != ma &&
+            '-' == ma[0] &&
+            '-' == ma[1])
+        {
+            return ma + 2;
+        }
+
+        return nullptr;
+    }
+
+    static
+    constexpr
+    clasp_char_t const*
+    trie_label_(
+        clasp_specification_t const (&specifications)[N]
+    ,   clasp_prefix_trie_node_t const& node
+    )
+    {
+        return specifications[node.labelSpecIndex].mappedArgument + 2 + node.labelOffset;
+    }
+
+    static
+    constexpr
+    bool
+    is_defaulted_(
+        clasp_specification_t const& specification
+    )
+    {
+        bool hasDefault = false;
+
+        ximpl::static_specifications_mapped_length_(specification.mappedArgument, &hasDefault);
+
+        return hasDefault;
+    }
+
+    /* as per clasp_prefix_trie_set_terminal_() */
+    constexpr
+    void
+    set_trie_terminal_(
+        clasp_specification_t const (&specifications)[N]
+    ,   int                         node
+    ,   int                         spec
+    )
+    {
+        int const previous = m_trieNodes[node].specIndex;
+
+        if (-1 == previous)
+        {
+            m_trieNodes[node].specIndex = spec;
+
+            for (; -1 != node; node = m_trieNodes[node].parent)
+            {
+                ++m_trieNodes[node].numNames;
+
+                if (-1 == m_trieNodes[node].anySpecIndex)
+                {
+                    m_trieNodes[node].anySpecIndex = spec;
+                }
+            }
+        }
+        else
+        if (is_defaulted_(specifications[previous]) &&
+            !is_defaulted_(specifications[spec]))
+        {
+            m_trieNodes[node].specIndex = spec;
+
+            for (; -1 != node; node = m_trieNodes[node].parent)
+            {
+                if (previous == m_trieNodes[node].anySpecIndex)
+                {
+                    m_trieNodes[node].anySpecIndex = spec;
+                }
+            }
+        }
+    }
+
+private: // fields
+    clasp_specification_t const*    m_specifications;
+    unsigned long                   m_seeds[num_buckets];
+    int                             m_slots[num_slots];
+    int                             m_shortFlags[CLASP_SHORT_FLAG_TABLE_SIZE];
+    size_t                          m_numWideShortFlags;
+    clasp_short_flag_t              m_wideShortFlags[max_keys];
+    size_t                          m_numTrieNodes;
+    clasp_prefix_trie_node_t        m_trieNodes[max_trie_nodes];
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+/** Parses the command-line against static specifications, using their
+ * (compile-time) index to look up flags and options
+ */
+template <size_t N>
+inline
+int
+parseArguments(
+    unsigned                            flags
+,   int                                 argc
+,   clasp_char_t*                       argv[]
+,   static_specifications<N> const&     specifications
+,   clasp_diagnostic_context_t const*   ctxt
+,   arguments_t const**                 args
+)
+{
+    clasp_specification_index_t const index = specifications.index();
+
+    return clasp_parseArgumentsWithIndex(flags, argc, argv, &index, ctxt, args);
+}
+
+/** Parses the command-line against static specifications, using their
+ * (compile-time) index to look up flags and options
+ */
+template <size_t N>
+inline
+int
+parseArguments(
+    unsigned                            flags
+,   int                                 argc
+,   clasp_char_t const* const           argv[]
+,   static_specifications<N> const&     specifications
+,   clasp_diagnostic_context_t const*   ctxt
+,   arguments_t const**                 args
+)
+{
+    clasp_specification_index_t const index = specifications.index();
+
+    return clasp_parseArgumentsWithIndex(flags, argc, const_cast<clasp_char_t**>(argv), &index, ctxt, args);
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+} /* namespace clasp */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !CLASP_INCL_CLASP_HPP_STATIC_SPECIFICATIONS */
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
@@ -0,0 +1,513 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    clasp/string_view.hpp
+ *
+ * Purpose: std::basic_string_view-based, allocation-free access to arguments.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * Home:    https://github.com/synesissoftware/CLASP/
+ *
+ * Copyright (c) 2026, Matthew Wilson
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer;
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution;
+ * - Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/** \file clasp/string_view.hpp
+ *
+ * \brief [C++17-only] <code>std::basic_string_view</code>-based,
+ *   allocation-free access to arguments.
+ */
+
+#ifndef CLASP_INCL_CLASP_HPP_STRING_VIEW
+#define CLASP_INCL_CLASP_HPP_STRING_VIEW
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * version information
+ */
+
+#ifndef CLASP_DOCUMENTATION_SKIP_SECTION
+# define CLASP_VER_CLASP_HPP_STRING_VIEW_MAJOR      1
+# define CLASP_VER_CLASP_HPP_STRING_VIEW_MINOR      0
+# define CLASP_VER_CLASP_HPP_STRING_VIEW_REVISION   1
+# define CLASP_VER_CLASP_HPP_STRING_VIEW_EDIT       1
+#endif /* !CLASP_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef __cplusplus
+# error This file is only compatible with C++ compilation
+#endif /* !__cplusplus */
+
+#if __cplusplus < 201703L && \
+    (   !defined(_MSVC_LANG) || \
+        _MSVC_LANG < 201703L)
+# error This file requires C++17 or later
+#endif
+
+/* CLASP header files */
+#include <clasp/clasp.hpp>
+
+/* Standard header files */
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+namespace clasp
+{
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * typedefs
+ */
+
+/// The string view type corresponding to clasp_char_t
+typedef std::basic_string_view<
+    clasp_char_t
+>                                                           string_view_t;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** A non-owning view of a contiguous sequence of arguments, in the manner
+ * of <code>std::span<clasp_argument_t const></code>
+ */
+class argument_span
+{
+public: // types
+    typedef clasp_argument_t                                value_type;
+    typedef clasp_argument_t const&                         reference;
+    typedef clasp_argument_t const&                         const_reference;
+    typedef clasp_argument_t const*                         pointer;
+    typedef clasp_argument_t const*                         const_pointer;
+    typedef clasp_argument_t const*                         iterator;
+    typedef clasp_argument_t const*                         const_iterator;
+    typedef size_t                                          size_type;
+    typedef ptrdiff_t                                       difference_type;
+    typedef argument_span                                   class_type;
+
+public: // construction
+    /// Constructs an empty instance
+    constexpr
+    argument_span() noexcept
+        : m_ptr(NULL)
+        , m_len(0)
+    {}
+    /// Constructs an instance over the given arguments
+    constexpr
+    argument_span(
+        const_pointer   ptr
+    ,   size_type       len
+    ) noexcept
+        : m_ptr(ptr)
+        , m_len(len)
+    {}
+
+public: // accessors
+    /// The number of arguments
+    constexpr size_type     size() const noexcept
+    {
+        return m_len;
+    }
+    /// Indicates whether there are no arguments
+    constexpr bool          empty() const noexcept
+    {
+        return 0 == m_len;
+    }
+    /// Pointer to the first argument
+    constexpr const_pointer data() const noexcept
+    {
+        return m_ptr;
+    }
+    /// The argument at the given index, which must be less than size()
+    constexpr reference     operator [](size_type index) const noexcept
+    {
+        return m_ptr[index];
+    }
+    /// The first argument; the span must not be empty
+    constexpr reference     front() const noexcept
+    {
+        return m_ptr[0];
+    }
+    /// The last argument; the span must not be empty
+    constexpr reference     back() const noexcept
+    {
+        return m_ptr[m_len - 1];
+    }
+
+public: // iteration
+    constexpr const_iterator begin() const noexcept
+    {
+        return m_ptr;
+    }
+    constexpr const_iterator end() const noexcept
+    {
+        return m_ptr + m_len;
+    }
+
+private: // fields
+    const_pointer   m_ptr;
+    size_type       m_len;
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+
+#ifndef CLASP_DOCUMENTATION_SKIP_SECTION
+
+namespace ximpl
+{
+    template <typename T>
+    struct string_view_dependent_false_
+        : std::false_type
+    {};
+
+    /* Converts the given value to T, which may be string_view_t, a
+     * C-style string, bool, any integral type, float, or double
+     */
+    template <typename T>
+    conversion_status_
+    string_view_convert_(
+        clasp_slice_t const&    value
+    ,   T*                      result
+    ,   char const**            invalidFormatMessage
+    )
+    {
+        if constexpr (std::is_same<T, string_view_t>::value)
+        {
+            *result = string_view_t(value.ptr, value.len);
+
+            return conversion_succeeded_;
+        }
+        else if constexpr (std::is_same<T, clasp_char_t const*>::value)
+        {
+            *result = value.ptr;
+
+            return conversion_succeeded_;
+        }
+        else if constexpr (std::is_same<T, bool>::value)
+        {
+            bool        wasStrictlyCorrect;
+            bool const  b = boolean_conversion_traits_::convert(value, &wasStrictlyCorrect);
+
+            *invalidFormatMessage = "option value must be a boolean";
+
+            if (!wasStrictlyCorrect)
+            {
+                return conversion_invalidFormat_;
+            }
+
+            *result = b;
+
+            return conversion_succeeded_;
+        }
+        else if constexpr (std::is_integral<T>::value)
+        {
+            *invalidFormatMessage = "value is not an integer for option";
+
+            return integer_conversion_traits_<T>::convert(value, result);
+        }
+        else if constexpr (std::is_same<T, float>::value ||
+                           std::is_same<T, double>::value)
+        {
+            *invalidFormatMessage = "value is not a real number for option";
+
+            return real_conversion_traits_<T>::convert(value, result);
+        }
+        else
+        {
+            static_assert(string_view_dependent_false_<T>::value, "unsupported option value type");
+
+            return conversion_invalidFormat_;
+        }
+    }
+
+    template <typename T>
+    std::optional<T>
+    string_view_check_option_(
+        clasp_arguments_t const*    args
+    ,   bool                        ignoreUsed
+    ,   string_view_t               optionName
+    )
+    {
+        { for (size_t i = 0; i != args->numOptions; ++i)
+        {
+            clasp_argument_t const& arg = args->options[i];
+
+            if (ignoreUsed &&
+                clasp_argumentIsUsed(args, &arg))
+            {
+                continue;
+            }
+
+            if (string_view_t(arg.resolvedName.ptr, arg.resolvedName.len) == optionName)
+            {
+                T                           result;
+                char const*                 invalidFormatMessage    =   "invalid value for option";
+                conversion_status_ const    status                  =   string_view_convert_(arg.value, &result, &invalidFormatMessage);
+
+                clasp_useArgument(args, &arg);
+
+                if (conversion_succeeded_ != status)
+                {
+                    // The name is copied only in order to report the failure
+
+                    throw_if_conversion_failed_(status, invalidFormatMessage, clasp_string_t(optionName).c_str());
+                }
+
+                return result;
+            }
+        }}
+
+        return std::nullopt;
+    }
+} /* namespace ximpl */
+
+#endif /* !CLASP_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+/** Obtains a view of the given slice
+ */
+constexpr
+string_view_t
+to_string_view(
+    clasp_slice_t const& slice
+) noexcept
+{
+    return string_view_t(slice.ptr, slice.len);
+}
+
+/** Obtains a view of the given argument's given name
+ */
+constexpr
+string_view_t
+given_name(
+    clasp_argument_t const& arg
+) noexcept
+{
+    return to_string_view(arg.givenName);
+}
+
+/** Obtains a view of the given argument's resolved name
+ */
+constexpr
+string_view_t
+resolved_name(
+    clasp_argument_t const& arg
+) noexcept
+{
+    return to_string_view(arg.resolvedName);
+}
+
+/** Obtains a view of the given argument's value
+ */
+constexpr
+string_view_t
+value(
+    clasp_argument_t const& arg
+) noexcept
+{
+    return to_string_view(arg.value);
+}
+
+/** Obtains a view of the program name
+ */
+constexpr
+string_view_t
+program_name(
+    clasp_arguments_t const* args
+) noexcept
+{
+    return to_string_view(args->programName);
+}
+
+/** Obtains a span of all the arguments
+ */
+constexpr
+argument_span
+arguments(
+    clasp_arguments_t const* args
+) noexcept
+{
+    return argument_span(args->arguments, args->numArguments);
+}
+
+/** Obtains a span of the flags and options
+ */
+constexpr
+argument_span
+flags_and_options(
+    clasp_arguments_t const* args
+) noexcept
+{
+    return argument_span(args->flagsAndOptions, args->numFlagsAndOptions);
+}
+
+/** Obtains a span of the flags
+ */
+constexpr
+argument_span
+flags(
+    clasp_arguments_t const* args
+) noexcept
+{
+    return argument_span(args->flags, args->numFlags);
+}
+
+/** Obtains a span of the options
+ */
+constexpr
+argument_span
+options(
+    clasp_arguments_t const* args
+) noexcept
+{
+    return argument_span(args->options, args->numOptions);
+}
+
+/** Obtains a span of the values
+ */
+constexpr
+argument_span
+values(
+    clasp_arguments_t const* args
+) noexcept
+{
+    return argument_span(args->values, args->numValues);
+}
+
+/** Checks whether the given flag was specified, and marks it used
+ *
+ * \param args The arguments structure
+ * \param flagName The (resolved) name of the flag
+ */
+inline
+bool
+check_flag(
+    clasp_arguments_t const*    args
+,   string_view_t               flagName
+)
+{
+    { for (size_t i = 0; i != args->numFlags; ++i)
+    {
+        clasp_argument_t const& arg = args->flags[i];
+
+        if (to_string_view(arg.resolvedName) == flagName)
+        {
+            clasp_useArgument(args, &arg);
+
+            return true;
+        }
+    }}
+
+    return false;
+}
+
+/** Obtains the value of the first option of the given name, if any, and
+ * marks it used
+ *
+ * \tparam T The result type: string_view_t (the default), a C-style
+ *   string, <code>bool</code>, any integral type, <code>float</code>, or
+ *   <code>double</code>
+ *
+ * \param args The arguments structure
+ * \param optionName The (resolved) name of the option
+ *
+ * \return The (converted) value, or <code>std::nullopt</code> if the option
+ *   was not specified
+ *
+ * \exception clasp::invalid_option_value_exception Thrown if the value
+ *   cannot be converted to T
+ *
+ * \note No memory is allocated, other than in reporting a failure to
+ *   convert the value
+ */
+template <typename T = string_view_t>
+std::optional<T>
+check_option(
+    clasp_arguments_t const*    args
+,   string_view_t               optionName
+)
+{
+    return ::clasp::ximpl::string_view_check_option_<T>(args, false, optionName);
+}
+
+/** Obtains the value of the first option of the given name that has not
+ * yet been used, if any, and marks it used
+ *
+ * \see check_option()
+ */
+template <typename T = string_view_t>
+std::optional<T>
+check_next_option(
+    clasp_arguments_t const*    args
+,   string_view_t               optionName
+)
+{
+    return ::clasp::ximpl::string_view_check_option_<T>(args, true, optionName);
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+} /* namespace clasp */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !CLASP_INCL_CLASP_HPP_STRING_VIEW */
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
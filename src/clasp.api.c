@@ -4,7 +4,7 @@
  * Purpose: CLASP API.
  *
  * Created: 4th June 2008
- * Updated: 11th March 2025
+ * Updated: 19th October 2026
  *
  * Home:    https://github.com/synesissoftware/CLASP/
  *
@@ -71,6 +71,7 @@
 #endif /* CLASP_CMDLINE_ARGS_USE_RECLS */
 
 #include <errno.h>
+#include <limits.h>
 #include <stdlib.h>
 
 
@@ -111,12 +112,8 @@ For two reasons, we can only call recls *once* for each wildcard argument:
 #define CLASP_SECTION_MIN_                                  (1)
 #define CLASP_SECTION_MAX_                                  (1000)
 
-
-/* /////////////////////////////////////////////////////////////////////////
- * internal flags
- */
-
-#define CLASP_ARG_F_USED_                                   (0x0002)
+#define CLASP_SERIALIZED_MAGIC_                             "CLASPSA1"
+#define CLASP_SERIALIZED_ALIGNMENT_                         (16)
 
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -125,6 +122,8 @@ For two reasons, we can only call recls *once* for each wildcard argument:
 
 #define CLASP_STRING_NULL_OR_EMPTY_(s)                      (NULL == (s) || '\0' == 0[(s)])
 
+#define CLASP_SERIALIZED_ROUND_(cb)                         (((cb) + (CLASP_SERIALIZED_ALIGNMENT_ - 1)) & ~stlsoft_static_cast(size_t, CLASP_SERIALIZED_ALIGNMENT_ - 1))
+
 
 /* /////////////////////////////////////////////////////////////////////////
  * helper functions
@@ -193,6 +192,7 @@ clasp_evaluate_specification_index_(
 struct clasp_expanded_args_t
 {
     clasp_diagnostic_context_t const*   ctxt;
+    clasp_parse_statistics_t*           stats;      /*!< The statistics, if being collected, in which allocations are counted */
     size_t                              size;       /*!< The current extent of (i.e. number of items in) args, the array of string pointers */
     size_t                              capacity;   /*!< Total capacity of array of pointers */
     clasp_char_t const**                args;       /*!< The array of string pointers */
@@ -202,6 +202,28 @@ struct clasp_expanded_args_t
 
 #ifdef CLASP_CMDLINE_ARGS_USE_RECLS
 
+/* Duplicates the given string, as clasp_strdup_(), counting the allocation
+ * in the statistics of the expanded arguments, if being collected
+ */
+static
+clasp_char_t*
+clasp_expanded_strdup_(
+    struct clasp_expanded_args_t const* expandedArgs
+,   clasp_char_t const*                 s
+)
+{
+    clasp_char_t* const r = clasp_strdup_(expandedArgs->ctxt, CLASP_ALLOC_SITE_WILDCARD_STRING, s);
+
+    if (NULL != r &&
+        NULL != expandedArgs->stats)
+    {
+        ++expandedArgs->stats->numAllocations;
+        expandedArgs->stats->numBytesAllocated += (1 + clasp_strlen_(s)) * sizeof(clasp_char_t);
+    }
+
+    return r;
+}
+
 static
 int
 RECLS_CALLCONV_DEFAULT clasp_recls_callback(
@@ -214,7 +236,7 @@ RECLS_CALLCONV_DEFAULT clasp_recls_callback(
     if (expandedArgs->size == expandedArgs->capacity)
     {
         size_t                  newCapacity =   (expandedArgs->capacity + CLASP_EXPANDEDARGS_ADDITIONAL) * sizeof(clasp_char_t*);
-        clasp_char_t const**    newArgs     =   (clasp_char_t const**)clasp_realloc_(expandedArgs->ctxt, (void*)expandedArgs->args, newCapacity);
+        clasp_char_t const**    newArgs     =   (clasp_char_t const**)clasp_statistics_realloc_(expandedArgs->ctxt, expandedArgs->stats, CLASP_ALLOC_SITE_WILDCARD_VECTOR, (void*)expandedArgs->args, newCapacity);
 
         if (NULL == newArgs)
         {
@@ -228,7 +250,7 @@ RECLS_CALLCONV_DEFAULT clasp_recls_callback(
     }
 
     /* Now we have enough space in the array, and we need to add the item */
-    expandedArgs->args[expandedArgs->size] = clasp_strdup_(expandedArgs->ctxt, hEntry->searchRelativePath.begin);
+    expandedArgs->args[expandedArgs->size] = clasp_expanded_strdup_(expandedArgs, hEntry->searchRelativePath.begin);
 
     if (NULL == expandedArgs->args[expandedArgs->size])
     {
@@ -333,10 +355,14 @@ struct clasp_arguments_x_t
     clasp_diagnostic_context_t  ctxt;
     size_t                      cb;
     clasp_char_t*               stringsBase;
-    void*                       reserved0;
-    size_t                      reserved1;
+    void*                       arena;  /* non-NULL iff allocated by clasp_parseArgumentsBatch(), or mapped by clasp_mapArguments(), in which case it is the blob */
+    clasp_stream_chunk_t_*      chunks; /* the chunks holding the values appended by clasp_appendValuesFromStream(), released with the block */
+    unsigned                    flags;  /* the parsing flags, reapplied by clasp_appendArguments() */
     void const*                 specifications;
-    size_t                      reserved2;
+    clasp_specification_index_t const*  index;  /* the index, and */
+    clasp_value_schema_t const*         schema; /* the schema, of the parse, reapplied by clasp_appendArguments() */
+    clasp_parse_statistics_t*   statistics; /* non-NULL iff collected, in which case it follows the block */
+    clasp_typed_value_t*        typedValues; /* non-NULL iff decoded by clasp_parseArgumentsWithSchema(), in which case they end the strings area */
     clasp_argument_t            args[1];
 };
 #ifndef __cplusplus
@@ -367,10 +393,12 @@ clasp_diagnostic_context_from_args_(
 static
 clasp_specification_t const*
 clasp_lookup_alias_len_(
-    clasp_specification_t const specifications[]
-,   clasp_char_t const*         arg
-,   size_t                      cchArg
-,   unsigned                    flags
+    clasp_parse_statistics_t*           stats
+,   clasp_specification_t const         specifications[]
+,   clasp_specification_index_t const*  index
+,   clasp_char_t const*                 arg
+,   size_t                              cchArg
+,   unsigned                            flags
 );
 
 static
@@ -381,10 +409,77 @@ clasp_lookup_alias_(
 ,   unsigned                    flags
 )
 {
-    return clasp_lookup_alias_len_(specifications, arg, clasp_strlen_(arg), flags);
+    return clasp_lookup_alias_len_(NULL, specifications, NULL, arg, clasp_strlen_(arg), flags);
 }
 #endif
 
+/* Compares as clasp_strncmp_(), counting the comparison in stats, if not
+ * NULL
+ */
+static
+int
+clasp_counted_strncmp_(
+    clasp_parse_statistics_t*   stats
+,   clasp_char_t const*         s1
+,   clasp_char_t const*         s2
+,   size_t                      n
+)
+{
+    CLASP_STATISTICS_COUNT_(stats, numStringComparisons);
+
+    return clasp_strncmp_(s1, s2, n);
+}
+
+/* Looks up the given alias via the given index, which yields the same
+ * specification as would clasp_lookup_alias_len_() (other than in
+ * matching names exactly), by checking that the argument is a key of the
+ * specification in the slot to which it hashes.
+ */
+clasp_specification_t const*
+clasp_lookup_indexed_alias_len_(
+    clasp_parse_statistics_t*           stats
+,   clasp_specification_index_t const*  index
+,   clasp_char_t const*                 arg
+,   size_t                              cchArg
+,   unsigned                            flags
+)
+{
+    unsigned long const seed = index->seeds[clasp_hashSpecificationKey(arg, cchArg, 0) & (index->numBuckets - 1)];
+
+    CLASP_ASSERT(NULL != arg);
+
+    if (0 != seed)
+    {
+        int const specIndex = index->slots[clasp_hashSpecificationKey(arg, cchArg, seed) & (index->numSlots - 1)];
+
+        if (specIndex >= 0)
+        {
+            clasp_specification_t const* const alias = index->specifications + specIndex;
+
+            if (NULL != alias->name &&
+                clasp_strlen_(alias->name) == cchArg &&
+                0 == clasp_counted_strncmp_(stats, alias->name, arg, cchArg))
+            {
+                return alias;
+            }
+
+            if (NULL != alias->mappedArgument)
+            {
+                clasp_char_t const* const   equal   =   clasp_strchreq_(alias->mappedArgument, flags);
+                size_t const                len     =   (NULL == equal) ? clasp_strlen_(alias->mappedArgument) : (size_t)(equal - alias->mappedArgument);
+
+                if (len == cchArg &&
+                    0 == clasp_counted_strncmp_(stats, alias->mappedArgument, arg, cchArg))
+                {
+                    return alias;
+                }
+            }
+        }
+    }
+
+    return NULL;
+}
+
 /* Looks up the given alias in the specifications vector, searching first for the
  * alias, then for non-defaulted mapped arguments, then for defaulted
  * mapped arguments.
@@ -397,14 +492,23 @@ clasp_lookup_alias_(
 static
 clasp_specification_t const*
 clasp_lookup_alias_len_(
-    clasp_specification_t const specifications[]
-,   clasp_char_t const*         arg
-,   size_t                      cchArg
-,   unsigned                    flags
+    clasp_parse_statistics_t*           stats
+,   clasp_specification_t const         specifications[]
+,   clasp_specification_index_t const*  index
+,   clasp_char_t const*                 arg
+,   size_t                              cchArg
+,   unsigned                            flags
 )
 {
     ((void)flags);
 
+    CLASP_STATISTICS_COUNT_(stats, numAliasLookups);
+
+    if (NULL != index)
+    {
+        return clasp_lookup_indexed_alias_len_(stats, index, arg, cchArg, flags);
+    }
+
     if (NULL != specifications)
     {
         CLASP_ASSERT(NULL != arg);
@@ -415,7 +519,7 @@ clasp_lookup_alias_len_(
         {
             if (NULL != alias->name)
             {
-                if (0 == clasp_strncmp_(alias->name, arg, cchArg))
+                if (0 == clasp_counted_strncmp_(stats, alias->name, arg, cchArg))
                 {
                     return alias;
                 }
@@ -436,7 +540,7 @@ clasp_lookup_alias_len_(
 
                     if (len == cchArg)
                     {
-                        if (0 == clasp_strncmp_(alias->mappedArgument, arg, cchArg))
+                        if (0 == clasp_counted_strncmp_(stats, alias->mappedArgument, arg, cchArg))
                         {
                             return alias;
                         }
@@ -458,7 +562,7 @@ clasp_lookup_alias_len_(
                     const size_t len = (size_t)(equal - alias->mappedArgument);
 
                     if (len == cchArg &&
-                        0 == clasp_strncmp_(alias->mappedArgument, arg, cchArg))
+                        0 == clasp_counted_strncmp_(stats, alias->mappedArgument, arg, cchArg))
                     {
                         return alias;
                     }
@@ -470,6 +574,199 @@ clasp_lookup_alias_len_(
     return NULL;
 }
 
+/* Looks up the given long (double-hyphen) argument, as
+ * clasp_lookup_alias_len_(), and then, if not found and a prefix trie is
+ * given, as an unambiguous prefix of a long name. Ambiguity is logged only
+ * if ctxt is not NULL.
+ */
+static
+clasp_specification_t const*
+clasp_lookup_long_alias_len_(
+    clasp_parse_statistics_t*           stats
+,   clasp_diagnostic_context_t const*   ctxt
+,   clasp_prefix_trie_t_ const*         trie
+,   clasp_specification_t const         specifications[]
+,   clasp_specification_index_t const*  index
+,   clasp_char_t const*                 arg
+,   size_t                              cchArg
+,   unsigned                            flags
+)
+{
+    clasp_specification_t const* const alias = clasp_lookup_alias_len_(stats, specifications, index, arg, cchArg, flags);
+
+    if (NULL == alias &&
+        NULL != trie)
+    {
+        return clasp_prefix_trie_lookup_(ctxt, trie, specifications, arg, cchArg);
+    }
+
+    return alias;
+}
+
+/* A direct table, indexed by character, of the specifications of the
+ * single-character flags - "-c" - as found by clasp_lookup_alias_len_(),
+ * for parsing without an index. It is built at most once per parse, on the
+ * first flag cluster, and is shared by the sizing and parsing passes.
+ */
+typedef struct clasp_short_flags_t_ clasp_short_flags_t_;
+
+struct clasp_short_flags_t_
+{
+    clasp_bool_t    built;
+    int             entries[CLASP_SHORT_FLAG_TABLE_SIZE];
+};
+
+/* Builds the table in the order in which clasp_lookup_alias_len_()
+ * searches - names (of which "-c" is a leading part), then non-defaulted
+ * mapped arguments, then defaulted mapped arguments - so that the first
+ * specification found wins.
+ */
+static
+void
+clasp_short_flags_build_(
+    clasp_short_flags_t_*       table
+,   clasp_specification_t const specifications[]
+,   unsigned                    flags
+)
+{
+    { size_t i; for (i = 0; i != CLASP_SHORT_FLAG_TABLE_SIZE; ++i)
+    {
+        table->entries[i] = -1;
+    }}
+
+    { int pass; for (pass = 0; 3 != pass; ++pass)
+    {
+        { clasp_specification_t const* alias = specifications; for (; CLASP_ARGTYPE_INVALID != alias->type; ++alias)
+        {
+            clasp_char_t const* key = NULL;
+
+            if (0 == pass)
+            {
+                if (NULL != alias->name &&
+                    '-' == alias->name[0] &&
+                    '\0' != alias->name[1])
+                {
+                    key = alias->name;
+                }
+            }
+            else
+            if (NULL != alias->mappedArgument &&
+                '-' == alias->mappedArgument[0] &&
+                '\0' != alias->mappedArgument[1])
+            {
+                clasp_char_t const* const equal = clasp_strchreq_(alias->mappedArgument, flags);
+
+                if ((NULL != equal) == (2 == pass) &&
+                    (alias->mappedArgument + 2) == ((NULL == equal) ? (alias->mappedArgument + clasp_strlen_(alias->mappedArgument)) : equal))
+                {
+                    key = alias->mappedArgument;
+                }
+            }
+
+            if (NULL != key)
+            {
+                unsigned long const code = clasp_char_code_(key[1]);
+
+                if (code < CLASP_SHORT_FLAG_TABLE_SIZE &&
+                    table->entries[code] < 0)
+                {
+                    table->entries[code] = stlsoft_static_cast(int, alias - specifications);
+                }
+            }
+        }}
+    }}
+
+    table->built = clasp_true_v;
+}
+
+/* Looks up the single-character flag "-c", as part of a flag cluster,
+ * yielding the same specification as would clasp_lookup_alias_len_(), by
+ * a single load from the direct table of the index, if any, or else from
+ * the (lazily-built) given table; wide characters beyond the direct table
+ * are searched for in the wide table of the index, or else looked up as
+ * would be any other argument.
+ */
+static
+clasp_specification_t const*
+clasp_lookup_short_flag_(
+    clasp_parse_statistics_t*           stats
+,   clasp_short_flags_t_*               table
+,   clasp_specification_t const         specifications[]
+,   clasp_specification_index_t const*  index
+,   clasp_char_t                        ch
+,   unsigned                            flags
+)
+{
+    unsigned long const code = clasp_char_code_(ch);
+    int                 specIndex;
+
+    if (NULL != index &&
+        NULL != index->shortFlags)
+    {
+        CLASP_STATISTICS_COUNT_(stats, numAliasLookups);
+
+        if (code < CLASP_SHORT_FLAG_TABLE_SIZE)
+        {
+            specIndex = index->shortFlags[code];
+        }
+        else
+        {
+            size_t lo = 0;
+            size_t hi = index->numWideShortFlags;
+
+            for (specIndex = -1; lo != hi; )
+            {
+                size_t const        mid     =   lo + (hi - lo) / 2;
+                unsigned long const midCode =   clasp_char_code_(index->wideShortFlags[mid].character);
+
+                if (midCode == code)
+                {
+                    specIndex = index->wideShortFlags[mid].specIndex;
+
+                    break;
+                }
+                else if (midCode < code)
+                {
+                    lo = mid + 1;
+                }
+                else
+                {
+                    hi = mid;
+                }
+            }
+        }
+
+        return (specIndex < 0) ? NULL : (index->specifications + specIndex);
+    }
+
+    if (NULL == index &&
+        NULL != specifications &&
+        NULL != table &&
+        code < CLASP_SHORT_FLAG_TABLE_SIZE)
+    {
+        if (!table->built)
+        {
+            clasp_short_flags_build_(table, specifications, flags);
+        }
+
+        CLASP_STATISTICS_COUNT_(stats, numAliasLookups);
+
+        specIndex = table->entries[code];
+
+        return (specIndex < 0) ? NULL : (specifications + specIndex);
+    }
+
+    {
+        clasp_char_t flag[3];
+
+        flag[0] =   '-';
+        flag[1] =   ch;
+        flag[2] =   '\0';
+
+        return clasp_lookup_alias_len_(stats, specifications, index, flag, 2u, flags);
+    }
+}
+
 #if 0
 static
 clasp_bool_t
@@ -539,7 +836,6 @@ clasp_check_alias_duplicates_(
  * and returns the result as a slice.
  *
  */
-static
 size_t
 clasp_identify_programName_(
     unsigned                    flags
@@ -608,13 +904,17 @@ clasp_identify_programName_(
 static
 int
 clasp_calculate_sizes_(
-    unsigned                    flags
-,   int                         argc
-,   clasp_char_t*               argv[]
-,   clasp_specification_t const specifications[]
-,   size_t*                     numArgs
-,   size_t*                     cbStrings
-,   size_t*                     cbTotal
+    unsigned                            flags
+,   int                                 argc
+,   clasp_char_t*                       argv[]
+,   clasp_specification_t const         specifications[]
+,   clasp_specification_index_t const*  index
+,   clasp_prefix_trie_t_ const*         trie
+,   clasp_short_flags_t_*               shortFlags
+,   clasp_parse_statistics_t*           stats
+,   size_t*                             numArgs
+,   size_t*                             cbStrings
+,   size_t*                             cbTotal
 )
 {
     clasp_bool_t    nextArgumentIsValue         =   clasp_false_v;
@@ -686,7 +986,7 @@ clasp_calculate_sizes_(
 
                     if (NULL != equal1)
                     {
-                        clasp_specification_t const* const alias = clasp_lookup_alias_len_(specifications, arg, (size_t)(equal1 - arg), flags);
+                        clasp_specification_t const* const alias = clasp_lookup_long_alias_len_(stats, NULL, trie, specifications, index, arg, (size_t)(equal1 - arg), flags);
 
                         if (NULL != alias)
                         {
@@ -715,7 +1015,7 @@ clasp_calculate_sizes_(
                     {
                         /* = sign not specified */
 
-                        clasp_specification_t const* const alias = clasp_lookup_alias_len_(specifications, arg, argLen, flags);
+                        clasp_specification_t const* const alias = clasp_lookup_long_alias_len_(stats, NULL, trie, specifications, index, arg, argLen, flags);
 
                         if (NULL != alias)
                         {
@@ -749,7 +1049,7 @@ clasp_calculate_sizes_(
 
                                     if (!CLASP_STRING_NULL_OR_EMPTY_(alias->name) &&
                                         0 != nextArgLen &&
-                                        NULL == clasp_lookup_alias_len_(specifications, nextArg, nextArgLen, flags))
+                                        NULL == clasp_lookup_long_alias_len_(stats, NULL, trie, specifications, index, nextArg, nextArgLen, flags))
                                     {
                                         nextArgumentIsValue = clasp_true_v;
                                     }
@@ -807,7 +1107,7 @@ clasp_calculate_sizes_(
 
                     if (NULL != equal2)
                     {
-                        clasp_specification_t const* const alias = clasp_lookup_alias_len_(specifications, arg, (size_t)(equal2 - arg), flags);
+                        clasp_specification_t const* const alias = clasp_lookup_alias_len_(stats, specifications, index, arg, (size_t)(equal2 - arg), flags);
 
                         if (NULL != alias &&
                             !CLASP_STRING_NULL_OR_EMPTY_(alias->mappedArgument))
@@ -841,7 +1141,7 @@ clasp_calculate_sizes_(
                     {
                         /* work out whether option or flag */
 
-                        clasp_specification_t const* const alias = clasp_lookup_alias_len_(specifications, arg, argLen, flags);
+                        clasp_specification_t const* const alias = clasp_lookup_alias_len_(stats, specifications, index, arg, argLen, flags);
 
                         if (NULL != alias)
                         {
@@ -917,11 +1217,7 @@ clasp_calculate_sizes_(
 
                             { size_t j; for (j = 1; '\0' != arg[j]; ++j)
                             {
-                                clasp_char_t                    flag[3] = { '-', '?', '\0' };
-                                clasp_specification_t const*    flagAlias;
-
-                                flag[1]     =   arg[j];
-                                flagAlias   =   clasp_lookup_alias_len_(specifications, flag, 2u, flags);
+                                clasp_specification_t const* const flagAlias = clasp_lookup_short_flag_(stats, shortFlags, specifications, index, arg[j], flags);
 
                                 if (NULL != flagAlias &&
                                     NULL != flagAlias->mappedArgument)
@@ -1084,86 +1380,13 @@ clasp_is_valid_alias_section_range_(
     return CLASP_SECTION_MIN_ <= i && CLASP_SECTION_MAX_ >= i;
 }
 
-
-/* /////////////////////////////////////////////////////////////////////////
- * API functions
- */
-
-CLASP_CALL(void)
-clasp_init_diagnostic_context(
-    clasp_diagnostic_context_t* dc
-,   void*                       context
-,   clasp_malloc_fn_t           pfnMalloc
-,   clasp_realloc_fn_t          pfnRealloc
-,   clasp_free_fn_t             pfnFree
-,   clasp_log_fn_t              pfnLog
-,   int const                   (*severities)[5]
-,   void*                       param
-)
-{
-    static int const severities_[5] = { 7, 4, 3, 1, 0 };
-
-    CLASP_ASSERT(NULL != dc);
-    CLASP_ASSERT((NULL == pfnMalloc && NULL == pfnRealloc && NULL == pfnFree) || (NULL != pfnMalloc && NULL != pfnRealloc && NULL != pfnFree));
-
-    if (NULL == severities)
-    {
-        /* Null Object (Variable) pattern */
-        severities = &severities_;
-    }
-
-    memset(dc, 0, sizeof(*dc));
-
-    dc->context         =   context;
-
-    dc->pfnMalloc       =   pfnMalloc;
-    dc->pfnRealloc      =   pfnRealloc;
-    dc->pfnFree         =   pfnFree;
-
-    dc->pfnLog          =   pfnLog;
-    dc->severities[0]   =   (*severities)[0];
-    dc->severities[1]   =   (*severities)[1];
-    dc->severities[2]   =   (*severities)[2];
-    dc->severities[3]   =   (*severities)[3];
-    dc->severities[4]   =   (*severities)[4];
-
-    dc->param           =   param;
-}
-
-static
 int
-clasp_parseArguments_NoWild_(
-    unsigned                            flags
-,   int                                 argc
-,   clasp_char_t*                       argv[]
-,   int                                 originalArgc
-,   clasp_char_t*                       originalArgv[]
-,   clasp_specification_t const         specifications[]
-,   clasp_diagnostic_context_t const*   ctxt
-,   clasp_arguments_t const**           args
-);
-
-CLASP_CALL(int)
-clasp_parseArguments(
-    unsigned                            flags
-,   int                                 argc
-,   clasp_char_t*                       argv[]
+clasp_validate_specifications_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_parse_statistics_t*           stats
 ,   clasp_specification_t const         specifications[]
-,   clasp_diagnostic_context_t const*   ctxt
-,   clasp_arguments_t const**           args
 )
 {
-    clasp_diagnostic_context_t  ctxt_;
-    int                         r;
-
-    ctxt = clasp_verify_context_(ctxt, &ctxt_, &r);
-    if (NULL == ctxt)
-    {
-        return r;
-    }
-
-    CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_DEBUG, CLASP_LITERAL_("clasp_parseArguments(): argc=%d"), argc);
-
     /* Validate the specifications. Must contain only:
      *
      * - flags
@@ -1226,887 +1449,2641 @@ clasp_parseArguments(
         }}
     }
 
-    if (!clasp_check_alias_duplicates_(ctxt, specifications))
     {
-        return EINVAL;
-    }
-
-#ifdef CLASP_CMDLINE_ARGS_USE_RECLS
+        double const        start   =   (NULL != stats) ? clasp_statistics_now_ns_() : 0.0;
+        clasp_bool_t const  unique  =   clasp_check_alias_duplicates_(ctxt, specifications);
 
-    {
-        struct clasp_expanded_args_t    expandedArgs;
+        if (NULL != stats)
+        {
+            stats->nsDuplicateChecking = clasp_statistics_now_ns_() - start;
+        }
 
-        expandedArgs.ctxt       =   ctxt;
-        expandedArgs.size       =   0;
-        expandedArgs.capacity   =   argc + CLASP_EXPANDEDARGS_ADDITIONAL;
-        expandedArgs.args       =   (clasp_char_t const**)clasp_malloc_(ctxt, expandedArgs.capacity * sizeof(clasp_char_t*));
-
-        if (NULL == expandedArgs.args)
+        if (!unique)
         {
-            CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_FATAL, CLASP_LITERAL_("could not allocate memory for wildcard expansion"));
-
-            return ENOMEM;
+            return EINVAL;
         }
-        else
-        {
-            int                     result          =   0;
-            const recls_uint32_t    reclsFlags      =   RECLS_F_FILES | RECLS_F_DIRECTORIES | RECLS_F_LINKS | RECLS_F_DEVICES;
-            clasp_char_t*           aposStrippedArg =   NULL;
-
-            memset((void*)expandedArgs.args, 0, sizeof(clasp_char_t*) * expandedArgs.capacity);
-
-            expandedArgs.args[0] = argv[0];
-            ++expandedArgs.size;
-
-            /* populate newArgv array using recls */
-            { int i; for (i = 1; i != argc; ++i)
-            {
-                recls_rc_t          rc;
-                clasp_char_t const* arg             =   argv[i];
-                size_t              len             =   clasp_strlen_(arg);
-                int                 isAposQuoted    =   0;
-
-                expandedArgs.numFiles = 0;
-
-                if (NULL != aposStrippedArg)
-                {
-                    clasp_free_(ctxt, aposStrippedArg);
-                    aposStrippedArg = NULL;
-                }
-
-/* TODO: Need to process ranges , e.g. "[abc].txt" */
+    }
 
-                if (len >= 2 &&
-                    '\'' == arg[0] &&
-                    '\'' == arg[len - 1])
-                {
-                    isAposQuoted = 1;
+    return 0;
+}
 
-                    aposStrippedArg = clasp_strdup_(ctxt, arg + isAposQuoted);
 
-                    if (NULL == aposStrippedArg)
-                    {
-                        goto cleanup;
-                    }
-                    else
-                    {
-                        aposStrippedArg[len - 2] = '\0';
-                        --len;
-                        arg = aposStrippedArg;
-                    }
-                }
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
 
-                if (CLASP_F_DONT_EXPAND_WILDCARDS_ON_WINDOWS == (CLASP_F_DONT_EXPAND_WILDCARDS_ON_WINDOWS & flags) ||
-                    NULL == clasp_strpbrk_(arg, CLASP_LITERAL_("*?")))
-                {
-                    rc = RECLS_RC_OK;
-                }
-                else
-                {
-                    if (0 == (CLASP_F_DO_EXPAND_WILDCARDS_IN_APOSQUOTES_ON_WINDOWS & flags) &&
-                        isAposQuoted)
-                    {
-                        rc = RECLS_RC_OK;
-                    }
-                    else
-                    {
-                        rc = Recls_SearchProcess(CLASP_LITERAL_("."), arg, reclsFlags, clasp_recls_callback, &expandedArgs);
-                    }
-                }
+CLASP_CALL(void)
+clasp_init_diagnostic_context(
+    clasp_diagnostic_context_t* dc
+,   void*                       context
+,   clasp_malloc_fn_t           pfnMalloc
+,   clasp_realloc_fn_t          pfnRealloc
+,   clasp_free_fn_t             pfnFree
+,   clasp_log_fn_t              pfnLog
+,   int const                   (*severities)[5]
+,   void*                       param
+)
+{
+    static int const severities_[5] = { 7, 4, 3, 1, 0 };
 
-                if (RECLS_SUCCEEDED(rc))
-                {
-                    if (0 == expandedArgs.numFiles)
-                    {
-                        CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_DEBUG, CLASP_LITERAL_("no expansion for argument [%.*s]"), (int)len, arg);
+    CLASP_ASSERT(NULL != dc);
+    CLASP_ASSERT((NULL == pfnMalloc && NULL == pfnRealloc && NULL == pfnFree) || (NULL != pfnMalloc && NULL != pfnRealloc && NULL != pfnFree));
 
-                        if (expandedArgs.size == expandedArgs.capacity)
-                        {
-                            size_t                  newCapacity =   (expandedArgs.capacity + CLASP_EXPANDEDARGS_ADDITIONAL) * sizeof(clasp_char_t*);
-                            clasp_char_t const**    newArgs     =   (clasp_char_t const**)clasp_realloc_(ctxt, (void*)expandedArgs.args, newCapacity);
+    if (NULL == severities)
+    {
+        /* Null Object (Variable) pattern */
+        severities = &severities_;
+    }
 
-                            if (NULL == newArgs)
-                            {
-                                CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_FATAL, CLASP_LITERAL_("could not allocate memory for wildcard expansion"));
+    memset(dc, 0, sizeof(*dc));
 
-                                result = ENOMEM;
+    dc->context         =   context;
 
-                                goto cleanup;
-                            }
-                            else
-                            {
-                                expandedArgs.args       =   newArgs;
-                                expandedArgs.capacity   =   newCapacity / sizeof(clasp_char_t*);
-                            }
-                        }
+    dc->pfnMalloc       =   pfnMalloc;
+    dc->pfnRealloc      =   pfnRealloc;
+    dc->pfnFree         =   pfnFree;
 
-                        expandedArgs.args[expandedArgs.size] = clasp_strdup_(ctxt, arg);
+    dc->pfnLog          =   pfnLog;
+    dc->severities[0]   =   (*severities)[0];
+    dc->severities[1]   =   (*severities)[1];
+    dc->severities[2]   =   (*severities)[2];
+    dc->severities[3]   =   (*severities)[3];
+    dc->severities[4]   =   (*severities)[4];
 
-                        if (NULL == expandedArgs.args[1])
-                        {
-                            CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_FATAL, CLASP_LITERAL_("could not allocate memory for wildcard expansion"));
+    dc->param           =   param;
 
-                            result = ENOMEM;
+    dc->cb              =   sizeof(*dc);
+}
 
-                            goto cleanup;
-                        }
+/* Obtains the given statistics, zeroed, if the context specifies that
+ * statistics are to be collected, or NULL otherwise
+ */
+static
+clasp_parse_statistics_t*
+clasp_parse_statistics_start_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_parse_statistics_t*           stats
+)
+{
+    if (0 == (CLASP_DC_F_COLLECT_STATISTICS & ctxt->flags))
+    {
+        return NULL;
+    }
 
-                        ++expandedArgs.size;
-                    }
-                    else
-                    {
-                        ; /* Nothing to do, because the callback has done it */
+    memset(stats, 0, sizeof(*stats));
 
-                        CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_DEBUG, CLASP_LITERAL_("%d matching files for wildcard [%.*s]"), (int)expandedArgs.numFiles, (int)len, arg);
-                    }
-                }
-                else if (RECLS_RC_USER_CANCELLED_SEARCH == rc)
-                {
-                    CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_FATAL, CLASP_LITERAL_("could not allocate memory for wildcard expansion"));
+    return stats;
+}
 
-                    result = ENOMEM;
+static
+int
+clasp_parseArguments_NoWild_(
+    unsigned                            flags
+,   int                                 argc
+,   clasp_char_t*                       argv[]
+,   int                                 originalArgc
+,   clasp_char_t*                       originalArgv[]
+,   clasp_specification_t const         specifications[]
+,   clasp_value_schema_t const          schema[]
+,   clasp_specification_index_t const*  index
+,   clasp_diagnostic_context_t const*   ctxt
+,   clasp_parse_statistics_t*           stats
+,   clasp_arguments_t const**           args
+);
 
-                    goto cleanup;
-                }
-                else
-                {
-                    CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_FATAL, CLASP_LITERAL_("wildcard expansion failed"));
+static
+void
+clasp_parseArguments_Fill_(
+    unsigned                            flags
+,   int                                 argc
+,   clasp_char_t*                       argv[]
+,   int                                 originalArgc
+,   clasp_char_t*                       originalArgv[]
+,   clasp_specification_t const         specifications[]
+,   clasp_value_schema_t const          schema[]
+,   clasp_specification_index_t const*  index
+,   clasp_prefix_trie_t_ const*         trie
+,   clasp_short_flags_t_*               shortFlags
+,   clasp_parse_statistics_t*           stats
+,   clasp_diagnostic_context_t const*   ctxt
+,   size_t                              numArgs
+,   size_t                              cbStrings
+,   size_t                              cbTotal
+,   clasp_arguments_x_t*                argsx
+);
 
-                    result = EIO;
+static
+int
+clasp_parseArguments_Validated_(
+    unsigned                            flags
+,   int                                 argc
+,   clasp_char_t*                       argv[]
+,   clasp_specification_t const         specifications[]
+,   clasp_value_schema_t const          schema[]
+,   clasp_specification_index_t const*  index
+,   clasp_diagnostic_context_t const*   ctxt
+,   clasp_parse_statistics_t*           stats
+,   clasp_arguments_t const**           args
+);
 
-                    goto cleanup;
-                }
-            }}
+CLASP_CALL(int)
+clasp_parseArguments(
+    unsigned                            flags
+,   int                                 argc
+,   clasp_char_t*                       argv[]
+,   clasp_specification_t const         specifications[]
+,   clasp_diagnostic_context_t const*   ctxt
+,   clasp_arguments_t const**           args
+)
+{
+    clasp_diagnostic_context_t  ctxt_;
+    int                         r;
+    clasp_parse_statistics_t    stats_;
+    clasp_parse_statistics_t*   stats;
 
-            /* now invoke on "new" args array */
+    ctxt = clasp_verify_context_(ctxt, &ctxt_, &r);
+    if (NULL == ctxt)
+    {
+        return r;
+    }
 
-            result = clasp_parseArguments_NoWild_(flags, (int)expandedArgs.size, expandedArgs.args, argc, argv, specifications, ctxt, args);
+    CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_DEBUG, CLASP_LITERAL_("clasp_parseArguments(): argc=%d"), argc);
 
+    stats = clasp_parse_statistics_start_(ctxt, &stats_);
 
-cleanup:
-            clasp_free_(ctxt, aposStrippedArg);
+    if (NULL == stats)
+    {
+        r = clasp_validate_specifications_(ctxt, NULL, specifications);
+    }
+    else
+    {
+        double const start = clasp_statistics_now_ns_();
 
-            /* free newArgv array */
-            { size_t i; for (i = 1; i != expandedArgs.size; ++i)
-            {
-                clasp_free_(ctxt, (void*)expandedArgs.args[i]);
-            }}
-            clasp_free_(ctxt, (void*)expandedArgs.args);
+        r = clasp_validate_specifications_(ctxt, stats, specifications);
 
-            return result;
-        }
+        stats->nsValidation = (clasp_statistics_now_ns_() - start) - stats->nsDuplicateChecking;
+    }
+    if (0 != r)
+    {
+        return r;
     }
-#else /* ? CLASP_CMDLINE_ARGS_USE_RECLS */
 
-    return clasp_parseArguments_NoWild_(flags, argc, argv, argc, argv, specifications, ctxt, args);
-#endif /* CLASP_CMDLINE_ARGS_USE_RECLS */
+    return clasp_parseArguments_Validated_(flags, argc, argv, specifications, NULL, NULL, ctxt, stats, args);
 }
 
-static
-int
-clasp_parseArguments_NoWild_(
+CLASP_CALL(int)
+clasp_parseArgumentsWithSchema(
     unsigned                            flags
 ,   int                                 argc
 ,   clasp_char_t*                       argv[]
-,   int                                 originalArgc
-,   clasp_char_t*                       originalArgv[]
 ,   clasp_specification_t const         specifications[]
+,   clasp_value_schema_t const          schema[]
 ,   clasp_diagnostic_context_t const*   ctxt
 ,   clasp_arguments_t const**           args
 )
 {
-    size_t                      cbTotal;
-    size_t                      numArgs;
-    size_t                      cbStrings;
-    clasp_arguments_x_t*        argsx;
-
-    CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_DEBUG, CLASP_LITERAL_("clasp_parseArguments_NoWild_(): argc=%d"), argc);
+    clasp_diagnostic_context_t  ctxt_;
+    int                         r;
+    clasp_parse_statistics_t    stats_;
+    clasp_parse_statistics_t*   stats;
 
-    CLASP_ASSERT(argc > 0);
-    CLASP_ASSERT(NULL != ctxt);
-    CLASP_ASSERT(NULL != args);
+    CLASP_ASSERT(NULL != schema);
 
-    *args = NULL;
+    ctxt = clasp_verify_context_(ctxt, &ctxt_, &r);
+    if (NULL == ctxt)
+    {
+        return r;
+    }
 
-    clasp_calculate_sizes_(flags, argc, argv, specifications, &numArgs, &cbStrings, &cbTotal);
+    CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_DEBUG, CLASP_LITERAL_("clasp_parseArgumentsWithSchema(): argc=%d"), argc);
 
-    argsx = stlsoft_static_cast(clasp_arguments_x_t*, clasp_malloc_(ctxt, cbTotal));
+    stats = clasp_parse_statistics_start_(ctxt, &stats_);
 
-    if (NULL == argsx)
+    if (NULL == stats)
     {
-        CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_FATAL, CLASP_LITERAL_("could not allocate memory to store results"));
+        r = clasp_validate_specifications_(ctxt, NULL, specifications);
 
-        return ENOMEM;
+        if (0 == r)
+        {
+            r = clasp_schema_validate_(ctxt, specifications, schema);
+        }
     }
+    else
+    {
+        double const start = clasp_statistics_now_ns_();
 
-    memcpy(&argsx->ctxt, ctxt, sizeof(argsx->ctxt));
+        r = clasp_validate_specifications_(ctxt, stats, specifications);
 
-    argsx->reserved0      = NULL;
-    argsx->reserved1      = 0;
-    argsx->specifications = specifications;
-    argsx->reserved2      = 0;
+        if (0 == r)
+        {
+            r = clasp_schema_validate_(ctxt, specifications, schema);
+        }
 
-    argsx->claspArgs.numArguments       =   numArgs;
-    argsx->claspArgs.arguments          =   NULL;
-    argsx->claspArgs.numFlagsAndOptions =   0;
-    argsx->claspArgs.flagsAndOptions    =   NULL;
-    argsx->claspArgs.numFlags           =   0;
-    argsx->claspArgs.flags              =   NULL;
-    argsx->claspArgs.numOptions         =   0;
-    argsx->claspArgs.options            =   NULL;
-    argsx->claspArgs.numValues          =   0;
-    argsx->claspArgs.values             =   NULL;
-    argsx->claspArgs.argc               =   originalArgc;
-    argsx->claspArgs.argv               =   originalArgv;
-#if 0
-    argsx->claspArgs.programName;
-#endif
+        stats->nsValidation = (clasp_statistics_now_ns_() - start) - stats->nsDuplicateChecking;
+    }
+    if (0 != r)
+    {
+        return r;
+    }
 
-    argsx->cb                           =   cbTotal;
-    argsx->stringsBase                  =   stlsoft_static_cast(clasp_char_t*, stlsoft_static_cast(void*, argsx->args + numArgs));
+    return clasp_parseArguments_Validated_(flags, argc, argv, specifications, schema, NULL, ctxt, stats, args);
+}
 
-#ifdef _DEBUG
-    memset(&argsx->args[0], '~', numArgs * sizeof(clasp_argument_t));
-    memset(argsx->stringsBase, '%', cbStrings);
-#endif /* _DEBUG */
+CLASP_CALL(int)
+clasp_parseArgumentsWithIndex(
+    unsigned                            flags
+,   int                                 argc
+,   clasp_char_t*                       argv[]
+,   clasp_specification_index_t const*  index
+,   clasp_diagnostic_context_t const*   ctxt
+,   clasp_arguments_t const**           args
+)
+{
+    clasp_diagnostic_context_t  ctxt_;
+    int                         r;
+    clasp_parse_statistics_t    stats_;
+
+    CLASP_ASSERT(NULL != index);
+
+    ctxt = clasp_verify_context_(ctxt, &ctxt_, &r);
+    if (NULL == ctxt)
+    {
+        return r;
+    }
+
+    CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_DEBUG, CLASP_LITERAL_("clasp_parseArgumentsWithIndex(): argc=%d"), argc);
+
+    /* the specifications were validated when the index was created */
 
+    return clasp_parseArguments_Validated_(flags, argc, argv, index->specifications, NULL, index, ctxt, clasp_parse_statistics_start_(ctxt, &stats_), args);
+}
+
+CLASP_CALL(int)
+clasp_parseArgumentsCompiled(
+    unsigned                                flags
+,   int                                     argc
+,   clasp_char_t*                           argv[]
+,   clasp_compiled_specifications_t const*  compiled
+,   clasp_diagnostic_context_t const*       ctxt
+,   clasp_arguments_t const**               args
+)
 {
-    clasp_slice_t       programName;
+    CLASP_ASSERT(NULL != compiled);
 
-    clasp_bool_t        nextArgumentIsValue         =   clasp_false_v;
-    clasp_bool_t        treatAllArgumentsAsValues   =   clasp_false_v;
+    return clasp_parseArgumentsWithIndex(flags, argc, argv, &compiled->index, ctxt, args);
+}
 
-    clasp_argument_t*   currentArg                  =   &argsx->args[0];
-    clasp_char_t*       currentString               =   argsx->stringsBase;
+/* The state shared by the jobs of clasp_parseArgumentsBatch(). Each job
+ * writes only to its own elements of results and sizes, so the jobs of a
+ * pass may be run concurrently
+ */
+typedef struct clasp_batch_t_ clasp_batch_t_;
 
-    size_t              numValues                   =   0;
-    size_t              numOptions                  =   0;
-    size_t              numFlags                    =   0;
+struct clasp_batch_t_
+{
+    unsigned                            flags;
+    int const*                          argcs;
+    clasp_char_t** const*               argvs;
+    clasp_specification_index_t const*  index;
+    clasp_diagnostic_context_t const*   ctxt;
+    clasp_prefix_trie_t_ const*         trie;
+    clasp_batch_result_t*               results;
+    size_t*                             sizes;  /* numArgs, cbStrings, cbTotal, offset - for each job */
+    char*                               arena;
+};
 
-    { int i; for (i = 1; i != argc; ++i)
+static
+void
+CLASP_CALLCONV
+clasp_batch_size_job_(
+    void*   param
+,   size_t  job
+)
+{
+    clasp_batch_t_* const   batch   =   stlsoft_static_cast(clasp_batch_t_*, param);
+    size_t* const           sizes   =   batch->sizes + 4 * job;
+    int const               argc    =   batch->argcs[job];
+
+    if (argc < 1)
     {
-        clasp_char_t const* const   arg     =   argv[i];
-        const size_t                argLen  =   clasp_strlen_(arg);
+        batch->results[job].result = EINVAL;
 
-        CLASP_LOG_PRINTF(&argsx->ctxt, CLASP_SEVIX_DEBUG, CLASP_LITERAL_("argv[%d]: [%.*s]"), i, (int)argLen, arg);
+        sizes[0] = sizes[1] = sizes[2] = 0;
+    }
+    else
+    {
+        clasp_short_flags_t_ shortFlags;
 
-        if (nextArgumentIsValue)
-        {
-            /* Append an option */
+        shortFlags.built = clasp_false_v;
 
-            currentArg->value.len   =   argLen;
-            currentArg->value.ptr   =   clasp_add_string_to_area_(&currentString, arg, argLen);
+        clasp_calculate_sizes_(batch->flags, argc, batch->argvs[job], batch->index->specifications, batch->index, batch->trie, &shortFlags, NULL, &sizes[0], &sizes[1], &sizes[2]);
+    }
+}
 
-            CLASP_LOG_PRINTF(&argsx->ctxt, CLASP_SEVIX_DEBUG, CLASP_LITERAL_("found value [%.*s] for option [%.*s]"), (int)currentArg->value.len, currentArg->value.ptr, (int)currentArg->givenName.len, currentArg->givenName.ptr);
+static
+void
+CLASP_CALLCONV
+clasp_batch_parse_job_(
+    void*   param
+,   size_t  job
+)
+{
+    clasp_batch_t_* const   batch   =   stlsoft_static_cast(clasp_batch_t_*, param);
+    size_t const* const     sizes   =   batch->sizes + 4 * job;
 
-            ++currentArg;
+    if (0 == batch->results[job].result)
+    {
+        int const                   argc    =   batch->argcs[job];
+        clasp_char_t** const        argv    =   batch->argvs[job];
+        clasp_arguments_x_t* const  argsx   =   stlsoft_static_cast(clasp_arguments_x_t*, stlsoft_static_cast(void*, batch->arena + sizes[3]));
+        clasp_short_flags_t_        shortFlags;
 
-            nextArgumentIsValue = clasp_false_v;
+        shortFlags.built = clasp_false_v;
+
+        clasp_parseArguments_Fill_(batch->flags, argc, argv, argc, argv, batch->index->specifications, NULL, batch->index, batch->trie, &shortFlags, NULL, batch->ctxt, sizes[0], sizes[1], sizes[2], argsx);
+
+        argsx->arena = batch->arena;
+
+        batch->results[job].args = &argsx->claspArgs;
+    }
+}
+
+/* Marks as failed, with the given code, all results not already failed */
+static
+void
+clasp_batch_fail_(
+    size_t                  numJobs
+,   clasp_batch_result_t    results[]
+,   int                     code
+)
+{
+    { size_t i; for (i = 0; i != numJobs; ++i)
+    {
+        if (0 == results[i].result)
+        {
+            results[i].result = code;
         }
-        else if (   !treatAllArgumentsAsValues &&
-                    '-' == arg[0])
+    }}
+}
+
+static
+void
+clasp_batch_run_(
+    clasp_batch_pool_t const*   pool
+,   size_t                      numJobs
+,   clasp_batch_job_fn_t        pfnJob
+,   clasp_batch_t_*             batch
+)
+{
+    if (NULL != pool)
+    {
+        pool->pfnForEach(pool->context, numJobs, pfnJob, batch);
+    }
+    else
+    {
+        { size_t i; for (i = 0; i != numJobs; ++i)
         {
-            CLASP_ASSERT(!nextArgumentIsValue);
+            (*pfnJob)(batch, i);
+        }}
+    }
+}
 
-            /* A hyphenated argument */
+CLASP_CALL(int)
+clasp_parseArgumentsBatch(
+    unsigned                            flags
+,   size_t                              numCommandLines
+,   int const                           argcs[]
+,   clasp_char_t** const                argvs[]
+,   clasp_specification_index_t const*  index
+,   clasp_diagnostic_context_t const*   ctxt
+,   clasp_batch_result_t                results[]
+,   clasp_batch_pool_t const*           pool
+)
+{
+    clasp_diagnostic_context_t  ctxt_;
+    clasp_prefix_trie_t_        indexTrie;
+    clasp_prefix_trie_t_*       trie    =   NULL;
+    clasp_batch_t_              batch;
+    size_t                      cbArena =   0;
+    int                         r;
 
-            if ('-' == arg[1])
-            {
-                /* double hyphen argument */
+    CLASP_ASSERT(NULL != index);
+    CLASP_ASSERT(0 == numCommandLines || NULL != argcs);
+    CLASP_ASSERT(0 == numCommandLines || NULL != argvs);
+    CLASP_ASSERT(0 == numCommandLines || NULL != results);
+    CLASP_ASSERT(NULL == pool || NULL != pool->pfnForEach);
 
-                if ('\0' == arg[2] &&
-                    0 == (CLASP_F_DONT_RECOGNISE_DOUBLEHYPHEN_TO_START_VALUES & flags))
-                {
-                    /* The special "--" argument. Not added into array */
+    ctxt = clasp_verify_context_(ctxt, &ctxt_, &r);
+    if (NULL == ctxt)
+    {
+        return r;
+    }
 
-                    treatAllArgumentsAsValues = clasp_true_v;
-                }
-                else
-                {
-                    /* Now work out whether there's an associated value. If
-                     * there is, we will need to allocate the length
-                     */
+    CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_DEBUG, CLASP_LITERAL_("clasp_parseArgumentsBatch(): numCommandLines=%lu"), (unsigned long)numCommandLines);
 
-                    clasp_char_t const* const equal5 = clasp_strchreq_(arg + 2, flags);
+    { size_t i; for (i = 0; i != numCommandLines; ++i)
+    {
+        results[i].result   =   0;
+        results[i].args     =   NULL;
+    }}
 
-                    if (NULL != equal5)
-                    {
-                        const size_t nameLen = stlsoft_static_cast(size_t, equal5 - arg);
+    if (0 == numCommandLines)
+    {
+        return 0;
+    }
 
-                        clasp_specification_t const* const alias = clasp_lookup_alias_len_(specifications, arg, (size_t)(equal5 - arg), flags);
+    /* The prefix trie, if required and not held by the index, is built
+     * once, and shared by all jobs
+     */
+    batch.trie = NULL;
+    if (0 != (CLASP_F_ALLOW_UNIQUE_PREFIXES & flags) &&
+        NULL == (batch.trie = clasp_prefix_trie_from_index_(index, flags, &indexTrie)))
+    {
+        if (0 != clasp_prefix_trie_create_(ctxt, NULL, index->specifications, flags, &trie))
+        {
+            CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_FATAL, CLASP_LITERAL_("could not allocate memory for prefix matching"));
 
-                        if (NULL != alias &&
-                            !CLASP_STRING_NULL_OR_EMPTY_(alias->mappedArgument))
-                        {
-                            const size_t                longLen     =   clasp_strlen_(alias->mappedArgument);
-                            clasp_char_t const* const   equal5_c    =   clasp_strchreq_(alias->mappedArgument, flags);
+            clasp_batch_fail_(numCommandLines, results, ENOMEM);
 
-                            currentArg->resolvedName.len    =   (NULL == equal5_c) ? longLen : (size_t)(equal5_c - alias->mappedArgument);
-                            currentArg->resolvedName.ptr    =   clasp_add_string_to_area_(&currentString, alias->mappedArgument, currentArg->resolvedName.len);
-                            currentArg->givenName.len       =   nameLen;
-                            currentArg->givenName.ptr       =   clasp_add_string_to_area_(&currentString, arg, nameLen);
-                        }
-                        else
-                        {
-                            currentArg->resolvedName.len    =   nameLen;
-                            currentArg->resolvedName.ptr    =   clasp_add_string_to_area_(&currentString, arg, nameLen);
-                            currentArg->givenName.len       =   currentArg->resolvedName.len;
-                            currentArg->givenName.ptr       =   currentArg->resolvedName.ptr;
-                        }
+            return ENOMEM;
+        }
 
-                        currentArg->value.len           =   argLen - (nameLen + 1);
-                        currentArg->value.ptr           =   clasp_add_string_to_area_(&currentString, equal5 + 1, currentArg->value.len);
-                        currentArg->type                =   CLASP_ARGTYPE_OPTION;
-                        ++numOptions;
+        batch.trie = trie;
+    }
 
-                        if (NULL != alias)
-                        {
-                            currentArg->aliasIndex      =   clasp_evaluate_specification_index_(specifications, alias);
-                        }
-                        else
-                        {
-                            currentArg->aliasIndex      =   -1;
-                        }
-                    }
-                    else
-                    {
-                        /* = sign not specified */
+    batch.flags     =   flags;
+    batch.argcs     =   argcs;
+    batch.argvs     =   argvs;
+    batch.index     =   index;
+    batch.ctxt      =   ctxt;
+    batch.results   =   results;
+    batch.sizes     =   stlsoft_static_cast(size_t*, clasp_malloc_(ctxt, CLASP_ALLOC_SITE_BATCH_SIZES, 4 * numCommandLines * sizeof(size_t)));
+    batch.arena     =   NULL;
 
-                        clasp_specification_t const* const alias = clasp_lookup_alias_len_(specifications, arg, argLen, flags);
+    if (NULL == batch.sizes)
+    {
+        CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_FATAL, CLASP_LITERAL_("could not allocate memory to size results"));
 
-                        if (NULL != alias &&
-                            !CLASP_STRING_NULL_OR_EMPTY_(alias->mappedArgument))
-                        {
-                            clasp_char_t const* const equal5_b = clasp_strchreq_(alias->mappedArgument, flags);
+        clasp_batch_fail_(numCommandLines, results, ENOMEM);
 
-                            if (NULL != equal5_b)
-                            {
-                                /* has an '=' (or ':'), so interpret it as an option regardless of what the specifications says */
+        clasp_prefix_trie_destroy_(ctxt, trie);
 
-                                currentArg->resolvedName.len    =   (size_t)(equal5_b - alias->mappedArgument);
-                                currentArg->resolvedName.ptr    =   clasp_add_string_to_area_(&currentString, alias->mappedArgument, currentArg->resolvedName.len);
-                                currentArg->givenName.len       =   argLen;
-                                currentArg->givenName.ptr       =   clasp_add_string_to_area_(&currentString, arg, argLen);
-                                currentArg->value.len           =   clasp_strlen_(alias->mappedArgument) - (1u + (size_t)(equal5_b - alias->mappedArgument));
-                                currentArg->value.ptr           =   clasp_add_string_to_area_(&currentString, equal5_b + 1, currentArg->value.len);
-                                currentArg->type                =   CLASP_ARGTYPE_OPTION;
-                                ++numOptions;
-                            }
-                            else
-                            {
-                                /* not implicitly an option, so guided by the alias */
+        return ENOMEM;
+    }
 
-                                currentArg->resolvedName.len    =   clasp_strlen_(alias->mappedArgument);
-                                currentArg->resolvedName.ptr    =   clasp_add_string_to_area_(&currentString, alias->mappedArgument, currentArg->resolvedName.len);
-                                currentArg->givenName.len       =   argLen;
-                                currentArg->givenName.ptr       =   clasp_add_string_to_area_(&currentString, arg, argLen);
+    /* 1. size each command-line */
 
-                                if (alias->type == CLASP_ARGTYPE_OPTION)
-                                {
-                                    clasp_char_t const* const   nextArg     =   (i < (argc - 1)) ? argv[i + 1] : NULL;
-                                    size_t const                nextArgLen  =   (NULL != nextArg) ? clasp_strlen_(nextArg) : 0u;
+    clasp_batch_run_(pool, numCommandLines, clasp_batch_size_job_, &batch);
 
-                                    /* If it's an option
-                                     *  AND
-                                     * this argument has an alias
-                                     *  AND
-                                     * there's a subsequent argument
-                                     *  AND
-                                     * the next argument is not a recognised arguments
-                                     */
+    /* 2. lay out the results, each of which is a multiple of 16 bytes, in a
+     * single arena
+     */
 
-                                    if (!CLASP_STRING_NULL_OR_EMPTY_(alias->name) &&
-                                        0 != nextArgLen &&
-                                        NULL == clasp_lookup_alias_len_(specifications, nextArg, nextArgLen, flags))
-                                    {
-                                        nextArgumentIsValue = clasp_true_v;
-                                    }
-                                    else
-                                    {
-                                        currentArg->value.len   =   0;
-                                        currentArg->value.ptr   =   NULL;
-                                    }
-                                    ++numOptions;
-                                }
-                                else
-                                {
-                                    currentArg->value.len       =   0;
-                                    currentArg->value.ptr       =   NULL;
-                                    ++numFlags;
-                                }
+    { size_t i; for (i = 0; i != numCommandLines; ++i)
+    {
+        batch.sizes[4 * i + 3] = cbArena;
 
-                                currentArg->type                =   alias->type;
-                            }
-                        }
-                        else
-                        {
-                            currentArg->resolvedName.len    =   argLen;
-                            currentArg->resolvedName.ptr    =   clasp_add_string_to_area_(&currentString, arg, argLen);
-                            currentArg->givenName.len       =   currentArg->resolvedName.len;
-                            currentArg->givenName.ptr       =   currentArg->resolvedName.ptr;
-                            currentArg->value.len           =   0;
-                            currentArg->value.ptr           =   NULL;
-                            if (NULL != alias &&
-                                CLASP_ARGTYPE_OPTION == alias->type)
-                            {
-                                currentArg->type            =   CLASP_ARGTYPE_OPTION;
-                                nextArgumentIsValue         =   clasp_true_v;
-                                ++numOptions;
-                            }
-                            else
-                            {
-                                currentArg->type            =   CLASP_ARGTYPE_FLAG;
-                                ++numFlags;
-                            }
-                        }
+        cbArena += batch.sizes[4 * i + 2];
+    }}
 
-                        if (NULL != alias)
-                        {
-                            currentArg->aliasIndex      =   clasp_evaluate_specification_index_(specifications, alias);
-                        }
-                        else
-                        {
-                            currentArg->aliasIndex      =   -1;
-                        }
-                    }
-                    currentArg->numGivenHyphens =   2;
-                    currentArg->cmdLineIndex    =   i;
-                    currentArg->flags           =   0;
+    r = 0;
 
-                    if (!nextArgumentIsValue)
-                    {
-                        ++currentArg;
-                    }
-                }
-            }
-            else
+    if (0 != cbArena)
+    {
+        batch.arena = stlsoft_static_cast(char*, clasp_malloc_(ctxt, CLASP_ALLOC_SITE_BATCH_ARENA, cbArena));
+
+        if (NULL == batch.arena)
+        {
+            CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_FATAL, CLASP_LITERAL_("could not allocate memory to store results"));
+
+            clasp_batch_fail_(numCommandLines, results, ENOMEM);
+
+            r = ENOMEM;
+        }
+        else
+        {
+            /* 3. parse each command-line into its place in the arena */
+
+            clasp_batch_run_(pool, numCommandLines, clasp_batch_parse_job_, &batch);
+        }
+    }
+
+    clasp_free_(ctxt, CLASP_ALLOC_SITE_BATCH_SIZES, batch.sizes);
+    clasp_prefix_trie_destroy_(ctxt, trie);
+
+    return r;
+}
+
+CLASP_CALL(void)
+clasp_releaseArgumentsBatch(
+    size_t                      numCommandLines
+,   clasp_batch_result_t const  results[]
+)
+{
+    /* All the results share the one arena, so it is released via the
+     * first of them that holds parsed results
+     */
+
+    { size_t i; for (i = 0; i != numCommandLines; ++i)
+    {
+        if (NULL != results[i].args)
+        {
+            clasp_arguments_x_t* const argsx = clasp_argsx_from_args_(results[i].args);
+
+            CLASP_ASSERT(NULL != argsx->arena);
+
+            CLASP_LOG_PRINTF(&argsx->ctxt, CLASP_SEVIX_DEBUG, CLASP_LITERAL_("clasp_releaseArgumentsBatch()"));
+
+            clasp_free_(&argsx->ctxt, CLASP_ALLOC_SITE_BATCH_ARENA, argsx->arena);
+
+            break;
+        }
+    }}
+}
+
+static
+int
+clasp_parseArguments_Validated_(
+    unsigned                            flags
+,   int                                 argc
+,   clasp_char_t*                       argv[]
+,   clasp_specification_t const         specifications[]
+,   clasp_value_schema_t const          schema[]
+,   clasp_specification_index_t const*  index
+,   clasp_diagnostic_context_t const*   ctxt
+,   clasp_parse_statistics_t*           stats
+,   clasp_arguments_t const**           args
+)
+{
+#ifdef CLASP_CMDLINE_ARGS_USE_RECLS
+
+    {
+        struct clasp_expanded_args_t    expandedArgs;
+        double const                    start   =   (NULL != stats) ? clasp_statistics_now_ns_() : 0.0;
+
+        expandedArgs.ctxt       =   ctxt;
+        expandedArgs.stats      =   stats;
+        expandedArgs.size       =   0;
+        expandedArgs.capacity   =   argc + CLASP_EXPANDEDARGS_ADDITIONAL;
+        expandedArgs.args       =   (clasp_char_t const**)clasp_statistics_malloc_(ctxt, stats, CLASP_ALLOC_SITE_WILDCARD_VECTOR, expandedArgs.capacity * sizeof(clasp_char_t*));
+
+        if (NULL == expandedArgs.args)
+        {
+            CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_FATAL, CLASP_LITERAL_("could not allocate memory for wildcard expansion"));
+
+            return ENOMEM;
+        }
+        else
+        {
+            int                     result          =   0;
+            const recls_uint32_t    reclsFlags      =   RECLS_F_FILES | RECLS_F_DIRECTORIES | RECLS_F_LINKS | RECLS_F_DEVICES;
+            clasp_char_t*           aposStrippedArg =   NULL;
+
+            memset((void*)expandedArgs.args, 0, sizeof(clasp_char_t*) * expandedArgs.capacity);
+
+            expandedArgs.args[0] = argv[0];
+            ++expandedArgs.size;
+
+            /* populate newArgv array using recls */
+            { int i; for (i = 1; i != argc; ++i)
             {
-                /* single hyphen argument - work out whether option or flag */
+                recls_rc_t          rc;
+                clasp_char_t const* arg             =   argv[i];
+                size_t              len             =   clasp_strlen_(arg);
+                int                 isAposQuoted    =   0;
 
-                if ('\0' == arg[1])
+                expandedArgs.numFiles = 0;
+
+                if (NULL != aposStrippedArg)
                 {
-                    /* This is the special option with no name, which is
-                     * usually used to indicate that the program should
-                     * read from stdin
-                     */
+                    clasp_free_(ctxt, CLASP_ALLOC_SITE_WILDCARD_STRING, aposStrippedArg);
+                    aposStrippedArg = NULL;
+                }
 
-                    currentArg->resolvedName.len    =   1;
-                    currentArg->resolvedName.ptr    =   clasp_add_string_to_area_(&currentString, CLASP_LITERAL_("-"), 1);
-                    currentArg->givenName.len       =   currentArg->resolvedName.len;
-                    currentArg->givenName.ptr       =   currentArg->resolvedName.ptr;
-                    currentArg->value.len           =   0;
-                    currentArg->value.ptr           =   NULL;
-                    currentArg->numGivenHyphens     =   1;
-                    currentArg->aliasIndex          =   -1;
-                    currentArg->type                =   CLASP_ARGTYPE_FLAG;
-                    currentArg->cmdLineIndex        =   i;
-                    currentArg->flags               =   0;
+/* TODO: Need to process ranges , e.g. "[abc].txt" */
 
-                    if (flags & CLASP_F_TREAT_SINGLEHYPHEN_AS_VALUE)
+                if (len >= 2 &&
+                    '\'' == arg[0] &&
+                    '\'' == arg[len - 1])
+                {
+                    isAposQuoted = 1;
+
+                    aposStrippedArg = clasp_expanded_strdup_(&expandedArgs, arg + isAposQuoted);
+
+                    if (NULL == aposStrippedArg)
                     {
-                        currentArg->value.len       =   currentArg->resolvedName.len;
-                        currentArg->value.ptr       =   currentArg->resolvedName.ptr;
-                        currentArg->type            =   CLASP_ARGTYPE_VALUE;
-                        ++numValues;
+                        goto cleanup;
                     }
                     else
                     {
-                        ++numFlags;
+                        aposStrippedArg[len - 2] = '\0';
+                        --len;
+                        arg = aposStrippedArg;
                     }
+                }
 
-                    ++currentArg;
+                if (CLASP_F_DONT_EXPAND_WILDCARDS_ON_WINDOWS == (CLASP_F_DONT_EXPAND_WILDCARDS_ON_WINDOWS & flags) ||
+                    NULL == clasp_strpbrk_(arg, CLASP_LITERAL_("*?")))
+                {
+                    rc = RECLS_RC_OK;
                 }
                 else
                 {
-                    clasp_char_t const* const equal6 = clasp_strchreq_(arg + 1, flags);
-
-                    if (NULL != equal6)
+                    if (0 == (CLASP_F_DO_EXPAND_WILDCARDS_IN_APOSQUOTES_ON_WINDOWS & flags) &&
+                        isAposQuoted)
                     {
-                        const size_t nameLen = stlsoft_static_cast(size_t, equal6 - arg);
+                        rc = RECLS_RC_OK;
+                    }
+                    else
+                    {
+                        rc = Recls_SearchProcess(CLASP_LITERAL_("."), arg, reclsFlags, clasp_recls_callback, &expandedArgs);
+                    }
+                }
 
-                        clasp_specification_t const* const alias = clasp_lookup_alias_len_(specifications, arg, (size_t)(equal6 - arg), flags);
+                if (RECLS_SUCCEEDED(rc))
+                {
+                    if (0 == expandedArgs.numFiles)
+                    {
+                        CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_DEBUG, CLASP_LITERAL_("no expansion for argument [%.*s]"), (int)len, arg);
 
-                        if (NULL != alias &&
-                            !CLASP_STRING_NULL_OR_EMPTY_(alias->mappedArgument))
+                        if (expandedArgs.size == expandedArgs.capacity)
                         {
-                            const size_t                longLen     =   clasp_strlen_(alias->mappedArgument);
-                            clasp_char_t const* const   equal6_b    =   clasp_strchreq_(alias->mappedArgument, flags);
+                            size_t                  newCapacity =   (expandedArgs.capacity + CLASP_EXPANDEDARGS_ADDITIONAL) * sizeof(clasp_char_t*);
+                            clasp_char_t const**    newArgs     =   (clasp_char_t const**)clasp_statistics_realloc_(ctxt, stats, CLASP_ALLOC_SITE_WILDCARD_VECTOR, (void*)expandedArgs.args, newCapacity);
 
-                            currentArg->resolvedName.len    =   (NULL == equal6_b) ? longLen : (size_t)(equal6_b - alias->mappedArgument);
-                            currentArg->resolvedName.ptr    =   clasp_add_string_to_area_(&currentString, alias->mappedArgument, currentArg->resolvedName.len);
-                            currentArg->givenName.len       =   nameLen;
-                            currentArg->givenName.ptr       =   clasp_add_string_to_area_(&currentString, arg, nameLen);
-                        }
-                        else
-                        {
-                            currentArg->resolvedName.len    =   nameLen;
-                            currentArg->resolvedName.ptr    =   clasp_add_string_to_area_(&currentString, arg, nameLen);
-                            currentArg->givenName.len       =   currentArg->resolvedName.len;
-                            currentArg->givenName.ptr       =   currentArg->resolvedName.ptr;
-                        }
+                            if (NULL == newArgs)
+                            {
+                                CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_FATAL, CLASP_LITERAL_("could not allocate memory for wildcard expansion"));
 
-                        currentArg->value.len           =   argLen - (nameLen + 1);
-                        currentArg->value.ptr           =   clasp_add_string_to_area_(&currentString, equal6 + 1, currentArg->value.len);
-                        currentArg->type                =   CLASP_ARGTYPE_OPTION;
-                        currentArg->cmdLineIndex        =   i;
-                        currentArg->numGivenHyphens     =   1;
-                        if (NULL != alias)
-                        {
-                            currentArg->aliasIndex      =   clasp_evaluate_specification_index_(specifications, alias);
+                                result = ENOMEM;
+
+                                goto cleanup;
+                            }
+                            else
+                            {
+                                expandedArgs.args       =   newArgs;
+                                expandedArgs.capacity   =   newCapacity / sizeof(clasp_char_t*);
+                            }
                         }
-                        else
+
+                        expandedArgs.args[expandedArgs.size] = clasp_expanded_strdup_(&expandedArgs, arg);
+
+                        if (NULL == expandedArgs.args[1])
                         {
-                            currentArg->aliasIndex      =   -1;
-                        }
-                        currentArg->flags               =   0;
+                            CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_FATAL, CLASP_LITERAL_("could not allocate memory for wildcard expansion"));
 
-                        ++currentArg;
-                        ++numOptions;
-                    }
-                    else if (NULL == specifications)
-                    {
-                        /* Without any specifications, we must assume a flag */
+                            result = ENOMEM;
 
-                        currentArg->resolvedName.len    =   argLen;
-                        currentArg->resolvedName.ptr    =   clasp_add_string_to_area_(&currentString, arg, argLen);
-                        currentArg->givenName.len       =   argLen;
-                        currentArg->givenName.ptr       =   currentArg->resolvedName.ptr;
-                        currentArg->value.len           =   0;
-                        currentArg->value.ptr           =   NULL;
-                        currentArg->type                =   CLASP_ARGTYPE_FLAG;
-                        currentArg->cmdLineIndex        =   i;
-                        currentArg->numGivenHyphens     =   1;
-                        currentArg->aliasIndex          =   -1;
-                        currentArg->flags               =   0;
+                            goto cleanup;
+                        }
 
-                        ++currentArg;
-                        ++numFlags;
+                        ++expandedArgs.size;
                     }
                     else
                     {
-                        /* work out whether option or flag */
-
-                        clasp_specification_t const* const alias = clasp_lookup_alias_len_(specifications, arg, argLen, flags);
+                        ; /* Nothing to do, because the callback has done it */
+
+                        CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_DEBUG, CLASP_LITERAL_("%d matching files for wildcard [%.*s]"), (int)expandedArgs.numFiles, (int)len, arg);
+                    }
+                }
+                else if (RECLS_RC_USER_CANCELLED_SEARCH == rc)
+                {
+                    CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_FATAL, CLASP_LITERAL_("could not allocate memory for wildcard expansion"));
+
+                    result = ENOMEM;
+
+                    goto cleanup;
+                }
+                else
+                {
+                    CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_FATAL, CLASP_LITERAL_("wildcard expansion failed"));
+
+                    result = EIO;
+
+                    goto cleanup;
+                }
+            }}
+
+            if (NULL != stats)
+            {
+                stats->nsWildcardExpansion = clasp_statistics_now_ns_() - start;
+            }
+
+            /* now invoke on "new" args array */
+
+            result = clasp_parseArguments_NoWild_(flags, (int)expandedArgs.size, expandedArgs.args, argc, argv, specifications, schema, index, ctxt, stats, args);
+
+
+cleanup:
+            clasp_free_(ctxt, CLASP_ALLOC_SITE_WILDCARD_STRING, aposStrippedArg);
+
+            /* free newArgv array */
+            { size_t i; for (i = 1; i != expandedArgs.size; ++i)
+            {
+                clasp_free_(ctxt, CLASP_ALLOC_SITE_WILDCARD_STRING, (void*)expandedArgs.args[i]);
+            }}
+            clasp_free_(ctxt, CLASP_ALLOC_SITE_WILDCARD_VECTOR, (void*)expandedArgs.args);
+
+            return result;
+        }
+    }
+#else /* ? CLASP_CMDLINE_ARGS_USE_RECLS */
+
+    return clasp_parseArguments_NoWild_(flags, argc, argv, argc, argv, specifications, schema, index, ctxt, stats, args);
+#endif /* CLASP_CMDLINE_ARGS_USE_RECLS */
+}
+
+/* The number of bytes of the typed values - of which there may be one for
+ * each argument - and of the bitmap, of one bit for each specification,
+ * with which their decoding detects repeated arguments, that together end
+ * the strings area of a block, which is aligned on a 16-byte boundary
+ */
+static
+size_t
+clasp_typed_values_size_(
+    clasp_specification_t const         specifications[]
+,   clasp_value_schema_t const          schema[]
+,   size_t                              numArgs
+)
+{
+    if (NULL == specifications ||
+        NULL == schema)
+    {
+        return 0;
+    }
+
+    return (numArgs * sizeof(clasp_typed_value_t) + (clasp_countSpecifications(specifications) + 7) / 8 + 15) & ~stlsoft_static_cast(size_t, 15);
+}
+
+static
+int
+clasp_parseArguments_NoWild_(
+    unsigned                            flags
+,   int                                 argc
+,   clasp_char_t*                       argv[]
+,   int                                 originalArgc
+,   clasp_char_t*                       originalArgv[]
+,   clasp_specification_t const         specifications[]
+,   clasp_value_schema_t const          schema[]
+,   clasp_specification_index_t const*  index
+,   clasp_diagnostic_context_t const*   ctxt
+,   clasp_parse_statistics_t*           stats
+,   clasp_arguments_t const**           args
+)
+{
+    size_t                      cbTotal;
+    size_t                      numArgs;
+    size_t                      cbStrings;
+    clasp_arguments_x_t*        argsx;
+    clasp_prefix_trie_t_        indexTrie;
+    clasp_prefix_trie_t_ const* trie    =   NULL;
+    clasp_prefix_trie_t_*       ownTrie =   NULL;
+    clasp_short_flags_t_        shortFlags;
+
+    CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_DEBUG, CLASP_LITERAL_("clasp_parseArguments_NoWild_(): argc=%d"), argc);
+
+    CLASP_ASSERT(argc > 0);
+    CLASP_ASSERT(NULL != ctxt);
+    CLASP_ASSERT(NULL != args);
+
+    *args = NULL;
+
+    shortFlags.built = clasp_false_v;
+
+    /* The prefix trie, if required, is that held by the index or else is
+     * built once, and used by both the sizing and the parsing passes
+     */
+    if (0 != (CLASP_F_ALLOW_UNIQUE_PREFIXES & flags) &&
+        NULL != specifications &&
+        NULL == (trie = clasp_prefix_trie_from_index_(index, flags, &indexTrie)))
+    {
+        if (0 != clasp_prefix_trie_create_(ctxt, stats, specifications, flags, &ownTrie))
+        {
+            CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_FATAL, CLASP_LITERAL_("could not allocate memory for prefix matching"));
+
+            return ENOMEM;
+        }
+
+        trie = ownTrie;
+    }
+
+    if (NULL == stats)
+    {
+        clasp_calculate_sizes_(flags, argc, argv, specifications, index, trie, &shortFlags, NULL, &numArgs, &cbStrings, &cbTotal);
+
+        cbTotal += clasp_typed_values_size_(specifications, schema, numArgs);
+
+        argsx = stlsoft_static_cast(clasp_arguments_x_t*, clasp_malloc_(ctxt, CLASP_ALLOC_SITE_ARGUMENTS, cbTotal));
+    }
+    else
+    {
+        double const start = clasp_statistics_now_ns_();
+
+        clasp_calculate_sizes_(flags, argc, argv, specifications, index, trie, &shortFlags, stats, &numArgs, &cbStrings, &cbTotal);
+
+        cbTotal += clasp_typed_values_size_(specifications, schema, numArgs);
+
+        stats->nsSizing = clasp_statistics_now_ns_() - start;
+
+        /* the statistics follow the (16-byte aligned) block */
+        argsx = stlsoft_static_cast(clasp_arguments_x_t*, clasp_statistics_malloc_(ctxt, stats, CLASP_ALLOC_SITE_ARGUMENTS, cbTotal + sizeof(clasp_parse_statistics_t)));
+    }
+
+    if (NULL == argsx)
+    {
+        CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_FATAL, CLASP_LITERAL_("could not allocate memory to store results"));
+
+        clasp_prefix_trie_destroy_(ctxt, ownTrie);
+
+        return ENOMEM;
+    }
+
+    if (NULL == stats)
+    {
+        clasp_parseArguments_Fill_(flags, argc, argv, originalArgc, originalArgv, specifications, schema, index, trie, &shortFlags, NULL, ctxt, numArgs, cbStrings, cbTotal, argsx);
+    }
+    else
+    {
+        double const start = clasp_statistics_now_ns_();
+
+        clasp_parseArguments_Fill_(flags, argc, argv, originalArgc, originalArgv, specifications, schema, index, trie, &shortFlags, stats, ctxt, numArgs, cbStrings, cbTotal, argsx);
+
+        stats->nsFilling = (clasp_statistics_now_ns_() - start) - stats->nsSorting;
+
+        argsx->statistics = stlsoft_static_cast(clasp_parse_statistics_t*, stlsoft_static_cast(void*, (char*)argsx + cbTotal));
+
+        memcpy(argsx->statistics, stats, sizeof(*stats));
+    }
+
+    clasp_prefix_trie_destroy_(ctxt, ownTrie);
+
+    *args = &argsx->claspArgs;
+
+    return 0;
+}
+
+/* Parses the arguments into the given block, of the size calculated by
+ * clasp_calculate_sizes_()
+ */
+static
+void
+clasp_parseArguments_Fill_(
+    unsigned                            flags
+,   int                                 argc
+,   clasp_char_t*                       argv[]
+,   int                                 originalArgc
+,   clasp_char_t*                       originalArgv[]
+,   clasp_specification_t const         specifications[]
+,   clasp_value_schema_t const          schema[]
+,   clasp_specification_index_t const*  index
+,   clasp_prefix_trie_t_ const*         trie
+,   clasp_short_flags_t_*               shortFlags
+,   clasp_parse_statistics_t*           stats
+,   clasp_diagnostic_context_t const*   ctxt
+,   size_t                              numArgs
+,   size_t                              cbStrings
+,   size_t                              cbTotal
+,   clasp_arguments_x_t*                argsx
+)
+{
+    memcpy(&argsx->ctxt, ctxt, sizeof(argsx->ctxt));
+
+    argsx->arena          = NULL;
+    argsx->chunks         = NULL;
+    argsx->flags          = flags;
+    argsx->specifications = specifications;
+    argsx->index          = index;
+    argsx->schema         = schema;
+    argsx->statistics     = NULL;
+    argsx->typedValues    = NULL;
+
+    argsx->claspArgs.numArguments       =   numArgs;
+    argsx->claspArgs.arguments          =   NULL;
+    argsx->claspArgs.numFlagsAndOptions =   0;
+    argsx->claspArgs.flagsAndOptions    =   NULL;
+    argsx->claspArgs.numFlags           =   0;
+    argsx->claspArgs.flags              =   NULL;
+    argsx->claspArgs.numOptions         =   0;
+    argsx->claspArgs.options            =   NULL;
+    argsx->claspArgs.numValues          =   0;
+    argsx->claspArgs.values             =   NULL;
+    argsx->claspArgs.argc               =   originalArgc;
+    argsx->claspArgs.argv               =   originalArgv;
+#if 0
+    argsx->claspArgs.programName;
+#endif
+
+    argsx->cb                           =   cbTotal;
+    argsx->stringsBase                  =   stlsoft_static_cast(clasp_char_t*, stlsoft_static_cast(void*, argsx->args + numArgs));
+
+#ifdef _DEBUG
+    memset(&argsx->args[0], '~', numArgs * sizeof(clasp_argument_t));
+    memset(argsx->stringsBase, '%', cbStrings);
+#endif /* _DEBUG */
+
+    { size_t i; for (i = 0; i != numArgs; ++i)
+    {
+        argsx->args[i].source = 0;
+    }}
+
+{
+    clasp_slice_t       programName;
+
+    clasp_bool_t        nextArgumentIsValue         =   clasp_false_v;
+    clasp_bool_t        treatAllArgumentsAsValues   =   clasp_false_v;
+
+    clasp_argument_t*   currentArg                  =   &argsx->args[0];
+    clasp_char_t*       currentString               =   argsx->stringsBase;
+
+    size_t              numValues                   =   0;
+    size_t              numOptions                  =   0;
+    size_t              numFlags                    =   0;
+
+    { int i; for (i = 1; i != argc; ++i)
+    {
+        clasp_char_t const* const   arg     =   argv[i];
+        const size_t                argLen  =   clasp_strlen_(arg);
+
+        CLASP_LOG_PRINTF(&argsx->ctxt, CLASP_SEVIX_DEBUG, CLASP_LITERAL_("argv[%d]: [%.*s]"), i, (int)argLen, arg);
+
+        if (nextArgumentIsValue)
+        {
+            /* Append an option */
+
+            currentArg->value.len   =   argLen;
+            currentArg->value.ptr   =   clasp_add_string_to_area_(&currentString, arg, argLen);
+
+            CLASP_LOG_PRINTF(&argsx->ctxt, CLASP_SEVIX_DEBUG, CLASP_LITERAL_("found value [%.*s] for option [%.*s]"), (int)currentArg->value.len, currentArg->value.ptr, (int)currentArg->givenName.len, currentArg->givenName.ptr);
+
+            ++currentArg;
+
+            nextArgumentIsValue = clasp_false_v;
+        }
+        else if (   !treatAllArgumentsAsValues &&
+                    '-' == arg[0])
+        {
+            CLASP_ASSERT(!nextArgumentIsValue);
+
+            /* A hyphenated argument */
+
+            if ('-' == arg[1])
+            {
+                /* double hyphen argument */
+
+                if ('\0' == arg[2] &&
+                    0 == (CLASP_F_DONT_RECOGNISE_DOUBLEHYPHEN_TO_START_VALUES & flags))
+                {
+                    /* The special "--" argument. Not added into array */
+
+                    treatAllArgumentsAsValues = clasp_true_v;
+                }
+                else
+                {
+                    /* Now work out whether there's an associated value. If
+                     * there is, we will need to allocate the length
+                     */
+
+                    clasp_char_t const* const equal5 = clasp_strchreq_(arg + 2, flags);
+
+                    if (NULL != equal5)
+                    {
+                        const size_t nameLen = stlsoft_static_cast(size_t, equal5 - arg);
+
+                        clasp_specification_t const* const alias = clasp_lookup_long_alias_len_(stats, &argsx->ctxt, trie, specifications, index, arg, (size_t)(equal5 - arg), flags);
+
+                        if (NULL != alias &&
+                            !CLASP_STRING_NULL_OR_EMPTY_(alias->mappedArgument))
+                        {
+                            const size_t                longLen     =   clasp_strlen_(alias->mappedArgument);
+                            clasp_char_t const* const   equal5_c    =   clasp_strchreq_(alias->mappedArgument, flags);
+
+                            currentArg->resolvedName.len    =   (NULL == equal5_c) ? longLen : (size_t)(equal5_c - alias->mappedArgument);
+                            currentArg->resolvedName.ptr    =   clasp_add_string_to_area_(&currentString, alias->mappedArgument, currentArg->resolvedName.len);
+                            currentArg->givenName.len       =   nameLen;
+                            currentArg->givenName.ptr       =   clasp_add_string_to_area_(&currentString, arg, nameLen);
+                        }
+                        else
+                        {
+                            currentArg->resolvedName.len    =   nameLen;
+                            currentArg->resolvedName.ptr    =   clasp_add_string_to_area_(&currentString, arg, nameLen);
+                            currentArg->givenName.len       =   currentArg->resolvedName.len;
+                            currentArg->givenName.ptr       =   currentArg->resolvedName.ptr;
+                        }
+
+                        currentArg->value.len           =   argLen - (nameLen + 1);
+                        currentArg->value.ptr           =   clasp_add_string_to_area_(&currentString, equal5 + 1, currentArg->value.len);
+                        currentArg->type                =   CLASP_ARGTYPE_OPTION;
+                        ++numOptions;
+
+                        if (NULL != alias)
+                        {
+                            currentArg->aliasIndex      =   clasp_evaluate_specification_index_(specifications, alias);
+                        }
+                        else
+                        {
+                            currentArg->aliasIndex      =   -1;
+                        }
+                    }
+                    else
+                    {
+                        /* = sign not specified */
+
+                        clasp_specification_t const* const alias = clasp_lookup_long_alias_len_(stats, &argsx->ctxt, trie, specifications, index, arg, argLen, flags);
+
+                        if (NULL != alias &&
+                            !CLASP_STRING_NULL_OR_EMPTY_(alias->mappedArgument))
+                        {
+                            clasp_char_t const* const equal5_b = clasp_strchreq_(alias->mappedArgument, flags);
+
+                            if (NULL != equal5_b)
+                            {
+                                /* has an '=' (or ':'), so interpret it as an option regardless of what the specifications says */
+
+                                currentArg->resolvedName.len    =   (size_t)(equal5_b - alias->mappedArgument);
+                                currentArg->resolvedName.ptr    =   clasp_add_string_to_area_(&currentString, alias->mappedArgument, currentArg->resolvedName.len);
+                                currentArg->givenName.len       =   argLen;
+                                currentArg->givenName.ptr       =   clasp_add_string_to_area_(&currentString, arg, argLen);
+                                currentArg->value.len           =   clasp_strlen_(alias->mappedArgument) - (1u + (size_t)(equal5_b - alias->mappedArgument));
+                                currentArg->value.ptr           =   clasp_add_string_to_area_(&currentString, equal5_b + 1, currentArg->value.len);
+                                currentArg->type                =   CLASP_ARGTYPE_OPTION;
+                                ++numOptions;
+                            }
+                            else
+                            {
+                                /* not implicitly an option, so guided by the alias */
+
+                                currentArg->resolvedName.len    =   clasp_strlen_(alias->mappedArgument);
+                                currentArg->resolvedName.ptr    =   clasp_add_string_to_area_(&currentString, alias->mappedArgument, currentArg->resolvedName.len);
+                                currentArg->givenName.len       =   argLen;
+                                currentArg->givenName.ptr       =   clasp_add_string_to_area_(&currentString, arg, argLen);
+
+                                if (alias->type == CLASP_ARGTYPE_OPTION)
+                                {
+                                    clasp_char_t const* const   nextArg     =   (i < (argc - 1)) ? argv[i + 1] : NULL;
+                                    size_t const                nextArgLen  =   (NULL != nextArg) ? clasp_strlen_(nextArg) : 0u;
+
+                                    /* If it's an option
+                                     *  AND
+                                     * this argument has an alias
+                                     *  AND
+                                     * there's a subsequent argument
+                                     *  AND
+                                     * the next argument is not a recognised arguments
+                                     */
+
+                                    if (!CLASP_STRING_NULL_OR_EMPTY_(alias->name) &&
+                                        0 != nextArgLen &&
+                                        NULL == clasp_lookup_long_alias_len_(stats, NULL, trie, specifications, index, nextArg, nextArgLen, flags))
+                                    {
+                                        nextArgumentIsValue = clasp_true_v;
+                                    }
+                                    else
+                                    {
+                                        currentArg->value.len   =   0;
+                                        currentArg->value.ptr   =   NULL;
+                                    }
+                                    ++numOptions;
+                                }
+                                else
+                                {
+                                    currentArg->value.len       =   0;
+                                    currentArg->value.ptr       =   NULL;
+                                    ++numFlags;
+                                }
+
+                                currentArg->type                =   alias->type;
+                            }
+                        }
+                        else
+                        {
+                            currentArg->resolvedName.len    =   argLen;
+                            currentArg->resolvedName.ptr    =   clasp_add_string_to_area_(&currentString, arg, argLen);
+                            currentArg->givenName.len       =   currentArg->resolvedName.len;
+                            currentArg->givenName.ptr       =   currentArg->resolvedName.ptr;
+                            currentArg->value.len           =   0;
+                            currentArg->value.ptr           =   NULL;
+                            if (NULL != alias &&
+                                CLASP_ARGTYPE_OPTION == alias->type)
+                            {
+                                currentArg->type            =   CLASP_ARGTYPE_OPTION;
+                                nextArgumentIsValue         =   clasp_true_v;
+                                ++numOptions;
+                            }
+                            else
+                            {
+                                currentArg->type            =   CLASP_ARGTYPE_FLAG;
+                                ++numFlags;
+                            }
+                        }
+
+                        if (NULL != alias)
+                        {
+                            currentArg->aliasIndex      =   clasp_evaluate_specification_index_(specifications, alias);
+                        }
+                        else
+                        {
+                            currentArg->aliasIndex      =   -1;
+                        }
+                    }
+                    currentArg->numGivenHyphens =   2;
+                    currentArg->cmdLineIndex    =   i;
+                    currentArg->flags           =   0;
+
+                    if (!nextArgumentIsValue)
+                    {
+                        ++currentArg;
+                    }
+                }
+            }
+            else
+            {
+                /* single hyphen argument - work out whether option or flag */
+
+                if ('\0' == arg[1])
+                {
+                    /* This is the special option with no name, which is
+                     * usually used to indicate that the program should
+                     * read from stdin
+                     */
+
+                    currentArg->resolvedName.len    =   1;
+                    currentArg->resolvedName.ptr    =   clasp_add_string_to_area_(&currentString, CLASP_LITERAL_("-"), 1);
+                    currentArg->givenName.len       =   currentArg->resolvedName.len;
+                    currentArg->givenName.ptr       =   currentArg->resolvedName.ptr;
+                    currentArg->value.len           =   0;
+                    currentArg->value.ptr           =   NULL;
+                    currentArg->numGivenHyphens     =   1;
+                    currentArg->aliasIndex          =   -1;
+                    currentArg->type                =   CLASP_ARGTYPE_FLAG;
+                    currentArg->cmdLineIndex        =   i;
+                    currentArg->flags               =   0;
+
+                    if (flags & CLASP_F_TREAT_SINGLEHYPHEN_AS_VALUE)
+                    {
+                        currentArg->value.len       =   currentArg->resolvedName.len;
+                        currentArg->value.ptr       =   currentArg->resolvedName.ptr;
+                        currentArg->type            =   CLASP_ARGTYPE_VALUE;
+                        ++numValues;
+                    }
+                    else
+                    {
+                        ++numFlags;
+                    }
+
+                    ++currentArg;
+                }
+                else
+                {
+                    clasp_char_t const* const equal6 = clasp_strchreq_(arg + 1, flags);
+
+                    if (NULL != equal6)
+                    {
+                        const size_t nameLen = stlsoft_static_cast(size_t, equal6 - arg);
+
+                        clasp_specification_t const* const alias = clasp_lookup_alias_len_(stats, specifications, index, arg, (size_t)(equal6 - arg), flags);
+
+                        if (NULL != alias &&
+                            !CLASP_STRING_NULL_OR_EMPTY_(alias->mappedArgument))
+                        {
+                            const size_t                longLen     =   clasp_strlen_(alias->mappedArgument);
+                            clasp_char_t const* const   equal6_b    =   clasp_strchreq_(alias->mappedArgument, flags);
+
+                            currentArg->resolvedName.len    =   (NULL == equal6_b) ? longLen : (size_t)(equal6_b - alias->mappedArgument);
+                            currentArg->resolvedName.ptr    =   clasp_add_string_to_area_(&currentString, alias->mappedArgument, currentArg->resolvedName.len);
+                            currentArg->givenName.len       =   nameLen;
+                            currentArg->givenName.ptr       =   clasp_add_string_to_area_(&currentString, arg, nameLen);
+                        }
+                        else
+                        {
+                            currentArg->resolvedName.len    =   nameLen;
+                            currentArg->resolvedName.ptr    =   clasp_add_string_to_area_(&currentString, arg, nameLen);
+                            currentArg->givenName.len       =   currentArg->resolvedName.len;
+                            currentArg->givenName.ptr       =   currentArg->resolvedName.ptr;
+                        }
+
+                        currentArg->value.len           =   argLen - (nameLen + 1);
+                        currentArg->value.ptr           =   clasp_add_string_to_area_(&currentString, equal6 + 1, currentArg->value.len);
+                        currentArg->type                =   CLASP_ARGTYPE_OPTION;
+                        currentArg->cmdLineIndex        =   i;
+                        currentArg->numGivenHyphens     =   1;
+                        if (NULL != alias)
+                        {
+                            currentArg->aliasIndex      =   clasp_evaluate_specification_index_(specifications, alias);
+                        }
+                        else
+                        {
+                            currentArg->aliasIndex      =   -1;
+                        }
+                        currentArg->flags               =   0;
+
+                        ++currentArg;
+                        ++numOptions;
+                    }
+                    else if (NULL == specifications)
+                    {
+                        /* Without any specifications, we must assume a flag */
+
+                        currentArg->resolvedName.len    =   argLen;
+                        currentArg->resolvedName.ptr    =   clasp_add_string_to_area_(&currentString, arg, argLen);
+                        currentArg->givenName.len       =   argLen;
+                        currentArg->givenName.ptr       =   currentArg->resolvedName.ptr;
+                        currentArg->value.len           =   0;
+                        currentArg->value.ptr           =   NULL;
+                        currentArg->type                =   CLASP_ARGTYPE_FLAG;
+                        currentArg->cmdLineIndex        =   i;
+                        currentArg->numGivenHyphens     =   1;
+                        currentArg->aliasIndex          =   -1;
+                        currentArg->flags               =   0;
+
+                        ++currentArg;
+                        ++numFlags;
+                    }
+                    else
+                    {
+                        /* work out whether option or flag */
+
+                        clasp_specification_t const* const alias = clasp_lookup_alias_len_(stats, specifications, index, arg, argLen, flags);
 
                         if (NULL != alias)
                         {
                             clasp_char_t const* equal7;
 
-                            if (NULL != alias->mappedArgument &&
-                                '-' == alias->mappedArgument[0] &&
-                                NULL != (equal7 = clasp_strchreq_(alias->mappedArgument, flags)))
-                            {
-                                const size_t nameLen = stlsoft_static_cast(size_t, equal7 - alias->mappedArgument);
+                            if (NULL != alias->mappedArgument &&
+                                '-' == alias->mappedArgument[0] &&
+                                NULL != (equal7 = clasp_strchreq_(alias->mappedArgument, flags)))
+                            {
+                                const size_t nameLen = stlsoft_static_cast(size_t, equal7 - alias->mappedArgument);
+
+                                currentArg->resolvedName.len    =   nameLen;
+                                currentArg->resolvedName.ptr    =   clasp_add_string_to_area_(&currentString, alias->mappedArgument, nameLen);
+                                currentArg->givenName.len       =   argLen;
+                                currentArg->givenName.ptr       =   clasp_add_string_to_area_(&currentString, arg, argLen);
+                                currentArg->value.len           =   clasp_strlen_(equal7 + 1);
+                                currentArg->value.ptr           =   clasp_add_string_to_area_(&currentString, equal7 + 1, currentArg->value.len);
+                                currentArg->type                =   CLASP_ARGTYPE_OPTION;
+                                currentArg->flags               =   0;
+                            }
+                            else
+                            {
+                                if (NULL != alias->mappedArgument &&
+                                    '-' == alias->mappedArgument[0])
+                                {
+                                    currentArg->resolvedName.len    =   clasp_strlen_(alias->mappedArgument);
+                                    currentArg->resolvedName.ptr    =   clasp_add_string_to_area_(&currentString, alias->mappedArgument, currentArg->resolvedName.len);
+                                    currentArg->givenName.len       =   argLen;
+                                    currentArg->givenName.ptr       =   clasp_add_string_to_area_(&currentString, arg, argLen);
+                                }
+                                else
+                                {
+                                    currentArg->givenName.len       =   argLen;
+                                    currentArg->givenName.ptr       =   clasp_add_string_to_area_(&currentString, arg, argLen);
+                                    currentArg->resolvedName.len    =   currentArg->givenName.len;
+                                    currentArg->resolvedName.ptr    =   currentArg->givenName.ptr;
+                                }
+
+                                if (alias->type == CLASP_ARGTYPE_OPTION)
+                                {
+                                    nextArgumentIsValue = clasp_true_v;
+                                }
+                                else
+                                {
+                                    currentArg->value.len       =   0;
+                                    currentArg->value.ptr       =   NULL;
+                                }
+
+                                currentArg->type                =   alias->type;
+
+                                if (nextArgumentIsValue)
+                                {
+                                    currentArg->type = CLASP_ARGTYPE_OPTION; /* Ignore the alias' type here */
+                                }
+
+                                currentArg->flags               =   0;
+                            }
+
+                            currentArg->cmdLineIndex    =   i;
+                            currentArg->numGivenHyphens =   1;
+                            currentArg->aliasIndex      =   clasp_evaluate_specification_index_(specifications, alias);
+
+                            switch (currentArg->type)
+                            {
+                            default:
+                                CLASP_ASSERT(0);
+                            case CLASP_ARGTYPE_VALUE:
+                                CLASP_ASSERT(0);
+                            case CLASP_ARGTYPE_OPTION:
+                                ++numOptions;
+                                break;
+                            case CLASP_ARGTYPE_FLAG:
+                                ++numFlags;
+                                break;
+                            }
+
+                            if (!nextArgumentIsValue)
+                            {
+                                ++currentArg;
+                            }
+                        }
+                        else
+                        {
+                            /* It's one or more flags, any of which may also be
+                             * specifications
+                             */
+                            const size_t                n           =   argLen - 1;
+                            clasp_char_t const* const   givenName   =   clasp_add_string_to_area_(&currentString, arg, argLen);
+
+                            CLASP_ASSERT(0 != n);
+                            ((void)n);
+
+                            { size_t j; for (j = 1; '\0' != arg[j]; ++j)
+                            {
+                                clasp_specification_t const* const flagAlias = clasp_lookup_short_flag_(stats, shortFlags, specifications, index, arg[j], flags);
+
+                                if (NULL != flagAlias)
+                                {
+                                    /* This is similar to the above processing with the exception
+                                     * that we do not account for following values
+                                     */
+
+                                    clasp_char_t const* equal8;
+
+                                    if (NULL != flagAlias->mappedArgument &&
+                                        '-' == flagAlias->mappedArgument[0] &&
+                                        NULL != (equal8 = clasp_strchreq_(flagAlias->mappedArgument, flags)))
+                                    {
+                                        const size_t nameLen = stlsoft_static_cast(size_t, equal8 - flagAlias->mappedArgument);
+
+                                        currentArg->resolvedName.len    =   nameLen;
+                                        currentArg->resolvedName.ptr    =   clasp_add_string_to_area_(&currentString, flagAlias->mappedArgument, nameLen);
+                                        currentArg->givenName.len       =   argLen;
+                                        currentArg->givenName.ptr       =   givenName;
+                                        currentArg->value.len           =   clasp_strlen_(equal8 + 1);
+                                        currentArg->value.ptr           =   clasp_add_string_to_area_(&currentString, equal8 + 1, currentArg->value.len);
+                                        currentArg->type                =   CLASP_ARGTYPE_OPTION;
+                                    }
+                                    else
+                                    {
+                                        if (NULL != flagAlias->mappedArgument)
+                                        {
+                                            currentArg->resolvedName.len    =   clasp_strlen_(flagAlias->mappedArgument);
+                                            currentArg->resolvedName.ptr    =   clasp_add_string_to_area_(&currentString, flagAlias->mappedArgument, currentArg->resolvedName.len);
+                                        }
+                                        else
+                                        {
+                                            currentArg->resolvedName.len    =   2u;
+                                            currentArg->resolvedName.ptr    =   clasp_add_flag_to_area_(&currentString, arg[j]);
+                                        }
+                                        currentArg->givenName.len       =   argLen;
+                                        currentArg->givenName.ptr       =   givenName;
+                                        currentArg->value.len           =   0;
+                                        currentArg->value.ptr           =   NULL;
+                                        currentArg->type                =   flagAlias->type;
+                                    }
+                                    currentArg->cmdLineIndex        =   i;
+                                    currentArg->numGivenHyphens     =   1;
+                                    currentArg->aliasIndex          =   clasp_evaluate_specification_index_(specifications, flagAlias);
+                                    currentArg->flags               =   0;
+
+                                    switch (currentArg->type)
+                                    {
+                                    default:
+                                        CLASP_ASSERT(0);
+                                    case CLASP_ARGTYPE_VALUE:
+                                        CLASP_ASSERT(0);
+                                    case CLASP_ARGTYPE_OPTION:
+                                        ++numOptions;
+                                        break;
+                                    case CLASP_ARGTYPE_FLAG:
+                                        ++numFlags;
+                                        break;
+                                    }
+
+                                    ++currentArg;
+                                }
+                                else
+                                {
+                                    currentArg->resolvedName.len    =   2;
+                                    currentArg->resolvedName.ptr    =   clasp_add_flag_to_area_(&currentString, arg[j]);
+                                    currentArg->givenName.len       =   argLen;
+                                    currentArg->givenName.ptr       =   givenName;
+                                    currentArg->value.len           =   0;
+                                    currentArg->value.ptr           =   NULL;
+                                    currentArg->cmdLineIndex        =   i;
+                                    currentArg->type                =   CLASP_ARGTYPE_FLAG;
+                                    currentArg->numGivenHyphens     =   1;
+                                    currentArg->aliasIndex          =   -1;
+                                    currentArg->flags               =   0;
+
+                                    ++currentArg;
+                                    ++numFlags;
+                                }
+                            }}
+                        }
+                    }
+                }
+            }
+        }
+        else
+        {
+            /* Append a value */
+            currentArg->resolvedName.len    =   0;
+            currentArg->resolvedName.ptr    =   NULL;
+            currentArg->givenName.len       =   0;
+            currentArg->givenName.ptr       =   NULL;
+
+            currentArg->value.len           =   argLen;
+            currentArg->value.ptr           =   clasp_add_string_to_area_(&currentString, arg, currentArg->value.len);
+
+            currentArg->cmdLineIndex        =   i;
+            currentArg->type                =   CLASP_ARGTYPE_VALUE;
+            currentArg->numGivenHyphens     =   0;
+            currentArg->aliasIndex          =   -1;
+            currentArg->flags               =   0;
+
+            ++currentArg;
+            ++numValues;
+        }
+    }}
+
+    if (nextArgumentIsValue)
+    {
+        /* A separate value argument is required, but not provided. We
+         * will indicate this to the caller by having an empty value
+         */
+
+        currentArg->value.len       =   0;
+        currentArg->value.ptr       =   NULL;
+    }
+
+    /* Decode the values of the flags/options, as they now stand, into the
+     * typed values that end the block
+     */
+    {
+        size_t const cbTyped = clasp_typed_values_size_(specifications, schema, numArgs);
+
+        if (0 != cbTyped)
+        {
+            argsx->typedValues = stlsoft_static_cast(clasp_typed_value_t*, stlsoft_static_cast(void*, (char*)argsx + cbTotal - cbTyped));
+
+            clasp_schema_decode_(&argsx->ctxt, specifications, schema, &argsx->args[0], numArgs, argsx->typedValues, stlsoft_static_cast(unsigned char*, stlsoft_static_cast(void*, argsx->typedValues + numArgs)));
+        }
+    }
+
+#ifdef _DEBUG
+    if (NULL != specifications)
+    {
+        size_t const numSpecifications = clasp_countSpecifications(specifications);
+
+        { size_t i; for (i = 0; i != argsx->claspArgs.numArguments; ++i)
+        {
+            CLASP_ASSERT(argsx->args[i].aliasIndex >= -1 && argsx->args[i].aliasIndex < (int)numSpecifications);
+        }}
+    }
+#endif /* _DEBUG */
+
+    /* Build in the program name */
+
+    clasp_identify_programName_(flags, argc, argv, &programName);
+
+    argsx->claspArgs.programName.len    =   programName.len;
+    argsx->claspArgs.programName.ptr    =   clasp_add_string_to_area_(&currentString, programName.ptr, programName.len);
+
+    if (0 == (flags & CLASP_F_PRESERVE_ORIGINAL_ARGUMENT_ORDER))
+    {
+        CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_DEBUG, CLASP_LITERAL_("sorting results"));
+
+        /* Now we must sort them */
+        if (NULL == stats)
+        {
+            qsort(&argsx->args[0], argsx->claspArgs.numArguments, sizeof(clasp_argument_t), compare_clasp_argument_t);
+        }
+        else
+        {
+            double const start = clasp_statistics_now_ns_();
+
+            qsort(&argsx->args[0], argsx->claspArgs.numArguments, sizeof(clasp_argument_t), compare_clasp_argument_t);
+
+            stats->nsSorting = clasp_statistics_now_ns_() - start;
+        }
+
+        argsx->claspArgs.arguments          =   &argsx->args[0];
+        argsx->claspArgs.numFlagsAndOptions =   numFlags + numOptions;
+        argsx->claspArgs.flagsAndOptions    =   &argsx->args[0];
+        argsx->claspArgs.numFlags           =   numFlags;
+        argsx->claspArgs.flags              =   &argsx->args[0];
+        argsx->claspArgs.numOptions         =   numOptions;
+        argsx->claspArgs.options            =   &argsx->args[0] + numFlags;
+        argsx->claspArgs.numValues          =   numValues;
+        argsx->claspArgs.values             =   &argsx->args[0] + numFlags + numOptions;
+
+        CLASP_ASSERT(NULL != argsx);
+
+        CLASP_ASSERT(numFlags + numOptions + numValues == numArgs);
+
+        CLASP_ASSERT(argsx->claspArgs.numArguments == numArgs);
+        CLASP_ASSERT(NULL != argsx->claspArgs.arguments);
+        CLASP_ASSERT(argsx->claspArgs.numFlagsAndOptions <= argsx->claspArgs.numArguments);
+        CLASP_ASSERT(NULL != argsx->claspArgs.flagsAndOptions);
+        CLASP_ASSERT(argsx->claspArgs.numFlags <= argsx->claspArgs.numArguments);
+        CLASP_ASSERT(NULL != argsx->claspArgs.flags);
+        CLASP_ASSERT(argsx->claspArgs.numOptions <= argsx->claspArgs.numArguments);
+        CLASP_ASSERT(NULL != argsx->claspArgs.options);
+        CLASP_ASSERT(argsx->claspArgs.numValues <= argsx->claspArgs.numArguments);
+        CLASP_ASSERT(NULL != argsx->claspArgs.values);
+    }
+    else
+    {
+        argsx->claspArgs.arguments          =   &argsx->args[0];
+
+        CLASP_ASSERT(NULL != argsx);
+
+        CLASP_ASSERT(argsx->claspArgs.numArguments == numArgs);
+        CLASP_ASSERT(NULL != argsx->claspArgs.arguments);
+        CLASP_ASSERT(0 == argsx->claspArgs.numFlagsAndOptions);
+        CLASP_ASSERT(NULL == argsx->claspArgs.flagsAndOptions);
+        CLASP_ASSERT(0 == argsx->claspArgs.numFlags);
+        CLASP_ASSERT(NULL == argsx->claspArgs.flags);
+        CLASP_ASSERT(0 == argsx->claspArgs.numOptions);
+        CLASP_ASSERT(NULL == argsx->claspArgs.options);
+        CLASP_ASSERT(0 == argsx->claspArgs.numValues);
+        CLASP_ASSERT(NULL == argsx->claspArgs.values);
+    }
+
+    CLASP_ASSERT(originalArgc == argsx->claspArgs.argc);
+    CLASP_ASSERT(originalArgv == argsx->claspArgs.argv);
+
+    CLASP_ASSERT(argsx->cb == cbTotal);
+    CLASP_ASSERT(currentString >= argsx->stringsBase);
+    CLASP_ASSERT(stlsoft_static_cast(size_t, currentString - argsx->stringsBase) == cbStrings);
+}}
+
+CLASP_CALL(void)
+clasp_releaseArguments(
+    clasp_arguments_t const*    args
+)
+{
+    clasp_arguments_x_t* argsx = clasp_argsx_from_args_(args);
+
+    CLASP_LOG_PRINTF(&argsx->ctxt, CLASP_SEVIX_DEBUG, CLASP_LITERAL_("clasp_releaseArguments()"));
+
+    /* results of clasp_parseArgumentsBatch() are released only together,
+     * by clasp_releaseArgumentsBatch(), and those of clasp_mapArguments()
+     * by clasp_unmapArguments()
+     */
+    CLASP_ASSERT(NULL == argsx->arena);
+
+    if (NULL == argsx->arena)
+    {
+#ifndef CLASP_USE_WIDE_STRINGS
+
+        clasp_stream_chunks_free_(&argsx->ctxt, argsx->chunks);
+#endif /* !CLASP_USE_WIDE_STRINGS */
+
+        clasp_free_(&argsx->ctxt, CLASP_ALLOC_SITE_ARGUMENTS, argsx);
+    }
+}
+
+/* The number of bytes - including any padding - from the start of the
+ * strings area to the end of the block
+ */
+static
+size_t
+clasp_strings_size_(
+    clasp_arguments_x_t const*  argsx
+)
+{
+    return argsx->cb - (size_t)((char const*)argsx->stringsBase - (char const*)argsx);
+}
+
+/* The number of bytes from the start of the strings area to the typed
+ * values, if any, that end it
+ */
+static
+size_t
+clasp_untyped_strings_size_(
+    clasp_arguments_x_t const*  argsx
+)
+{
+    if (NULL == argsx->typedValues)
+    {
+        return clasp_strings_size_(argsx);
+    }
+
+    return (size_t)((char const*)argsx->typedValues - (char const*)argsx->stringsBase);
+}
+
+/* The number of typed values decoded for the arguments of the block, which
+ * is the greatest of the indexes, each plus one, recorded in them
+ */
+static
+size_t
+clasp_typed_values_count_(
+    clasp_arguments_x_t const*  argsx
+)
+{
+    size_t n = 0;
+
+    if (NULL != argsx->typedValues)
+    {
+        { size_t i; for (i = 0; i != argsx->claspArgs.numArguments; ++i)
+        {
+            size_t const j = stlsoft_static_cast(size_t, argsx->args[i].flags >> CLASP_ARG_TYPED_SHIFT_);
+
+            if (n < j)
+            {
+                n = j;
+            }
+        }}
+    }
+
+    return n;
+}
+
+/* Copies the given arguments, rebasing into the given strings area those
+ * of their slices that lie in the strings area of their block
+ */
+static
+clasp_argument_t*
+clasp_append_rebased_arguments_(
+    clasp_argument_t*           dest
+,   clasp_argument_t const*     src
+,   size_t                      n
+,   clasp_arguments_x_t const*  srcx
+,   clasp_char_t*               stringsBase
+,   int                         source
+,   size_t                      typedBase
+)
+{
+    clasp_char_t const* const   srcBase =   srcx->stringsBase;
+    clasp_char_t const* const   srcEnd  =   (clasp_char_t const*)((char const*)srcBase + clasp_strings_size_(srcx));
+
+    { size_t i; for (i = 0; i != n; ++i, ++dest, ++src)
+    {
+        *dest = *src;
+
+#define CLASP_REBASE_SLICE_(slice)                                                          \
+                                                                                            \
+        if (NULL != dest->slice.ptr &&                                                      \
+            dest->slice.ptr >= srcBase &&                                                   \
+            dest->slice.ptr < srcEnd)                                                       \
+        {                                                                                   \
+            dest->slice.ptr = stringsBase + (dest->slice.ptr - srcBase);                    \
+        }
+
+        CLASP_REBASE_SLICE_(resolvedName)
+        CLASP_REBASE_SLICE_(givenName)
+        CLASP_REBASE_SLICE_(value)
+
+#undef CLASP_REBASE_SLICE_
+
+        /* the typed values of appended arguments follow the existing ones,
+         * and those that cannot be recorded are not kept
+         */
+        if (0 != typedBase &&
+            0 != (dest->flags >> CLASP_ARG_TYPED_SHIFT_))
+        {
+            size_t const n = typedBase + stlsoft_static_cast(size_t, dest->flags >> CLASP_ARG_TYPED_SHIFT_);
+
+            dest->flags &= (1 << CLASP_ARG_TYPED_SHIFT_) - 1;
+
+            if (n <= CLASP_ARG_TYPED_MAX_)
+            {
+                dest->flags |= stlsoft_static_cast(int, n << CLASP_ARG_TYPED_SHIFT_);
+            }
+        }
+
+        if (source >= 0)
+        {
+            /* the new arguments were parsed after a program name */
+            dest->cmdLineIndex  -=  1;
+            dest->source        =   source;
+        }
+    }}
+
+    return dest;
+}
+
+/* Allocates a block for the arguments of argsx and a further numArgsNew
+ * arguments, cbStringsNew bytes of strings, and numTypedNew typed values,
+ * into which are copied the management information, the strings, and the
+ * typed values of argsx, but not its arguments. The typed values end the
+ * block, with those of argsx first
+ */
+static
+clasp_arguments_x_t*
+clasp_merged_block_create_(
+    clasp_arguments_x_t const*  argsx
+,   size_t                      numArgsNew
+,   size_t                      cbStringsNew
+,   size_t                      numTypedNew
+)
+{
+    size_t const            cbStringsOld    =   clasp_untyped_strings_size_(argsx);
+    size_t const            numTypedOld     =   clasp_typed_values_count_(argsx);
+    size_t const            numArgs         =   argsx->claspArgs.numArguments + numArgsNew;
+    size_t const            cbUntyped       =   0
+                                            +   sizeof(clasp_arguments_x_t)
+                                            +   (numArgs ? (numArgs - 1) : 0) * sizeof(clasp_argument_t)
+                                            +   cbStringsOld
+                                            +   cbStringsNew
+                                            ;
+    size_t const            cbTotal         =   (NULL == argsx->typedValues && 0 == numTypedNew)
+                                            ?   cbUntyped
+                                            :   ((cbUntyped + 15) & ~stlsoft_static_cast(size_t, 15)) + (numTypedOld + numTypedNew) * sizeof(clasp_typed_value_t)
+                                            ;
+    clasp_arguments_x_t*    mergedx         =   stlsoft_static_cast(clasp_arguments_x_t*, clasp_malloc_(&argsx->ctxt, CLASP_ALLOC_SITE_ARGUMENTS, cbTotal));
+
+    if (NULL != mergedx)
+    {
+        memcpy(mergedx, argsx, offsetof(clasp_arguments_x_t, args));
+
+        mergedx->cb                     =   cbTotal;
+        mergedx->statistics             =   NULL;
+        mergedx->stringsBase            =   stlsoft_static_cast(clasp_char_t*, stlsoft_static_cast(void*, mergedx->args + numArgs));
+        mergedx->claspArgs.numArguments =   numArgs;
+        mergedx->claspArgs.arguments    =   &mergedx->args[0];
+
+        memcpy(mergedx->stringsBase, argsx->stringsBase, cbStringsOld);
+
+        mergedx->claspArgs.programName.ptr = mergedx->stringsBase + (argsx->claspArgs.programName.ptr - argsx->stringsBase);
+
+        if (cbTotal != cbUntyped)
+        {
+            mergedx->typedValues = stlsoft_static_cast(clasp_typed_value_t*, stlsoft_static_cast(void*, (char*)mergedx + ((cbUntyped + 15) & ~stlsoft_static_cast(size_t, 15))));
+
+            if (0 != numTypedOld)
+            {
+                memcpy(mergedx->typedValues, argsx->typedValues, numTypedOld * sizeof(clasp_typed_value_t));
+            }
+        }
+    }
+
+    return mergedx;
+}
+
+CLASP_CALL(int)
+clasp_appendArguments(
+    clasp_arguments_t const**   args
+,   int                         source
+,   int                         argc
+,   clasp_char_t*               argv[]
+)
+{
+    clasp_arguments_x_t*        argsx;
+    clasp_arguments_x_t*        newx;
+    clasp_arguments_x_t*        mergedx;
+    clasp_arguments_t const*    newArgs;
+    clasp_char_t**              argv2;
+    size_t                      cbStringsOld;
+    size_t                      numTypedOld;
+    size_t                      numTypedNew;
+    int                         r;
+
+    CLASP_ASSERT(NULL != args);
+    CLASP_ASSERT(NULL != *args);
+    CLASP_ASSERT(0 == argc || NULL != argv);
+
+    argsx = clasp_argsx_from_args_(*args);
+
+    CLASP_LOG_PRINTF(&argsx->ctxt, CLASP_SEVIX_DEBUG, CLASP_LITERAL_("clasp_appendArguments(): source=%d, argc=%d"), source, argc);
+
+    /* results of clasp_parseArgumentsBatch() share an arena, and the
+     * strings of those of clasp_mapArguments() lie in the caller's memory,
+     * and so neither can be extended
+     */
+    if (NULL != argsx->arena ||
+        source < 1 ||
+        argc < 0)
+    {
+        return EINVAL;
+    }
+
+    if (0 == argc)
+    {
+        return 0;
+    }
+
+    /* 1. parse the new arguments alone, with the flags, specifications,
+     * index (and so its prefix trie), and schema of the original parse.
+     * Since the parsing functions skip argv[0], the arguments are preceded
+     * by the original program name
+     */
+
+    argv2 = stlsoft_static_cast(clasp_char_t**, clasp_malloc_(&argsx->ctxt, CLASP_ALLOC_SITE_APPEND_VECTOR, (1 + argc) * sizeof(clasp_char_t*)));
+
+    if (NULL == argv2)
+    {
+        CLASP_LOG_PRINTF(&argsx->ctxt, CLASP_SEVIX_FATAL, CLASP_LITERAL_("could not allocate memory to append arguments"));
+
+        return ENOMEM;
+    }
+
+    argv2[0] = stlsoft_const_cast(clasp_char_t*, argsx->claspArgs.programName.ptr);
+    memcpy(argv2 + 1, argv, argc * sizeof(clasp_char_t*));
+
+    r = clasp_parseArguments_NoWild_(argsx->flags, 1 + argc, argv2, 1 + argc, argv2, stlsoft_static_cast(clasp_specification_t const*, argsx->specifications), argsx->schema, argsx->index, &argsx->ctxt, NULL, &newArgs);
+
+    clasp_free_(&argsx->ctxt, CLASP_ALLOC_SITE_APPEND_VECTOR, argv2);
+
+    if (0 != r)
+    {
+        return r;
+    }
+
+    newx = clasp_argsx_from_args_(newArgs);
+
+    /* 2. merge the existing and new arguments into a new block, group by
+     * group, the new after the existing. No argument is parsed (or
+     * decoded) again: each is copied, its slices rebased, and the index of
+     * any typed value offset by the number of the existing ones
+     */
+
+    cbStringsOld    =   clasp_untyped_strings_size_(argsx);
+    numTypedOld     =   clasp_typed_values_count_(argsx);
+    numTypedNew     =   clasp_typed_values_count_(newx);
+    mergedx         =   clasp_merged_block_create_(argsx, newx->claspArgs.numArguments, clasp_untyped_strings_size_(newx), numTypedNew);
+
+    if (NULL == mergedx)
+    {
+        CLASP_LOG_PRINTF(&argsx->ctxt, CLASP_SEVIX_FATAL, CLASP_LITERAL_("could not allocate memory to append arguments"));
+
+        clasp_releaseArguments(newArgs);
+
+        return ENOMEM;
+    }
+
+    memcpy((char*)mergedx->stringsBase + cbStringsOld, newx->stringsBase, clasp_untyped_strings_size_(newx));
+
+    if (0 != numTypedNew)
+    {
+        memcpy(mergedx->typedValues + numTypedOld, newx->typedValues, numTypedNew * sizeof(clasp_typed_value_t));
+    }
+
+    {
+        clasp_char_t* const stringsOld  =   mergedx->stringsBase;
+        clasp_char_t* const stringsNew  =   (clasp_char_t*)((char*)mergedx->stringsBase + cbStringsOld);
+        clasp_argument_t*   dest        =   &mergedx->args[0];
+
+        if (0 != (CLASP_F_PRESERVE_ORIGINAL_ARGUMENT_ORDER & argsx->flags))
+        {
+            dest = clasp_append_rebased_arguments_(dest, argsx->claspArgs.arguments, argsx->claspArgs.numArguments, argsx, stringsOld, -1, 0);
+            dest = clasp_append_rebased_arguments_(dest, newx->claspArgs.arguments, newx->claspArgs.numArguments, newx, stringsNew, source, numTypedOld);
+        }
+        else
+        {
+            mergedx->claspArgs.flags                =   dest;
+            dest = clasp_append_rebased_arguments_(dest, argsx->claspArgs.flags, argsx->claspArgs.numFlags, argsx, stringsOld, -1, 0);
+            dest = clasp_append_rebased_arguments_(dest, newx->claspArgs.flags, newx->claspArgs.numFlags, newx, stringsNew, source, numTypedOld);
+
+            mergedx->claspArgs.options              =   dest;
+            dest = clasp_append_rebased_arguments_(dest, argsx->claspArgs.options, argsx->claspArgs.numOptions, argsx, stringsOld, -1, 0);
+            dest = clasp_append_rebased_arguments_(dest, newx->claspArgs.options, newx->claspArgs.numOptions, newx, stringsNew, source, numTypedOld);
+
+            mergedx->claspArgs.values               =   dest;
+            dest = clasp_append_rebased_arguments_(dest, argsx->claspArgs.values, argsx->claspArgs.numValues, argsx, stringsOld, -1, 0);
+            dest = clasp_append_rebased_arguments_(dest, newx->claspArgs.values, newx->claspArgs.numValues, newx, stringsNew, source, numTypedOld);
+
+            mergedx->claspArgs.flagsAndOptions      =   mergedx->claspArgs.flags;
+            mergedx->claspArgs.numFlags             =   argsx->claspArgs.numFlags + newx->claspArgs.numFlags;
+            mergedx->claspArgs.numOptions           =   argsx->claspArgs.numOptions + newx->claspArgs.numOptions;
+            mergedx->claspArgs.numFlagsAndOptions   =   mergedx->claspArgs.numFlags + mergedx->claspArgs.numOptions;
+            mergedx->claspArgs.numValues            =   argsx->claspArgs.numValues + newx->claspArgs.numValues;
+        }
+
+        CLASP_ASSERT(dest == mergedx->args + mergedx->claspArgs.numArguments);
+        ((void)dest);
+    }
+
+    /* the chunks of any streamed values now belong to the new block */
+    argsx->chunks = NULL;
+
+    clasp_releaseArguments(newArgs);
+    clasp_releaseArguments(*args);
+
+    *args = &mergedx->claspArgs;
+
+    return 0;
+}
+
+#ifndef CLASP_USE_WIDE_STRINGS
+
+/* The state with which streamed values are appended to a block */
+typedef struct clasp_stream_fill_t_ clasp_stream_fill_t_;
+
+struct clasp_stream_fill_t_
+{
+    clasp_argument_t*   dest;
+    int                 source;
+};
+
+static
+int
+CLASP_CALLCONV
+clasp_stream_fill_value_(
+    void*               param
+,   clasp_char_t const* value
+,   size_t              cchValue
+,   size_t              index
+)
+{
+    clasp_stream_fill_t_* const fill    =   stlsoft_static_cast(clasp_stream_fill_t_*, param);
+    clasp_argument_t* const     arg     =   fill->dest++;
+
+    arg->resolvedName.len   =   0;
+    arg->resolvedName.ptr   =   NULL;
+    arg->givenName.len      =   0;
+    arg->givenName.ptr      =   NULL;
+    arg->value.len          =   cchValue;
+    arg->value.ptr          =   value;
+    arg->type               =   CLASP_ARGTYPE_VALUE;
+    arg->cmdLineIndex       =   stlsoft_static_cast(int, index);
+    arg->numGivenHyphens    =   0;
+    arg->aliasIndex         =   -1;
+    arg->flags              =   0;
+    arg->source             =   fill->source;
+
+    return 0;
+}
+
+CLASP_CALL(int)
+clasp_appendValuesFromStream(
+    clasp_arguments_t const**   args
+,   clasp_char_t const*         optionName
+,   unsigned                    streamFlags
+,   int                         source
+)
+{
+    clasp_arguments_x_t*    argsx;
+    clasp_arguments_x_t*    mergedx;
+    clasp_stream_chunk_t_*  chunks;
+    clasp_stream_fill_t_    fill;
+    size_t                  numValues;
+    int                     r;
+
+    CLASP_ASSERT(NULL != args);
+    CLASP_ASSERT(NULL != *args);
+    CLASP_ASSERT(NULL != optionName);
+
+    argsx = clasp_argsx_from_args_(*args);
+
+    CLASP_LOG_PRINTF(&argsx->ctxt, CLASP_SEVIX_DEBUG, CLASP_LITERAL_("clasp_appendValuesFromStream(): optionName=%s, source=%d"), optionName, source);
+
+    if (NULL != argsx->arena ||
+        source < 1)
+    {
+        return EINVAL;
+    }
+
+    /* 1. read the streams into chunks, in which the values are terminated
+     * in place
+     */
+
+    r = clasp_stream_read_option_(*args, optionName, streamFlags, NULL, NULL, &chunks);
+
+    if (0 != r)
+    {
+        clasp_stream_chunks_free_(&argsx->ctxt, chunks);
+
+        return r;
+    }
+
+    numValues = clasp_stream_chunks_for_each_(chunks, NULL, NULL);
+
+    if (0 == numValues)
+    {
+        clasp_stream_chunks_free_(&argsx->ctxt, chunks);
+
+        return 0;
+    }
+
+    /* 2. copy the existing arguments into a new block, followed by a value
+     * argument that refers to each streamed value where it lies
+     */
+
+    mergedx = clasp_merged_block_create_(argsx, numValues, 0, 0);
+
+    if (NULL == mergedx)
+    {
+        CLASP_LOG_PRINTF(&argsx->ctxt, CLASP_SEVIX_FATAL, CLASP_LITERAL_("could not allocate memory to append streamed values"));
+
+        clasp_stream_chunks_free_(&argsx->ctxt, chunks);
+
+        return ENOMEM;
+    }
+
+    fill.dest   =   clasp_append_rebased_arguments_(&mergedx->args[0], argsx->claspArgs.arguments, argsx->claspArgs.numArguments, argsx, mergedx->stringsBase, -1, 0);
+    fill.source =   source;
+
+    clasp_stream_chunks_for_each_(chunks, clasp_stream_fill_value_, &fill);
+
+    CLASP_ASSERT(fill.dest == mergedx->args + mergedx->claspArgs.numArguments);
+
+    if (0 == (CLASP_F_PRESERVE_ORIGINAL_ARGUMENT_ORDER & argsx->flags))
+    {
+        size_t const numFlagsAndOptions = argsx->claspArgs.numFlagsAndOptions;
+
+        mergedx->claspArgs.flagsAndOptions  =   &mergedx->args[0];
+        mergedx->claspArgs.flags            =   &mergedx->args[0];
+        mergedx->claspArgs.options          =   &mergedx->args[0] + argsx->claspArgs.numFlags;
+        mergedx->claspArgs.values           =   &mergedx->args[0] + numFlagsAndOptions;
+        mergedx->claspArgs.numValues        =   argsx->claspArgs.numValues + numValues;
+    }
+
+    mergedx->chunks =   clasp_stream_chunks_join_(argsx->chunks, chunks);
+    argsx->chunks   =   NULL;
+
+    clasp_releaseArguments(*args);
+
+    *args = &mergedx->claspArgs;
+
+    return 0;
+}
+#endif /* !CLASP_USE_WIDE_STRINGS */
+
+CLASP_CALL(clasp_specification_t const*)
+clasp_getSpecifications(
+    clasp_arguments_t const*    args
+)
+{
+    if (NULL != args)
+    {
+        return (clasp_specification_t const*)clasp_argsx_from_args_(args)->specifications;
+    }
+
+    return NULL;
+}
+
+CLASP_CALL(clasp_parse_statistics_t const*)
+clasp_getParseStatistics(
+    clasp_arguments_t const*    args
+)
+{
+    CLASP_ASSERT(NULL != args);
+
+    return clasp_argsx_from_args_(args)->statistics;
+}
+
+CLASP_CALL(clasp_typed_value_t const*)
+clasp_getTypedValue(
+    clasp_arguments_t const*    args
+,   clasp_argument_t const*     arg
+)
+{
+    clasp_arguments_x_t const*  argsx;
+    int                         n;
+
+    CLASP_ASSERT(NULL != args);
+    CLASP_ASSERT(NULL != arg);
+
+    argsx   =   clasp_argsx_from_args_(args);
+    n       =   arg->flags >> CLASP_ARG_TYPED_SHIFT_;
 
-                                currentArg->resolvedName.len    =   nameLen;
-                                currentArg->resolvedName.ptr    =   clasp_add_string_to_area_(&currentString, alias->mappedArgument, nameLen);
-                                currentArg->givenName.len       =   argLen;
-                                currentArg->givenName.ptr       =   clasp_add_string_to_area_(&currentString, arg, argLen);
-                                currentArg->value.len           =   clasp_strlen_(equal7 + 1);
-                                currentArg->value.ptr           =   clasp_add_string_to_area_(&currentString, equal7 + 1, currentArg->value.len);
-                                currentArg->type                =   CLASP_ARGTYPE_OPTION;
-                                currentArg->flags               =   0;
-                            }
-                            else
-                            {
-                                if (NULL != alias->mappedArgument &&
-                                    '-' == alias->mappedArgument[0])
-                                {
-                                    currentArg->resolvedName.len    =   clasp_strlen_(alias->mappedArgument);
-                                    currentArg->resolvedName.ptr    =   clasp_add_string_to_area_(&currentString, alias->mappedArgument, currentArg->resolvedName.len);
-                                    currentArg->givenName.len       =   argLen;
-                                    currentArg->givenName.ptr       =   clasp_add_string_to_area_(&currentString, arg, argLen);
-                                }
-                                else
-                                {
-                                    currentArg->givenName.len       =   argLen;
-                                    currentArg->givenName.ptr       =   clasp_add_string_to_area_(&currentString, arg, argLen);
-                                    currentArg->resolvedName.len    =   currentArg->givenName.len;
-                                    currentArg->resolvedName.ptr    =   currentArg->givenName.ptr;
-                                }
+    if (NULL == argsx->typedValues ||
+        0 == n)
+    {
+        return NULL;
+    }
 
-                                if (alias->type == CLASP_ARGTYPE_OPTION)
-                                {
-                                    nextArgumentIsValue = clasp_true_v;
-                                }
-                                else
-                                {
-                                    currentArg->value.len       =   0;
-                                    currentArg->value.ptr       =   NULL;
-                                }
+    return &argsx->typedValues[n - 1];
+}
 
-                                currentArg->type                =   alias->type;
+/* The serialized form comprises this header, followed by a copy of the
+ * block of the results, then by a copy of the argument vector, and then by
+ * the strings of the argument vector, each part beginning on a multiple of
+ * CLASP_SERIALIZED_ALIGNMENT_. Every pointer is relative to base, the
+ * address at which the blob was written, and the blob is never written
+ * thereafter: clasp_mapArguments() relocates the head of the block - the
+ * members and the arguments array, up to the strings - and the argument
+ * vector into process-local memory, leaving the blob, which may thus be
+ * shared between processes, to hold only the strings.
+ */
+typedef struct clasp_serialized_header_t_ clasp_serialized_header_t_;
 
-                                if (nextArgumentIsValue)
-                                {
-                                    currentArg->type = CLASP_ARGTYPE_OPTION; /* Ignore the alias' type here */
-                                }
+struct clasp_serialized_header_t_
+{
+    char        magic[8];
+    unsigned    version;
+    unsigned    cbChar;
+    unsigned    cbPointer;
+    unsigned    reserved0;
+    size_t      fingerprint[2];
+    size_t      cb;
+    void*       base;
+};
 
-                                currentArg->flags               =   0;
-                            }
+/* The fingerprint covers every field of the specifications that can affect
+ * the parsing
+ */
+static
+void
+clasp_fingerprint_specifications_(
+    size_t                      fingerprint[2]
+,   clasp_specification_t const specifications[]
+)
+{
+    clasp_fingerprint_init_(fingerprint);
 
-                            currentArg->cmdLineIndex    =   i;
-                            currentArg->numGivenHyphens =   1;
-                            currentArg->aliasIndex      =   clasp_evaluate_specification_index_(specifications, alias);
+    if (NULL != specifications)
+    {
+        clasp_specification_t const* spec;
 
-                            switch (currentArg->type)
-                            {
-                            default:
-                                CLASP_ASSERT(0);
-                            case CLASP_ARGTYPE_VALUE:
-                                CLASP_ASSERT(0);
-                            case CLASP_ARGTYPE_OPTION:
-                                ++numOptions;
-                                break;
-                            case CLASP_ARGTYPE_FLAG:
-                                ++numFlags;
-                                break;
-                            }
+        for (spec = specifications; CLASP_ARGTYPE_INVALID != spec->type; ++spec)
+        {
+            clasp_fingerprint_int_(fingerprint, spec->type);
+            clasp_fingerprint_string_(fingerprint, spec->name);
+            clasp_fingerprint_string_(fingerprint, spec->mappedArgument);
+            clasp_fingerprint_int_(fingerprint, spec->bitFlags);
+        }
+    }
+}
 
-                            if (!nextArgumentIsValue)
-                            {
-                                ++currentArg;
-                            }
-                        }
-                        else
-                        {
-                            /* It's one or more flags, any of which may also be
-                             * specifications
-                             */
-                            const size_t                n           =   argLen - 1;
-                            clasp_char_t const* const   givenName   =   clasp_add_string_to_area_(&currentString, arg, argLen);
+/* The size of the head of the block of results having the given number of
+ * arguments, i.e. the members and the arguments array, which precede the
+ * strings
+ */
+static
+size_t
+clasp_arguments_head_size_(
+    size_t numArguments
+)
+{
+    return offsetof(clasp_arguments_x_t, args) + numArguments * sizeof(clasp_argument_t);
+}
 
-                            CLASP_ASSERT(0 != n);
-                            ((void)n);
+/* Evaluates whether the n objects, each of cbEach bytes, at p - an address
+ * in the process that wrote the blob - lie wholly within the blob, at or
+ * after its offset lo
+ */
+static
+int
+clasp_serialized_range_is_valid_(
+    clasp_serialized_header_t_ const*   header
+,   void const*                         p
+,   size_t                              lo
+,   size_t                              n
+,   size_t                              cbEach
+)
+{
+    size_t const off = (size_t)p - (size_t)header->base;
 
-                            { size_t j; for (j = 1; '\0' != arg[j]; ++j)
-                            {
-                                clasp_char_t                    flag[3] = { '-', '?', '\0' };
-                                clasp_specification_t const*    flagAlias;
+    return  off >= lo &&
+            off <= header->cb &&
+            n <= (header->cb - off) / cbEach;
+}
 
-                                flag[1]     =   arg[j];
-                                flagAlias   =   clasp_lookup_alias_len_(specifications, flag, 2u, flags);
+/* Evaluates whether the n arguments at p - an address in the process that
+ * wrote the blob - are (NULL, or) a run of the arguments array of the
+ * block, which has numArguments elements
+ */
+static
+int
+clasp_serialized_arguments_are_valid_(
+    clasp_serialized_header_t_ const*   header
+,   size_t                              cbHeader
+,   size_t                              numArguments
+,   clasp_argument_t const*             p
+,   size_t                              n
+)
+{
+    size_t const    lo  =   cbHeader + offsetof(clasp_arguments_x_t, args);
+    size_t const    off =   (size_t)p - (size_t)header->base;
 
-                                if (NULL != flagAlias)
-                                {
-                                    /* This is similar to the above processing with the exception
-                                     * that we do not account for following values
-                                     */
+    if (NULL == p)
+    {
+        return 0 == n;
+    }
 
-                                    clasp_char_t const* equal8;
+    return  off >= lo &&
+            0 == (off - lo) % sizeof(clasp_argument_t) &&
+            (off - lo) / sizeof(clasp_argument_t) <= numArguments &&
+            n <= numArguments - (off - lo) / sizeof(clasp_argument_t);
+}
 
-                                    if (NULL != flagAlias->mappedArgument &&
-                                        '-' == flagAlias->mappedArgument[0] &&
-                                        NULL != (equal8 = clasp_strchreq_(flagAlias->mappedArgument, flags)))
-                                    {
-                                        const size_t nameLen = stlsoft_static_cast(size_t, equal8 - flagAlias->mappedArgument);
+/* Evaluates whether the slice, and the nul that follows its characters,
+ * lie wholly within the blob, after its header
+ */
+static
+int
+clasp_serialized_slice_is_valid_(
+    clasp_serialized_header_t_ const*   header
+,   size_t                              cbHeader
+,   clasp_slice_t const*                slice
+)
+{
+    if (NULL == slice->ptr)
+    {
+        return 0 == slice->len;
+    }
 
-                                        currentArg->resolvedName.len    =   nameLen;
-                                        currentArg->resolvedName.ptr    =   clasp_add_string_to_area_(&currentString, flagAlias->mappedArgument, nameLen);
-                                        currentArg->givenName.len       =   argLen;
-                                        currentArg->givenName.ptr       =   givenName;
-                                        currentArg->value.len           =   clasp_strlen_(equal8 + 1);
-                                        currentArg->value.ptr           =   clasp_add_string_to_area_(&currentString, equal8 + 1, currentArg->value.len);
-                                        currentArg->type                =   CLASP_ARGTYPE_OPTION;
-                                    }
-                                    else
-                                    {
-                                        if (NULL != flagAlias->mappedArgument)
-                                        {
-                                            currentArg->resolvedName.len    =   clasp_strlen_(flagAlias->mappedArgument);
-                                            currentArg->resolvedName.ptr    =   clasp_add_string_to_area_(&currentString, flagAlias->mappedArgument, currentArg->resolvedName.len);
-                                        }
-                                        else
-                                        {
-                                            currentArg->resolvedName.len    =   2u;
-                                            currentArg->resolvedName.ptr    =   clasp_add_string_to_area_(&currentString, flag, 2u);
-                                        }
-                                        currentArg->givenName.len       =   argLen;
-                                        currentArg->givenName.ptr       =   givenName;
-                                        currentArg->value.len           =   0;
-                                        currentArg->value.ptr           =   NULL;
-                                        currentArg->type                =   flagAlias->type;
-                                    }
-                                    currentArg->cmdLineIndex        =   i;
-                                    currentArg->numGivenHyphens     =   1;
-                                    currentArg->aliasIndex          =   clasp_evaluate_specification_index_(specifications, flagAlias);
-                                    currentArg->flags               =   0;
+    return  slice->len < ~stlsoft_static_cast(size_t, 0) &&
+            0 == ((size_t)slice->ptr - (size_t)header->base) % sizeof(clasp_char_t) &&
+            clasp_serialized_range_is_valid_(header, slice->ptr, cbHeader, 1 + slice->len, sizeof(clasp_char_t)) &&
+            '\0' == stlsoft_static_cast(clasp_char_t const*, stlsoft_static_cast(void const*, header))[((size_t)slice->ptr - (size_t)header->base) / sizeof(clasp_char_t) + slice->len];
+}
+
+/* Evaluates whether every count and every pointer of the serialized block -
+ * and of its argument vector, if any - lies within the blob, whose size,
+ * header->cb, is known not to exceed the memory given, so that the block
+ * may be copied and its pointers followed without reading beyond it
+ */
+static
+int
+clasp_serialized_block_is_valid_(
+    void const*                         blob
+,   size_t                              cbHeader
+,   size_t                              numSpecifications
+)
+{
+    clasp_serialized_header_t_ const* const header  =   stlsoft_static_cast(clasp_serialized_header_t_ const*, blob);
+    clasp_arguments_x_t const* const        blockx  =   stlsoft_static_cast(clasp_arguments_x_t const*, stlsoft_static_cast(void const*, (char const*)blob + cbHeader));
+    clasp_arguments_t const* const          a       =   &blockx->claspArgs;
+    size_t const                            cbBlock =   header->cb - cbHeader;
+    size_t                                  numTyped;
+
+    /* the block, and the arguments array of its head */
+
+    if (blockx->cb > cbBlock ||
+        blockx->cb < offsetof(clasp_arguments_x_t, args) ||
+        a->numArguments > (blockx->cb - offsetof(clasp_arguments_x_t, args)) / sizeof(clasp_argument_t))
+    {
+        return 0;
+    }
+
+    if (!clasp_serialized_arguments_are_valid_(header, cbHeader, a->numArguments, a->arguments, a->numArguments) ||
+        !clasp_serialized_arguments_are_valid_(header, cbHeader, a->numArguments, a->flagsAndOptions, a->numFlagsAndOptions) ||
+        !clasp_serialized_arguments_are_valid_(header, cbHeader, a->numArguments, a->flags, a->numFlags) ||
+        !clasp_serialized_arguments_are_valid_(header, cbHeader, a->numArguments, a->options, a->numOptions) ||
+        !clasp_serialized_arguments_are_valid_(header, cbHeader, a->numArguments, a->values, a->numValues))
+    {
+        return 0;
+    }
+
+    /* the strings, and the typed values that end them */
+
+    if (!clasp_serialized_range_is_valid_(header, blockx->stringsBase, cbHeader, 0, 1) ||
+        !clasp_serialized_slice_is_valid_(header, cbHeader, &a->programName))
+    {
+        return 0;
+    }
+
+    numTyped = 0;
+
+    if (NULL != blockx->typedValues)
+    {
+        size_t const off = (size_t)blockx->typedValues - (size_t)header->base;
+
+        if (0 != off % CLASP_SERIALIZED_ALIGNMENT_ ||
+            !clasp_serialized_range_is_valid_(header, blockx->typedValues, cbHeader, 0, 1))
+        {
+            return 0;
+        }
+
+        numTyped = (header->cb - off) / sizeof(clasp_typed_value_t);
+    }
+
+    { size_t i; for (i = 0; i != a->numArguments; ++i)
+    {
+        clasp_argument_t const* const arg = &blockx->args[i];
+
+        if (!clasp_serialized_slice_is_valid_(header, cbHeader, &arg->resolvedName) ||
+            !clasp_serialized_slice_is_valid_(header, cbHeader, &arg->givenName) ||
+            !clasp_serialized_slice_is_valid_(header, cbHeader, &arg->value) ||
+            arg->aliasIndex < -1 ||
+            (arg->aliasIndex >= 0 && stlsoft_static_cast(size_t, arg->aliasIndex) >= numSpecifications) ||
+            stlsoft_static_cast(size_t, arg->flags >> CLASP_ARG_TYPED_SHIFT_) > numTyped)
+        {
+            return 0;
+        }
+    }}
+
+    /* the argument vector, each of whose strings is nul-terminated */
+
+    if (NULL != a->argv)
+    {
+        clasp_char_t* const* const  vector  =   stlsoft_static_cast(clasp_char_t* const*, stlsoft_static_cast(void const*, (char const*)blob + ((size_t)a->argv - (size_t)header->base)));
+        size_t const                end     =   header->cb / sizeof(clasp_char_t);
+
+        if (a->argc < 0 ||
+            0 != ((size_t)a->argv - (size_t)header->base) % sizeof(clasp_char_t*) ||
+            !clasp_serialized_range_is_valid_(header, a->argv, cbHeader, 1 + stlsoft_static_cast(size_t, a->argc), sizeof(clasp_char_t*)))
+        {
+            return 0;
+        }
+
+        { int i; for (i = 0; i != a->argc; ++i)
+        {
+            size_t const off = (size_t)vector[i] - (size_t)header->base;
+            size_t       j;
+
+            if (0 != off % sizeof(clasp_char_t) ||
+                !clasp_serialized_range_is_valid_(header, vector[i], cbHeader, 1, sizeof(clasp_char_t)))
+            {
+                return 0;
+            }
+
+            for (j = off / sizeof(clasp_char_t); j != end && '\0' != stlsoft_static_cast(clasp_char_t const*, blob)[j]; ++j)
+            {}
+
+            if (j == end)
+            {
+                return 0;
+            }
+        }}
+    }
+
+    return 1;
+}
+
+/* Relocates every pointer of the block - and of its argument vector, if
+ * any - such that those into its head (see clasp_arguments_head_size_())
+ * that refer to memory relative to headFrom refer to the same place
+ * relative to headTo, and all others that refer to memory relative to
+ * from refer to the same place relative to to.
+ *
+ * The arithmetic is done on integers since, when mapping, from is the
+ * address of the blob in another process.
+ */
+static
+void
+clasp_relocate_arguments_(
+    clasp_arguments_x_t*    argsx
+,   void const*             headFrom
+,   void*                   headTo
+,   void const*             from
+,   void*                   to
+)
+{
+#define CLASP_RELOCATE_(type, p, from, to)                                                                                                                                                  ((p) = (NULL == (p)) ? (p) : (type)(void*)((char*)(to) + ((size_t)(p) - (size_t)(from))))
+
+    CLASP_RELOCATE_(clasp_argument_t const*, argsx->claspArgs.arguments, headFrom, headTo);
+    CLASP_RELOCATE_(clasp_argument_t const*, argsx->claspArgs.flagsAndOptions, headFrom, headTo);
+    CLASP_RELOCATE_(clasp_argument_t const*, argsx->claspArgs.flags, headFrom, headTo);
+    CLASP_RELOCATE_(clasp_argument_t const*, argsx->claspArgs.options, headFrom, headTo);
+    CLASP_RELOCATE_(clasp_argument_t const*, argsx->claspArgs.values, headFrom, headTo);
+    CLASP_RELOCATE_(clasp_char_t const*, argsx->claspArgs.programName.ptr, from, to);
+    CLASP_RELOCATE_(clasp_char_t*, argsx->stringsBase, from, to);
+    CLASP_RELOCATE_(clasp_typed_value_t*, argsx->typedValues, from, to);
+
+    { size_t i; for (i = 0; i != argsx->claspArgs.numArguments; ++i)
+    {
+        clasp_argument_t* const arg = &argsx->args[i];
+
+        CLASP_RELOCATE_(clasp_char_t const*, arg->resolvedName.ptr, from, to);
+        CLASP_RELOCATE_(clasp_char_t const*, arg->givenName.ptr, from, to);
+        CLASP_RELOCATE_(clasp_char_t const*, arg->value.ptr, from, to);
+    }}
+
+    if (NULL != argsx->claspArgs.argv)
+    {
+        { int i; for (i = 0; i != argsx->claspArgs.argc; ++i)
+        {
+            CLASP_RELOCATE_(clasp_char_t*, argsx->claspArgs.argv[i], from, to);
+        }}
+    }
+
+#undef CLASP_RELOCATE_
+}
+
+CLASP_CALL(int)
+clasp_serializeArguments(
+    clasp_arguments_t const*    args
+,   void*                       buffer
+,   size_t                      cbBuffer
+,   size_t*                     pcbRequired
+)
+{
+    clasp_arguments_x_t const* const    argsx       =   clasp_argsx_from_args_(args);
+    int const                           argc        =   args->argc;
+    clasp_char_t* const* const          argv        =   args->argv;
+    size_t const                        cbHeader    =   CLASP_SERIALIZED_ROUND_(sizeof(clasp_serialized_header_t_));
+    size_t const                        cbBlock     =   CLASP_SERIALIZED_ROUND_(argsx->cb);
+    size_t const                        cbVector    =   (NULL == argv) ? 0 : CLASP_SERIALIZED_ROUND_((1 + argc) * sizeof(clasp_char_t*));
+    size_t                              cbStrings   =   0;
+    size_t                              cbTotal;
+
+    CLASP_ASSERT(NULL != args);
+
+    CLASP_LOG_PRINTF(&argsx->ctxt, CLASP_SEVIX_DEBUG, CLASP_LITERAL_("clasp_serializeArguments(): cbBuffer=%lu"), (unsigned long)cbBuffer);
+
+    if (NULL != argv)
+    {
+        { int i; for (i = 0; i != argc; ++i)
+        {
+            cbStrings += (1 + clasp_strlen_(argv[i])) * sizeof(clasp_char_t);
+        }}
+    }
+
+    cbTotal = cbHeader + cbBlock + cbVector + CLASP_SERIALIZED_ROUND_(cbStrings);
+
+    if (NULL != pcbRequired)
+    {
+        *pcbRequired = cbTotal;
+    }
+
+    if (NULL == buffer)
+    {
+        return 0;
+    }
+
+    if (0 != ((size_t)buffer % CLASP_SERIALIZED_ALIGNMENT_))
+    {
+        return EINVAL;
+    }
 
-                                    switch (currentArg->type)
-                                    {
-                                    default:
-                                        CLASP_ASSERT(0);
-                                    case CLASP_ARGTYPE_VALUE:
-                                        CLASP_ASSERT(0);
-                                    case CLASP_ARGTYPE_OPTION:
-                                        ++numOptions;
-                                        break;
-                                    case CLASP_ARGTYPE_FLAG:
-                                        ++numFlags;
-                                        break;
-                                    }
+    /* streamed values lie outside both the block and the argument vector */
+    if (NULL != argsx->chunks)
+    {
+        return EINVAL;
+    }
 
-                                    ++currentArg;
-                                }
-                                else
-                                {
-                                    currentArg->resolvedName.len    =   2;
-                                    currentArg->resolvedName.ptr    =   clasp_add_flag_to_area_(&currentString, arg[j]);
-                                    currentArg->givenName.len       =   argLen;
-                                    currentArg->givenName.ptr       =   givenName;
-                                    currentArg->value.len           =   0;
-                                    currentArg->value.ptr           =   NULL;
-                                    currentArg->cmdLineIndex        =   i;
-                                    currentArg->type                =   CLASP_ARGTYPE_FLAG;
-                                    currentArg->numGivenHyphens     =   1;
-                                    currentArg->aliasIndex          =   -1;
-                                    currentArg->flags               =   0;
+    if (cbBuffer < cbTotal)
+    {
+        return ERANGE;
+    }
 
-                                    ++currentArg;
-                                    ++numFlags;
-                                }
-                            }}
-                        }
-                    }
-                }
-            }
-        }
-        else
+    {
+        clasp_serialized_header_t_* const   header  =   stlsoft_static_cast(clasp_serialized_header_t_*, buffer);
+        clasp_arguments_x_t* const          blockx  =   stlsoft_static_cast(clasp_arguments_x_t*, stlsoft_static_cast(void*, (char*)buffer + cbHeader));
+        size_t const                        cbHead  =   clasp_arguments_head_size_(args->numArguments);
+
+        memset(buffer, 0, cbTotal);
+
+        memcpy(header->magic, CLASP_SERIALIZED_MAGIC_, sizeof(header->magic));
+        header->version     =   CLASP_VER;
+        header->cbChar      =   sizeof(clasp_char_t);
+        header->cbPointer   =   sizeof(void*);
+        clasp_fingerprint_specifications_(header->fingerprint, stlsoft_static_cast(clasp_specification_t const*, argsx->specifications));
+        header->cb          =   cbTotal;
+        header->base        =   buffer;
+
+        /* the block is copied, less everything that has meaning only in
+         * this process, and then relocated into the buffer; the head and
+         * the strings are copied separately, since the head of mapped
+         * results is apart from their strings
+         */
+
+        memcpy(blockx, argsx, cbHead);
+        memcpy((char*)blockx + cbHead, argsx->stringsBase, argsx->cb - cbHead);
+
+        memset(&blockx->ctxt, 0, sizeof(blockx->ctxt));
+        blockx->arena               =   NULL;
+        blockx->chunks              =   NULL;
+        blockx->specifications      =   NULL;
+        blockx->index               =   NULL;
+        blockx->schema              =   NULL;
+        blockx->statistics          =   NULL;
+        blockx->claspArgs.argv      =   NULL;
+
+        clasp_relocate_arguments_(blockx, argsx, blockx, (char const*)argsx->stringsBase - cbHead, blockx);
+
+        if (NULL != argv)
         {
-            /* Append a value */
-            currentArg->resolvedName.len    =   0;
-            currentArg->resolvedName.ptr    =   NULL;
-            currentArg->givenName.len       =   0;
-            currentArg->givenName.ptr       =   NULL;
+            clasp_char_t** const    vector  =   stlsoft_static_cast(clasp_char_t**, stlsoft_static_cast(void*, (char*)blockx + cbBlock));
+            clasp_char_t*           strings =   stlsoft_static_cast(clasp_char_t*, stlsoft_static_cast(void*, (char*)vector + cbVector));
 
-            currentArg->value.len           =   argLen;
-            currentArg->value.ptr           =   clasp_add_string_to_area_(&currentString, arg, currentArg->value.len);
+            { int i; for (i = 0; i != argc; ++i)
+            {
+                size_t const len = clasp_strlen_(argv[i]);
 
-            currentArg->cmdLineIndex        =   i;
-            currentArg->type                =   CLASP_ARGTYPE_VALUE;
-            currentArg->numGivenHyphens     =   0;
-            currentArg->aliasIndex          =   -1;
-            currentArg->flags               =   0;
+                vector[i] = strings;
+                memcpy(strings, argv[i], (1 + len) * sizeof(clasp_char_t));
+                strings += 1 + len;
+            }}
+            vector[argc] = NULL;
 
-            ++currentArg;
-            ++numValues;
+            blockx->claspArgs.argv = vector;
         }
-    }}
+    }
 
-    if (nextArgumentIsValue)
-    {
-        /* A separate value argument is required, but not provided. We
-         * will indicate this to the caller by having an empty value
-         */
+    return 0;
+}
 
-        currentArg->value.len       =   0;
-        currentArg->value.ptr       =   NULL;
+CLASP_CALL(int)
+clasp_mapArguments(
+    void const*                         blob
+,   size_t                              cbBlob
+,   clasp_specification_t const         specifications[]
+,   clasp_diagnostic_context_t const*   ctxt
+,   clasp_arguments_t const**           args
+)
+{
+    clasp_diagnostic_context_t              ctxt_;
+    clasp_serialized_header_t_ const* const header      =   stlsoft_static_cast(clasp_serialized_header_t_ const*, blob);
+    size_t const                            cbHeader    =   CLASP_SERIALIZED_ROUND_(sizeof(clasp_serialized_header_t_));
+    clasp_arguments_x_t const*              blockx;
+    size_t                                  cbHead;
+    size_t                                  cbPrivate;
+    clasp_arguments_x_t*                    argsx;
+    size_t                                  fingerprint[2];
+    int                                     r;
+
+    CLASP_ASSERT(NULL != blob);
+    CLASP_ASSERT(NULL != args);
+
+    ctxt = clasp_verify_context_(ctxt, &ctxt_, &r);
+    if (NULL == ctxt)
+    {
+        return r;
     }
 
-#ifdef _DEBUG
-    if (NULL != specifications)
+    CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_DEBUG, CLASP_LITERAL_("clasp_mapArguments(): cbBlob=%lu"), (unsigned long)cbBlob);
+
+    *args = NULL;
+
+    if (0 != ((size_t)blob % CLASP_SERIALIZED_ALIGNMENT_) ||
+        cbBlob < cbHeader + sizeof(clasp_arguments_x_t) ||
+        0 != memcmp(header->magic, CLASP_SERIALIZED_MAGIC_, sizeof(header->magic)) ||
+        CLASP_VER != header->version ||
+        sizeof(clasp_char_t) != header->cbChar ||
+        sizeof(void*) != header->cbPointer ||
+        cbBlob < header->cb ||
+        header->cb < cbHeader + sizeof(clasp_arguments_x_t))
     {
-        size_t const numSpecifications = clasp_countSpecifications(specifications);
+        CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_ERROR, CLASP_LITERAL_("the blob is not a compatible serialization of parsing results"));
 
-        { size_t i; for (i = 0; i != argsx->claspArgs.numArguments; ++i)
-        {
-            CLASP_ASSERT(argsx->args[i].aliasIndex >= -1 && argsx->args[i].aliasIndex < (int)numSpecifications);
-        }}
+        return EINVAL;
     }
-#endif /* _DEBUG */
 
-    /* Build in the program name */
+    clasp_fingerprint_specifications_(fingerprint, specifications);
 
-    clasp_identify_programName_(flags, argc, argv, &programName);
+    if (fingerprint[0] != header->fingerprint[0] ||
+        fingerprint[1] != header->fingerprint[1])
+    {
+        CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_ERROR, CLASP_LITERAL_("the blob was serialized from results parsed with different specifications"));
 
-    argsx->claspArgs.programName.len    =   programName.len;
-    argsx->claspArgs.programName.ptr    =   clasp_add_string_to_area_(&currentString, programName.ptr, programName.len);
+        return EINVAL;
+    }
 
-    if (0 == (flags & CLASP_F_PRESERVE_ORIGINAL_ARGUMENT_ORDER))
+    if (!clasp_serialized_block_is_valid_(blob, cbHeader, (NULL == specifications) ? 0u : clasp_countSpecifications(specifications)))
     {
-        CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_DEBUG, CLASP_LITERAL_("sorting results"));
+        CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_ERROR, CLASP_LITERAL_("the blob is corrupt: a count or an offset lies beyond its end"));
 
-        /* Now we must sort them */
-        qsort(&argsx->args[0], argsx->claspArgs.numArguments, sizeof(clasp_argument_t), compare_clasp_argument_t);
+        return EINVAL;
+    }
 
-        argsx->claspArgs.arguments          =   &argsx->args[0];
-        argsx->claspArgs.numFlagsAndOptions =   numFlags + numOptions;
-        argsx->claspArgs.flagsAndOptions    =   &argsx->args[0];
-        argsx->claspArgs.numFlags           =   numFlags;
-        argsx->claspArgs.flags              =   &argsx->args[0];
-        argsx->claspArgs.numOptions         =   numOptions;
-        argsx->claspArgs.options            =   &argsx->args[0] + numFlags;
-        argsx->claspArgs.numValues          =   numValues;
-        argsx->claspArgs.values             =   &argsx->args[0] + numFlags + numOptions;
+    blockx  =   stlsoft_static_cast(clasp_arguments_x_t const*, stlsoft_static_cast(void const*, (char const*)blob + cbHeader));
+    cbHead  =   clasp_arguments_head_size_(blockx->claspArgs.numArguments);
+    cbPrivate = CLASP_SERIALIZED_ROUND_(sizeof(clasp_arguments_x_t) + blockx->claspArgs.numArguments * sizeof(clasp_argument_t));
 
-        CLASP_ASSERT(NULL != argsx);
+    if (NULL != blockx->claspArgs.argv)
+    {
+        cbPrivate += (1 + blockx->claspArgs.argc) * sizeof(clasp_char_t*);
+    }
 
-        CLASP_ASSERT(numFlags + numOptions + numValues == numArgs);
+    /* the head of the block, and the argument vector, are copied into
+     * process-local memory, so that the blob - which may be shared - is
+     * only ever read
+     */
+    argsx = stlsoft_static_cast(clasp_arguments_x_t*, clasp_malloc_(ctxt, CLASP_ALLOC_SITE_ARGUMENTS, cbPrivate));
 
-        CLASP_ASSERT(argsx->claspArgs.numArguments == numArgs);
-        CLASP_ASSERT(NULL != argsx->claspArgs.arguments);
-        CLASP_ASSERT(argsx->claspArgs.numFlagsAndOptions <= argsx->claspArgs.numArguments);
-        CLASP_ASSERT(NULL != argsx->claspArgs.flagsAndOptions);
-        CLASP_ASSERT(argsx->claspArgs.numFlags <= argsx->claspArgs.numArguments);
-        CLASP_ASSERT(NULL != argsx->claspArgs.flags);
-        CLASP_ASSERT(argsx->claspArgs.numOptions <= argsx->claspArgs.numArguments);
-        CLASP_ASSERT(NULL != argsx->claspArgs.options);
-        CLASP_ASSERT(argsx->claspArgs.numValues <= argsx->claspArgs.numArguments);
-        CLASP_ASSERT(NULL != argsx->claspArgs.values);
+    if (NULL == argsx)
+    {
+        CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_FATAL, CLASP_LITERAL_("could not allocate memory for mapped arguments"));
+
+        return ENOMEM;
     }
-    else
+
+    memcpy(argsx, blockx, cbHead);
+
+    if (NULL != blockx->claspArgs.argv)
     {
-        argsx->claspArgs.arguments          =   &argsx->args[0];
+        clasp_char_t** const vector = stlsoft_static_cast(clasp_char_t**, stlsoft_static_cast(void*, (char*)argsx + CLASP_SERIALIZED_ROUND_(sizeof(clasp_arguments_x_t) + blockx->claspArgs.numArguments * sizeof(clasp_argument_t))));
 
-        CLASP_ASSERT(NULL != argsx);
+        memcpy(vector, (char const*)blob + ((size_t)blockx->claspArgs.argv - (size_t)header->base), (1 + blockx->claspArgs.argc) * sizeof(clasp_char_t*));
 
-        CLASP_ASSERT(argsx->claspArgs.numArguments == numArgs);
-        CLASP_ASSERT(NULL != argsx->claspArgs.arguments);
-        CLASP_ASSERT(0 == argsx->claspArgs.numFlagsAndOptions);
-        CLASP_ASSERT(NULL == argsx->claspArgs.flagsAndOptions);
-        CLASP_ASSERT(0 == argsx->claspArgs.numFlags);
-        CLASP_ASSERT(NULL == argsx->claspArgs.flags);
-        CLASP_ASSERT(0 == argsx->claspArgs.numOptions);
-        CLASP_ASSERT(NULL == argsx->claspArgs.options);
-        CLASP_ASSERT(0 == argsx->claspArgs.numValues);
-        CLASP_ASSERT(NULL == argsx->claspArgs.values);
+        argsx->claspArgs.argv = vector;
     }
 
-    CLASP_ASSERT(originalArgc == argsx->claspArgs.argc);
-    CLASP_ASSERT(originalArgv == argsx->claspArgs.argv);
+    clasp_relocate_arguments_(argsx, (char const*)header->base + cbHeader, argsx, header->base, stlsoft_const_cast(void*, blob));
 
-    CLASP_ASSERT(argsx->cb == cbTotal);
-    CLASP_ASSERT(currentString >= argsx->stringsBase);
-    CLASP_ASSERT(stlsoft_static_cast(size_t, currentString - argsx->stringsBase) == cbStrings);
+    argsx->ctxt             =   *ctxt;
+    argsx->arena            =   stlsoft_const_cast(void*, blob);
+    argsx->chunks           =   NULL;
+    argsx->specifications   =   specifications;
+    argsx->index            =   NULL;
+    argsx->schema           =   NULL;
+    argsx->statistics       =   NULL;
 
     *args = &argsx->claspArgs;
 
     return 0;
-}}
+}
 
 CLASP_CALL(void)
-clasp_releaseArguments(
+clasp_unmapArguments(
     clasp_arguments_t const*    args
 )
 {
-    clasp_arguments_x_t* argsx = clasp_argsx_from_args_(args);
+    if (NULL != args)
+    {
+        clasp_arguments_x_t* const argsx = clasp_argsx_from_args_(args);
 
-    CLASP_LOG_PRINTF(&argsx->ctxt, CLASP_SEVIX_DEBUG, CLASP_LITERAL_("clasp_releaseArguments()"));
+        CLASP_LOG_PRINTF(&argsx->ctxt, CLASP_SEVIX_DEBUG, CLASP_LITERAL_("clasp_unmapArguments()"));
 
-    clasp_free_(&argsx->ctxt, argsx);
-}
+        CLASP_ASSERT(NULL != argsx->arena);
 
-CLASP_CALL(clasp_specification_t const*)
-clasp_getSpecifications(
-    clasp_arguments_t const*    args
-)
-{
-    if (NULL != args)
-    {
-        return (clasp_specification_t const*)clasp_argsx_from_args_(args)->specifications;
+        clasp_free_(&argsx->ctxt, CLASP_ALLOC_SITE_ARGUMENTS, argsx);
     }
-
-    return NULL;
 }
 
 CLASP_CALL(size_t)
@@ -2144,7 +4121,7 @@ clasp_reportUnrecognisedFlagsAndOptions(
     for (i = 0; i != args->numFlagsAndOptions; ++i)
     {
         clasp_argument_t const* const       arg     =   &args->flagsAndOptions[i];
-        clasp_specification_t const* const  alias   =   clasp_lookup_alias_len_(specifications, arg->resolvedName.ptr, arg->resolvedName.len, flags);
+        clasp_specification_t const* const  alias   =   clasp_lookup_alias_len_(NULL, specifications, NULL, arg->resolvedName.ptr, arg->resolvedName.len, flags);
 
         if (NULL == alias)
         {
@@ -2166,6 +4143,147 @@ clasp_reportUnrecognisedFlagsAndOptions(
     return n;
 }
 
+CLASP_CALL(void)
+clasp_initArgumentErrors(
+    clasp_argument_errors_t*    errors
+,   clasp_argument_error_t*     storage
+,   size_t                      capacity
+)
+{
+    CLASP_ASSERT(NULL != errors);
+    CLASP_ASSERT(NULL != storage || 0 == capacity);
+
+    errors->errors      =   storage;
+    errors->capacity    =   capacity;
+    errors->numErrors   =   0;
+}
+
+CLASP_CALL(void)
+clasp_addArgumentError(
+    clasp_argument_errors_t*    errors
+,   clasp_argerr_t              kind
+,   int                         cmdLineIndex
+,   clasp_char_t const*         name
+,   size_t                      cchName
+)
+{
+    CLASP_ASSERT(NULL != errors);
+
+    if (errors->numErrors < errors->capacity)
+    {
+        clasp_argument_error_t* const error = &errors->errors[errors->numErrors];
+
+        error->kind         =   kind;
+        error->cmdLineIndex =   cmdLineIndex;
+        error->name.len     =   cchName;
+        error->name.ptr     =   name;
+    }
+
+    ++errors->numErrors;
+}
+
+CLASP_CALL(size_t)
+clasp_verifyArguments(
+    clasp_arguments_t const*    args
+,   clasp_specification_t const specifications[]
+,   unsigned                    verifyFlags
+,   clasp_argument_errors_t*    errors
+)
+{
+    size_t  i;
+    size_t  n = 0;
+
+    CLASP_ASSERT(NULL != args);
+
+    if (NULL == specifications)
+    {
+        specifications = clasp_getSpecifications(args);
+    }
+
+    for (i = 0; i != args->numFlagsAndOptions; ++i)
+    {
+        clasp_argument_t const* const   arg     =   &args->flagsAndOptions[i];
+        clasp_typed_value_t const*      typedValue;
+        clasp_argerr_t                  kind;
+
+        if (0 != (CLASP_VERIFY_F_ALL_RECOGNISED & verifyFlags) &&
+            (   NULL == specifications ||
+                NULL == clasp_lookup_alias_len_(NULL, specifications, NULL, arg->resolvedName.ptr, arg->resolvedName.len, 0)))
+        {
+            kind = CLASP_ARGERR_UNRECOGNISED_ARGUMENT;
+        }
+        else if (0 != (CLASP_VERIFY_F_ALL_VALID & verifyFlags) &&
+            NULL != (typedValue = clasp_getTypedValue(args, arg)) &&
+            0 != typedValue->error)
+        {
+            kind = stlsoft_static_cast(clasp_argerr_t, typedValue->error);
+        }
+        else if (0 != (CLASP_VERIFY_F_ALL_USED & verifyFlags) &&
+            !clasp_argumentIsUsed_(args, arg))
+        {
+            kind = CLASP_ARGERR_UNUSED_ARGUMENT;
+        }
+        else
+        {
+            continue;
+        }
+
+        ++n;
+
+        if (NULL != errors)
+        {
+            clasp_addArgumentError(errors, kind, arg->cmdLineIndex, arg->givenName.ptr, arg->givenName.len);
+        }
+    }
+
+    return n;
+}
+
+CLASP_CALL(size_t)
+clasp_findPrefixCandidates(
+    clasp_arguments_t const*        args
+,   clasp_specification_t const     specifications[]
+,   clasp_char_t const*             name
+,   size_t                          cchName
+,   clasp_specification_t const**   candidates
+,   size_t                          maxCandidates
+)
+{
+    clasp_diagnostic_context_t const*   ctxt;
+    clasp_prefix_trie_t_*               trie;
+    size_t                              n;
+
+    unsigned flags = 0;
+
+    CLASP_ASSERT(NULL != args);
+    CLASP_ASSERT(NULL != name);
+
+    ctxt = clasp_diagnostic_context_from_args_(args);
+
+    if (NULL == specifications)
+    {
+        specifications = clasp_getSpecifications(args);
+    }
+
+    if (NULL == specifications)
+    {
+        return 0;
+    }
+
+    if (0 != clasp_prefix_trie_create_(ctxt, NULL, specifications, flags, &trie))
+    {
+        CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_FATAL, CLASP_LITERAL_("could not allocate memory for prefix matching"));
+
+        return 0;
+    }
+
+    n = clasp_prefix_trie_candidates_(trie, specifications, name, cchName, candidates, maxCandidates);
+
+    clasp_prefix_trie_destroy_(ctxt, trie);
+
+    return n;
+}
+
 static
 size_t clasp_report_unused_arguments_(
     clasp_arguments_t const*    args
@@ -0,0 +1,214 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/clasp.buffer.c
+ *
+ * Purpose: CLASP (growable) buffer facilities.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * Home:    https://github.com/synesissoftware/CLASP/
+ *
+ * Copyright (c) 2026, Matthew Wilson
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer;
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution;
+ * - Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include "clasp.internal.h"
+
+#include <errno.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+#define CLASP_BUFFER_MIN_CAPACITY_                          (256)
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+void
+clasp_buffer_init_(
+    clasp_buffer_t_*                    buffer
+,   clasp_diagnostic_context_t const*   ctxt
+,   clasp_alloc_site_t                  site
+)
+{
+    CLASP_ASSERT(NULL != buffer);
+    CLASP_ASSERT(NULL != ctxt);
+
+    buffer->ctxt        =   ctxt;
+    buffer->site        =   site;
+    buffer->ptr         =   NULL;
+    buffer->len         =   0;
+    buffer->capacity    =   0;
+    buffer->result      =   0;
+}
+
+void
+clasp_buffer_uninit_(
+    clasp_buffer_t_*    buffer
+)
+{
+    CLASP_ASSERT(NULL != buffer);
+
+    if (NULL != buffer->ptr)
+    {
+        clasp_free_(buffer->ctxt, buffer->site, buffer->ptr);
+
+        buffer->ptr = NULL;
+    }
+}
+
+int
+clasp_buffer_reserve_(
+    clasp_buffer_t_*    buffer
+,   size_t              cch
+)
+{
+    CLASP_ASSERT(NULL != buffer);
+
+    if (0 != buffer->result)
+    {
+        return buffer->result;
+    }
+
+    if (buffer->len + cch + 1 > buffer->capacity)
+    {
+        size_t          capacity    =   (buffer->capacity < CLASP_BUFFER_MIN_CAPACITY_) ? CLASP_BUFFER_MIN_CAPACITY_ : buffer->capacity;
+        clasp_char_t*   ptr;
+
+        for (; capacity < buffer->len + cch + 1; capacity *= 2)
+        {}
+
+        ptr = stlsoft_static_cast(clasp_char_t*, clasp_realloc_(buffer->ctxt, buffer->site, buffer->ptr, sizeof(clasp_char_t) * capacity));
+
+        if (NULL == ptr)
+        {
+            buffer->result = ENOMEM;
+
+            return ENOMEM;
+        }
+
+        buffer->ptr         =   ptr;
+        buffer->capacity    =   capacity;
+
+        buffer->ptr[buffer->len] = '\0';
+    }
+
+    return 0;
+}
+
+void
+clasp_buffer_append_(
+    clasp_buffer_t_*    buffer
+,   clasp_char_t const* s
+,   size_t              len
+)
+{
+    CLASP_ASSERT(NULL != buffer);
+    CLASP_ASSERT(NULL != s || 0 == len);
+
+    if (0 == len)
+    {
+        return;
+    }
+
+    if (0 == clasp_buffer_reserve_(buffer, len))
+    {
+        memcpy(buffer->ptr + buffer->len, s, sizeof(clasp_char_t) * len);
+        buffer->len += len;
+        buffer->ptr[buffer->len] = '\0';
+    }
+}
+
+void
+clasp_buffer_append_s_(
+    clasp_buffer_t_*    buffer
+,   clasp_char_t const* s
+)
+{
+    CLASP_ASSERT(NULL != s);
+
+    clasp_buffer_append_(buffer, s, clasp_strlen_(s));
+}
+
+void
+clasp_buffer_append_n_(
+    clasp_buffer_t_*    buffer
+,   clasp_char_t        ch
+,   size_t              n
+)
+{
+    CLASP_ASSERT(NULL != buffer);
+
+    if (0 == clasp_buffer_reserve_(buffer, n))
+    {
+        { size_t i; for (i = 0; i != n; ++i)
+        {
+            buffer->ptr[buffer->len++] = ch;
+        }}
+        buffer->ptr[buffer->len] = '\0';
+    }
+}
+
+void
+clasp_buffer_append_int_(
+    clasp_buffer_t_*    buffer
+,   int                 i
+)
+{
+    clasp_char_t    sz[21];
+    clasp_char_t*   p   =   &sz[0] + CLASP_NUM_ELEMENTS_(sz);
+    unsigned        u   =   (i < 0) ? (0u - stlsoft_static_cast(unsigned, i)) : stlsoft_static_cast(unsigned, i);
+
+    do
+    {
+        *--p = stlsoft_static_cast(clasp_char_t, '0' + (u % 10));
+        u /= 10;
+    }
+    while (0 != u);
+
+    if (i < 0)
+    {
+        *--p = '-';
+    }
+
+    clasp_buffer_append_(buffer, p, stlsoft_static_cast(size_t, (&sz[0] + CLASP_NUM_ELEMENTS_(sz)) - p));
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
@@ -0,0 +1,880 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/clasp.completion.c
+ *
+ * Purpose: CLASP shell-completion facilities.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * Home:    https://github.com/synesissoftware/CLASP/
+ *
+ * Copyright (c) 2026, Matthew Wilson
+ * All rights reserved.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include "clasp.internal.h"
+
+#include <errno.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+#define CLASP_COMPLETION_NONE_                              (~(size_t)0)
+
+#define CLASP_COMPLETION_KIND_NAME_                         (0x01)
+#define CLASP_COMPLETION_KIND_VALUE_                        (0x02)
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+typedef struct clasp_completion_node_t_ clasp_completion_node_t_;
+
+struct clasp_completion_node_t_
+{
+    clasp_char_t    ch;
+    unsigned        kinds;          /* kinds of the words ending here */
+    size_t          depth;          /* length of the word ending here */
+    size_t          parent;
+    size_t          firstChild;
+    size_t          lastChild;
+    size_t          nextSibling;
+    size_t          specIndex;      /* specification of the (first) name ending here, or NONE */
+};
+
+/* A trie of all the words that may be completed: the names (aliases) of
+ * the flags and options, and their long names - the mapped arguments, up
+ * to any '=' - as NAME words; and the long name, '=', and each member of
+ * the value-set of each option as VALUE words.
+ *
+ * Nodes are held in a single block, and children are kept in insertion
+ * order, so that candidates are produced in the order of the
+ * specifications.
+ */
+typedef struct clasp_completion_trie_t_ clasp_completion_trie_t_;
+
+struct clasp_completion_trie_t_
+{
+    unsigned                            flags;
+    size_t                              numNodes;
+    size_t                              maxNodes;
+    clasp_completion_node_t_            nodes[1];
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+/* Obtains the key under which the value-set members of an option are
+ * held: its long name - the mapped argument up to any '=' - or, failing
+ * that, its name
+ */
+static
+size_t
+clasp_completion_get_key_(
+    clasp_specification_t const*    specification
+,   unsigned                        flags
+,   clasp_char_t const**            pkey
+)
+{
+    clasp_char_t const* const ma = specification->mappedArgument;
+
+    if (NULL != ma &&
+        '-' == ma[0])
+    {
+        clasp_char_t const* const equal = clasp_strchreq_(ma, flags);
+
+        *pkey = ma;
+
+        return (NULL == equal) ? clasp_strlen_(ma) : stlsoft_static_cast(size_t, equal - ma);
+    }
+
+    if (NULL != specification->name)
+    {
+        *pkey = specification->name;
+
+        return clasp_strlen_(specification->name);
+    }
+
+    *pkey = NULL;
+
+    return 0;
+}
+
+/* Invokes pfn for each member - which is not empty - of the value-set,
+ * whose first character is the separator
+ */
+static
+size_t
+clasp_completion_for_each_member_(
+    clasp_char_t const* valueSet
+,   void              (*pfn)(clasp_completion_trie_t_* trie, size_t node, clasp_char_t const* member, size_t cchMember, size_t* total)
+,   clasp_completion_trie_t_* trie
+,   size_t              node
+)
+{
+    size_t total = 0;
+
+    if (NULL != valueSet &&
+        '\0' != valueSet[0])
+    {
+        clasp_char_t const  sep = valueSet[0];
+        clasp_char_t const* b   = valueSet + 1;
+
+        for (;;)
+        {
+            clasp_char_t const* e = b;
+
+            for (; '\0' != *e && sep != *e; ++e)
+            {}
+
+            if (e != b)
+            {
+                (*pfn)(trie, node, b, stlsoft_static_cast(size_t, e - b), &total);
+            }
+
+            if ('\0' == *e)
+            {
+                break;
+            }
+
+            b = e + 1;
+        }
+    }
+
+    return total;
+}
+
+/* Obtains the child of node for ch, adding it if there is none */
+static
+size_t
+clasp_completion_trie_child_(
+    clasp_completion_trie_t_*   trie
+,   size_t                      node
+,   clasp_char_t                ch
+)
+{
+    size_t child = trie->nodes[node].firstChild;
+
+    for (; CLASP_COMPLETION_NONE_ != child; child = trie->nodes[child].nextSibling)
+    {
+        if (ch == trie->nodes[child].ch)
+        {
+            return child;
+        }
+    }
+
+    child = trie->numNodes++;
+
+    CLASP_ASSERT(child < trie->maxNodes);
+
+    trie->nodes[child].ch           =   ch;
+    trie->nodes[child].kinds        =   0;
+    trie->nodes[child].depth        =   trie->nodes[node].depth + 1;
+    trie->nodes[child].parent       =   node;
+    trie->nodes[child].firstChild   =   CLASP_COMPLETION_NONE_;
+    trie->nodes[child].lastChild    =   CLASP_COMPLETION_NONE_;
+    trie->nodes[child].nextSibling  =   CLASP_COMPLETION_NONE_;
+    trie->nodes[child].specIndex    =   CLASP_COMPLETION_NONE_;
+
+    if (CLASP_COMPLETION_NONE_ == trie->nodes[node].lastChild)
+    {
+        trie->nodes[node].firstChild = child;
+    }
+    else
+    {
+        trie->nodes[trie->nodes[node].lastChild].nextSibling = child;
+    }
+    trie->nodes[node].lastChild = child;
+
+    return child;
+}
+
+/* Inserts s[0, len) beneath node, returning the node at which it ends */
+static
+size_t
+clasp_completion_trie_insert_(
+    clasp_completion_trie_t_*   trie
+,   size_t                      node
+,   clasp_char_t const*         s
+,   size_t                      len
+)
+{
+    { size_t i; for (i = 0; i != len; ++i)
+    {
+        node = clasp_completion_trie_child_(trie, node, s[i]);
+    }}
+
+    return node;
+}
+
+static
+void
+clasp_completion_trie_mark_(
+    clasp_completion_trie_t_*   trie
+,   size_t                      node
+,   unsigned                    kind
+,   size_t                      specIndex
+)
+{
+    trie->nodes[node].kinds |= kind;
+
+    if (CLASP_COMPLETION_NONE_ == trie->nodes[node].specIndex)
+    {
+        trie->nodes[node].specIndex = specIndex;
+    }
+}
+
+static
+void
+clasp_completion_count_member_(
+    clasp_completion_trie_t_*   trie
+,   size_t                      node
+,   clasp_char_t const*         member
+,   size_t                      cchMember
+,   size_t*                     total
+)
+{
+    ((void)trie);
+    ((void)node);
+    ((void)member);
+
+    *total += cchMember;
+}
+
+static
+void
+clasp_completion_insert_member_(
+    clasp_completion_trie_t_*   trie
+,   size_t                      node
+,   clasp_char_t const*         member
+,   size_t                      cchMember
+,   size_t*                     total
+)
+{
+    size_t const end = clasp_completion_trie_insert_(trie, node, member, cchMember);
+
+    ((void)total);
+
+    clasp_completion_trie_mark_(trie, end, CLASP_COMPLETION_KIND_VALUE_, trie->nodes[node].specIndex);
+}
+
+static
+int
+clasp_completion_trie_create_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_specification_t const         specifications[]
+,   unsigned                            flags
+,   clasp_completion_trie_t_**          ptrie
+)
+{
+    size_t                      maxNodes    =   1;
+    clasp_completion_trie_t_*   trie;
+
+    CLASP_ASSERT(NULL != ctxt);
+    CLASP_ASSERT(NULL != ptrie);
+
+    *ptrie = NULL;
+
+    /* 1. size the trie by the total length of all words */
+
+    if (NULL != specifications)
+    {
+        clasp_specification_t const* spec;
+
+        for (spec = specifications; CLASP_ARGTYPE_INVALID != spec->type; ++spec)
+        {
+            clasp_char_t const* key;
+            size_t const        cchKey = clasp_completion_get_key_(spec, flags, &key);
+
+            if (NULL != spec->name)
+            {
+                maxNodes += clasp_strlen_(spec->name);
+            }
+
+            maxNodes += cchKey;
+
+            /* the '=' that follows the key - which is added even when
+             * the value-set has no members - and the members after it
+             */
+            if (0 != cchKey &&
+                CLASP_ARGTYPE_OPTION == spec->type &&
+                NULL != spec->valueSet)
+            {
+                maxNodes += 1 + clasp_completion_for_each_member_(spec->valueSet, clasp_completion_count_member_, NULL, 0);
+            }
+        }
+    }
+
+    trie = stlsoft_static_cast(clasp_completion_trie_t_*, clasp_malloc_(ctxt, CLASP_ALLOC_SITE_COMPLETION, sizeof(clasp_completion_trie_t_) + (maxNodes - 1) * sizeof(clasp_completion_node_t_)));
+
+    if (NULL == trie)
+    {
+        return ENOMEM;
+    }
+
+    trie->flags     =   flags;
+    trie->numNodes  =   1;
+    trie->maxNodes  =   maxNodes;
+
+    trie->nodes[0].ch           =   '\0';
+    trie->nodes[0].kinds        =   0;
+    trie->nodes[0].depth        =   0;
+    trie->nodes[0].parent       =   CLASP_COMPLETION_NONE_;
+    trie->nodes[0].firstChild   =   CLASP_COMPLETION_NONE_;
+    trie->nodes[0].lastChild    =   CLASP_COMPLETION_NONE_;
+    trie->nodes[0].nextSibling  =   CLASP_COMPLETION_NONE_;
+    trie->nodes[0].specIndex    =   CLASP_COMPLETION_NONE_;
+
+    /* 2. insert the words of each specification */
+
+    if (NULL != specifications)
+    {
+        size_t i;
+
+        for (i = 0; CLASP_ARGTYPE_INVALID != specifications[i].type; ++i)
+        {
+            clasp_specification_t const* const  spec    =   specifications + i;
+            clasp_char_t const*                 key;
+            size_t const                        cchKey  =   clasp_completion_get_key_(spec, flags, &key);
+
+            if (NULL != spec->name &&
+                '\0' != spec->name[0])
+            {
+                clasp_completion_trie_mark_(trie, clasp_completion_trie_insert_(trie, 0, spec->name, clasp_strlen_(spec->name)), CLASP_COMPLETION_KIND_NAME_, i);
+            }
+
+            if (0 != cchKey)
+            {
+                size_t const node = clasp_completion_trie_insert_(trie, 0, key, cchKey);
+
+                /* as for clasp_lookup_alias_len_(), a long name denotes
+                 * the first specification whose mapped argument has no
+                 * default value, in preference to one that does
+                 */
+                if (CLASP_COMPLETION_NONE_ != trie->nodes[node].specIndex &&
+                    NULL != specifications[trie->nodes[node].specIndex].mappedArgument &&
+                    NULL != clasp_strchreq_(specifications[trie->nodes[node].specIndex].mappedArgument, flags) &&
+                    NULL != spec->mappedArgument &&
+                    NULL == clasp_strchreq_(spec->mappedArgument, flags))
+                {
+                    trie->nodes[node].specIndex = i;
+                }
+
+                clasp_completion_trie_mark_(trie, node, CLASP_COMPLETION_KIND_NAME_, i);
+
+                if (CLASP_ARGTYPE_OPTION == spec->type &&
+                    NULL != spec->valueSet)
+                {
+                    size_t const equal = clasp_completion_trie_child_(trie, node, '=');
+
+                    trie->nodes[equal].specIndex = i;
+
+                    clasp_completion_for_each_member_(spec->valueSet, clasp_completion_insert_member_, trie, equal);
+                }
+            }
+        }
+    }
+
+    *ptrie = trie;
+
+    return 0;
+}
+
+/* Walks from node to the node for s[0, len), returning NONE if there is
+ * none
+ */
+static
+size_t
+clasp_completion_trie_find_(
+    clasp_completion_trie_t_ const* trie
+,   size_t                          node
+,   clasp_char_t const*             s
+,   size_t                          len
+)
+{
+    { size_t i; for (i = 0; i != len && CLASP_COMPLETION_NONE_ != node; ++i)
+    {
+        size_t child = trie->nodes[node].firstChild;
+
+        for (; CLASP_COMPLETION_NONE_ != child; child = trie->nodes[child].nextSibling)
+        {
+            if (s[i] == trie->nodes[child].ch)
+            {
+                break;
+            }
+        }
+
+        node = child;
+    }}
+
+    return node;
+}
+
+/* Obtains the specification named by s[0, len), or NULL */
+static
+clasp_specification_t const*
+clasp_completion_trie_lookup_(
+    clasp_completion_trie_t_ const* trie
+,   clasp_specification_t const     specifications[]
+,   clasp_char_t const*             s
+,   size_t                          len
+)
+{
+    size_t const node = clasp_completion_trie_find_(trie, 0, s, len);
+
+    if (CLASP_COMPLETION_NONE_ != node &&
+        0 != (CLASP_COMPLETION_KIND_NAME_ & trie->nodes[node].kinds))
+    {
+        return specifications + trie->nodes[node].specIndex;
+    }
+
+    return NULL;
+}
+
+/* Obtains the option that takes a separate value when given by the
+ * argument s[0, len) - which may name a flag that is an alias of an
+ * option - or NULL
+ */
+static
+clasp_specification_t const*
+clasp_completion_resolve_option_(
+    clasp_completion_trie_t_ const* trie
+,   clasp_specification_t const     specifications[]
+,   clasp_char_t const*             s
+,   size_t                          len
+)
+{
+    clasp_specification_t const* spec = clasp_completion_trie_lookup_(trie, specifications, s, len);
+
+    if (NULL != spec &&
+        CLASP_ARGTYPE_FLAG == spec->type &&
+        NULL != spec->mappedArgument &&
+        NULL == clasp_strchreq_(spec->mappedArgument, trie->flags))
+    {
+        spec = clasp_completion_trie_lookup_(trie, specifications, spec->mappedArgument, clasp_strlen_(spec->mappedArgument));
+    }
+
+    return (NULL != spec && CLASP_ARGTYPE_OPTION == spec->type) ? spec : NULL;
+}
+
+/* Renders, one per line, each word of the given kind in the subtree
+ * rooted at top, omitting its first skip characters and preceding it with
+ * prefix[0, cchPrefix)
+ */
+static
+size_t
+clasp_completion_render_(
+    clasp_completion_trie_t_ const* trie
+,   size_t                          top
+,   unsigned                        kind
+,   size_t                          skip
+,   clasp_char_t const*             prefix
+,   size_t                          cchPrefix
+,   clasp_buffer_t_*                buffer
+)
+{
+    size_t n = 0;
+    size_t node;
+
+    for (node = top; CLASP_COMPLETION_NONE_ != node; )
+    {
+        clasp_completion_node_t_ const* const p = &trie->nodes[node];
+
+        if (0 != (kind & p->kinds))
+        {
+            size_t const cch = p->depth - skip;
+
+            clasp_buffer_append_(buffer, prefix, cchPrefix);
+            clasp_buffer_append_n_(buffer, ' ', cch);
+
+            if (0 == buffer->result)
+            {
+                clasp_char_t*   dest    =   buffer->ptr + buffer->len;
+                size_t          i       =   node;
+
+                for (; trie->nodes[i].depth > skip; i = trie->nodes[i].parent)
+                {
+                    *--dest = trie->nodes[i].ch;
+                }
+            }
+
+            clasp_buffer_append_n_(buffer, '\n', 1);
+
+            ++n;
+        }
+
+        /* next node, in depth-first order, within the subtree */
+        if (CLASP_COMPLETION_NONE_ != p->firstChild)
+        {
+            node = p->firstChild;
+        }
+        else
+        {
+            for (; top != node && CLASP_COMPLETION_NONE_ == trie->nodes[node].nextSibling; node = trie->nodes[node].parent)
+            {}
+
+            node = (top == node) ? CLASP_COMPLETION_NONE_ : trie->nodes[node].nextSibling;
+        }
+    }
+
+    return n;
+}
+
+/* Renders the values of the option spec that begin with
+ * value[0, cchValue)
+ */
+static
+size_t
+clasp_completion_render_values_(
+    clasp_completion_trie_t_ const* trie
+,   clasp_specification_t const*    spec
+,   clasp_char_t const*             value
+,   size_t                          cchValue
+,   clasp_char_t const*             prefix
+,   size_t                          cchPrefix
+,   clasp_buffer_t_*                buffer
+)
+{
+    clasp_char_t const* key;
+    size_t const        cchKey  =   clasp_completion_get_key_(spec, trie->flags, &key);
+    size_t              node    =   clasp_completion_trie_find_(trie, 0, key, cchKey);
+
+    node = clasp_completion_trie_find_(trie, node, CLASP_LITERAL_("="), 1);
+    node = clasp_completion_trie_find_(trie, node, value, cchValue);
+
+    if (CLASP_COMPLETION_NONE_ == node)
+    {
+        return 0;
+    }
+
+    return clasp_completion_render_(trie, node, CLASP_COMPLETION_KIND_VALUE_, cchKey + 1, prefix, cchPrefix, buffer);
+}
+
+static
+clasp_bool_t
+clasp_completion_is_equals_(
+    clasp_char_t const* arg
+)
+{
+    return '=' == arg[0] && '\0' == arg[1];
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+CLASP_CALL(int)
+clasp_completeArguments(
+    unsigned                            flags
+,   int                                 argc
+,   clasp_char_t*                       argv[]
+,   int                                 wordIndex
+,   clasp_specification_t const        specifications[]
+,   clasp_diagnostic_context_t const*   ctxt
+,   clasp_char_t**                      pbuffer
+,   size_t*                             pcchBuffer
+,   size_t*                             pnumCandidates
+)
+{
+    clasp_diagnostic_context_t      ctxt_;
+    clasp_completion_trie_t_*       trie;
+    clasp_buffer_t_                 buffer;
+    clasp_specification_t const*    valueOf             =   NULL;
+    clasp_bool_t                    valuesOnly          =   clasp_false_v;
+    clasp_char_t const*             word;
+    size_t                          numCandidates       =   0;
+    int                             r;
+
+    CLASP_ASSERT(NULL != argv);
+    CLASP_ASSERT(NULL != pbuffer);
+
+    *pbuffer = NULL;
+    if (NULL != pcchBuffer)
+    {
+        *pcchBuffer = 0;
+    }
+    if (NULL != pnumCandidates)
+    {
+        *pnumCandidates = 0;
+    }
+
+    if (wordIndex < 1 ||
+        wordIndex > argc)
+    {
+        return EINVAL;
+    }
+
+    ctxt = clasp_verify_context_(ctxt, &ctxt_, &r);
+    if (NULL == ctxt)
+    {
+        return r;
+    }
+
+    r = clasp_completion_trie_create_(ctxt, specifications, flags, &trie);
+    if (0 != r)
+    {
+        return r;
+    }
+
+    /* 1. determine the position of the word: whether it is the value of a
+     * preceding option, or follows the double-hyphen
+     */
+
+    { int i; for (i = 1; i != wordIndex; ++i)
+    {
+        clasp_char_t const* const arg = argv[i];
+
+        if (NULL != valueOf)
+        {
+            /* bash separates "--option=value" into three words */
+            if (!clasp_completion_is_equals_(arg))
+            {
+                valueOf = NULL;
+            }
+        }
+        else if (valuesOnly)
+        {
+        }
+        else if ('-' == arg[0] &&
+                 '-' == arg[1] &&
+                 '\0' == arg[2] &&
+                 0 == (CLASP_F_DONT_RECOGNISE_DOUBLEHYPHEN_TO_START_VALUES & flags))
+        {
+            valuesOnly = clasp_true_v;
+        }
+        else if ('-' == arg[0] &&
+                 NULL == clasp_strchreq_(arg, flags))
+        {
+            valueOf = clasp_completion_resolve_option_(trie, specifications, arg, clasp_strlen_(arg));
+        }
+    }}
+
+    word = (wordIndex < argc) ? argv[wordIndex] : CLASP_LITERAL_("");
+
+    /* 2. render the candidates */
+
+    clasp_buffer_init_(&buffer, ctxt, CLASP_ALLOC_SITE_COMPLETION);
+
+    /* ensure that the result is non-NULL, even if there are no candidates */
+    clasp_buffer_reserve_(&buffer, 0);
+
+    if (NULL != valueOf)
+    {
+        if (clasp_completion_is_equals_(word))
+        {
+            word = CLASP_LITERAL_("");
+        }
+
+        numCandidates = clasp_completion_render_values_(trie, valueOf, word, clasp_strlen_(word), NULL, 0, &buffer);
+    }
+    else if (!valuesOnly &&
+             '-' == word[0])
+    {
+        clasp_char_t const* const equal = clasp_strchreq_(word, flags);
+
+        if (NULL == equal)
+        {
+            size_t const node = clasp_completion_trie_find_(trie, 0, word, clasp_strlen_(word));
+
+            if (CLASP_COMPLETION_NONE_ != node)
+            {
+                numCandidates = clasp_completion_render_(trie, node, CLASP_COMPLETION_KIND_NAME_, 0, NULL, 0, &buffer);
+            }
+        }
+        else
+        {
+            size_t const                        cchName =   stlsoft_static_cast(size_t, equal - word);
+            clasp_specification_t const* const  spec    =   clasp_completion_resolve_option_(trie, specifications, word, cchName);
+
+            if (NULL != spec)
+            {
+                numCandidates = clasp_completion_render_values_(trie, spec, equal + 1, clasp_strlen_(equal + 1), word, cchName + 1, &buffer);
+            }
+        }
+    }
+
+    clasp_free_(ctxt, CLASP_ALLOC_SITE_COMPLETION, trie);
+
+    if (0 != buffer.result)
+    {
+        r = buffer.result;
+
+        clasp_buffer_uninit_(&buffer);
+
+        return r;
+    }
+
+    *pbuffer = buffer.ptr;
+    if (NULL != pcchBuffer)
+    {
+        *pcchBuffer = buffer.len;
+    }
+    if (NULL != pnumCandidates)
+    {
+        *pnumCandidates = numCandidates;
+    }
+
+    return 0;
+}
+
+CLASP_CALL(void)
+clasp_releaseCompletionBuffer(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_char_t*                       buffer
+)
+{
+    if (NULL != buffer)
+    {
+        clasp_diagnostic_context_t  ctxt_;
+        int                         r;
+
+        ctxt = clasp_verify_context_(ctxt, &ctxt_, &r);
+        if (NULL != ctxt)
+        {
+            clasp_free_(ctxt, CLASP_ALLOC_SITE_COMPLETION, buffer);
+        }
+    }
+}
+
+CLASP_CALL(int)
+clasp_handleCompletionRequest(
+    unsigned                            flags
+,   int                                 argc
+,   clasp_char_t*                       argv[]
+,   clasp_specification_t const        specifications[]
+,   clasp_diagnostic_context_t const*   ctxt
+)
+{
+    char const* const   request =   getenv(CLASP_COMPLETION_ENVIRONMENT_VARIABLE);
+    clasp_char_t*       candidates;
+    size_t              cchCandidates;
+
+    if (NULL == request ||
+        '\0' == request[0])
+    {
+        return 0;
+    }
+
+    if (0 == clasp_completeArguments(flags, argc, argv, atoi(request), specifications, ctxt, &candidates, &cchCandidates, NULL))
+    {
+        if (0 != cchCandidates)
+        {
+#ifdef CLASP_USE_WIDE_STRINGS
+
+            fputws(candidates, stdout);
+#else /* ? CLASP_USE_WIDE_STRINGS */
+
+            fwrite(candidates, sizeof(clasp_char_t), cchCandidates, stdout);
+#endif /* CLASP_USE_WIDE_STRINGS */
+            fflush(stdout);
+        }
+
+        clasp_releaseCompletionBuffer(ctxt, candidates);
+    }
+
+    return 1;
+}
+
+CLASP_CALL(int)
+clasp_showCompletionScript(
+    clasp_char_t const*                 programName
+,   int                                 shell
+,   void*                               stm
+,   clasp_diagnostic_context_t const*   ctxt
+)
+{
+    clasp_diagnostic_context_t  ctxt_;
+    clasp_buffer_t_             ident;
+    clasp_buffer_t_             buffer;
+    int                         r;
+
+    CLASP_ASSERT(NULL != programName);
+    CLASP_ASSERT(NULL != stm);
+
+    ctxt = clasp_verify_context_(ctxt, &ctxt_, &r);
+    if (NULL == ctxt)
+    {
+        return r;
+    }
+
+    /* the name of the shell function is derived from the program name */
+
+    clasp_buffer_init_(&ident, ctxt, CLASP_ALLOC_SITE_COMPLETION);
+
+    clasp_buffer_append_s_(&ident, CLASP_LITERAL_("_"));
+    { clasp_char_t const* p = programName; for (; '\0' != *p; ++p)
+    {
+        clasp_char_t const ch = *p;
+
+        clasp_buffer_append_n_(&ident, (('a' <= ch && ch <= 'z') || ('A' <= ch && ch <= 'Z') || ('0' <= ch && ch <= '9')) ? ch : '_', 1);
+    }}
+    clasp_buffer_append_s_(&ident, CLASP_LITERAL_("_clasp_complete"));
+
+    if (0 != ident.result)
+    {
+        r = ident.result;
+
+        clasp_buffer_uninit_(&ident);
+
+        return r;
+    }
+
+    clasp_buffer_init_(&buffer, ctxt, CLASP_ALLOC_SITE_COMPLETION);
+
+    switch (shell)
+    {
+    case CLASP_COMPLETION_SHELL_BASH:
+
+        clasp_buffer_append_s_(&buffer, CLASP_LITERAL_("# bash completion for "));
+        clasp_buffer_append_s_(&buffer, programName);
+        clasp_buffer_append_s_(&buffer, CLASP_LITERAL_("\n"));
+        clasp_buffer_append_s_(&buffer, ident.ptr);
+        clasp_buffer_append_s_(&buffer, CLASP_LITERAL_("()\n{\n    local IFS=$'\\n'\n    COMPREPLY=( $(" CLASP_COMPLETION_ENVIRONMENT_VARIABLE "=\"$COMP_CWORD\" \"${COMP_WORDS[0]}\" \"${COMP_WORDS[@]:1:$COMP_CWORD}\" 2>/dev/null) )\n}\ncomplete -o default -F "));
+        clasp_buffer_append_s_(&buffer, ident.ptr);
+        clasp_buffer_append_s_(&buffer, CLASP_LITERAL_(" "));
+        clasp_buffer_append_s_(&buffer, programName);
+        clasp_buffer_append_s_(&buffer, CLASP_LITERAL_("\n"));
+        break;
+    case CLASP_COMPLETION_SHELL_ZSH:
+
+        clasp_buffer_append_s_(&buffer, CLASP_LITERAL_("#compdef "));
+        clasp_buffer_append_s_(&buffer, programName);
+        clasp_buffer_append_s_(&buffer, CLASP_LITERAL_("\n"));
+        clasp_buffer_append_s_(&buffer, ident.ptr);
+        clasp_buffer_append_s_(&buffer, CLASP_LITERAL_("()\n{\n    local -a candidates\n    candidates=( ${(f)\"$(" CLASP_COMPLETION_ENVIRONMENT_VARIABLE "=$(( CURRENT - 1 )) \"${words[1]}\" \"${(@)words[2,CURRENT]}\" 2>/dev/null)\"} )\n    if (( ${#candidates} )); then\n        compadd -Q -- $candidates\n    else\n        _files\n    fi\n}\ncompdef "));
+        clasp_buffer_append_s_(&buffer, ident.ptr);
+        clasp_buffer_append_s_(&buffer, CLASP_LITERAL_(" "));
+        clasp_buffer_append_s_(&buffer, programName);
+        clasp_buffer_append_s_(&buffer, CLASP_LITERAL_("\n"));
+        break;
+    default:
+
+        clasp_buffer_uninit_(&buffer);
+        clasp_buffer_uninit_(&ident);
+
+        return EINVAL;
+    }
+
+    r = clasp_usage_write_buffer_to_FILE_(ctxt, &buffer, stlsoft_static_cast(FILE*, stm));
+
+    clasp_buffer_uninit_(&buffer);
+    clasp_buffer_uninit_(&ident);
+
+    return r;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
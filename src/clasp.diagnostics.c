@@ -4,7 +4,7 @@
  * Purpose: CLASP diagnostics facilities.
  *
  * Created: 4th June 2008
- * Updated: 11th March 2025
+ * Updated: 19th October 2026
  *
  * Home:    https://github.com/synesissoftware/CLASP/
  *
@@ -125,6 +125,7 @@ clasp_verify_context_(
     CLASP_ASSERT(NULL != r);
 
     local->context          =   NULL;
+    local->param            =   NULL;
     local->pfnMalloc        =   clasp_stock_malloc_;
     local->pfnRealloc       =   clasp_stock_realloc_;
     local->pfnFree          =   clasp_stock_free_;
@@ -134,6 +135,9 @@ clasp_verify_context_(
     local->severities[2]    =   3;
     local->severities[3]    =   1;
     local->severities[4]    =   0;
+    local->flags            =   0;
+    local->pfnTrace         =   NULL;
+    local->cb               =   sizeof(*local);
 
     *r = 0;
 
@@ -155,10 +159,10 @@ clasp_verify_context_(
         }
 
         /* If all ok, now copy over the three groups of
-         * fields
+         * fields, along with the parameter
          */
 
-        local->context       =   NULL;
+        local->param            =   ctxt->param;
 
         if (NULL != ctxt->pfnMalloc)
         {
@@ -176,6 +180,22 @@ clasp_verify_context_(
             local->severities[3]    =   ctxt->severities[3];
             local->severities[4]    =   ctxt->severities[4];
         }
+
+        /* The context, which is passed to the functions, the flags, and
+         * the trace function are taken only from a context that records
+         * - as one initialised by clasp_init_diagnostic_context() does -
+         * a size that includes them, so that those members are never
+         * read uninitialised from a context filled in by hand (or built
+         * against an earlier version of this header)
+         */
+
+        if (ctxt->cb >= offsetof(clasp_diagnostic_context_t, cb) &&
+            ctxt->cb <= sizeof(clasp_diagnostic_context_t))
+        {
+            local->context          =   ctxt->context;
+            local->flags            =   ctxt->flags;
+            local->pfnTrace         =   ctxt->pfnTrace;
+        }
     }
 
     return local;
@@ -0,0 +1,89 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/clasp.fingerprint.c
+ *
+ * Purpose: CLASP fingerprinting facilities.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * Home:    https://github.com/synesissoftware/CLASP/
+ *
+ * Copyright (c) 2026, Matthew Wilson
+ * All rights reserved.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include "clasp.internal.h"
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+void
+clasp_fingerprint_init_(
+    size_t      fingerprint[2]
+)
+{
+    fingerprint[0] = stlsoft_static_cast(size_t, 2166136261u);
+    fingerprint[1] = 0;
+}
+
+void
+clasp_fingerprint_bytes_(
+    size_t      fingerprint[2]
+,   void const* pv
+,   size_t      cb
+)
+{
+    unsigned char const* const p = stlsoft_static_cast(unsigned char const*, pv);
+
+    { size_t i; for (i = 0; i != cb; ++i)
+    {
+        fingerprint[0] ^= p[i];
+        fingerprint[0] *= stlsoft_static_cast(size_t, 16777619u);
+
+        fingerprint[1] = p[i] + (fingerprint[1] << 6) + (fingerprint[1] << 16) - fingerprint[1];
+    }}
+}
+
+void
+clasp_fingerprint_int_(
+    size_t      fingerprint[2]
+,   int         i
+)
+{
+    clasp_fingerprint_bytes_(fingerprint, &i, sizeof(i));
+}
+
+void
+clasp_fingerprint_string_(
+    size_t              fingerprint[2]
+,   clasp_char_t const* s
+)
+{
+    /* length-prefixed, so that adjacent fields cannot alias, and with NULL
+     * distinct from the empty string
+     */
+
+    if (NULL == s)
+    {
+        clasp_fingerprint_int_(fingerprint, -1);
+    }
+    else
+    {
+        size_t const len = clasp_strlen_(s);
+
+        clasp_fingerprint_bytes_(fingerprint, &len, sizeof(len));
+        clasp_fingerprint_bytes_(fingerprint, s, sizeof(clasp_char_t) * len);
+    }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
@@ -0,0 +1,538 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/clasp.index.c
+ *
+ * Purpose: CLASP specification index facilities.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * Home:    https://github.com/synesissoftware/CLASP/
+ *
+ * Copyright (c) 2026, Matthew Wilson
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer;
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution;
+ * - Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include "clasp.internal.h"
+
+#include <errno.h>
+#include <stddef.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+/* The seed beyond which placement of a bucket is abandoned; it is not
+ * reached in practice
+ */
+#define CLASP_INDEX_MAX_SEED_                               (0xffffUL)
+#define CLASP_INDEX_NONE_                                   (~(size_t)0)
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+typedef struct clasp_index_key_t_ clasp_index_key_t_;
+
+struct clasp_index_key_t_
+{
+    clasp_char_t const* ptr;
+    size_t              len;
+    unsigned long       hash;       /* with seed 0 */
+    int                 specIndex;
+    size_t              bucket;
+};
+
+/* The index is allocated in a single block, holding the context from which
+ * it was allocated, followed by the seeds, wide short flags, slots, short
+ * flags, and prefix trie arrays
+ */
+typedef struct clasp_specification_index_x_t_ clasp_specification_index_x_t_;
+
+struct clasp_specification_index_x_t_
+{
+    clasp_specification_index_t index;
+    clasp_diagnostic_context_t  ctxt;
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+static
+size_t
+clasp_index_next_power_of_2_(
+    size_t n
+)
+{
+    size_t r = 1;
+
+    for (; r < n; r <<= 1)
+    {}
+
+    return r;
+}
+
+/* Gathers the keys in the order in which clasp_lookup_alias_len_()
+ * searches - names, then non-defaulted mapped arguments, then defaulted
+ * mapped arguments - omitting any already gathered, so that the first
+ * specification of any given key wins. Keys already gathered are found via
+ * table, an open-addressed set, keyed by hash, of numTable (a power of two
+ * greater than the number of keys) entries. Returns the number of keys.
+ */
+static
+size_t
+clasp_index_gather_keys_(
+    clasp_specification_t const specifications[]
+,   size_t                      numBuckets
+,   clasp_index_key_t_*         keys
+,   size_t*                     table
+,   size_t                      numTable
+)
+{
+    size_t numKeys = 0;
+
+    { size_t i; for (i = 0; i != numTable; ++i)
+    {
+        table[i] = CLASP_INDEX_NONE_;
+    }}
+
+    { int pass; for (pass = 0; 3 != pass; ++pass)
+    {
+        { size_t i; for (i = 0; CLASP_ARGTYPE_INVALID != specifications[i].type; ++i)
+        {
+            clasp_specification_t const* const  specification   =   specifications + i;
+            clasp_char_t const*                 key             =   NULL;
+            size_t                              cchKey          =   0;
+
+            if (0 == pass)
+            {
+                key = specification->name;
+
+                if (NULL != key)
+                {
+                    cchKey = clasp_strlen_(key);
+                }
+            }
+            else
+            if (NULL != specification->mappedArgument)
+            {
+                clasp_char_t const* const equal = clasp_strchreq_(specification->mappedArgument, 0);
+
+                if ((NULL != equal) == (2 == pass))
+                {
+                    key     =   specification->mappedArgument;
+                    cchKey  =   (NULL == equal) ? clasp_strlen_(key) : stlsoft_static_cast(size_t, equal - key);
+                }
+            }
+
+            if (0 != cchKey)
+            {
+                unsigned long const hash    =   clasp_hashSpecificationKey(key, cchKey, 0);
+                size_t              t       =   hash & (numTable - 1);
+                clasp_bool_t        found   =   clasp_false_v;
+
+                for (; !found && CLASP_INDEX_NONE_ != table[t]; t = (t + 1) & (numTable - 1))
+                {
+                    clasp_index_key_t_ const* const other = &keys[table[t]];
+
+                    found = other->hash == hash && other->len == cchKey && 0 == clasp_strncmp_(other->ptr, key, cchKey);
+                }
+
+                if (!found)
+                {
+                    table[t]                =   numKeys;
+                    keys[numKeys].ptr       =   key;
+                    keys[numKeys].len       =   cchKey;
+                    keys[numKeys].hash      =   hash;
+                    keys[numKeys].specIndex =   stlsoft_static_cast(int, i);
+                    keys[numKeys].bucket    =   hash & (numBuckets - 1);
+                    ++numKeys;
+                }
+            }
+        }}
+    }}
+
+    return numKeys;
+}
+
+/* Indicates whether the key is that of a single-character flag, i.e.
+ * "-c"
+ */
+static
+clasp_bool_t
+clasp_index_is_short_flag_(
+    clasp_index_key_t_ const* key
+)
+{
+    return 2 == key->len && '-' == key->ptr[0];
+}
+
+/* Attempts to place all the keys of a bucket, given by order[first, last),
+ * with the given seed, into distinct empty slots, leaving the slots as
+ * they were on failure
+ */
+static
+clasp_bool_t
+clasp_index_place_bucket_(
+    clasp_index_key_t_ const*   keys
+,   size_t const*               order
+,   size_t                      first
+,   size_t                      last
+,   unsigned long               seed
+,   int*                        slots
+,   size_t                      numSlots
+)
+{
+    { size_t j; for (j = first; j != last; ++j)
+    {
+        clasp_index_key_t_ const* const key     =   &keys[order[j]];
+        size_t const                    slot    =   clasp_hashSpecificationKey(key->ptr, key->len, seed) & (numSlots - 1);
+
+        if (-1 != slots[slot])
+        {
+            /* undo the placements thus far */
+            for (; first != j; ++first)
+            {
+                clasp_index_key_t_ const* const placed = &keys[order[first]];
+
+                slots[clasp_hashSpecificationKey(placed->ptr, placed->len, seed) & (numSlots - 1)] = -1;
+            }
+
+            return clasp_false_v;
+        }
+
+        slots[slot] = key->specIndex;
+    }}
+
+    return clasp_true_v;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+CLASP_CALL(unsigned long)
+clasp_hashSpecificationKey(
+    clasp_char_t const*                 key
+,   size_t                              cchKey
+,   unsigned long                       seed
+)
+{
+    unsigned long h = (2166136261UL ^ (seed * 0x9e3779b1UL)) & 0xffffffffUL;
+
+    CLASP_ASSERT(NULL != key || 0 == cchKey);
+
+    { size_t i; for (i = 0; i != cchKey; ++i)
+    {
+        h ^= stlsoft_static_cast(unsigned long, key[i]);
+        h = (h * 16777619UL) & 0xffffffffUL;
+    }}
+
+    return h ^ (h >> 16);
+}
+
+CLASP_CALL(int)
+clasp_createSpecificationIndex(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_specification_t const         specifications[]
+,   clasp_specification_index_t const** pindex
+)
+{
+    clasp_diagnostic_context_t      ctxt_;
+    int                             r;
+    size_t                          numSpecifications;
+    size_t                          maxKeys;
+    size_t                          numKeys;
+    size_t                          numBuckets;
+    size_t                          numSlots;
+    clasp_index_key_t_*             keys;
+    size_t*                         starts;
+    size_t*                         order;
+    size_t*                         sizeStarts;
+    size_t*                         bucketOrder;
+    size_t*                         table;
+    clasp_specification_index_x_t_* indexx;
+    unsigned long*                  seeds;
+    int*                            slots;
+    int*                            shortFlags;
+    clasp_short_flag_t*             wideShortFlags;
+    size_t                          numWideShortFlags;
+    size_t                          maxTrieNodes;
+    clasp_prefix_trie_node_t*       trieNodes;
+
+    CLASP_ASSERT(NULL != specifications);
+    CLASP_ASSERT(NULL != pindex);
+
+    *pindex = NULL;
+
+    ctxt = clasp_verify_context_(ctxt, &ctxt_, &r);
+    if (NULL == ctxt)
+    {
+        return r;
+    }
+
+    r = clasp_validate_specifications_(ctxt, NULL, specifications);
+    if (0 != r)
+    {
+        return r;
+    }
+
+    /* sized as by clasp::static_specifications, wherein N includes the
+     * terminator
+     */
+    numSpecifications   =   clasp_countSpecifications(specifications) + 1;
+    maxKeys             =   2 * numSpecifications;
+    numBuckets          =   clasp_index_next_power_of_2_(numSpecifications);
+    numSlots            =   clasp_index_next_power_of_2_(2 * maxKeys);
+    maxTrieNodes        =   clasp_prefix_trie_max_nodes_(specifications, 0);
+
+    keys = stlsoft_static_cast(clasp_index_key_t_*, clasp_malloc_(ctxt, CLASP_ALLOC_SITE_INDEX_SCRATCH, maxKeys * sizeof(clasp_index_key_t_)));
+    starts = stlsoft_static_cast(size_t*, clasp_malloc_(ctxt, CLASP_ALLOC_SITE_INDEX_SCRATCH, ((numBuckets + 1) + maxKeys + (maxKeys + 2) + numBuckets + numSlots) * sizeof(size_t)));
+    indexx = NULL;
+
+    if (NULL != keys &&
+        NULL != starts)
+    {
+        order       =   starts + numBuckets + 1;
+        sizeStarts  =   order + maxKeys;
+        bucketOrder =   sizeStarts + maxKeys + 2;
+        table       =   bucketOrder + numBuckets;
+
+        numKeys = clasp_index_gather_keys_(specifications, numBuckets, keys, table, numSlots);
+
+        numWideShortFlags = 0;
+        { size_t k; for (k = 0; k != numKeys; ++k)
+        {
+            if (clasp_index_is_short_flag_(&keys[k]) &&
+                clasp_char_code_(keys[k].ptr[1]) >= CLASP_SHORT_FLAG_TABLE_SIZE)
+            {
+                ++numWideShortFlags;
+            }
+        }}
+
+        indexx = stlsoft_static_cast(clasp_specification_index_x_t_*, clasp_malloc_(ctxt, CLASP_ALLOC_SITE_INDEX, sizeof(clasp_specification_index_x_t_) + numBuckets * sizeof(unsigned long) + numWideShortFlags * sizeof(clasp_short_flag_t) + (numSlots + CLASP_SHORT_FLAG_TABLE_SIZE) * sizeof(int) + maxTrieNodes * sizeof(clasp_prefix_trie_node_t)));
+    }
+
+    if (NULL == indexx ||
+        NULL == keys ||
+        NULL == starts)
+    {
+        CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_FATAL, CLASP_LITERAL_("could not allocate memory for specification index"));
+
+        if (NULL != starts)
+        {
+            clasp_free_(ctxt, CLASP_ALLOC_SITE_INDEX_SCRATCH, starts);
+        }
+        if (NULL != keys)
+        {
+            clasp_free_(ctxt, CLASP_ALLOC_SITE_INDEX_SCRATCH, keys);
+        }
+        if (NULL != indexx)
+        {
+            clasp_free_(ctxt, CLASP_ALLOC_SITE_INDEX, indexx);
+        }
+
+        return ENOMEM;
+    }
+
+    memcpy(&indexx->ctxt, ctxt, sizeof(indexx->ctxt));
+
+    /* the arrays are placed in decreasing order of alignment */
+    seeds           =   stlsoft_static_cast(unsigned long*, stlsoft_static_cast(void*, indexx + 1));
+    wideShortFlags  =   stlsoft_static_cast(clasp_short_flag_t*, stlsoft_static_cast(void*, seeds + numBuckets));
+    slots           =   stlsoft_static_cast(int*, stlsoft_static_cast(void*, wideShortFlags + numWideShortFlags));
+    shortFlags      =   slots + numSlots;
+    trieNodes       =   stlsoft_static_cast(clasp_prefix_trie_node_t*, stlsoft_static_cast(void*, shortFlags + CLASP_SHORT_FLAG_TABLE_SIZE));
+
+    indexx->index.specifications    =   specifications;
+    indexx->index.numBuckets        =   numBuckets;
+    indexx->index.seeds             =   seeds;
+    indexx->index.numSlots          =   numSlots;
+    indexx->index.slots             =   slots;
+    indexx->index.shortFlags        =   shortFlags;
+    indexx->index.numWideShortFlags =   numWideShortFlags;
+    indexx->index.wideShortFlags    =   (0 == numWideShortFlags) ? NULL : wideShortFlags;
+    indexx->index.numTrieNodes      =   clasp_prefix_trie_build_(specifications, 0, trieNodes);
+    indexx->index.trieNodes         =   trieNodes;
+
+    /* 0. the single-character keys, which are already in order of
+     * precedence, are entered in the direct table, or else inserted, in
+     * order of character, into the wide table
+     */
+
+    { size_t i; for (i = 0; i != CLASP_SHORT_FLAG_TABLE_SIZE; ++i)
+    {
+        shortFlags[i] = -1;
+    }}
+
+    numWideShortFlags = 0;
+    { size_t k; for (k = 0; k != numKeys; ++k)
+    {
+        if (clasp_index_is_short_flag_(&keys[k]))
+        {
+            unsigned long const code = clasp_char_code_(keys[k].ptr[1]);
+
+            if (code < CLASP_SHORT_FLAG_TABLE_SIZE)
+            {
+                shortFlags[code] = keys[k].specIndex;
+            }
+            else
+            {
+                size_t w = numWideShortFlags++;
+
+                for (; 0 != w && clasp_char_code_(wideShortFlags[w - 1].character) > code; --w)
+                {
+                    wideShortFlags[w] = wideShortFlags[w - 1];
+                }
+
+                wideShortFlags[w].character = keys[k].ptr[1];
+                wideShortFlags[w].specIndex = keys[k].specIndex;
+            }
+        }
+    }}
+
+    /* 1. order the keys by bucket (a counting sort), such that bucket b
+     * occupies order[starts[b], starts[b + 1]); and order the buckets by
+     * decreasing size, and then by increasing index (another counting
+     * sort, indexed by numKeys - size), into bucketOrder
+     */
+
+    memset(starts, 0, (numBuckets + 1) * sizeof(size_t));
+    memset(sizeStarts, 0, (numKeys + 2) * sizeof(size_t));
+
+    { size_t k; for (k = 0; k != numKeys; ++k)
+    {
+        ++starts[keys[k].bucket + 1];
+    }}
+    { size_t b; for (b = 0; b != numBuckets; ++b)
+    {
+        ++sizeStarts[numKeys - starts[b + 1] + 1];
+
+        starts[b + 1] += starts[b];
+    }}
+    { size_t k; for (k = 0; k != numKeys; ++k)
+    {
+        order[starts[keys[k].bucket]++] = k;
+    }}
+    { size_t b; for (b = numBuckets; 0 != b; --b)
+    {
+        starts[b] = starts[b - 1];
+    }}
+    starts[0] = 0;
+    { size_t z; for (z = 0; z != numKeys + 1; ++z)
+    {
+        sizeStarts[z + 1] += sizeStarts[z];
+    }}
+    { size_t b; for (b = 0; b != numBuckets; ++b)
+    {
+        bucketOrder[sizeStarts[numKeys - (starts[b + 1] - starts[b])]++] = b;
+    }}
+
+    /* 2. place the non-empty buckets, largest first, finding for each the
+     * first seed that maps all its keys to distinct empty slots
+     */
+
+    { size_t i; for (i = 0; i != numBuckets; ++i)
+    {
+        seeds[i] = 0;
+    }}
+    { size_t i; for (i = 0; i != numSlots; ++i)
+    {
+        slots[i] = -1;
+    }}
+
+    r = 0;
+
+    { size_t o; for (o = 0; 0 == r && o != numBuckets; ++o)
+    {
+        size_t const    b       =   bucketOrder[o];
+        unsigned long   seed    =   1;
+
+        if (starts[b] == starts[b + 1])
+        {
+            break;
+        }
+
+        for (; !clasp_index_place_bucket_(keys, order, starts[b], starts[b + 1], seed, slots, numSlots); ++seed)
+        {
+            if (CLASP_INDEX_MAX_SEED_ == seed)
+            {
+                CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_ERROR, CLASP_LITERAL_("could not compute perfect hash of specifications"));
+
+                r = EINVAL;
+
+                break;
+            }
+        }
+
+        seeds[b] = seed;
+    }}
+
+    clasp_free_(ctxt, CLASP_ALLOC_SITE_INDEX_SCRATCH, starts);
+    clasp_free_(ctxt, CLASP_ALLOC_SITE_INDEX_SCRATCH, keys);
+
+    if (0 != r)
+    {
+        clasp_free_(ctxt, CLASP_ALLOC_SITE_INDEX, indexx);
+    }
+    else
+    {
+        *pindex = &indexx->index;
+    }
+
+    return r;
+}
+
+CLASP_CALL(void)
+clasp_destroySpecificationIndex(
+    clasp_specification_index_t const*  index
+)
+{
+    if (NULL != index)
+    {
+        clasp_specification_index_x_t_* const indexx = (clasp_specification_index_x_t_*)stlsoft_const_cast(clasp_specification_index_t*, index);
+
+        CLASP_ASSERT(0 == offsetof(clasp_specification_index_x_t_, index));
+
+        clasp_free_(&indexx->ctxt, CLASP_ALLOC_SITE_INDEX, indexx);
+    }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
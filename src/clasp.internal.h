@@ -4,7 +4,7 @@
  * Purpose: CLASP internal common header.
  *
  * Created: 4th June 2008
- * Updated: 11th March 2025
+ * Updated: 19th October 2026
  *
  * Home:    https://github.com/synesissoftware/CLASP/
  *
@@ -39,6 +39,9 @@
  * ////////////////////////////////////////////////////////////////////// */
 
 
+#ifndef CLASP_INCL_SRC_H_CLASP_INTERNAL
+#define CLASP_INCL_SRC_H_CLASP_INTERNAL
+
 
 /* /////////////////////////////////////////////////////////////////////////
  * includes
@@ -51,6 +54,7 @@
 #else /* ? compiler */
 # include <assert.h>
 #endif /* compiler */
+#include <stdio.h>
 #include <string.h>
 
 
@@ -140,15 +144,535 @@ clasp_diagnostic_context_from_args_(
  * memory
  */
 
-void* clasp_malloc_(clasp_diagnostic_context_t const* ctxt, size_t cb);
-void* clasp_realloc_(clasp_diagnostic_context_t const* ctxt, void* pv, size_t cb);
-void clasp_free_(clasp_diagnostic_context_t const* ctxt, void* pv);
+/* Allocates, reallocates, and frees via the functions of the diagnostic
+ * context, reporting each to its trace function, if any, tagged with the
+ * given site.
+ */
+void* clasp_malloc_(clasp_diagnostic_context_t const* ctxt, clasp_alloc_site_t site, size_t cb);
+void* clasp_realloc_(clasp_diagnostic_context_t const* ctxt, clasp_alloc_site_t site, void* pv, size_t cb);
+void clasp_free_(clasp_diagnostic_context_t const* ctxt, clasp_alloc_site_t site, void* pv);
 
 void* CLASP_CALLCONV clasp_stock_malloc_(void* context, size_t cb);
 void* CLASP_CALLCONV clasp_stock_realloc_(void* context, void* pv, size_t cb);
 void CLASP_CALLCONV clasp_stock_free_(void* context, void* pv);
 
 
+/* /////////////////////////////////////////////////////////////////////////
+ * statistics
+ */
+
+/* Counts the given statistic, if statistics are being collected */
+#define CLASP_STATISTICS_COUNT_(stats, member)              ((NULL != (stats)) ? (void)++(stats)->member : (void)0)
+
+/* Obtains the current time, in nanoseconds, from the platform's monotonic
+ * clock (or, failing that, from clock()).
+ */
+double
+clasp_statistics_now_ns_(void);
+
+/* As clasp_malloc_(), counting the allocation in stats, if not NULL */
+void*
+clasp_statistics_malloc_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_parse_statistics_t*           stats
+,   clasp_alloc_site_t                  site
+,   size_t                              cb
+);
+
+/* As clasp_realloc_(), counting the allocation in stats, if not NULL */
+void*
+clasp_statistics_realloc_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_parse_statistics_t*           stats
+,   clasp_alloc_site_t                  site
+,   void*                               pv
+,   size_t                              cb
+);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * fingerprinting
+ *
+ * A fingerprint comprises two independent hashes - FNV-1a and sdbm - of a
+ * sequence of fields.
+ */
+
+/* Initialises the fingerprint */
+void
+clasp_fingerprint_init_(
+    size_t      fingerprint[2]
+);
+
+/* Folds the bytes pv[0, cb) into the fingerprint */
+void
+clasp_fingerprint_bytes_(
+    size_t      fingerprint[2]
+,   void const* pv
+,   size_t      cb
+);
+
+/* Folds the integer into the fingerprint */
+void
+clasp_fingerprint_int_(
+    size_t      fingerprint[2]
+,   int         i
+);
+
+/* Folds the - length-prefixed - string into the fingerprint, with NULL
+ * distinct from the empty string
+ */
+void
+clasp_fingerprint_string_(
+    size_t              fingerprint[2]
+,   clasp_char_t const* s
+);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * buffer
+ */
+
+/* A growable, nul-terminated, character buffer, whose memory is acquired
+ * via the diagnostic context.
+ *
+ * Once an operation fails, all subsequent appends are ignored, and the
+ * failure code is available in the result member.
+ */
+typedef struct clasp_buffer_t_ clasp_buffer_t_;
+
+struct clasp_buffer_t_
+{
+    clasp_diagnostic_context_t const*   ctxt;
+    clasp_alloc_site_t                  site;
+    clasp_char_t*                       ptr;
+    size_t                              len;
+    size_t                              capacity;
+    int                                 result;
+};
+
+/* Initialises the buffer, which does not allocate.
+ *
+ * \pre (NULL != buffer)
+ * \pre (NULL != ctxt)
+ */
+void
+clasp_buffer_init_(
+    clasp_buffer_t_*                    buffer
+,   clasp_diagnostic_context_t const*   ctxt
+,   clasp_alloc_site_t                  site
+);
+
+/* Releases any memory held by the buffer.
+ *
+ * \pre (NULL != buffer)
+ */
+void
+clasp_buffer_uninit_(
+    clasp_buffer_t_*    buffer
+);
+
+/* Ensures that the buffer has capacity for at least cch characters (in
+ * addition to its current contents and the nul-terminator).
+ *
+ * \retval 0 The capacity is available
+ * \retval ENOMEM The capacity could not be allocated
+ *
+ * \pre (NULL != buffer)
+ */
+int
+clasp_buffer_reserve_(
+    clasp_buffer_t_*    buffer
+,   size_t              cch
+);
+
+/* Appends the characters s[0, len) to the buffer.
+ *
+ * \pre (NULL != buffer)
+ * \pre (NULL != s || 0 == len)
+ */
+void
+clasp_buffer_append_(
+    clasp_buffer_t_*    buffer
+,   clasp_char_t const* s
+,   size_t              len
+);
+
+/* Appends the nul-terminated string s to the buffer.
+ *
+ * \pre (NULL != buffer)
+ * \pre (NULL != s)
+ */
+void
+clasp_buffer_append_s_(
+    clasp_buffer_t_*    buffer
+,   clasp_char_t const* s
+);
+
+/* Appends n instances of the character ch to the buffer.
+ *
+ * \pre (NULL != buffer)
+ */
+void
+clasp_buffer_append_n_(
+    clasp_buffer_t_*    buffer
+,   clasp_char_t        ch
+,   size_t              n
+);
+
+/* Appends the decimal representation of i to the buffer.
+ *
+ * \pre (NULL != buffer)
+ */
+void
+clasp_buffer_append_int_(
+    clasp_buffer_t_*    buffer
+,   int                 i
+);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * wrapping
+ */
+
+/* Callback invoked for each line produced by clasp_wrap_text_(). The line
+ * is not nul-terminated.
+ */
+typedef void (*clasp_wrap_line_fn_t_)(
+    void*               param
+,   clasp_char_t const* line
+,   size_t              len
+);
+
+/* Breaks the text s[0, len) into lines of no more than width display
+ * columns, breaking at whitespace, and invokes pfn for each line in turn.
+ *
+ * Display width is measured in terminal columns - each UTF-8 sequence (or,
+ * in wide-string builds, each character) being 0, 1, or 2 columns wide -
+ * rather than in characters. A word wider than width is placed on a line
+ * of its own. Empty text yields a single empty line.
+ *
+ * All breaks are determined in a single pass over the text.
+ *
+ * \pre (NULL != s || 0 == len)
+ * \pre (NULL != pfn)
+ */
+void
+clasp_wrap_text_(
+    clasp_char_t const*     s
+,   size_t                  len
+,   size_t                  width
+,   clasp_wrap_line_fn_t_   pfn
+,   void*                   param
+);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * prefix trie
+ */
+
+/* A compressed (radix) trie of the (distinct) long names - the mapped
+ * arguments, up to any '=' - of the flag and option specifications, in
+ * which each node records the number of names in its subtree, so that a
+ * prefix may be resolved to a unique name in O(length). Its nodes are
+ * either owned by the trie, or else held by a specification index.
+ */
+typedef struct clasp_prefix_trie_t_ clasp_prefix_trie_t_;
+
+struct clasp_prefix_trie_t_
+{
+    unsigned                            flags;
+    size_t                              numNodes;
+    clasp_prefix_trie_node_t const*     nodes;
+};
+
+/* Obtains the maximum number of nodes of the trie of the specifications */
+size_t
+clasp_prefix_trie_max_nodes_(
+    clasp_specification_t const         specifications[]
+,   unsigned                            flags
+);
+
+/* Builds the trie of the specifications into nodes, which must have room
+ * for clasp_prefix_trie_max_nodes_() elements, returning the number of
+ * nodes.
+ *
+ * \note Must be kept in step with clasp::static_specifications
+ *
+ * \pre (NULL != nodes)
+ */
+size_t
+clasp_prefix_trie_build_(
+    clasp_specification_t const         specifications[]
+,   unsigned                            flags
+,   clasp_prefix_trie_node_t*           nodes
+);
+
+/* Creates a prefix trie from the specifications.
+ *
+ * \retval 0 The trie was created
+ * \retval ENOMEM The trie could not be allocated
+ *
+ * \pre (NULL != ctxt)
+ * \pre (NULL != ptrie)
+ */
+int
+clasp_prefix_trie_create_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_parse_statistics_t*           stats
+,   clasp_specification_t const         specifications[]
+,   unsigned                            flags
+,   clasp_prefix_trie_t_**              ptrie
+);
+
+/* Destroys a prefix trie.
+ *
+ * \pre (NULL != ctxt)
+ */
+void
+clasp_prefix_trie_destroy_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_prefix_trie_t_*               trie
+);
+
+/* Initialises, without allocation, the given trie to refer to the nodes
+ * held by the index, returning it, or returns NULL if the index (which may
+ * be NULL) holds none. The trie must not be destroyed.
+ *
+ * \pre (NULL != trie)
+ */
+clasp_prefix_trie_t_ const*
+clasp_prefix_trie_from_index_(
+    clasp_specification_index_t const*  index
+,   unsigned                            flags
+,   clasp_prefix_trie_t_*               trie
+);
+
+/* Looks up the specification whose long name is uniquely identified by
+ * the prefix name[0, cchName), which must include the leading "--".
+ *
+ * If the prefix is ambiguous, NULL is returned and, when ctxt is not NULL,
+ * the ambiguity is logged along with all the candidate names.
+ *
+ * \pre (NULL != trie)
+ * \pre (NULL != name)
+ */
+clasp_specification_t const*
+clasp_prefix_trie_lookup_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_prefix_trie_t_ const*         trie
+,   clasp_specification_t const         specifications[]
+,   clasp_char_t const*                 name
+,   size_t                              cchName
+);
+
+/* Obtains the specifications of all the long names that begin with
+ * name[0, cchName), writing up to maxCandidates of them into candidates,
+ * and returning the total number.
+ *
+ * \pre (NULL != trie)
+ * \pre (NULL != name)
+ * \pre (NULL != candidates || 0 == maxCandidates)
+ */
+size_t
+clasp_prefix_trie_candidates_(
+    clasp_prefix_trie_t_ const*         trie
+,   clasp_specification_t const         specifications[]
+,   clasp_char_t const*                 name
+,   size_t                              cchName
+,   clasp_specification_t const**       candidates
+,   size_t                              maxCandidates
+);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * value schema
+ *
+ * The values of flags/options are decoded, against a schema parallel to
+ * the specifications, into an array of typed values held in the results
+ * block. The index of the typed value of an argument is held, plus one, in
+ * the bits of its flags member from CLASP_ARG_TYPED_SHIFT_ upwards, so
+ * that it remains valid as the arguments are sorted, appended, and
+ * serialized.
+ */
+
+#define CLASP_ARG_TYPED_SHIFT_                              (8)
+
+/* The greatest number of typed values that may be so recorded; the values
+ * of arguments beyond it are not decoded
+ */
+#define CLASP_ARG_TYPED_MAX_                                (INT_MAX >> CLASP_ARG_TYPED_SHIFT_)
+
+/** Validates the schema against the specifications, logging the first
+ * problem found.
+ *
+ * \retval 0 The schema is valid
+ * \retval EINVAL The schema is invalid
+ *
+ * \pre (NULL != ctxt)
+ * \pre (NULL != schema)
+ */
+int
+clasp_schema_validate_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_specification_t const         specifications[]
+,   clasp_value_schema_t const          schema[]
+);
+
+/** Decodes the values of the flags/options among the given arguments into
+ * typedValues - which must have room for numArgs elements - recording the
+ * index of each in its argument, and returns the number decoded. seen
+ * must have room for one bit for each specification.
+ *
+ * \pre (NULL != ctxt)
+ * \pre (NULL != specifications)
+ * \pre (NULL != schema)
+ * \pre (NULL != typedValues || 0 == numArgs)
+ * \pre (NULL != seen)
+ */
+size_t
+clasp_schema_decode_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_specification_t const         specifications[]
+,   clasp_value_schema_t const          schema[]
+,   clasp_argument_t*                   arguments
+,   size_t                              numArgs
+,   clasp_typed_value_t*                typedValues
+,   unsigned char*                      seen
+);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * values-from-stream
+ */
+
+/* A list of the chunks into which the values of streams are read, each
+ * value being terminated in place. Used only with multibyte strings.
+ */
+typedef struct clasp_stream_chunk_t_ clasp_stream_chunk_t_;
+
+#ifndef CLASP_USE_WIDE_STRINGS
+
+/* Reads the stream of each instance of the option optionName, in order,
+ * marking each as used: if pchunks is not NULL, into chunks that are
+ * returned - even on failure - in *pchunks; otherwise, delivering each
+ * value to pfn, stopping if it returns non-0.
+ *
+ * \pre (NULL != args)
+ * \pre (NULL != optionName)
+ * \pre (NULL != pfn || NULL != pchunks)
+ */
+int
+clasp_stream_read_option_(
+    clasp_arguments_t const*    args
+,   clasp_char_t const*         optionName
+,   unsigned                    streamFlags
+,   clasp_stream_value_fn_t     pfn
+,   void*                       param
+,   clasp_stream_chunk_t_**     pchunks
+);
+
+/* Invokes pfn, if not NULL, for each value held in the chunks, returning
+ * the number of values
+ */
+size_t
+clasp_stream_chunks_for_each_(
+    clasp_stream_chunk_t_ const*    chunks
+,   clasp_stream_value_fn_t         pfn
+,   void*                           param
+);
+
+/* Appends the list more to the list chunks, returning the joined list */
+clasp_stream_chunk_t_*
+clasp_stream_chunks_join_(
+    clasp_stream_chunk_t_*  chunks
+,   clasp_stream_chunk_t_*  more
+);
+
+/* Frees all the chunks in the list, which may be empty */
+void
+clasp_stream_chunks_free_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_stream_chunk_t_*              chunks
+);
+#endif /* !CLASP_USE_WIDE_STRINGS */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * usage
+ */
+
+/* Renders the version information into the buffer.
+ *
+ * \pre (NULL != ctxt)
+ * \pre (NULL != info)
+ * \pre (NULL != buffer)
+ */
+void
+clasp_usage_render_version_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_usageinfo_t const*            info
+,   clasp_buffer_t_*                    buffer
+);
+
+/* Renders the header (summary, version, copyright, description, and
+ * usage) into the buffer.
+ *
+ * \pre (NULL != ctxt)
+ * \pre (NULL != info)
+ * \pre (NULL != info->usage)
+ * \pre (NULL != buffer)
+ */
+void
+clasp_usage_render_header_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_usageinfo_t const*            info
+,   clasp_buffer_t_*                    buffer
+);
+
+/* Renders the body (the flags and options) into the buffer.
+ *
+ * \pre (NULL != ctxt)
+ * \pre (NULL != info)
+ * \pre (NULL != buffer)
+ */
+void
+clasp_usage_render_body_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_usageinfo_t const*            info
+,   clasp_specification_t const         specifications[]
+,   clasp_buffer_t_*                    buffer
+);
+
+/* Renders header and body into the buffer, via the same field replacement
+ * logic as is applied for caller-supplied callbacks.
+ *
+ * \return The result of the buffer
+ *
+ * \pre (NULL != args)
+ * \pre (NULL != usageinfo)
+ * \pre (NULL != buffer)
+ */
+int
+clasp_usage_render_usage_(
+    clasp_arguments_t const*    args
+,   clasp_usageinfo_t const*    usageinfo
+,   clasp_specification_t const specifications[]
+,   clasp_buffer_t_*            buffer
+);
+
+/* Writes the contents of the buffer to the stream, in a single write.
+ *
+ * \retval 0 The contents were written
+ * \retval !0 The buffer is in a failed state, or the write failed
+ */
+int
+clasp_usage_write_buffer_to_FILE_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_buffer_t_ const*              buffer
+,   FILE*                               stm
+);
+
+
 /* /////////////////////////////////////////////////////////////////////////
  * argument-control
  */
@@ -181,6 +705,36 @@ clasp_useArgument_(
 ,   clasp_argument_t const*     arg
 );
 
+/* Looks up the name arg[0, cchArg) - of a flag or option, or up to any
+ * '=' of an option - via the given index, matching names and mapped
+ * arguments exactly, and counting each comparison in stats, if not NULL.
+ *
+ * \pre NULL != index
+ * \pre NULL != arg
+ */
+clasp_specification_t const*
+clasp_lookup_indexed_alias_len_(
+    clasp_parse_statistics_t*           stats
+,   clasp_specification_index_t const*  index
+,   clasp_char_t const*                 arg
+,   size_t                              cchArg
+,   unsigned                            flags
+);
+
+/* Parses argv[0] for the program name - without directory, and, on
+ * Windows, without extension - and returns its length.
+ *
+ * \pre 0 < argc
+ * \pre NULL != programName
+ */
+size_t
+clasp_identify_programName_(
+    unsigned                        flags
+,   int                             argc
+,   clasp_char_t*                   argv[]
+,   clasp_slice_t*                  programName
+);
+
 void
 clasp_count_flags_and_options_(
     clasp_specification_t const     specifications[]
@@ -188,6 +742,21 @@ clasp_count_flags_and_options_(
 ,   size_t*                         numOptions
 );
 
+/* Validates the specifications, as does clasp_parseArguments().
+ *
+ * \retval 0 The specifications are valid
+ * \retval EINVAL The specifications contain an invalid type or a duplicate
+ *   alias, which is logged
+ *
+ * \pre NULL != ctxt
+ */
+int
+clasp_validate_specifications_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_parse_statistics_t*           stats
+,   clasp_specification_t const         specifications[]
+);
+
 
 /* /////////////////////////////////////////////////////////////////////////
  * character encoding abstraction
@@ -204,6 +773,7 @@ clasp_count_flags_and_options_(
 # define clasp_strpbrk_                                     wcspbrk
 # define clasp_strrchr_                                     wcsrchr
 # define clasp_strstr_                                      wcsstr
+# define clasp_char_code_(ch)                               stlsoft_static_cast(unsigned long, (ch))
 # define CLASP_LITERAL_(x)                                  L ## x
 #else /* ? CLASP_USE_WIDE_STRINGS */
 
@@ -216,6 +786,7 @@ clasp_count_flags_and_options_(
 # define clasp_strpbrk_                                     strpbrk
 # define clasp_strrchr_                                     strrchr
 # define clasp_strstr_                                      strstr
+# define clasp_char_code_(ch)                               stlsoft_static_cast(unsigned long, stlsoft_static_cast(unsigned char, (ch)))
 # define CLASP_LITERAL_(x)                                  x
 #endif
 
@@ -227,21 +798,15 @@ clasp_count_flags_and_options_(
 /* Duplicates a string.
  *
  * \param ctxt The diagnostic context. May not be NULL;
+ * \param site The site of the allocation;
  * param s The string to be duplicated;
  */
 clasp_char_t* clasp_strdup_(
     clasp_diagnostic_context_t const*   ctxt
+,   clasp_alloc_site_t                  site
 ,   clasp_char_t const*                 s
 );
 
-/* Duplicates a string.
- *
- * param s The string to be duplicated;
- */
-clasp_char_t* clasp_strdup_raw_(
-    clasp_char_t const* s
-);
-
 /* This function controls whether the library recognises just an equals
  * sign ('='), or both an equals sign '=' and a colon (':') as separating
  * an option name and value.
@@ -347,5 +912,7 @@ clasp_strtok_wblank_r_(
 );
 
 
+#endif /* !CLASP_INCL_SRC_H_CLASP_INTERNAL */
+
 /* ///////////////////////////// end of file //////////////////////////// */
 
@@ -4,7 +4,7 @@
  * Purpose: CLASP memory facilities.
  *
  * Created: 4th June 2008
- * Updated: 12th July 2024
+ * Updated: 19th October 2026
  *
  * Home:    https://github.com/synesissoftware/CLASP/
  *
@@ -71,25 +71,48 @@ void CLASP_CALLCONV clasp_stock_free_(void* context, void* pv)
     free(pv);
 }
 
-void* clasp_malloc_(clasp_diagnostic_context_t const* ctxt, size_t cb)
+void* clasp_malloc_(clasp_diagnostic_context_t const* ctxt, clasp_alloc_site_t site, size_t cb)
 {
+    void* pv;
+
     CLASP_ASSERT(NULL != ctxt);
 
-    return ctxt->pfnMalloc(ctxt->context, cb);
+    pv = ctxt->pfnMalloc(ctxt->context, cb);
+
+    if (NULL != ctxt->pfnTrace)
+    {
+        ctxt->pfnTrace(ctxt->context, CLASP_ALLOC_OP_MALLOC, site, NULL, pv, cb);
+    }
+
+    return pv;
 }
-void* clasp_realloc_(clasp_diagnostic_context_t const* ctxt, void* pv, size_t cb)
+void* clasp_realloc_(clasp_diagnostic_context_t const* ctxt, clasp_alloc_site_t site, void* pv, size_t cb)
 {
+    void* pvNew;
+
     CLASP_ASSERT(NULL != ctxt);
 
-    return ctxt->pfnRealloc(ctxt->context, pv, cb);
+    pvNew = ctxt->pfnRealloc(ctxt->context, pv, cb);
+
+    if (NULL != ctxt->pfnTrace)
+    {
+        ctxt->pfnTrace(ctxt->context, CLASP_ALLOC_OP_REALLOC, site, pv, pvNew, cb);
+    }
+
+    return pvNew;
 }
-void clasp_free_(clasp_diagnostic_context_t const* ctxt, void* pv)
+void clasp_free_(clasp_diagnostic_context_t const* ctxt, clasp_alloc_site_t site, void* pv)
 {
     CLASP_ASSERT(NULL != ctxt);
 
+    if (NULL != ctxt->pfnTrace &&
+        NULL != pv)
+    {
+        ctxt->pfnTrace(ctxt->context, CLASP_ALLOC_OP_FREE, site, pv, NULL, 0);
+    }
+
     ctxt->pfnFree(ctxt->context, pv);
 }
 
-
 /* ///////////////////////////// end of file //////////////////////////// */
 
@@ -0,0 +1,854 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/clasp.schema.c
+ *
+ * Purpose: CLASP typed value schema: decoding of the values of
+ *          flags/options as part of the parse.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * Home:    https://github.com/synesissoftware/CLASP/
+ *
+ * Copyright (c) 2026, Matthew Wilson
+ * All rights reserved.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include "clasp.internal.h"
+
+#include <errno.h>
+#include <limits.h>
+#include <locale.h>
+#include <math.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+/* The longest real number - in characters - that will be decoded */
+#define CLASP_SCHEMA_MAX_REAL_CHARS_                        (63)
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+static
+int
+clasp_schema_is_trivial_(
+    clasp_value_schema_t const* entry
+)
+{
+    return CLASP_VALUEKIND_NONE == entry->kind && 0 == entry->schemaFlags;
+}
+
+static
+clasp_char_t
+clasp_schema_tolower_(
+    clasp_char_t    ch
+)
+{
+    return (ch >= 'A' && ch <= 'Z') ? stlsoft_static_cast(clasp_char_t, ch + ('a' - 'A')) : ch;
+}
+
+/* Indicates whether s[0, len) is equal, without regard to (ASCII) case, to
+ * the given (lowercase) literal
+ */
+static
+int
+clasp_schema_equal_nocase_(
+    clasp_char_t const* s
+,   size_t              len
+,   char const*         literal
+)
+{
+    size_t i;
+
+    for (i = 0; i != len; ++i)
+    {
+        if ('\0' == literal[i] ||
+            clasp_schema_tolower_(s[i]) != stlsoft_static_cast(clasp_char_t, literal[i]))
+        {
+            return 0;
+        }
+    }
+
+    return '\0' == literal[len];
+}
+
+static
+int
+clasp_schema_digit_(
+    clasp_char_t    ch
+,   unsigned        base
+)
+{
+    int v;
+
+    if (ch >= '0' && ch <= '9')
+    {
+        v = stlsoft_static_cast(int, ch - '0');
+    }
+    else if (ch >= 'a' && ch <= 'f')
+    {
+        v = 10 + stlsoft_static_cast(int, ch - 'a');
+    }
+    else if (ch >= 'A' && ch <= 'F')
+    {
+        v = 10 + stlsoft_static_cast(int, ch - 'A');
+    }
+    else
+    {
+        return -1;
+    }
+
+    return (v < stlsoft_static_cast(int, base)) ? v : -1;
+}
+
+/* Decodes the unsigned integer - decimal or, if allowHex, optionally
+ * hexadecimal - at the start of s[0, len), writing the number of
+ * characters consumed into *consumed.
+ *
+ * Returns 0, EINVAL if there are no digits, or ERANGE if the number does
+ * not fit.
+ */
+static
+int
+clasp_schema_parse_unsigned_(
+    clasp_char_t const* s
+,   size_t              len
+,   int                 allowHex
+,   unsigned long*      result
+,   size_t*             consumed
+)
+{
+    unsigned        base    =   10;
+    size_t          i       =   0;
+    size_t          first;
+    unsigned long   n       =   0;
+    int             r       =   0;
+
+    if (allowHex &&
+        len > 2 &&
+        '0' == s[0] &&
+        ('x' == s[1] || 'X' == s[1]))
+    {
+        base    =   16;
+        i       =   2;
+    }
+
+    for (first = i; i != len; ++i)
+    {
+        int const d = clasp_schema_digit_(s[i], base);
+
+        if (d < 0)
+        {
+            break;
+        }
+
+        if (n > (ULONG_MAX - stlsoft_static_cast(unsigned long, d)) / base)
+        {
+            r = ERANGE;
+        }
+        else
+        {
+            n = n * base + stlsoft_static_cast(unsigned long, d);
+        }
+    }
+
+    if (first == i)
+    {
+        return EINVAL;
+    }
+
+    *result     =   n;
+    *consumed   =   i;
+
+    return r;
+}
+
+/* Decodes the (non-negative, unless allowSign) decimal real number at the
+ * start of s[0, len), writing the number of characters consumed into
+ * *consumed.
+ *
+ * The number is validated, and then narrowed and passed to strtod(), with
+ * the decimal point translated to that of the current locale.
+ *
+ * Returns 0, EINVAL if it is not a number, or ERANGE if it overflows.
+ */
+static
+int
+clasp_schema_parse_real_(
+    clasp_char_t const* s
+,   size_t              len
+,   int                 allowSign
+,   double*             result
+,   size_t*             consumed
+)
+{
+    char    buff[1 + CLASP_SCHEMA_MAX_REAL_CHARS_ + 1];
+    char    decimalPoint;
+    size_t  i           =   0;
+    size_t  numDigits   =   0;
+    size_t  n;
+
+    if (allowSign &&
+        0 != len &&
+        ('+' == s[0] || '-' == s[0]))
+    {
+        ++i;
+    }
+
+    for (; i != len && s[i] >= '0' && s[i] <= '9'; ++i, ++numDigits)
+    {}
+
+    if (i != len &&
+        '.' == s[i])
+    {
+        for (++i; i != len && s[i] >= '0' && s[i] <= '9'; ++i, ++numDigits)
+        {}
+    }
+
+    if (0 == numDigits)
+    {
+        return EINVAL;
+    }
+
+    if (i + 1 < len &&
+        ('e' == s[i] || 'E' == s[i]))
+    {
+        size_t j = i + 1;
+
+        if ('+' == s[j] || '-' == s[j])
+        {
+            ++j;
+        }
+
+        if (j != len &&
+            s[j] >= '0' && s[j] <= '9')
+        {
+            for (i = j; i != len && s[i] >= '0' && s[i] <= '9'; ++i)
+            {}
+        }
+    }
+
+    if (i > CLASP_SCHEMA_MAX_REAL_CHARS_)
+    {
+        return ERANGE;
+    }
+
+    decimalPoint = localeconv()->decimal_point[0];
+
+    for (n = 0; n != i; ++n)
+    {
+        buff[n] = ('.' == s[n]) ? decimalPoint : stlsoft_static_cast(char, s[n]);
+    }
+    buff[i] = '\0';
+
+    {
+        int const   savedErrno  =   errno;
+        double      d;
+
+        errno = 0;
+
+        d = strtod(buff, NULL);
+
+        if (ERANGE == errno &&
+            (HUGE_VAL == d || -HUGE_VAL == d))
+        {
+            errno = savedErrno;
+
+            return ERANGE;
+        }
+
+        errno = savedErrno;
+
+        *result     =   d;
+        *consumed   =   i;
+    }
+
+    return 0;
+}
+
+static
+int
+clasp_schema_decode_int_(
+    clasp_slice_t const*    value
+,   clasp_typed_value_t*    tv
+)
+{
+    int             isNeg   =   0;
+    size_t          i       =   0;
+    size_t          consumed;
+    unsigned long   magnitude;
+
+    if ('+' == value->ptr[0] ||
+        '-' == value->ptr[0])
+    {
+        isNeg   =   '-' == value->ptr[0];
+        i       =   1;
+    }
+
+    if (0 != clasp_schema_parse_unsigned_(value->ptr + i, value->len - i, 1, &magnitude, &consumed) ||
+        i + consumed != value->len)
+    {
+        return CLASP_ARGERR_INVALID_OPTION_VALUE;
+    }
+
+    if (isNeg)
+    {
+        if (magnitude > stlsoft_static_cast(unsigned long, LONG_MAX) + 1u)
+        {
+            return CLASP_ARGERR_INVALID_OPTION_VALUE;
+        }
+
+        tv->value.integer = (0 == magnitude) ? 0 : -stlsoft_static_cast(long, magnitude - 1u) - 1;
+    }
+    else
+    {
+        if (magnitude > stlsoft_static_cast(unsigned long, LONG_MAX))
+        {
+            return CLASP_ARGERR_INVALID_OPTION_VALUE;
+        }
+
+        tv->value.integer = stlsoft_static_cast(long, magnitude);
+    }
+
+    return 0;
+}
+
+static
+int
+clasp_schema_decode_uint_(
+    clasp_slice_t const*    value
+,   clasp_typed_value_t*    tv
+)
+{
+    size_t const    i   =   ('+' == value->ptr[0]) ? 1u : 0u;
+    size_t          consumed;
+
+    if (0 != clasp_schema_parse_unsigned_(value->ptr + i, value->len - i, 1, &tv->value.uinteger, &consumed) ||
+        i + consumed != value->len)
+    {
+        return CLASP_ARGERR_INVALID_OPTION_VALUE;
+    }
+
+    return 0;
+}
+
+static
+int
+clasp_schema_decode_double_(
+    clasp_slice_t const*    value
+,   clasp_typed_value_t*    tv
+)
+{
+    size_t consumed;
+
+    if (0 != clasp_schema_parse_real_(value->ptr, value->len, 1, &tv->value.real, &consumed) ||
+        consumed != value->len)
+    {
+        return CLASP_ARGERR_INVALID_OPTION_VALUE;
+    }
+
+    return 0;
+}
+
+static
+int
+clasp_schema_decode_bool_(
+    clasp_slice_t const*    value
+,   clasp_typed_value_t*    tv
+)
+{
+    static char const* const    s_true[]    =   { "true", "yes", "on", "1" };
+    static char const* const    s_false[]   =   { "false", "no", "off", "0" };
+    size_t                      i;
+
+    for (i = 0; i != CLASP_NUM_ELEMENTS_(s_true); ++i)
+    {
+        if (clasp_schema_equal_nocase_(value->ptr, value->len, s_true[i]))
+        {
+            tv->value.boolean = 1;
+
+            return 0;
+        }
+        if (clasp_schema_equal_nocase_(value->ptr, value->len, s_false[i]))
+        {
+            tv->value.boolean = 0;
+
+            return 0;
+        }
+    }
+
+    return CLASP_ARGERR_INVALID_OPTION_VALUE;
+}
+
+static
+int
+clasp_schema_decode_size_(
+    clasp_slice_t const*    value
+,   clasp_typed_value_t*    tv
+)
+{
+    size_t          consumed;
+    unsigned long   n;
+    unsigned        shift   =   0;
+    size_t          i;
+
+    if (0 != clasp_schema_parse_unsigned_(value->ptr, value->len, 0, &n, &consumed))
+    {
+        return CLASP_ARGERR_INVALID_OPTION_VALUE;
+    }
+
+    i = consumed;
+
+    if (i != value->len)
+    {
+        switch (clasp_schema_tolower_(value->ptr[i]))
+        {
+        case 'k':
+            shift = 10;
+            break;
+        case 'm':
+            shift = 20;
+            break;
+        case 'g':
+            shift = 30;
+            break;
+        case 't':
+            shift = 40;
+            break;
+        case 'b':
+            break;
+        default:
+            return CLASP_ARGERR_INVALID_OPTION_VALUE;
+        }
+
+        if (0 != shift)
+        {
+            ++i;
+
+            if (i != value->len &&
+                'i' == value->ptr[i])
+            {
+                if (i + 1 == value->len)
+                {
+                    return CLASP_ARGERR_INVALID_OPTION_VALUE;
+                }
+
+                ++i;
+            }
+        }
+
+        if (i != value->len)
+        {
+            if ('B' != value->ptr[i] &&
+                'b' != value->ptr[i])
+            {
+                return CLASP_ARGERR_INVALID_OPTION_VALUE;
+            }
+
+            ++i;
+        }
+
+        if (i != value->len)
+        {
+            return CLASP_ARGERR_INVALID_OPTION_VALUE;
+        }
+    }
+
+    if (shift >= sizeof(unsigned long) * CHAR_BIT ||
+        n > (ULONG_MAX >> shift))
+    {
+        return CLASP_ARGERR_INVALID_OPTION_VALUE;
+    }
+
+    tv->value.uinteger = n << shift;
+
+    return 0;
+}
+
+static
+int
+clasp_schema_decode_duration_(
+    clasp_slice_t const*    value
+,   clasp_typed_value_t*    tv
+)
+{
+    clasp_char_t const* unit;
+    size_t              unitLen;
+    size_t              consumed;
+    double              d;
+
+    if (0 != clasp_schema_parse_real_(value->ptr, value->len, 0, &d, &consumed))
+    {
+        return CLASP_ARGERR_INVALID_OPTION_VALUE;
+    }
+
+    unit    =   value->ptr + consumed;
+    unitLen =   value->len - consumed;
+
+    if (0 == unitLen ||
+        clasp_schema_equal_nocase_(unit, unitLen, "s"))
+    {
+        ;
+    }
+    else if (clasp_schema_equal_nocase_(unit, unitLen, "ms"))
+    {
+        d /= 1000.0;
+    }
+    else if (clasp_schema_equal_nocase_(unit, unitLen, "m"))
+    {
+        d *= 60.0;
+    }
+    else if (clasp_schema_equal_nocase_(unit, unitLen, "h"))
+    {
+        d *= 60.0 * 60.0;
+    }
+    else if (clasp_schema_equal_nocase_(unit, unitLen, "d"))
+    {
+        d *= 24.0 * 60.0 * 60.0;
+    }
+    else
+    {
+        return CLASP_ARGERR_INVALID_OPTION_VALUE;
+    }
+
+    tv->value.real = d;
+
+    return 0;
+}
+
+static
+int
+clasp_schema_decode_enum_(
+    clasp_slice_t const*            value
+,   clasp_specification_t const*    spec
+,   clasp_typed_value_t*            tv
+)
+{
+    clasp_char_t const* const   valueSet    =   spec->valueSet;
+    clasp_char_t const          sep         =   valueSet[0];
+    clasp_char_t const*         b           =   valueSet + 1;
+    int                         index       =   0;
+
+    for (;; ++index)
+    {
+        clasp_char_t const* e = b;
+
+        for (; '\0' != *e && sep != *e; ++e)
+        {}
+
+        if ('\0' == *e &&
+            b == e)
+        {
+            /* a trailing separator permits any other value */
+
+            if (b != valueSet + 1 &&
+                sep == b[-1])
+            {
+                tv->value.index = -1;
+
+                return 0;
+            }
+
+            break;
+        }
+
+        if (stlsoft_static_cast(size_t, e - b) == value->len &&
+            0 == clasp_strncmp_(b, value->ptr, value->len))
+        {
+            tv->value.index = index;
+
+            return 0;
+        }
+
+        if ('\0' == *e)
+        {
+            break;
+        }
+
+        b = e + 1;
+    }
+
+    return CLASP_ARGERR_INVALID_OPTION_VALUE;
+}
+
+/* Decodes the value of the argument into tv, returning 0, or the
+ * clasp_argerr_t that describes why it is not valid
+ */
+static
+int
+clasp_schema_decode_value_(
+    clasp_argument_t const*         arg
+,   clasp_specification_t const*    spec
+,   clasp_value_schema_t const*     entry
+,   clasp_typed_value_t*            tv
+)
+{
+    double  d;
+    int     r;
+
+    if (CLASP_VALUEKIND_NONE == entry->kind)
+    {
+        return 0;
+    }
+
+    if (0 == arg->value.len)
+    {
+        return CLASP_ARGERR_MISSING_OPTION_VALUE;
+    }
+
+    switch (entry->kind)
+    {
+    case CLASP_VALUEKIND_INT:
+        r = clasp_schema_decode_int_(&arg->value, tv);
+        d = (0 == r) ? stlsoft_static_cast(double, tv->value.integer) : 0.0;
+        break;
+    case CLASP_VALUEKIND_UINT:
+        r = clasp_schema_decode_uint_(&arg->value, tv);
+        d = (0 == r) ? stlsoft_static_cast(double, tv->value.uinteger) : 0.0;
+        break;
+    case CLASP_VALUEKIND_DOUBLE:
+        r = clasp_schema_decode_double_(&arg->value, tv);
+        d = tv->value.real;
+        break;
+    case CLASP_VALUEKIND_BOOL:
+        return clasp_schema_decode_bool_(&arg->value, tv);
+    case CLASP_VALUEKIND_SIZE:
+        r = clasp_schema_decode_size_(&arg->value, tv);
+        d = (0 == r) ? stlsoft_static_cast(double, tv->value.uinteger) : 0.0;
+        break;
+    case CLASP_VALUEKIND_DURATION:
+        r = clasp_schema_decode_duration_(&arg->value, tv);
+        d = tv->value.real;
+        break;
+    case CLASP_VALUEKIND_ENUM:
+        return clasp_schema_decode_enum_(&arg->value, spec, tv);
+    default:
+        CLASP_ASSERT(0);
+        return CLASP_ARGERR_INVALID_OPTION_VALUE;
+    }
+
+    if (0 == r &&
+        0 != (CLASP_SCHEMA_F_BOUNDED & entry->schemaFlags) &&
+        (   d < entry->minimum ||
+            d > entry->maximum))
+    {
+        r = CLASP_ARGERR_INVALID_OPTION_VALUE;
+    }
+
+    return r;
+}
+
+/* Obtains the index of the specification against whose schema the
+ * argument is to be decoded, or -1 if it is not to be decoded
+ */
+static
+int
+clasp_schema_resolve_(
+    clasp_specification_t const     specifications[]
+,   clasp_value_schema_t const      schema[]
+,   clasp_argument_t const*         arg
+)
+{
+    int const                       specIndex   =   arg->aliasIndex;
+    clasp_specification_t const*    spec;
+
+    if (specIndex < 0 ||
+        CLASP_ARGTYPE_VALUE == arg->type)
+    {
+        return -1;
+    }
+
+    if (!clasp_schema_is_trivial_(&schema[specIndex]))
+    {
+        return specIndex;
+    }
+
+    /* an alias defers to the schema of the specification that it names */
+
+    for (spec = specifications; CLASP_ARGTYPE_INVALID != spec->type; ++spec)
+    {
+        int const j = stlsoft_static_cast(int, spec - specifications);
+
+        if (j != specIndex &&
+            spec->type == specifications[specIndex].type &&
+            !clasp_schema_is_trivial_(&schema[j]) &&
+            NULL != spec->mappedArgument &&
+            0 == clasp_strncmp_(spec->mappedArgument, arg->resolvedName.ptr, arg->resolvedName.len))
+        {
+            clasp_char_t const ch = spec->mappedArgument[arg->resolvedName.len];
+
+            if ('\0' == ch ||
+                '=' == ch ||
+                ':' == ch)
+            {
+                return j;
+            }
+        }
+    }
+
+    return -1;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * internal API functions
+ */
+
+int
+clasp_schema_validate_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_specification_t const         specifications[]
+,   clasp_value_schema_t const          schema[]
+)
+{
+    clasp_specification_t const* spec;
+
+    CLASP_ASSERT(NULL != ctxt);
+    CLASP_ASSERT(NULL != schema);
+
+    if (NULL == specifications)
+    {
+        return 0;
+    }
+
+    for (spec = specifications; CLASP_ARGTYPE_INVALID != spec->type; ++spec)
+    {
+        clasp_value_schema_t const* const entry = &schema[spec - specifications];
+
+        if (stlsoft_static_cast(unsigned, entry->kind) > stlsoft_static_cast(unsigned, CLASP_VALUEKIND_ENUM))
+        {
+            CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_EMERG, CLASP_LITERAL_("unknown value kind (%d) specified in schema array"), stlsoft_static_cast(int, entry->kind));
+
+            return EINVAL;
+        }
+
+        if (CLASP_VALUEKIND_NONE != entry->kind &&
+            CLASP_ARGTYPE_OPTION != spec->type)
+        {
+            CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_EMERG, CLASP_LITERAL_("value kind specified in schema array for a specification that is not an option: %s"), (NULL != spec->mappedArgument) ? spec->mappedArgument : CLASP_LITERAL_(""));
+
+            return EINVAL;
+        }
+
+        if (CLASP_VALUEKIND_ENUM == entry->kind &&
+            (   NULL == spec->valueSet ||
+                '\0' == spec->valueSet[0]))
+        {
+            CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_EMERG, CLASP_LITERAL_("enumeration specified in schema array for an option without a value set: %s"), (NULL != spec->mappedArgument) ? spec->mappedArgument : CLASP_LITERAL_(""));
+
+            return EINVAL;
+        }
+
+        if (0 != (CLASP_SCHEMA_F_BOUNDED & entry->schemaFlags) &&
+            !(entry->minimum <= entry->maximum))
+        {
+            CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_EMERG, CLASP_LITERAL_("minimum greater than maximum specified in schema array: %s"), (NULL != spec->mappedArgument) ? spec->mappedArgument : CLASP_LITERAL_(""));
+
+            return EINVAL;
+        }
+    }
+
+    return 0;
+}
+
+size_t
+clasp_schema_decode_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_specification_t const         specifications[]
+,   clasp_value_schema_t const          schema[]
+,   clasp_argument_t*                   arguments
+,   size_t                              numArgs
+,   clasp_typed_value_t*                typedValues
+,   unsigned char*                      seen
+)
+{
+    size_t  n = 0;
+    size_t  i;
+
+    CLASP_ASSERT(NULL != ctxt);
+    CLASP_ASSERT(NULL != specifications);
+    CLASP_ASSERT(NULL != schema);
+    CLASP_ASSERT(NULL != typedValues || 0 == numArgs);
+    CLASP_ASSERT(NULL != seen);
+
+    memset(seen, 0, (clasp_countSpecifications(specifications) + 7) / 8);
+
+    for (i = 0; i != numArgs; ++i)
+    {
+        clasp_argument_t* const     arg         =   &arguments[i];
+        int const                   specIndex   =   clasp_schema_resolve_(specifications, schema, arg);
+        clasp_value_schema_t const* entry;
+        clasp_typed_value_t*        tv;
+
+        if (specIndex < 0)
+        {
+            continue;
+        }
+
+        if (CLASP_ARG_TYPED_MAX_ == n)
+        {
+            CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_WARN, CLASP_LITERAL_("too many option values to decode: those from '%.*s' onwards are not decoded"), (int)arg->givenName.len, arg->givenName.ptr);
+
+            break;
+        }
+
+        entry           =   &schema[specIndex];
+        tv              =   &typedValues[n];
+
+        tv->kind        =   entry->kind;
+        tv->specIndex   =   specIndex;
+        tv->value.real  =   0.0;
+        tv->error       =   clasp_schema_decode_value_(arg, &specifications[specIndex], entry, tv);
+
+        if (0 != (CLASP_SCHEMA_F_SINGLE & entry->schemaFlags))
+        {
+            unsigned char const bit = stlsoft_static_cast(unsigned char, 1u << (specIndex % 8));
+
+            if (0 != (seen[specIndex / 8] & bit))
+            {
+                tv->error = CLASP_ARGERR_REPEATED_ARGUMENT;
+            }
+
+            seen[specIndex / 8] |= bit;
+        }
+
+        /* the error is reported to the caller in the typed value, so is
+         * only noted here
+         */
+        switch (tv->error)
+        {
+        case 0:
+            break;
+        case CLASP_ARGERR_MISSING_OPTION_VALUE:
+            CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_DEBUG, CLASP_LITERAL_("no value given for option '%.*s'"), (int)arg->givenName.len, arg->givenName.ptr);
+            break;
+        case CLASP_ARGERR_REPEATED_ARGUMENT:
+            CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_DEBUG, CLASP_LITERAL_("'%.*s' may be specified only once"), (int)arg->givenName.len, arg->givenName.ptr);
+            break;
+        default:
+            CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_DEBUG, CLASP_LITERAL_("invalid value '%.*s' for option '%.*s'"), (int)arg->value.len, arg->value.ptr, (int)arg->givenName.len, arg->givenName.ptr);
+            break;
+        }
+
+        ++n;
+
+        arg->flags |= stlsoft_static_cast(int, n << CLASP_ARG_TYPED_SHIFT_);
+    }
+
+    return n;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
@@ -0,0 +1,120 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/clasp.statistics.c
+ *
+ * Purpose: CLASP parse statistics facilities.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * Home:    https://github.com/synesissoftware/CLASP/
+ *
+ * Copyright (c) 2026, Matthew Wilson
+ * All rights reserved.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * feature control
+ */
+
+#if !defined(_POSIX_C_SOURCE) && \
+    (   defined(unix) || \
+        defined(UNIX) || \
+        defined(__unix) || \
+        defined(__unix__))
+
+# define _POSIX_C_SOURCE                                    200809L
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include "clasp.internal.h"
+
+#include <time.h>
+
+#if defined(CLASP_PLATFORM_IS_WINDOWS)
+
+# include <windows.h>
+#elif defined(CLASP_PLATFORM_IS_UNIX)
+
+# include <unistd.h>
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+double
+clasp_statistics_now_ns_(void)
+{
+#if defined(CLASP_PLATFORM_IS_WINDOWS)
+
+    LARGE_INTEGER   frequency;
+    LARGE_INTEGER   count;
+
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&count);
+
+    return (double)count.QuadPart * 1.0e9 / (double)frequency.QuadPart;
+#elif defined(CLASP_PLATFORM_IS_UNIX) && \
+      defined(_POSIX_TIMERS) && \
+      _POSIX_TIMERS > 0 && \
+      defined(CLOCK_MONOTONIC)
+
+    struct timespec ts;
+
+    if (0 == clock_gettime(CLOCK_MONOTONIC, &ts))
+    {
+        return (double)ts.tv_sec * 1.0e9 + (double)ts.tv_nsec;
+    }
+
+    return (double)clock() * 1.0e9 / CLOCKS_PER_SEC;
+#else
+
+    return (double)clock() * 1.0e9 / CLOCKS_PER_SEC;
+#endif
+}
+
+void*
+clasp_statistics_malloc_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_parse_statistics_t*           stats
+,   clasp_alloc_site_t                  site
+,   size_t                              cb
+)
+{
+    if (NULL != stats)
+    {
+        ++stats->numAllocations;
+        stats->numBytesAllocated += cb;
+    }
+
+    return clasp_malloc_(ctxt, site, cb);
+}
+
+void*
+clasp_statistics_realloc_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_parse_statistics_t*           stats
+,   clasp_alloc_site_t                  site
+,   void*                               pv
+,   size_t                              cb
+)
+{
+    if (NULL != stats)
+    {
+        ++stats->numAllocations;
+        stats->numBytesAllocated += cb;
+    }
+
+    return clasp_realloc_(ctxt, site, pv, cb);
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
@@ -0,0 +1,564 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/clasp.stream.c
+ *
+ * Purpose: CLASP values-from-stream facilities.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * Home:    https://github.com/synesissoftware/CLASP/
+ *
+ * Copyright (c) 2026, Matthew Wilson
+ * All rights reserved.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include "clasp.internal.h"
+
+#ifndef CLASP_USE_WIDE_STRINGS
+
+#include <errno.h>
+#include <stddef.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+/* The number of characters read into each chunk (and by each read) */
+#define CLASP_STREAM_CHUNK_SIZE_                            (0x10000)
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+struct clasp_stream_chunk_t_
+{
+    clasp_stream_chunk_t_*  next;
+    size_t                  capacity;   /* the number of characters in data */
+    size_t                  size;       /* the number of characters of data that hold (complete) values */
+    char                    data[1];
+};
+
+/* The state of the reading of the stream(s) of an option.
+ *
+ * When retaining, each stream is read into a list of chunks, in which the
+ * values are terminated in place - the delimiters being overwritten - and
+ * only a value that straddles the end of a chunk is moved, to the start of
+ * the next. Otherwise, the values are delivered to pfn as they are
+ * terminated, and a single chunk is reused, growing only to hold a value
+ * longer than it.
+ */
+typedef struct clasp_stream_reader_t_ clasp_stream_reader_t_;
+
+struct clasp_stream_reader_t_
+{
+    clasp_diagnostic_context_t const*   ctxt;
+    char                                delimiter;
+    clasp_stream_value_fn_t             pfn;
+    void*                               param;
+    int                                 retain;
+    clasp_stream_chunk_t_*              head;
+    clasp_stream_chunk_t_*              tail;
+    size_t                              numValues;
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+static
+clasp_stream_chunk_t_*
+clasp_stream_chunk_alloc_(
+    clasp_diagnostic_context_t const*   ctxt
+,   size_t                              capacity
+)
+{
+    clasp_stream_chunk_t_* const chunk = stlsoft_static_cast(clasp_stream_chunk_t_*, clasp_malloc_(ctxt, CLASP_ALLOC_SITE_STREAM_CHUNK, offsetof(clasp_stream_chunk_t_, data) + capacity));
+
+    if (NULL != chunk)
+    {
+        chunk->next     =   NULL;
+        chunk->capacity =   capacity;
+        chunk->size     =   0;
+    }
+
+    return chunk;
+}
+
+/* Delivers - when not retaining - or counts the value s[0, len), which has
+ * been terminated in place, unless it is empty
+ */
+static
+int
+clasp_stream_emit_(
+    clasp_stream_reader_t_* reader
+,   char*                   s
+,   size_t                  len
+)
+{
+    /* a newline-delimited value may come from a file with CRLF endings */
+    if ('\n' == reader->delimiter &&
+        0 != len &&
+        '\r' == s[len - 1])
+    {
+        s[--len] = '\0';
+    }
+
+    if (0 == len)
+    {
+        return 0;
+    }
+
+    if (reader->retain)
+    {
+        ++reader->numValues;
+
+        return 0;
+    }
+    else
+    {
+        return reader->pfn(reader->param, s, len, reader->numValues++);
+    }
+}
+
+/* Reads the whole of the stream, in chunks, terminating and emitting each
+ * value in place
+ */
+static
+int
+clasp_stream_read_FILE_(
+    clasp_stream_reader_t_* reader
+,   FILE*                   stm
+)
+{
+    clasp_stream_chunk_t_*  chunk   =   clasp_stream_chunk_alloc_(reader->ctxt, CLASP_STREAM_CHUNK_SIZE_);
+    clasp_stream_chunk_t_*  prev    =   reader->tail;
+    size_t                  start   =   0;  /* the start of the (incomplete) current value */
+    size_t                  end     =   0;  /* the end of the characters read */
+    int                     r       =   0;
+
+    if (NULL == chunk)
+    {
+        return ENOMEM;
+    }
+
+    if (reader->retain)
+    {
+        if (NULL == reader->tail)
+        {
+            reader->head = chunk;
+        }
+        else
+        {
+            reader->tail->next = chunk;
+        }
+        reader->tail = chunk;
+    }
+
+    for (;;)
+    {
+        size_t  n;
+        char*   p;
+        char*   last;
+
+        /* 1. make room, keeping one character for the terminator of a
+         * final value that has no delimiter
+         */
+
+        if (end + 1 == chunk->capacity)
+        {
+            size_t const partial = end - start;
+
+            if (reader->retain)
+            {
+                size_t const                    capacity    =   (2 * (partial + 1) > CLASP_STREAM_CHUNK_SIZE_) ? 2 * (partial + 1) : CLASP_STREAM_CHUNK_SIZE_;
+                clasp_stream_chunk_t_* const    next        =   clasp_stream_chunk_alloc_(reader->ctxt, capacity);
+
+                if (NULL == next)
+                {
+                    r = ENOMEM;
+
+                    break;
+                }
+
+                memcpy(next->data, chunk->data + start, partial);
+
+                chunk->size     =   start;
+                chunk->next     =   next;
+                prev            =   chunk;
+                chunk           =   next;
+                reader->tail    =   next;
+            }
+            else if (0 != start)
+            {
+                memmove(chunk->data, chunk->data + start, partial);
+            }
+            else
+            {
+                clasp_stream_chunk_t_* const larger = stlsoft_static_cast(clasp_stream_chunk_t_*, clasp_realloc_(reader->ctxt, CLASP_ALLOC_SITE_STREAM_CHUNK, chunk, offsetof(clasp_stream_chunk_t_, data) + 2 * chunk->capacity));
+
+                if (NULL == larger)
+                {
+                    r = ENOMEM;
+
+                    break;
+                }
+
+                chunk           =   larger;
+                chunk->capacity *=  2;
+            }
+
+            start   =   0;
+            end     =   partial;
+        }
+
+        /* 2. read, and terminate each value in place */
+
+        n = fread(chunk->data + end, 1, chunk->capacity - 1 - end, stm);
+
+        if (0 == n)
+        {
+            if (ferror(stm))
+            {
+                r = EIO;
+            }
+            else if (end != start)
+            {
+                chunk->data[end] = '\0';
+
+                r = clasp_stream_emit_(reader, chunk->data + start, end - start);
+
+                start = end + 1;
+            }
+
+            break;
+        }
+
+        p       =   chunk->data + end;
+        last    =   p + n;
+        end     +=  n;
+
+        for (; p != last; )
+        {
+            char* const delim = stlsoft_static_cast(char*, memchr(p, reader->delimiter, stlsoft_static_cast(size_t, last - p)));
+
+            if (NULL == delim)
+            {
+                break;
+            }
+
+            *delim = '\0';
+
+            r = clasp_stream_emit_(reader, chunk->data + start, stlsoft_static_cast(size_t, delim - (chunk->data + start)));
+
+            if (0 != r)
+            {
+                break;
+            }
+
+            p       =   delim + 1;
+            start   =   stlsoft_static_cast(size_t, p - chunk->data);
+        }
+
+        if (0 != r)
+        {
+            break;
+        }
+    }
+
+    if (reader->retain)
+    {
+        /* the last chunk is trimmed to its values - which have not yet been
+         * sliced, and so may move - or, if it has none, discarded
+         */
+
+        chunk->size = start;
+
+        if (0 == chunk->size)
+        {
+            if (NULL == prev)
+            {
+                reader->head = NULL;
+            }
+            else
+            {
+                prev->next = NULL;
+            }
+            reader->tail = prev;
+
+            clasp_free_(reader->ctxt, CLASP_ALLOC_SITE_STREAM_CHUNK, chunk);
+        }
+        else if (chunk->size != chunk->capacity)
+        {
+            clasp_stream_chunk_t_* const trimmed = stlsoft_static_cast(clasp_stream_chunk_t_*, clasp_realloc_(reader->ctxt, CLASP_ALLOC_SITE_STREAM_CHUNK, chunk, offsetof(clasp_stream_chunk_t_, data) + chunk->size));
+
+            if (NULL != trimmed)
+            {
+                trimmed->capacity = trimmed->size;
+
+                if (NULL == prev)
+                {
+                    reader->head = trimmed;
+                }
+                else
+                {
+                    prev->next = trimmed;
+                }
+                reader->tail = trimmed;
+            }
+        }
+    }
+    else
+    {
+        clasp_free_(reader->ctxt, CLASP_ALLOC_SITE_STREAM_CHUNK, chunk);
+    }
+
+    return r;
+}
+
+/* Reads the stream named by the value of the option - the standard input
+ * for "-", or otherwise the file of that path
+ */
+static
+int
+clasp_stream_read_value_(
+    clasp_stream_reader_t_*     reader
+,   clasp_argument_t const*     arg
+)
+{
+    clasp_char_t const* const   value   =   arg->value.ptr;
+    size_t const                len     =   arg->value.len;
+    clasp_char_t*               path;
+    FILE*                       stm;
+    int                         r;
+
+    if (0 == len)
+    {
+        CLASP_LOG_PRINTF(reader->ctxt, CLASP_SEVIX_ERROR, CLASP_LITERAL_("no stream given for option '%.*s'"), (int)arg->givenName.len, arg->givenName.ptr);
+
+        return EINVAL;
+    }
+
+    if (1 == len &&
+        '-' == value[0])
+    {
+        return clasp_stream_read_FILE_(reader, stdin);
+    }
+
+    path = stlsoft_static_cast(clasp_char_t*, clasp_malloc_(reader->ctxt, CLASP_ALLOC_SITE_STREAM_CHUNK, (1 + len) * sizeof(clasp_char_t)));
+
+    if (NULL == path)
+    {
+        return ENOMEM;
+    }
+
+    memcpy(path, value, len * sizeof(clasp_char_t));
+    path[len] = '\0';
+
+    errno = 0;
+
+    stm = fopen(path, "rb");
+
+    if (NULL == stm)
+    {
+        r = (0 != errno) ? errno : ENOENT;
+
+        CLASP_LOG_PRINTF(reader->ctxt, CLASP_SEVIX_ERROR, CLASP_LITERAL_("could not open '%s' for option '%.*s'"), path, (int)arg->givenName.len, arg->givenName.ptr);
+    }
+    else
+    {
+        r = clasp_stream_read_FILE_(reader, stm);
+
+        fclose(stm);
+    }
+
+    clasp_free_(reader->ctxt, CLASP_ALLOC_SITE_STREAM_CHUNK, path);
+
+    return r;
+}
+
+static
+int
+CLASP_CALLCONV
+clasp_stream_count_value_(
+    void*               param
+,   clasp_char_t const* value
+,   size_t              cchValue
+,   size_t              index
+)
+{
+    ((void)param);
+    ((void)value);
+    ((void)cchValue);
+    ((void)index);
+
+    return 0;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * internal functions
+ */
+
+int
+clasp_stream_read_option_(
+    clasp_arguments_t const*    args
+,   clasp_char_t const*         optionName
+,   unsigned                    streamFlags
+,   clasp_stream_value_fn_t     pfn
+,   void*                       param
+,   clasp_stream_chunk_t_**     pchunks
+)
+{
+    clasp_stream_reader_t_  reader;
+    size_t const            cchName =   clasp_strlen_(optionName);
+    int                     r       =   0;
+
+    CLASP_ASSERT(NULL != args);
+    CLASP_ASSERT(NULL != optionName);
+    CLASP_ASSERT(NULL != pfn || NULL != pchunks);
+
+    reader.ctxt         =   clasp_diagnostic_context_from_args_(args);
+    reader.delimiter    =   (0 != (CLASP_STREAM_F_NUL_DELIMITED & streamFlags)) ? '\0' : '\n';
+    reader.pfn          =   pfn;
+    reader.param        =   param;
+    reader.retain       =   (NULL != pchunks);
+    reader.head         =   NULL;
+    reader.tail         =   NULL;
+    reader.numValues    =   0;
+
+    /* each instance of the option is read, in command-line order */
+
+    { size_t i; for (i = 0; 0 == r && i != args->numArguments; ++i)
+    {
+        clasp_argument_t const* const arg = &args->arguments[i];
+
+        if (CLASP_ARGTYPE_OPTION == arg->type &&
+            cchName == arg->resolvedName.len &&
+            0 == clasp_strncmp_(optionName, arg->resolvedName.ptr, cchName))
+        {
+            if (!clasp_argumentIsUsed(args, arg))
+            {
+                clasp_useArgument(args, arg);
+            }
+
+            r = clasp_stream_read_value_(&reader, arg);
+        }
+    }}
+
+    if (NULL != pchunks)
+    {
+        *pchunks = reader.head;
+    }
+
+    return r;
+}
+
+size_t
+clasp_stream_chunks_for_each_(
+    clasp_stream_chunk_t_ const*    chunks
+,   clasp_stream_value_fn_t         pfn
+,   void*                           param
+)
+{
+    size_t n = 0;
+
+    if (NULL == pfn)
+    {
+        pfn = clasp_stream_count_value_;
+    }
+
+    for (; NULL != chunks; chunks = chunks->next)
+    {
+        char const*         p   =   chunks->data;
+        char const* const   end =   chunks->data + chunks->size;
+
+        for (; p != end; )
+        {
+            size_t const len = strlen(p);
+
+            if (0 != len)
+            {
+                pfn(param, p, len, n++);
+            }
+
+            p += len + 1;
+        }
+    }
+
+    return n;
+}
+
+clasp_stream_chunk_t_*
+clasp_stream_chunks_join_(
+    clasp_stream_chunk_t_*  chunks
+,   clasp_stream_chunk_t_*  more
+)
+{
+    clasp_stream_chunk_t_* last;
+
+    if (NULL == chunks)
+    {
+        return more;
+    }
+
+    for (last = chunks; NULL != last->next; last = last->next)
+    {}
+
+    last->next = more;
+
+    return chunks;
+}
+
+void
+clasp_stream_chunks_free_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_stream_chunk_t_*              chunks
+)
+{
+    while (NULL != chunks)
+    {
+        clasp_stream_chunk_t_* const next = chunks->next;
+
+        clasp_free_(ctxt, CLASP_ALLOC_SITE_STREAM_CHUNK, chunks);
+
+        chunks = next;
+    }
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+CLASP_CALL(int)
+clasp_forEachStreamedValue(
+    clasp_arguments_t const*    args
+,   clasp_char_t const*         optionName
+,   unsigned                    streamFlags
+,   clasp_stream_value_fn_t     pfn
+,   void*                       param
+)
+{
+    CLASP_ASSERT(NULL != args);
+    CLASP_ASSERT(NULL != optionName);
+    CLASP_ASSERT(NULL != pfn);
+
+    CLASP_LOG_PRINTF(clasp_diagnostic_context_from_args_(args), CLASP_SEVIX_DEBUG, CLASP_LITERAL_("clasp_forEachStreamedValue(): optionName=%s"), optionName);
+
+    return clasp_stream_read_option_(args, optionName, streamFlags, pfn, param, NULL);
+}
+
+#endif /* !CLASP_USE_WIDE_STRINGS */
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
@@ -4,7 +4,7 @@
  * Purpose: CLASP string facilities.
  *
  * Created: 4th June 2008
- * Updated: 11th March 2025
+ * Updated: 19th October 2026
  *
  * Home:    https://github.com/synesissoftware/CLASP/
  *
@@ -76,27 +76,12 @@
 clasp_char_t*
 clasp_strdup_(
     clasp_diagnostic_context_t const*   ctxt
+,   clasp_alloc_site_t                  site
 ,   clasp_char_t const*                 s
 )
 {
     size_t          len     =   clasp_strlen_(s);
-    clasp_char_t*   newS    =   (clasp_char_t*)clasp_malloc_(ctxt, (1 + len) * sizeof(clasp_char_t));
-
-    if (NULL != newS)
-    {
-        memcpy(newS, s, (1 + len) * sizeof(clasp_char_t));
-    }
-
-    return newS;
-}
-
-clasp_char_t*
-clasp_strdup_raw_(
-    clasp_char_t const* s
-)
-{
-    size_t          len     =   clasp_strlen_(s);
-    clasp_char_t*   newS    =   (clasp_char_t*)malloc((1 + len) * sizeof(clasp_char_t));
+    clasp_char_t*   newS    =   (clasp_char_t*)clasp_malloc_(ctxt, site, (1 + len) * sizeof(clasp_char_t));
 
     if (NULL != newS)
     {
@@ -0,0 +1,576 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/clasp.subcommands.c
+ *
+ * Purpose: CLASP subcommand and applet dispatch facilities.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * Home:    https://github.com/synesissoftware/CLASP/
+ *
+ * Copyright (c) 2026, Matthew Wilson
+ * All rights reserved.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include "clasp.internal.h"
+
+#include <errno.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+/* The table, the per-subcommand indexes, and the verb hash table are held
+ * in a single allocation.
+ *
+ * An applet registry is a table without global specifications, whose
+ * entries are clasp_applet_t, which has the same initial members - name,
+ * specifications, index - as clasp_subcommand_t.
+ */
+struct clasp_subcommand_table_t
+{
+    clasp_diagnostic_context_t          ctxt;
+    clasp_specification_index_t const*  globalIndex;    /* NULL iff there are no global specifications */
+    void const*                         entries;
+    size_t                              cbEntry;
+    size_t                              numSubcommands;
+    clasp_specification_index_t const** indexes;        /* of each subcommand, once selected */
+    unsigned char*                      ownsIndex;      /* non-0 iff the corresponding index was created by the table */
+    size_t                              numSlots;       /* a power of 2 */
+    int*                                slots;          /* the subcommand of each slot, or -1 */
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * macros
+ */
+
+#define CLASP_SUBCOMMAND_ENTRY_(table, i)                   stlsoft_static_cast(clasp_subcommand_t const*, stlsoft_static_cast(void const*, stlsoft_static_cast(char const*, (table)->entries) + (i) * (table)->cbEntry))
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+static
+size_t
+clasp_subcommand_slot_(
+    clasp_subcommand_table_t const* table
+,   clasp_char_t const*             verb
+,   size_t                          cchVerb
+)
+{
+    size_t slot = clasp_hashSpecificationKey(verb, cchVerb, 0) & (table->numSlots - 1);
+
+    /* linear probing, ending at the verb or at an empty slot */
+    for (;; slot = (slot + 1) & (table->numSlots - 1))
+    {
+        int const i = table->slots[slot];
+
+        if (i < 0)
+        {
+            return slot;
+        }
+        else
+        {
+            clasp_char_t const* const name = CLASP_SUBCOMMAND_ENTRY_(table, i)->name;
+
+            if (clasp_strlen_(name) == cchVerb &&
+                0 == clasp_strncmp_(name, verb, cchVerb))
+            {
+                return slot;
+            }
+        }
+    }
+}
+
+/* Determines the command-line index of the verb, which is the first
+ * argument that is neither a flag or option, nor the value of a global
+ * option given separately from its name
+ */
+static
+int
+clasp_subcommand_find_verb_(
+    unsigned                        flags
+,   int                             argc
+,   clasp_char_t* const             argv[]
+,   clasp_subcommand_table_t const* table
+)
+{
+    int i;
+
+    for (i = 1; i < argc; ++i)
+    {
+        clasp_char_t const* const arg = argv[i];
+
+        if ('-' != arg[0] ||
+            '\0' == arg[1])
+        {
+            break;
+        }
+
+        if ('-' == arg[1] &&
+            '\0' == arg[2] &&
+            0 == (CLASP_F_DONT_RECOGNISE_DOUBLEHYPHEN_TO_START_VALUES & flags))
+        {
+            /* the verb follows the double-hyphen */
+            ++i;
+
+            break;
+        }
+
+        if (NULL != table->globalIndex &&
+            NULL == clasp_strchreq_(arg, flags))
+        {
+            clasp_specification_t const* const spec = clasp_lookup_indexed_alias_len_(NULL, table->globalIndex, arg, clasp_strlen_(arg), flags);
+
+            /* as per clasp_calculate_sizes_(), an alias whose mapped
+             * argument carries a value - e.g. "--format=json" - takes
+             * none from the next argument
+             */
+            if (NULL != spec &&
+                CLASP_ARGTYPE_OPTION == spec->type &&
+                (   NULL == spec->mappedArgument ||
+                    NULL == clasp_strchreq_(spec->mappedArgument, flags)))
+            {
+                /* the value is the next argument */
+                ++i;
+            }
+        }
+    }
+
+    return (i < argc) ? i : argc;
+}
+
+
+/* Creates a table over the given entries - each of cbEntry bytes, and
+ * beginning with the members of clasp_subcommand_t - indexing the global
+ * specifications, if any
+ */
+static
+int
+clasp_subcommand_table_create_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_specification_t const         globalSpecifications[]
+,   void const*                         entries
+,   size_t                              cbEntry
+,   clasp_subcommand_table_t**          ptable
+)
+{
+    clasp_diagnostic_context_t  ctxt_;
+    int                         r;
+    size_t                      numSubcommands;
+    size_t                      numSlots;
+    size_t                      cb;
+    clasp_subcommand_table_t*   table;
+
+    CLASP_ASSERT(NULL != entries);
+    CLASP_ASSERT(NULL != ptable);
+
+    *ptable = NULL;
+
+    ctxt = clasp_verify_context_(ctxt, &ctxt_, &r);
+    if (NULL == ctxt)
+    {
+        return r;
+    }
+
+    { char const* entry; for (numSubcommands = 0, entry = stlsoft_static_cast(char const*, entries); NULL != stlsoft_static_cast(clasp_subcommand_t const*, stlsoft_static_cast(void const*, entry))->name; ++numSubcommands, entry += cbEntry)
+    {}}
+
+    /* at least twice as many slots as verbs, so that probing is short */
+    for (numSlots = 2; numSlots < 2 * numSubcommands; numSlots *= 2)
+    {}
+
+    cb  =   0
+        +   sizeof(clasp_subcommand_table_t)
+        +   numSubcommands * sizeof(clasp_specification_index_t const*)
+        +   numSlots * sizeof(int)
+        +   numSubcommands
+        ;
+
+    table = stlsoft_static_cast(clasp_subcommand_table_t*, clasp_malloc_(ctxt, CLASP_ALLOC_SITE_SUBCOMMAND_TABLE, cb));
+
+    if (NULL == table)
+    {
+        CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_FATAL, CLASP_LITERAL_("could not allocate memory for subcommand table"));
+
+        return ENOMEM;
+    }
+
+    table->ctxt             =   *ctxt;
+    table->globalIndex      =   NULL;
+    table->entries          =   entries;
+    table->cbEntry          =   cbEntry;
+    table->numSubcommands   =   numSubcommands;
+    table->indexes          =   stlsoft_static_cast(clasp_specification_index_t const**, stlsoft_static_cast(void*, table + 1));
+    table->numSlots         =   numSlots;
+    table->slots            =   stlsoft_static_cast(int*, stlsoft_static_cast(void*, table->indexes + numSubcommands));
+    table->ownsIndex        =   stlsoft_static_cast(unsigned char*, stlsoft_static_cast(void*, table->slots + numSlots));
+
+    { size_t i; for (i = 0; i != numSlots; ++i)
+    {
+        table->slots[i] = -1;
+    }}
+
+    { size_t i; for (i = 0; i != numSubcommands; ++i)
+    {
+        clasp_subcommand_t const* const entry   =   CLASP_SUBCOMMAND_ENTRY_(table, i);
+        clasp_char_t const* const       name    =   entry->name;
+        size_t const                    cchName =   clasp_strlen_(name);
+        size_t                          slot;
+
+        table->indexes[i]   =   entry->index;
+        table->ownsIndex[i] =   0;
+
+        if (0 == cchName)
+        {
+            CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_EMERG, CLASP_LITERAL_("programming error: empty subcommand/applet name"));
+
+            clasp_free_(ctxt, CLASP_ALLOC_SITE_SUBCOMMAND_TABLE, table);
+
+            return EINVAL;
+        }
+
+        slot = clasp_subcommand_slot_(table, name, cchName);
+
+        if (table->slots[slot] >= 0)
+        {
+            CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_EMERG, CLASP_LITERAL_("programming error: duplicate subcommand/applet name: %s"), name);
+
+            clasp_free_(ctxt, CLASP_ALLOC_SITE_SUBCOMMAND_TABLE, table);
+
+            return EINVAL;
+        }
+
+        table->slots[slot] = stlsoft_static_cast(int, i);
+    }}
+
+    if (NULL != globalSpecifications)
+    {
+        r = clasp_createSpecificationIndex(ctxt, globalSpecifications, &table->globalIndex);
+
+        if (0 != r)
+        {
+            clasp_free_(ctxt, CLASP_ALLOC_SITE_SUBCOMMAND_TABLE, table);
+
+            return r;
+        }
+    }
+
+    *ptable = table;
+
+    return 0;
+}
+
+/* Obtains the index of the given entry, creating it on first use, or
+ * NULL if the entry has no specifications
+ */
+static
+int
+clasp_subcommand_table_index_(
+    clasp_subcommand_table_t const*     table
+,   size_t                              i
+,   clasp_specification_index_t const** pindex
+)
+{
+    clasp_subcommand_table_t* const table_ = stlsoft_const_cast(clasp_subcommand_table_t*, table);
+
+    if (NULL == table->indexes[i])
+    {
+        clasp_specification_t const* const specifications = CLASP_SUBCOMMAND_ENTRY_(table, i)->specifications;
+
+        if (NULL != specifications)
+        {
+            int const r = clasp_createSpecificationIndex(&table_->ctxt, specifications, &table_->indexes[i]);
+
+            if (0 != r)
+            {
+                return r;
+            }
+
+            table_->ownsIndex[i] = 1;
+        }
+    }
+
+    *pindex = table->indexes[i];
+
+    return 0;
+}
+
+/* Parses the command-line against the given index or, if NULL, without
+ * specifications
+ */
+static
+int
+clasp_subcommand_parse_(
+    unsigned                            flags
+,   int                                 argc
+,   clasp_char_t*                       argv[]
+,   clasp_specification_index_t const*  index
+,   clasp_diagnostic_context_t const*   ctxt
+,   clasp_arguments_t const**           args
+)
+{
+    if (NULL != index)
+    {
+        return clasp_parseArgumentsWithIndex(flags, argc, argv, index, ctxt, args);
+    }
+    else
+    {
+        return clasp_parseArguments(flags, argc, argv, NULL, ctxt, args);
+    }
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+CLASP_CALL(int)
+clasp_createSubcommandTable(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_specification_t const         globalSpecifications[]
+,   clasp_subcommand_t const            subcommands[]
+,   clasp_subcommand_table_t const**    ptable
+)
+{
+    clasp_subcommand_table_t*   table;
+    int                         r;
+
+    CLASP_ASSERT(NULL != subcommands);
+    CLASP_ASSERT(NULL != ptable);
+
+    r = clasp_subcommand_table_create_(ctxt, globalSpecifications, subcommands, sizeof(clasp_subcommand_t), &table);
+
+    *ptable = table;
+
+    return r;
+}
+
+CLASP_CALL(void)
+clasp_destroySubcommandTable(
+    clasp_subcommand_table_t const*     table
+)
+{
+    if (NULL != table)
+    {
+        clasp_subcommand_table_t* const table_ = stlsoft_const_cast(clasp_subcommand_table_t*, table);
+
+        { size_t i; for (i = 0; i != table_->numSubcommands; ++i)
+        {
+            if (table_->ownsIndex[i])
+            {
+                clasp_destroySpecificationIndex(table_->indexes[i]);
+            }
+        }}
+
+        clasp_destroySpecificationIndex(table_->globalIndex);
+
+        clasp_free_(&table_->ctxt, CLASP_ALLOC_SITE_SUBCOMMAND_TABLE, table_);
+    }
+}
+
+CLASP_CALL(int)
+clasp_parseSubcommand(
+    unsigned                            flags
+,   int                                 argc
+,   clasp_char_t*                       argv[]
+,   clasp_subcommand_table_t const*     table
+,   clasp_diagnostic_context_t const*   ctxt
+,   clasp_subcommand_results_t*         results
+)
+{
+    clasp_diagnostic_context_t  ctxt_;
+    int                         verbIndex;
+    int                         r;
+
+    CLASP_ASSERT(NULL != table);
+    CLASP_ASSERT(NULL != results);
+
+    results->globalArgs =   NULL;
+    results->verbIndex  =   argc;
+    results->subcommand =   NULL;
+    results->args       =   NULL;
+
+    ctxt = clasp_verify_context_(ctxt, &ctxt_, &r);
+    if (NULL == ctxt)
+    {
+        return r;
+    }
+
+    CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_DEBUG, CLASP_LITERAL_("clasp_parseSubcommand(): argc=%d"), argc);
+
+    /* 1. the global options, parsed only up to the verb */
+
+    verbIndex = clasp_subcommand_find_verb_(flags, argc, argv, table);
+
+    r = clasp_subcommand_parse_(flags, verbIndex, argv, table->globalIndex, ctxt, &results->globalArgs);
+    if (0 != r)
+    {
+        return r;
+    }
+
+    results->verbIndex = verbIndex;
+
+    if (verbIndex == argc)
+    {
+        return 0;
+    }
+
+    /* 2. the verb, and then - against the index of its subcommand, created
+     * if necessary - its arguments
+     */
+
+    {
+        clasp_char_t const* const           verb    =   argv[verbIndex];
+        int const                           i       =   table->slots[clasp_subcommand_slot_(table, verb, clasp_strlen_(verb))];
+        clasp_specification_index_t const*  index;
+
+        if (i < 0)
+        {
+            CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_ERROR, CLASP_LITERAL_("unrecognised subcommand: %s"), verb);
+
+            return ENOENT;
+        }
+
+        r = clasp_subcommand_table_index_(table, stlsoft_static_cast(size_t, i), &index);
+        if (0 == r)
+        {
+            r = clasp_subcommand_parse_(flags, argc - verbIndex, argv + verbIndex, index, ctxt, &results->args);
+        }
+        if (0 != r)
+        {
+            clasp_releaseSubcommandResults(results);
+
+            results->globalArgs = NULL;
+            results->args       = NULL;
+
+            return r;
+        }
+
+        results->subcommand = CLASP_SUBCOMMAND_ENTRY_(table, i);
+    }
+
+    return 0;
+}
+
+CLASP_CALL(void)
+clasp_releaseSubcommandResults(
+    clasp_subcommand_results_t const*   results
+)
+{
+    CLASP_ASSERT(NULL != results);
+
+    if (NULL != results->args)
+    {
+        clasp_releaseArguments(results->args);
+    }
+
+    if (NULL != results->globalArgs)
+    {
+        clasp_releaseArguments(results->globalArgs);
+    }
+}
+
+CLASP_CALL(int)
+clasp_createAppletRegistry(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_applet_t const                applets[]
+,   clasp_applet_registry_t const**     pregistry
+)
+{
+    clasp_subcommand_table_t*   table;
+    int                         r;
+
+    CLASP_ASSERT(NULL != applets);
+    CLASP_ASSERT(NULL != pregistry);
+
+    r = clasp_subcommand_table_create_(ctxt, NULL, applets, sizeof(clasp_applet_t), &table);
+
+    *pregistry = stlsoft_static_cast(clasp_applet_registry_t const*, stlsoft_static_cast(void const*, table));
+
+    return r;
+}
+
+CLASP_CALL(void)
+clasp_destroyAppletRegistry(
+    clasp_applet_registry_t const*      registry
+)
+{
+    clasp_destroySubcommandTable(stlsoft_static_cast(clasp_subcommand_table_t const*, stlsoft_static_cast(void const*, registry)));
+}
+
+CLASP_CALL(int)
+clasp_parseApplet(
+    unsigned                            flags
+,   int                                 argc
+,   clasp_char_t*                       argv[]
+,   clasp_applet_registry_t const*      registry
+,   clasp_diagnostic_context_t const*   ctxt
+,   clasp_applet_t const**              papplet
+,   clasp_arguments_t const**           args
+)
+{
+    clasp_subcommand_table_t const* const   table   =   stlsoft_static_cast(clasp_subcommand_table_t const*, stlsoft_static_cast(void const*, registry));
+    clasp_diagnostic_context_t              ctxt_;
+    clasp_slice_t                           programName;
+    int                                     i;
+    clasp_specification_index_t const*      index;
+    int                                     r;
+
+    CLASP_ASSERT(NULL != registry);
+    CLASP_ASSERT(NULL != papplet);
+    CLASP_ASSERT(NULL != args);
+
+    *papplet    =   NULL;
+    *args       =   NULL;
+
+    ctxt = clasp_verify_context_(ctxt, &ctxt_, &r);
+    if (NULL == ctxt)
+    {
+        return r;
+    }
+
+    /* the applet is selected by the name under which the program was
+     * invoked, and only its specifications are indexed
+     */
+
+    clasp_identify_programName_(flags, argc, argv, &programName);
+
+    i = table->slots[clasp_subcommand_slot_(table, programName.ptr, programName.len)];
+
+    if (i < 0)
+    {
+        CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_ERROR, CLASP_LITERAL_("unrecognised applet: %.*s"), (int)programName.len, programName.ptr);
+
+        return ENOENT;
+    }
+
+    r = clasp_subcommand_table_index_(table, stlsoft_static_cast(size_t, i), &index);
+    if (0 != r)
+    {
+        return r;
+    }
+
+    r = clasp_subcommand_parse_(flags, argc, argv, index, ctxt, args);
+    if (0 != r)
+    {
+        return r;
+    }
+
+    *papplet = stlsoft_static_cast(clasp_applet_t const*, stlsoft_static_cast(void const*, CLASP_SUBCOMMAND_ENTRY_(table, i)));
+
+    return 0;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
@@ -0,0 +1,519 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/clasp.suggestions.c
+ *
+ * Purpose: CLASP "did you mean" suggestions for unrecognised names.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * Home:    https://github.com/synesissoftware/CLASP/
+ *
+ * Copyright (c) 2026, Matthew Wilson
+ * All rights reserved.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include "clasp.internal.h"
+
+#include <limits.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+/* The number of bits in the word used by the bit-parallel distance */
+#define CLASP_SUGGEST_WORD_BITS_                            (sizeof(clasp_suggest_word_t_) * CHAR_BIT)
+
+/* The number of characters whose match masks are held directly */
+#define CLASP_SUGGEST_DIRECT_CHARS_                         (256)
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+typedef unsigned long clasp_suggest_word_t_;
+
+/* The pattern - the name for which suggestions are sought - prepared for
+ * Myers' bit-parallel edit distance: the match mask of each character,
+ * held directly for those in the direct range, and searched for the (few)
+ * others, which may only arise with wide strings.
+ */
+typedef struct clasp_suggest_pattern_t_ clasp_suggest_pattern_t_;
+
+struct clasp_suggest_pattern_t_
+{
+    clasp_char_t const*     ptr;
+    size_t                  len;
+    clasp_suggest_word_t_   direct[CLASP_SUGGEST_DIRECT_CHARS_];
+    size_t                  numOthers;
+    clasp_char_t            otherChars[sizeof(clasp_suggest_word_t_) * CHAR_BIT];
+    clasp_suggest_word_t_   otherMasks[sizeof(clasp_suggest_word_t_) * CHAR_BIT];
+    size_t*                 row;            /* the DP row, used only if len exceeds the word */
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+static
+size_t
+clasp_suggest_char_index_(
+    clasp_char_t    ch
+)
+{
+#ifdef CLASP_USE_WIDE_STRINGS
+
+    return stlsoft_static_cast(size_t, ch);
+#else /* ? CLASP_USE_WIDE_STRINGS */
+
+    return stlsoft_static_cast(unsigned char, ch);
+#endif /* CLASP_USE_WIDE_STRINGS */
+}
+
+static
+clasp_suggest_word_t_
+clasp_suggest_mask_(
+    clasp_suggest_pattern_t_ const* pattern
+,   clasp_char_t                    ch
+)
+{
+    size_t const ix = clasp_suggest_char_index_(ch);
+
+    if (ix < CLASP_SUGGEST_DIRECT_CHARS_)
+    {
+        return pattern->direct[ix];
+    }
+    else
+    {
+        size_t i;
+
+        for (i = 0; i != pattern->numOthers; ++i)
+        {
+            if (ch == pattern->otherChars[i])
+            {
+                return pattern->otherMasks[i];
+            }
+        }
+
+        return 0;
+    }
+}
+
+static
+void
+clasp_suggest_pattern_init_(
+    clasp_suggest_pattern_t_*   pattern
+,   clasp_char_t const*         ptr
+,   size_t                      len
+)
+{
+    size_t i;
+
+    pattern->ptr        =   ptr;
+    pattern->len        =   len;
+    pattern->numOthers  =   0;
+    pattern->row        =   NULL;
+
+    for (i = 0; i != CLASP_SUGGEST_DIRECT_CHARS_; ++i)
+    {
+        pattern->direct[i] = 0;
+    }
+
+    if (len <= CLASP_SUGGEST_WORD_BITS_)
+    {
+        for (i = 0; i != len; ++i)
+        {
+            clasp_char_t const          ch  =   ptr[i];
+            size_t const                ix  =   clasp_suggest_char_index_(ch);
+            clasp_suggest_word_t_ const bit =   stlsoft_static_cast(clasp_suggest_word_t_, 1) << i;
+
+            if (ix < CLASP_SUGGEST_DIRECT_CHARS_)
+            {
+                pattern->direct[ix] |= bit;
+            }
+            else
+            {
+                size_t j;
+
+                for (j = 0; j != pattern->numOthers; ++j)
+                {
+                    if (ch == pattern->otherChars[j])
+                    {
+                        break;
+                    }
+                }
+
+                if (j == pattern->numOthers)
+                {
+                    pattern->otherChars[j] = ch;
+                    pattern->otherMasks[j] = 0;
+
+                    ++pattern->numOthers;
+                }
+
+                pattern->otherMasks[j] |= bit;
+            }
+        }
+    }
+}
+
+/* Calculates the (Levenshtein) edit distance between the pattern and the
+ * given word, by Myers' bit-parallel algorithm, in which each column of
+ * the DP matrix is held as vertical deltas in two words, and so is
+ * computed in a handful of word operations per character of the word.
+ *
+ * Stops early - returning a value greater than maxDistance - once the
+ * distance cannot come back within maxDistance.
+ *
+ * \pre pattern->len <= CLASP_SUGGEST_WORD_BITS_
+ */
+static
+size_t
+clasp_suggest_distance_myers_(
+    clasp_suggest_pattern_t_ const* pattern
+,   clasp_char_t const*             word
+,   size_t                          cchWord
+,   size_t                          maxDistance
+)
+{
+    clasp_suggest_word_t_ const one     =   1;
+    clasp_suggest_word_t_ const last    =   one << (pattern->len - 1);
+    clasp_suggest_word_t_       pv      =   ~stlsoft_static_cast(clasp_suggest_word_t_, 0);
+    clasp_suggest_word_t_       mv      =   0;
+    size_t                      score   =   pattern->len;
+    size_t                      j;
+
+    CLASP_ASSERT(0 != pattern->len);
+    CLASP_ASSERT(pattern->len <= CLASP_SUGGEST_WORD_BITS_);
+
+    for (j = 0; j != cchWord; ++j)
+    {
+        clasp_suggest_word_t_ const eq  =   clasp_suggest_mask_(pattern, word[j]);
+        clasp_suggest_word_t_ const xv  =   eq | mv;
+        clasp_suggest_word_t_ const xh  =   (((eq & pv) + pv) ^ pv) | eq;
+        clasp_suggest_word_t_       ph  =   mv | ~(xh | pv);
+        clasp_suggest_word_t_       mh  =   pv & xh;
+
+        if (0 != (ph & last))
+        {
+            ++score;
+        }
+        else if (0 != (mh & last))
+        {
+            --score;
+        }
+
+        /* the distance falls by at most one per remaining character */
+        if (score > maxDistance + (cchWord - (j + 1)))
+        {
+            return maxDistance + 1;
+        }
+
+        ph  =   (ph << 1) | one;
+        mh  =   (mh << 1);
+        pv  =   mh | ~(xv | ph);
+        mv  =   ph & xv;
+    }
+
+    return score;
+}
+
+/* Calculates the edit distance by the classic DP, over a single row, for
+ * a pattern too long for a word
+ */
+static
+size_t
+clasp_suggest_distance_dp_(
+    clasp_suggest_pattern_t_ const* pattern
+,   clasp_char_t const*             word
+,   size_t                          cchWord
+)
+{
+    size_t* const   row = pattern->row;
+    size_t          i;
+    size_t          j;
+
+    for (i = 0; i <= pattern->len; ++i)
+    {
+        row[i] = i;
+    }
+
+    for (j = 0; j != cchWord; ++j)
+    {
+        size_t diag = row[0];
+
+        row[0] = j + 1;
+
+        for (i = 0; i != pattern->len; ++i)
+        {
+            size_t const    up  =   row[i + 1];
+            size_t          d   =   diag + (pattern->ptr[i] != word[j]);
+
+            if (d > up + 1)
+            {
+                d = up + 1;
+            }
+            if (d > row[i] + 1)
+            {
+                d = row[i] + 1;
+            }
+
+            diag        =   up;
+            row[i + 1]  =   d;
+        }
+    }
+
+    return row[pattern->len];
+}
+
+/* Obtains the distance from the pattern to the word, or a value greater
+ * than maxDistance if their lengths differ by more than maxDistance
+ */
+static
+size_t
+clasp_suggest_distance_(
+    clasp_suggest_pattern_t_ const* pattern
+,   clasp_char_t const*             word
+,   size_t                          cchWord
+,   size_t                          maxDistance
+)
+{
+    size_t const diff = (cchWord < pattern->len) ? (pattern->len - cchWord) : (cchWord - pattern->len);
+
+    if (diff > maxDistance)
+    {
+        return maxDistance + 1;
+    }
+
+    if (0 == pattern->len)
+    {
+        return cchWord;
+    }
+
+    if (pattern->len <= CLASP_SUGGEST_WORD_BITS_)
+    {
+        return clasp_suggest_distance_myers_(pattern, word, cchWord, maxDistance);
+    }
+    else
+    {
+        return clasp_suggest_distance_dp_(pattern, word, cchWord);
+    }
+}
+
+/* Inserts the suggestion into the array, which is ordered by distance and
+ * then by specification, if it is among the best maxSuggestions
+ */
+static
+void
+clasp_suggest_insert_(
+    clasp_suggestion_t*             suggestions
+,   size_t                          numHeld
+,   size_t                          maxSuggestions
+,   clasp_specification_t const*    specification
+,   clasp_char_t const*             word
+,   size_t                          cchWord
+,   size_t                          distance
+)
+{
+    size_t i = numHeld;
+
+    if (i == maxSuggestions)
+    {
+        if (0 == i ||
+            suggestions[i - 1].distance <= distance)
+        {
+            return;
+        }
+
+        --i;
+    }
+
+    for (; 0 != i && suggestions[i - 1].distance > distance; --i)
+    {
+        suggestions[i] = suggestions[i - 1];
+    }
+
+    suggestions[i].specification    =   specification;
+    suggestions[i].name.len         =   cchWord;
+    suggestions[i].name.ptr         =   word;
+    suggestions[i].distance         =   distance;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+CLASP_CALL(size_t)
+clasp_findSuggestions(
+    clasp_arguments_t const*        args
+,   clasp_specification_t const     specifications[]
+,   clasp_char_t const*             name
+,   size_t                          cchName
+,   size_t                          maxDistance
+,   clasp_suggestion_t*             suggestions
+,   size_t                          maxSuggestions
+)
+{
+    clasp_diagnostic_context_t const*   ctxt    =   NULL;
+    clasp_diagnostic_context_t          ctxt_;
+    clasp_suggest_pattern_t_            pattern;
+    clasp_specification_t const*        spec;
+    size_t                              numHeld =   0;
+    size_t                              n       =   0;
+    size_t                              i;
+
+    unsigned flags = 0;
+
+    CLASP_ASSERT(NULL != args || NULL != specifications);
+    CLASP_ASSERT(NULL != name);
+    CLASP_ASSERT(NULL != suggestions || 0 == maxSuggestions);
+
+    if (NULL != args)
+    {
+        ctxt = clasp_diagnostic_context_from_args_(args);
+
+        if (NULL == specifications)
+        {
+            specifications = clasp_getSpecifications(args);
+        }
+    }
+
+    if (NULL == specifications)
+    {
+        return 0;
+    }
+
+    /* 1. the name is compared without any value */
+
+    for (i = 0; i != cchName; ++i)
+    {
+        if ('=' == name[i])
+        {
+            cchName = i;
+
+            break;
+        }
+    }
+
+    /* 2. the default distance is a third of the name without its hyphens */
+
+    if (0 == maxDistance)
+    {
+        for (i = 0; i != cchName && '-' == name[i]; ++i)
+        {}
+
+        maxDistance = (1 + cchName - i) / 3;
+
+        if (0 == maxDistance)
+        {
+            return 0;
+        }
+    }
+
+    clasp_suggest_pattern_init_(&pattern, name, cchName);
+
+    if (cchName > CLASP_SUGGEST_WORD_BITS_)
+    {
+        if (NULL == ctxt)
+        {
+            clasp_init_diagnostic_context(&ctxt_, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+
+            ctxt = &ctxt_;
+        }
+
+        pattern.row = stlsoft_static_cast(size_t*, clasp_malloc_(ctxt, CLASP_ALLOC_SITE_SUGGESTIONS, sizeof(size_t) * (1 + cchName)));
+
+        if (NULL == pattern.row)
+        {
+            CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_FATAL, CLASP_LITERAL_("could not allocate memory for suggestions"));
+
+            return 0;
+        }
+    }
+
+    /* 3. each flag/option is suggested by the closer of its name (alias)
+     * and its long name - the mapped argument up to any '=' - except that
+     * the long name of an alias to an option with a value, e.g. "-j" for
+     * "--format=json", is not considered, since it is that of the option
+     */
+
+    for (spec = specifications; CLASP_ARGTYPE_INVALID != spec->type; ++spec)
+    {
+        clasp_char_t const* best        =   NULL;
+        size_t              cchBest     =   0;
+        size_t              distance    =   maxDistance + 1;
+
+        if (CLASP_ARGTYPE_FLAG != spec->type &&
+            CLASP_ARGTYPE_OPTION != spec->type)
+        {
+            continue;
+        }
+
+        if (NULL != spec->mappedArgument &&
+            '-' == spec->mappedArgument[0])
+        {
+            clasp_char_t const* const   ma      =   spec->mappedArgument;
+            clasp_char_t const* const   equal   =   clasp_strchreq_(ma, flags);
+
+            if (NULL == equal ||
+                CLASP_ARGTYPE_OPTION == spec->type)
+            {
+                size_t const    cchMa   =   (NULL == equal) ? clasp_strlen_(ma) : stlsoft_static_cast(size_t, equal - ma);
+                size_t const    d       =   clasp_suggest_distance_(&pattern, ma, cchMa, maxDistance);
+
+                if (d < distance)
+                {
+                    best        =   ma;
+                    cchBest     =   cchMa;
+                    distance    =   d;
+                }
+            }
+        }
+
+        if (NULL != spec->name &&
+            '\0' != spec->name[0])
+        {
+            size_t const    cchAlias    =   clasp_strlen_(spec->name);
+            size_t const    d           =   clasp_suggest_distance_(&pattern, spec->name, cchAlias, maxDistance);
+
+            if (d < distance)
+            {
+                best        =   spec->name;
+                cchBest     =   cchAlias;
+                distance    =   d;
+            }
+        }
+
+        if (NULL != best)
+        {
+            clasp_suggest_insert_(suggestions, numHeld, maxSuggestions, spec, best, cchBest, distance);
+
+            if (numHeld != maxSuggestions)
+            {
+                ++numHeld;
+            }
+
+            ++n;
+        }
+    }
+
+    if (NULL != pattern.row)
+    {
+        clasp_free_(ctxt, CLASP_ALLOC_SITE_SUGGESTIONS, pattern.row);
+    }
+
+    return n;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
@@ -0,0 +1,642 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/clasp.trie.c
+ *
+ * Purpose: CLASP prefix trie facilities.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * Home:    https://github.com/synesissoftware/CLASP/
+ *
+ * Copyright (c) 2026, Matthew Wilson
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer;
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution;
+ * - Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include "clasp.internal.h"
+
+#include <errno.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+#define CLASP_PREFIX_TRIE_NONE_                             (-1)
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+/* Obtains the part of the specification's long name following the "--",
+ * returning its length, or 0 if it has no (double-hyphen) long name
+ */
+static
+size_t
+clasp_prefix_trie_get_name_(
+    clasp_specification_t const*    specification
+,   unsigned                        flags
+,   clasp_char_t const**            pname
+)
+{
+    clasp_char_t const* const ma = specification->mappedArgument;
+
+    if ((CLASP_ARGTYPE_FLAG == specification->type ||
+         CLASP_ARGTYPE_OPTION == specification->type) &&
+        NULL != ma &&
+        '-' == ma[0] &&
+        '-' == ma[1])
+    {
+        clasp_char_t const* const equal = clasp_strchreq_(ma + 2, flags);
+
+        *pname = ma + 2;
+
+        return (NULL == equal) ? clasp_strlen_(ma + 2) : stlsoft_static_cast(size_t, equal - (ma + 2));
+    }
+
+    return 0;
+}
+
+static
+clasp_bool_t
+clasp_prefix_trie_is_defaulted_(
+    clasp_specification_t const*    specification
+,   unsigned                        flags
+)
+{
+    return NULL != clasp_strchreq_(specification->mappedArgument, flags);
+}
+
+/* Obtains the label of the given node */
+static
+clasp_char_t const*
+clasp_prefix_trie_label_(
+    clasp_prefix_trie_node_t const* node
+,   clasp_specification_t const     specifications[]
+)
+{
+    return specifications[node->labelSpecIndex].mappedArgument + 2 + node->labelOffset;
+}
+
+static
+void
+clasp_prefix_trie_init_node_(
+    clasp_prefix_trie_node_t*   node
+,   int                         labelSpecIndex
+,   size_t                      labelOffset
+,   size_t                      labelLength
+,   int                         parent
+)
+{
+    node->labelSpecIndex    =   labelSpecIndex;
+    node->labelOffset       =   stlsoft_static_cast(int, labelOffset);
+    node->labelLength       =   stlsoft_static_cast(int, labelLength);
+    node->parent            =   parent;
+    node->firstChild        =   CLASP_PREFIX_TRIE_NONE_;
+    node->nextSibling       =   CLASP_PREFIX_TRIE_NONE_;
+    node->specIndex         =   CLASP_PREFIX_TRIE_NONE_;
+    node->numNames          =   0;
+    node->anySpecIndex      =   CLASP_PREFIX_TRIE_NONE_;
+}
+
+/* Records the specification against the node at which its long name ends:
+ * the first non-defaulted specification (or, failing that, the first
+ * defaulted one), as per clasp_lookup_alias_len_(); and maintains the name
+ * counts of the node and its ancestors
+ */
+static
+void
+clasp_prefix_trie_set_terminal_(
+    clasp_prefix_trie_node_t*       nodes
+,   clasp_specification_t const     specifications[]
+,   unsigned                        flags
+,   int                             node
+,   int                             specIndex
+)
+{
+    int const previous = nodes[node].specIndex;
+
+    if (CLASP_PREFIX_TRIE_NONE_ == previous)
+    {
+        nodes[node].specIndex = specIndex;
+
+        for (; CLASP_PREFIX_TRIE_NONE_ != node; node = nodes[node].parent)
+        {
+            ++nodes[node].numNames;
+
+            if (CLASP_PREFIX_TRIE_NONE_ == nodes[node].anySpecIndex)
+            {
+                nodes[node].anySpecIndex = specIndex;
+            }
+        }
+    }
+    else
+    if (clasp_prefix_trie_is_defaulted_(specifications + previous, flags) &&
+        !clasp_prefix_trie_is_defaulted_(specifications + specIndex, flags))
+    {
+        nodes[node].specIndex = specIndex;
+
+        for (; CLASP_PREFIX_TRIE_NONE_ != node; node = nodes[node].parent)
+        {
+            if (previous == nodes[node].anySpecIndex)
+            {
+                nodes[node].anySpecIndex = specIndex;
+            }
+        }
+    }
+}
+
+/* Walks from the root to the node for the prefix name[0, cchName), which
+ * excludes the leading "--", returning NONE if there is none. Where the
+ * prefix ends within a node's label, that node is returned and *exact is
+ * set to false
+ */
+static
+int
+clasp_prefix_trie_find_node_(
+    clasp_prefix_trie_t_ const*     trie
+,   clasp_specification_t const     specifications[]
+,   clasp_char_t const*             name
+,   size_t                          cchName
+,   clasp_bool_t*                   exact
+)
+{
+    int     node    =   0;
+    size_t  pos     =   0;
+
+    *exact = clasp_true_v;
+
+    for (; pos != cchName; )
+    {
+        int                 child   =   trie->nodes[node].firstChild;
+        clasp_char_t const* label   =   NULL;
+        size_t              n;
+
+        for (; CLASP_PREFIX_TRIE_NONE_ != child; child = trie->nodes[child].nextSibling)
+        {
+            label = clasp_prefix_trie_label_(&trie->nodes[child], specifications);
+
+            if (name[pos] == label[0])
+            {
+                break;
+            }
+        }
+
+        if (CLASP_PREFIX_TRIE_NONE_ == child)
+        {
+            return CLASP_PREFIX_TRIE_NONE_;
+        }
+
+        n = stlsoft_static_cast(size_t, trie->nodes[child].labelLength);
+
+        if (n > cchName - pos)
+        {
+            n = cchName - pos;
+
+            *exact = clasp_false_v;
+        }
+
+        if (0 != clasp_strncmp_(label, name + pos, n))
+        {
+            return CLASP_PREFIX_TRIE_NONE_;
+        }
+
+        node    =   child;
+        pos     +=  n;
+    }
+
+    return node;
+}
+
+/* Obtains the next node, in depth-first order, within the subtree rooted
+ * at top, or NONE when the subtree is exhausted
+ */
+static
+int
+clasp_prefix_trie_next_node_(
+    clasp_prefix_trie_t_ const* trie
+,   int                         top
+,   int                         node
+)
+{
+    if (CLASP_PREFIX_TRIE_NONE_ != trie->nodes[node].firstChild)
+    {
+        return trie->nodes[node].firstChild;
+    }
+
+    for (; top != node; node = trie->nodes[node].parent)
+    {
+        if (CLASP_PREFIX_TRIE_NONE_ != trie->nodes[node].nextSibling)
+        {
+            return trie->nodes[node].nextSibling;
+        }
+    }
+
+    return CLASP_PREFIX_TRIE_NONE_;
+}
+
+static
+void
+clasp_prefix_trie_log_ambiguity_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_prefix_trie_t_ const*         trie
+,   clasp_specification_t const         specifications[]
+,   int                                 top
+,   clasp_char_t const*                 name
+,   size_t                              cchName
+)
+{
+    clasp_buffer_t_ buffer;
+    int             node;
+    size_t          n = 0;
+
+    clasp_buffer_init_(&buffer, ctxt, CLASP_ALLOC_SITE_DIAGNOSTIC);
+
+    for (node = top; CLASP_PREFIX_TRIE_NONE_ != node; node = clasp_prefix_trie_next_node_(trie, top, node))
+    {
+        int const specIndex = trie->nodes[node].specIndex;
+
+        if (CLASP_PREFIX_TRIE_NONE_ != specIndex)
+        {
+            clasp_char_t const* candidate;
+            size_t const        cchCandidate = clasp_prefix_trie_get_name_(specifications + specIndex, trie->flags, &candidate);
+
+            if (0 != n++)
+            {
+                clasp_buffer_append_s_(&buffer, CLASP_LITERAL_(", "));
+            }
+            clasp_buffer_append_s_(&buffer, CLASP_LITERAL_("--"));
+            clasp_buffer_append_(&buffer, candidate, cchCandidate);
+        }
+    }
+
+    if (0 == buffer.result)
+    {
+        CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_WARN, CLASP_LITERAL_("ambiguous option '%.*s' could be any of: %s"), (int)cchName, name, buffer.ptr);
+    }
+
+    clasp_buffer_uninit_(&buffer);
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+size_t
+clasp_prefix_trie_max_nodes_(
+    clasp_specification_t const         specifications[]
+,   unsigned                            flags
+)
+{
+    size_t numNames = 0;
+
+    if (NULL != specifications)
+    {
+        clasp_specification_t const* spec;
+
+        for (spec = specifications; CLASP_ARGTYPE_INVALID != spec->type; ++spec)
+        {
+            clasp_char_t const* name;
+
+            if (0 != clasp_prefix_trie_get_name_(spec, flags, &name))
+            {
+                ++numNames;
+            }
+        }
+    }
+
+    /* the root, a leaf for each name, and at most one branching node for
+     * all but one of them
+     */
+    return 2 * numNames + 1;
+}
+
+size_t
+clasp_prefix_trie_build_(
+    clasp_specification_t const         specifications[]
+,   unsigned                            flags
+,   clasp_prefix_trie_node_t*           nodes
+)
+{
+    size_t numNodes = 1;
+
+    CLASP_ASSERT(NULL != nodes);
+
+    clasp_prefix_trie_init_node_(&nodes[0], CLASP_PREFIX_TRIE_NONE_, 0, 0, CLASP_PREFIX_TRIE_NONE_);
+
+    if (NULL != specifications)
+    {
+        int i;
+
+        for (i = 0; CLASP_ARGTYPE_INVALID != specifications[i].type; ++i)
+        {
+            clasp_char_t const* name;
+            size_t const        cchName =   clasp_prefix_trie_get_name_(specifications + i, flags, &name);
+            int                 node    =   0;
+            size_t              pos     =   0;
+
+            if (0 == cchName)
+            {
+                continue;
+            }
+
+            for (;;)
+            {
+                int                 child   =   nodes[node].firstChild;
+                int                 prev    =   CLASP_PREFIX_TRIE_NONE_;
+                clasp_char_t const* label   =   NULL;
+                size_t              m;
+
+                if (cchName == pos)
+                {
+                    clasp_prefix_trie_set_terminal_(nodes, specifications, flags, node, i);
+
+                    break;
+                }
+
+                for (; CLASP_PREFIX_TRIE_NONE_ != child; prev = child, child = nodes[child].nextSibling)
+                {
+                    label = clasp_prefix_trie_label_(&nodes[child], specifications);
+
+                    if (name[pos] == label[0])
+                    {
+                        break;
+                    }
+                }
+
+                if (CLASP_PREFIX_TRIE_NONE_ == child)
+                {
+                    /* a leaf for the remainder of the name */
+
+                    child = stlsoft_static_cast(int, numNodes++);
+
+                    clasp_prefix_trie_init_node_(&nodes[child], i, pos, cchName - pos, node);
+
+                    if (CLASP_PREFIX_TRIE_NONE_ == prev)
+                    {
+                        nodes[node].firstChild = child;
+                    }
+                    else
+                    {
+                        nodes[prev].nextSibling = child;
+                    }
+
+                    clasp_prefix_trie_set_terminal_(nodes, specifications, flags, child, i);
+
+                    break;
+                }
+
+                for (m = 1; m != stlsoft_static_cast(size_t, nodes[child].labelLength) && pos + m != cchName && name[pos + m] == label[m]; ++m)
+                {}
+
+                if (m != stlsoft_static_cast(size_t, nodes[child].labelLength))
+                {
+                    /* split the child's label, interposing a node that
+                     * takes the child's place among its siblings
+                     */
+
+                    int const mid = stlsoft_static_cast(int, numNodes++);
+
+                    clasp_prefix_trie_init_node_(&nodes[mid], nodes[child].labelSpecIndex, stlsoft_static_cast(size_t, nodes[child].labelOffset), m, node);
+
+                    nodes[mid].firstChild   =   child;
+                    nodes[mid].nextSibling  =   nodes[child].nextSibling;
+                    nodes[mid].numNames     =   nodes[child].numNames;
+                    nodes[mid].anySpecIndex =   nodes[child].anySpecIndex;
+
+                    if (CLASP_PREFIX_TRIE_NONE_ == prev)
+                    {
+                        nodes[node].firstChild = mid;
+                    }
+                    else
+                    {
+                        nodes[prev].nextSibling = mid;
+                    }
+
+                    nodes[child].parent         =   mid;
+                    nodes[child].labelOffset    +=  stlsoft_static_cast(int, m);
+                    nodes[child].labelLength    -=  stlsoft_static_cast(int, m);
+                    nodes[child].nextSibling    =   CLASP_PREFIX_TRIE_NONE_;
+
+                    child = mid;
+                }
+
+                node    =   child;
+                pos     +=  m;
+            }
+        }
+    }
+
+    return numNodes;
+}
+
+int
+clasp_prefix_trie_create_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_parse_statistics_t*           stats
+,   clasp_specification_t const         specifications[]
+,   unsigned                            flags
+,   clasp_prefix_trie_t_**              ptrie
+)
+{
+    size_t const            maxNodes    =   clasp_prefix_trie_max_nodes_(specifications, flags);
+    clasp_prefix_trie_t_*   trie;
+
+    CLASP_ASSERT(NULL != ctxt);
+    CLASP_ASSERT(NULL != ptrie);
+
+    *ptrie = NULL;
+
+    trie = stlsoft_static_cast(clasp_prefix_trie_t_*, clasp_statistics_malloc_(ctxt, stats, CLASP_ALLOC_SITE_PREFIX_TRIE, sizeof(clasp_prefix_trie_t_) + maxNodes * sizeof(clasp_prefix_trie_node_t)));
+
+    if (NULL == trie)
+    {
+        return ENOMEM;
+    }
+
+    {
+        clasp_prefix_trie_node_t* const nodes = stlsoft_static_cast(clasp_prefix_trie_node_t*, stlsoft_static_cast(void*, trie + 1));
+
+        trie->flags     =   flags;
+        trie->numNodes  =   clasp_prefix_trie_build_(specifications, flags, nodes);
+        trie->nodes     =   nodes;
+
+        CLASP_ASSERT(trie->numNodes <= maxNodes);
+    }
+
+    *ptrie = trie;
+
+    return 0;
+}
+
+void
+clasp_prefix_trie_destroy_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_prefix_trie_t_*               trie
+)
+{
+    CLASP_ASSERT(NULL != ctxt);
+
+    if (NULL != trie)
+    {
+        clasp_free_(ctxt, CLASP_ALLOC_SITE_PREFIX_TRIE, trie);
+    }
+}
+
+clasp_prefix_trie_t_ const*
+clasp_prefix_trie_from_index_(
+    clasp_specification_index_t const*  index
+,   unsigned                            flags
+,   clasp_prefix_trie_t_*               trie
+)
+{
+    CLASP_ASSERT(NULL != trie);
+
+    if (NULL == index ||
+        NULL == index->trieNodes)
+    {
+        return NULL;
+    }
+
+    trie->flags     =   flags;
+    trie->numNodes  =   index->numTrieNodes;
+    trie->nodes     =   index->trieNodes;
+
+    return trie;
+}
+
+clasp_specification_t const*
+clasp_prefix_trie_lookup_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_prefix_trie_t_ const*         trie
+,   clasp_specification_t const         specifications[]
+,   clasp_char_t const*                 name
+,   size_t                              cchName
+)
+{
+    int             node;
+    clasp_bool_t    exact;
+
+    CLASP_ASSERT(NULL != trie);
+    CLASP_ASSERT(NULL != name);
+
+    /* requires "--" and at least one character */
+    if (cchName < 3 ||
+        '-' != name[0] ||
+        '-' != name[1])
+    {
+        return NULL;
+    }
+
+    node = clasp_prefix_trie_find_node_(trie, specifications, name + 2, cchName - 2, &exact);
+
+    if (CLASP_PREFIX_TRIE_NONE_ == node)
+    {
+        return NULL;
+    }
+
+    if (1 == trie->nodes[node].numNames)
+    {
+        return specifications + trie->nodes[node].anySpecIndex;
+    }
+
+    if (exact &&
+        CLASP_PREFIX_TRIE_NONE_ != trie->nodes[node].specIndex)
+    {
+        return specifications + trie->nodes[node].specIndex;
+    }
+
+    if (NULL != ctxt)
+    {
+        clasp_prefix_trie_log_ambiguity_(ctxt, trie, specifications, node, name, cchName);
+    }
+
+    return NULL;
+}
+
+size_t
+clasp_prefix_trie_candidates_(
+    clasp_prefix_trie_t_ const*         trie
+,   clasp_specification_t const         specifications[]
+,   clasp_char_t const*                 name
+,   size_t                              cchName
+,   clasp_specification_t const**       candidates
+,   size_t                              maxCandidates
+)
+{
+    int             top;
+    int             node;
+    clasp_bool_t    exact;
+    size_t          n = 0;
+
+    CLASP_ASSERT(NULL != trie);
+    CLASP_ASSERT(NULL != name);
+    CLASP_ASSERT(NULL != candidates || 0 == maxCandidates);
+
+    if (cchName < 2 ||
+        '-' != name[0] ||
+        '-' != name[1])
+    {
+        return 0;
+    }
+
+    top = clasp_prefix_trie_find_node_(trie, specifications, name + 2, cchName - 2, &exact);
+
+    if (CLASP_PREFIX_TRIE_NONE_ == top)
+    {
+        return 0;
+    }
+
+    for (node = top; CLASP_PREFIX_TRIE_NONE_ != node; node = clasp_prefix_trie_next_node_(trie, top, node))
+    {
+        int const specIndex = trie->nodes[node].specIndex;
+
+        if (CLASP_PREFIX_TRIE_NONE_ != specIndex)
+        {
+            if (n < maxCandidates)
+            {
+                candidates[n] = specifications + specIndex;
+            }
+
+            ++n;
+        }
+    }
+
+    return n;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
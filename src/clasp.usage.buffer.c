@@ -0,0 +1,907 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/clasp.usage.buffer.c
+ *
+ * Purpose: CLASP usage (buffer) facilities.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * Home:    https://github.com/synesissoftware/CLASP/
+ *
+ * Copyright (c) 2026, Matthew Wilson
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer;
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution;
+ * - Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include "clasp.internal.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+static
+int
+clasp_is_valid_specification_type_(clasp_argtype_t t)
+{
+    switch (t)
+    {
+    case CLASP_ARGTYPE_FLAG:
+    case CLASP_ARGTYPE_OPTION:
+    case CLASP_ARGTYPE_VALUE:
+
+        return clasp_true_v;
+    default:
+
+        return clasp_false_v;
+    }
+}
+
+static
+size_t
+clasp_longOptionName_strlen_(clasp_char_t const* s, unsigned flags)
+{
+    clasp_char_t const* equals = clasp_strchreq_(s, flags);
+
+    return (NULL == equals) ? clasp_strlen_(s) : (size_t)(equals - s);
+}
+
+static
+size_t
+clasp_strlen_or_0_(clasp_char_t const* s)
+{
+    return (NULL == s) ? 0u : clasp_strlen_(s);
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * usage layout
+ *
+ * The column layout - item prefix and help indent - depends only on the
+ * usage information, and so is calculated once per rendering.
+ */
+
+typedef struct clasp_usage_layout_t_ clasp_usage_layout_t_;
+
+struct clasp_usage_layout_t_
+{
+    clasp_char_t    prefixChar;     /* character with which to prefix items */
+    size_t          prefixLen;      /* number of prefix characters */
+    clasp_char_t    indentChar;     /* character with which to indent help */
+    size_t          indentLen;      /* number of indent characters */
+    int             width;          /* console width; < 1 means unlimited */
+    int             availableWidth; /* width available for help fragments */
+};
+
+static
+void
+clasp_usage_layout_init_(
+    clasp_usage_layout_t_*      layout
+,   clasp_usageinfo_t const*    info
+)
+{
+    /* Prefixing. Either:
+     *
+     * - single TAB:  equiv "\t"
+     * - n-spaces:    equiv "%.*s", (int)n, ""
+     *
+     * Help indenting. Either:
+     *
+     * - two TABs:    equiv "\t\t"
+     * - 2n-spaces:   equiv "%.*s", (int)(2 * n), ""
+     */
+
+    if (info->assumedTabWidth < 1)
+    {
+        layout->prefixChar  =   ' ';
+        layout->prefixLen   =   (size_t)(-info->assumedTabWidth);
+        layout->indentChar  =   ' ';
+        layout->indentLen   =   2 * (size_t)(-info->assumedTabWidth);
+    }
+    else
+    {
+        layout->prefixChar  =   '\t';
+        layout->prefixLen   =   1u;
+        layout->indentChar  =   '\t';
+        layout->indentLen   =   2u;
+    }
+
+    layout->width           =   info->width;
+    layout->availableWidth  =   info->width - 2 * abs(info->assumedTabWidth);
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * usage model
+ *
+ * The usage model groups all (flag/option) specifications by their long
+ * name, via a single hashing pre-pass, and then determines each group's
+ * primary in a single walk of its members. Body rendering then needs only
+ * to consult the model, rather than rescanning the whole specification
+ * array for each item.
+ */
+
+#define CLASP_USAGE_MODEL_NONE_                             (~(size_t)0)
+
+typedef struct clasp_usage_model_t_ clasp_usage_model_t_;
+
+struct clasp_usage_model_t_
+{
+    size_t*     heads;      /* index of first member of item's group */
+    size_t*     nexts;      /* index of next member of item's group, or NONE */
+    size_t*     primaries;  /* index of primary of item's group */
+    size_t*     lengths;    /* length of the item's long name */
+    size_t      cchTotal;   /* total length of all item strings */
+};
+
+static
+size_t
+clasp_usage_model_hash_(
+    clasp_char_t const* s
+,   size_t              len
+)
+{
+    /* FNV-1a */
+
+    size_t h = stlsoft_static_cast(size_t, 2166136261u);
+
+    { size_t i; for (i = 0; i != len; ++i)
+    {
+        h ^= stlsoft_static_cast(size_t, s[i]);
+        h *= stlsoft_static_cast(size_t, 16777619u);
+    }}
+
+    return h;
+}
+
+static
+size_t
+clasp_usage_model_select_primary_(
+    clasp_usage_model_t_ const* model
+,   clasp_alias_t const         specifications[]
+,   size_t                      head
+)
+{
+    size_t  numberOfMatches =   0;
+    size_t  r2              =   CLASP_USAGE_MODEL_NONE_;
+    size_t  r3              =   CLASP_USAGE_MODEL_NONE_;
+    size_t  r4              =   CLASP_USAGE_MODEL_NONE_;
+    size_t  r5              =   CLASP_USAGE_MODEL_NONE_;
+
+    /* Algorithm:
+     *
+     * 1. If only matching alias, then primary
+     * 2. Use first (non-equal) matching alias with help text and NULL name
+     * 3. Use first (non-equal) matching alias with help text
+     * 4. Use first matching alias with help text and NULL name
+     * 5. Use first matching alias with help text
+     * 6. Use first matching alias
+     *
+     * All candidates are identified in a single walk of the group.
+     */
+
+    { size_t j; for (j = head; CLASP_USAGE_MODEL_NONE_ != j; j = model->nexts[j])
+    {
+        clasp_alias_t const* const  alias2      =   specifications + j;
+        clasp_bool_t const          hasHelp     =   NULL != alias2->help && '\0' != *alias2->help;
+        clasp_bool_t const          hasName     =   NULL != alias2->name && '\0' != *alias2->name;
+        clasp_bool_t const          hasDefault  =   NULL != alias2->mappedArgument && '\0' != alias2->mappedArgument[model->lengths[j]];
+
+        ++numberOfMatches;
+
+        if (hasHelp)
+        {
+            if (!hasDefault)
+            {
+                if (!hasName &&
+                    CLASP_USAGE_MODEL_NONE_ == r2)
+                {
+                    r2 = j;
+                }
+                if (CLASP_USAGE_MODEL_NONE_ == r3)
+                {
+                    r3 = j;
+                }
+            }
+            if (!hasName &&
+                CLASP_USAGE_MODEL_NONE_ == r4)
+            {
+                r4 = j;
+            }
+            if (CLASP_USAGE_MODEL_NONE_ == r5)
+            {
+                r5 = j;
+            }
+        }
+    }}
+
+    if (1u == numberOfMatches)
+    {
+        return head;
+    }
+
+    if (CLASP_USAGE_MODEL_NONE_ != r2)
+    {
+        return r2;
+    }
+    if (CLASP_USAGE_MODEL_NONE_ != r3)
+    {
+        return r3;
+    }
+    if (CLASP_USAGE_MODEL_NONE_ != r4)
+    {
+        return r4;
+    }
+    if (CLASP_USAGE_MODEL_NONE_ != r5)
+    {
+        return r5;
+    }
+
+    return head;
+}
+
+static
+int
+clasp_usage_model_init_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_usage_model_t_*               model
+,   clasp_alias_t const                 specifications[]
+,   size_t                              numSpecifications
+,   unsigned                            flags
+)
+{
+    size_t  numBuckets  =   8;
+    size_t* buckets;
+    size_t* tails;
+
+    CLASP_ASSERT(NULL != model);
+
+    for (; numBuckets < 2 * numSpecifications; numBuckets *= 2)
+    {}
+
+    model->heads = stlsoft_static_cast(size_t*, clasp_malloc_(ctxt, CLASP_ALLOC_SITE_USAGE_MODEL, sizeof(size_t) * (4 * numSpecifications + numBuckets)));
+
+    if (NULL == model->heads)
+    {
+        return ENOMEM;
+    }
+
+    model->nexts        =   model->heads + 1 * numSpecifications;
+    model->primaries    =   model->heads + 2 * numSpecifications;
+    model->lengths      =   model->heads + 3 * numSpecifications;
+    buckets             =   model->heads + 4 * numSpecifications;
+
+    /* the primaries array serves as the (head-indexed) tails array until
+     * the primaries are selected
+     */
+    tails               =   model->primaries;
+
+    model->cchTotal     =   0;
+
+    { size_t b; for (b = 0; b != numBuckets; ++b)
+    {
+        buckets[b] = CLASP_USAGE_MODEL_NONE_;
+    }}
+
+    /* 1. group by long name */
+
+    { size_t i; for (i = 0; i != numSpecifications; ++i)
+    {
+        clasp_alias_t const* const alias = specifications + i;
+
+        model->heads[i]     =   CLASP_USAGE_MODEL_NONE_;
+        model->nexts[i]     =   CLASP_USAGE_MODEL_NONE_;
+        model->primaries[i] =   CLASP_USAGE_MODEL_NONE_;
+        model->lengths[i]   =   0;
+
+        model->cchTotal     +=  clasp_strlen_or_0_(alias->name)
+                            +   clasp_strlen_or_0_(alias->mappedArgument)
+                            +   clasp_strlen_or_0_(alias->help)
+                            +   clasp_strlen_or_0_(alias->valueSet);
+
+        if (!clasp_is_valid_specification_type_(alias->type))
+        {
+            continue;
+        }
+
+        if (NULL == alias->mappedArgument)
+        {
+            model->heads[i] =   i;
+            tails[i]        =   i;
+
+            continue;
+        }
+        else
+        {
+            size_t const    len =   clasp_longOptionName_strlen_(alias->mappedArgument, flags);
+            size_t          b   =   clasp_usage_model_hash_(alias->mappedArgument, len) & (numBuckets - 1);
+
+            model->lengths[i] = len;
+
+            for (;; b = (b + 1) & (numBuckets - 1))
+            {
+                size_t const head = buckets[b];
+
+                if (CLASP_USAGE_MODEL_NONE_ == head)
+                {
+                    buckets[b]      =   i;
+                    model->heads[i] =   i;
+                    tails[i]        =   i;
+
+                    break;
+                }
+                else
+                if (len == model->lengths[head] &&
+                    0 == clasp_strncmp_(alias->mappedArgument, specifications[head].mappedArgument, len))
+                {
+                    model->heads[i]             =   head;
+                    model->nexts[tails[head]]   =   i;
+                    tails[head]                 =   i;
+
+                    break;
+                }
+            }
+        }
+    }}
+
+    /* 2. select each group's primary, and share it with all members */
+
+    { size_t i; for (i = 0; i != numSpecifications; ++i)
+    {
+        if (i == model->heads[i])
+        {
+            size_t const primary = clasp_usage_model_select_primary_(model, specifications, i);
+
+            { size_t j; for (j = i; CLASP_USAGE_MODEL_NONE_ != j; j = model->nexts[j])
+            {
+                model->primaries[j] = primary;
+            }}
+        }
+    }}
+
+    return 0;
+}
+
+static
+void
+clasp_usage_model_uninit_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_usage_model_t_*               model
+)
+{
+    clasp_free_(ctxt, CLASP_ALLOC_SITE_USAGE_MODEL, model->heads);
+}
+
+
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * rendering helpers
+ */
+
+static
+void
+clasp_usage_render_prefix_(
+    clasp_buffer_t_*                buffer
+,   clasp_usage_layout_t_ const*    layout
+)
+{
+    clasp_buffer_append_n_(buffer, layout->prefixChar, layout->prefixLen);
+}
+
+static
+void
+clasp_usage_render_help_fragment_(
+    clasp_buffer_t_*                buffer
+,   clasp_usage_layout_t_ const*    layout
+,   clasp_char_t const*             fragment
+,   size_t                          len
+)
+{
+    clasp_buffer_append_n_(buffer, layout->indentChar, layout->indentLen);
+    clasp_buffer_append_(buffer, fragment, len);
+    clasp_buffer_append_n_(buffer, '\n', 1);
+}
+
+typedef struct clasp_usage_help_param_t_ clasp_usage_help_param_t_;
+
+struct clasp_usage_help_param_t_
+{
+    clasp_buffer_t_*                buffer;
+    clasp_usage_layout_t_ const*    layout;
+};
+
+static
+void
+clasp_usage_render_help_line_(
+    void*               param
+,   clasp_char_t const* line
+,   size_t              len
+)
+{
+    clasp_usage_help_param_t_ const* const hp = stlsoft_static_cast(clasp_usage_help_param_t_ const*, param);
+
+    clasp_usage_render_help_fragment_(hp->buffer, hp->layout, line, len);
+}
+
+static
+void
+clasp_usage_render_help_(
+    clasp_buffer_t_*                buffer
+,   clasp_usage_layout_t_ const*    layout
+,   clasp_char_t const*             help
+)
+{
+    size_t const    len             =   clasp_strlen_(help);
+    int const       availableWidth  =   layout->availableWidth;
+
+    if (layout->width < 1)
+    {
+        clasp_usage_render_help_fragment_(buffer, layout, help, len);
+    }
+    else
+    {
+        clasp_usage_help_param_t_ hp;
+
+        hp.buffer   =   buffer;
+        hp.layout   =   layout;
+
+        clasp_wrap_text_(
+            help
+        ,   len
+        ,   (availableWidth < 0) ? 0u : stlsoft_static_cast(size_t, availableWidth)
+        ,   clasp_usage_render_help_line_
+        ,   &hp
+        );
+    }
+}
+
+/* Renders the value-set - e.g. "|fast|slow|" - of an option, selecting
+ * braces that do not clash with any of its values, directly into the
+ * buffer.
+ */
+static
+void
+clasp_usage_render_valueSet_(
+    clasp_buffer_t_*                buffer
+,   clasp_char_t const*             valueSet
+)
+{
+    static const clasp_char_t bracePairs[][2] =
+    {
+        /* "{}",   "[]",   "<>",   "()",   "  " */
+        { '{', '}' },
+        { '[', ']' },
+        { '<', '>' },
+        { '(', ')' },
+        { ' ', ' ' },
+    };
+
+    clasp_char_t const          delim       =   valueSet[0];
+    clasp_char_t const* const   values      =   valueSet + 1;
+    size_t const                len         =   clasp_strlen_(values);
+    size_t                      braceIndex  =   0;
+    clasp_char_t const*         tok         =   values;
+
+    /* each value - including the (possibly empty) one following the last
+     * delimiter - causes the braces to be advanced for as long as it
+     * contains either of them
+     */
+    for (;;)
+    {
+        clasp_char_t const* end = tok;
+
+        for (; '\0' != *end && delim != *end; ++end)
+        {}
+
+        for (;;)
+        {
+            clasp_char_t const* p;
+
+            for (p = tok; end != p; ++p)
+            {
+                if (bracePairs[braceIndex][0] == *p ||
+                    bracePairs[braceIndex][1] == *p)
+                {
+                    break;
+                }
+            }
+
+            if (end == p ||
+                braceIndex + 1 == CLASP_NUM_ELEMENTS_(bracePairs))
+            {
+                break;
+            }
+
+            ++braceIndex;
+        }
+
+        if ('\0' == *end)
+        {
+            break;
+        }
+
+        tok = end + 1;
+    }
+
+    clasp_buffer_append_n_(buffer, bracePairs[braceIndex][0], 1);
+    clasp_buffer_append_(buffer, values, len);
+    clasp_buffer_append_n_(buffer, bracePairs[braceIndex][1], 1);
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+void
+clasp_usage_render_version_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_usageinfo_t const*            info
+,   clasp_buffer_t_*                    buffer
+)
+{
+    CLASP_ASSERT(NULL != info);
+    CLASP_ASSERT(NULL != buffer);
+
+    ((void)ctxt);
+
+    if (NULL != info->toolName)
+    {
+        clasp_buffer_append_s_(buffer, info->toolName);
+        clasp_buffer_append_s_(buffer, CLASP_LITERAL_(" version "));
+    }
+
+    clasp_buffer_append_int_(buffer, info->version.major);
+    clasp_buffer_append_n_(buffer, '.', 1);
+    clasp_buffer_append_int_(buffer, info->version.minor);
+
+    if (info->version.revision >= 0)
+    {
+        clasp_buffer_append_n_(buffer, '.', 1);
+        clasp_buffer_append_int_(buffer, info->version.revision);
+
+        if (info->version.build >= 0)
+        {
+            clasp_buffer_append_n_(buffer, '.', 1);
+            clasp_buffer_append_int_(buffer, info->version.build);
+        }
+    }
+
+    clasp_buffer_append_n_(buffer, '\n', 1);
+}
+
+void
+clasp_usage_render_header_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_usageinfo_t const*            info
+,   clasp_buffer_t_*                    buffer
+)
+{
+    CLASP_ASSERT(NULL != info);
+    CLASP_ASSERT(NULL != info->usage);
+    CLASP_ASSERT(NULL != buffer);
+
+    clasp_buffer_reserve_(
+        buffer
+    ,   clasp_strlen_or_0_(info->summary)
+    +   clasp_strlen_or_0_(info->toolName)
+    +   clasp_strlen_or_0_(info->copyright)
+    +   clasp_strlen_or_0_(info->description)
+    +   clasp_strlen_or_0_(info->usage)
+    +   64
+    );
+
+    if (NULL != info->summary &&
+        '\0' != info->summary[0])
+    {
+        clasp_buffer_append_s_(buffer, info->summary);
+        clasp_buffer_append_n_(buffer, '\n', 1);
+    }
+
+    clasp_usage_render_version_(ctxt, info, buffer);
+
+    if (NULL != info->copyright &&
+        '\0' != info->copyright[0])
+    {
+        clasp_buffer_append_s_(buffer, info->copyright);
+        clasp_buffer_append_n_(buffer, '\n', 1);
+    }
+    if (NULL != info->description &&
+        '\0' != info->description[0])
+    {
+        clasp_buffer_append_s_(buffer, info->description);
+        clasp_buffer_append_n_(buffer, '\n', 1);
+    }
+
+    clasp_buffer_append_n_(buffer, '\n', 1);
+    clasp_buffer_append_s_(buffer, info->usage);
+    clasp_buffer_append_n_(buffer, '\n', 2);
+}
+
+void
+clasp_usage_render_body_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_usageinfo_t const*            info
+,   clasp_specification_t const         specifications[]
+,   clasp_buffer_t_*                    buffer
+)
+{
+    const size_t            numSpecifications   =   clasp_countSpecifications(specifications);
+    size_t                  numFlags            =   (size_t)~0;
+    size_t                  numOptions          =   (size_t)~0;
+    clasp_usage_layout_t_   layout;
+    clasp_usage_model_t_    model;
+
+    unsigned const          flags               =   0;
+
+    CLASP_ASSERT(NULL != ctxt);
+    CLASP_ASSERT(NULL != info);
+    CLASP_ASSERT(NULL != buffer);
+
+    if (NULL != specifications)
+    {
+        clasp_count_flags_and_options_(specifications, &numFlags, &numOptions);
+    }
+    else
+    {
+        numFlags = 0;
+        numOptions = 0;
+    }
+
+    if (0 == numFlags)
+    {
+        if (0 == numOptions)
+        {
+            return;
+        }
+        else
+        {
+            clasp_buffer_append_s_(buffer, CLASP_LITERAL_("Options:\n"));
+        }
+    }
+    else
+    {
+        if (0 == numOptions)
+        {
+            clasp_buffer_append_s_(buffer, CLASP_LITERAL_("Flags:\n"));
+        }
+        else
+        {
+            clasp_buffer_append_s_(buffer, CLASP_LITERAL_("Flags and options:\n"));
+        }
+    }
+
+    clasp_buffer_append_n_(buffer, '\n', 1);
+
+    if (0 != clasp_usage_model_init_(ctxt, &model, specifications, numSpecifications, flags))
+    {
+        CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_FATAL, CLASP_LITERAL_("could not allocate memory for usage model"));
+
+        buffer->result = ENOMEM;
+
+        return;
+    }
+
+    clasp_usage_layout_init_(&layout, info);
+
+    /* reserve, in one go, for all the item strings, and the per-item
+     * decoration and layout
+     */
+    clasp_buffer_reserve_(
+        buffer
+    ,   model.cchTotal
+    +   numSpecifications * (2 * layout.prefixLen + layout.indentLen + 32 + (size_t)info->blanksBetweenItems)
+    );
+
+    { size_t i; for (i = 0; i != numSpecifications; ++i)
+    {
+        clasp_alias_t const* alias = specifications + i;
+
+        if (CLASP_ARGTYPE_TACIT_ == alias->type)
+        {
+            break;
+        }
+        else
+        if (CLASP_ARGTYPE_GAP_ == alias->type)
+        {
+            if (0 != i)
+            {
+                clasp_buffer_append_n_(buffer, '\n', 1);
+            }
+
+            if (NULL != alias->help &&
+                '\0' != alias->help[0])
+            {
+                clasp_usage_render_prefix_(buffer, &layout);
+                clasp_buffer_append_s_(buffer, alias->help);
+                clasp_buffer_append_n_(buffer, '\n', 2);
+            }
+
+            continue;
+        }
+        else
+        {
+            size_t const                primaryIndex    =   model.primaries[i];
+            size_t const                maLen           =   model.lengths[i];
+            clasp_char_t const* const   defValue        =   (NULL == alias->mappedArgument || '\0' == alias->mappedArgument[maLen]) ? NULL : (alias->mappedArgument + maLen + 1);
+            clasp_bool_t const          isOption        =   CLASP_ARGTYPE_OPTION == alias->type;
+
+            /* Each item is displayed only when it is the primary of its
+             * group (in the usage model), whereupon all the *other*
+             * members of the group are displayed as its aliases, followed
+             * by the primary option details
+             */
+
+            if (primaryIndex != i)
+            {
+                continue;
+            }
+
+            { size_t j; for (j = model.heads[i]; CLASP_USAGE_MODEL_NONE_ != j; j = model.nexts[j])
+            {
+                clasp_alias_t const* alias2 = specifications + j;
+
+                if (j != i)
+                {
+                    if (NULL != alias2->name &&
+                        '\0' != *alias2->name)
+                    {
+                        clasp_usage_render_prefix_(buffer, &layout);
+                        clasp_buffer_append_s_(buffer, alias2->name);
+
+                        if ('\0' != alias2->mappedArgument[model.lengths[j]])
+                        {
+                            clasp_buffer_append_s_(buffer, CLASP_LITERAL_(" => "));
+                            clasp_buffer_append_s_(buffer, alias2->mappedArgument);
+                        }
+                        else
+                        if (isOption)
+                        {
+                            clasp_buffer_append_s_(buffer, CLASP_LITERAL_(" <value>"));
+                        }
+
+                        clasp_buffer_append_n_(buffer, '\n', 1);
+                    }
+                }
+            }}
+
+            if (NULL != alias->name &&
+                '\0' != *alias->name)
+            {
+                size_t  lenShort    =   clasp_longOptionName_strlen_(alias->name, flags);
+                size_t  lenLong     =   maLen;
+
+                if (lenShort != lenLong ||
+                    0 != clasp_strncmp_(alias->name, alias->mappedArgument, lenLong))
+                {
+                    clasp_usage_render_prefix_(buffer, &layout);
+                    clasp_buffer_append_s_(buffer, alias->name);
+                    if (isOption)
+                    {
+                        clasp_buffer_append_s_(buffer, CLASP_LITERAL_(" <value>"));
+                    }
+                    clasp_buffer_append_n_(buffer, '\n', 1);
+                }
+            }
+
+            clasp_usage_render_prefix_(buffer, &layout);
+            clasp_buffer_append_(buffer, alias->mappedArgument, maLen);
+            if (isOption)
+            {
+                clasp_buffer_append_s_(buffer, CLASP_LITERAL_("=<value>"));
+            }
+
+            if (isOption &&
+                NULL != alias->valueSet &&
+                '\0' != *alias->valueSet)
+            {
+                size_t const    vsLen       =   clasp_strlen_(alias->valueSet);
+                clasp_bool_t    allowOthers =   vsLen > 1 && alias->valueSet[0] == alias->valueSet[vsLen - 1];
+
+                clasp_buffer_append_s_(buffer, CLASP_LITERAL_(" as one of "));
+                clasp_usage_render_valueSet_(buffer, alias->valueSet);
+
+                if (allowOthers)
+                {
+                    clasp_buffer_append_s_(buffer, CLASP_LITERAL_(" or any other value"));
+                }
+                if (NULL != defValue &&
+                    '\0' != *defValue)
+                {
+                    clasp_buffer_append_s_(buffer, CLASP_LITERAL_("; default value="));
+                    clasp_buffer_append_s_(buffer, defValue);
+                }
+            }
+
+            clasp_buffer_append_n_(buffer, '\n', 1);
+
+            if (NULL != alias->help)
+            {
+                clasp_usage_render_help_(buffer, &layout, alias->help);
+            }
+
+            if (info->blanksBetweenItems > 0)
+            {
+                clasp_buffer_append_n_(buffer, '\n', (size_t)info->blanksBetweenItems);
+            }
+        }
+    }}
+
+    clasp_usage_model_uninit_(ctxt, &model);
+}
+
+int
+clasp_usage_write_buffer_to_FILE_(
+    clasp_diagnostic_context_t const*   ctxt
+,   clasp_buffer_t_ const*              buffer
+,   FILE*                               stm
+)
+{
+    CLASP_ASSERT(NULL != buffer);
+    CLASP_ASSERT(NULL != stm);
+
+    if (0 != buffer->result)
+    {
+        CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_FATAL, CLASP_LITERAL_("could not allocate memory to render usage"));
+
+        return buffer->result;
+    }
+
+    if (0 == buffer->len)
+    {
+        return 0;
+    }
+
+#ifdef CLASP_USE_WIDE_STRINGS
+
+    if (fputws(buffer->ptr, stm) < 0)
+#else /* ? CLASP_USE_WIDE_STRINGS */
+
+    if (buffer->len != fwrite(buffer->ptr, sizeof(clasp_char_t), buffer->len, stm))
+#endif /* CLASP_USE_WIDE_STRINGS */
+    {
+        return errno;
+    }
+
+    return 0;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
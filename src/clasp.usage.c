@@ -4,7 +4,7 @@
  * Purpose: CLASP usage facilities.
  *
  * Created: 4th June 2008
- * Updated: 11th March 2025
+ * Updated: 19th October 2026
  *
  * Home:    https://github.com/synesissoftware/CLASP/
  *
@@ -794,6 +794,53 @@ clasp_invoke_usage_new_(
     }
 }
 
+static
+void
+clasp_showHeaderToBuffer_(
+    clasp_arguments_t const*    args
+,   clasp_usageinfo_t const*    usageinfo
+,   clasp_alias_t const*        specifications
+)
+{
+    ((void)specifications);
+
+    clasp_usage_render_header_(clasp_diagnostic_context_from_args_(args), usageinfo, (clasp_buffer_t_*)usageinfo->param);
+}
+
+static
+void
+clasp_showBodyToBuffer_(
+    clasp_arguments_t const*    args
+,   clasp_usageinfo_t const*    usageinfo
+,   clasp_alias_t const*        specifications
+)
+{
+    clasp_usage_render_body_(clasp_diagnostic_context_from_args_(args), usageinfo, specifications, (clasp_buffer_t_*)usageinfo->param);
+}
+
+int
+clasp_usage_render_usage_(
+    clasp_arguments_t const*    args
+,   clasp_usageinfo_t const*    usageinfo
+,   clasp_alias_t const*        specifications
+,   clasp_buffer_t_*            buffer
+)
+{
+    clasp_usageinfo_t usageinfo_ = *usageinfo;
+
+    usageinfo_.param = buffer;
+
+    clasp_invoke_usage_new_(
+        clasp_showHeaderToBuffer_
+    ,   clasp_showBodyToBuffer_
+    ,   args
+    ,   &usageinfo_
+    ,   specifications
+    );
+
+    return buffer->result;
+}
+
 
 /* /////////////////////////////////////////////////////////////////////////
  * API functions
@@ -842,6 +889,28 @@ clasp_showUsage(
     usageinfo.assumedTabWidth       =   tabSize;
     usageinfo.blanksBetweenItems    =   blanksBetweenItems;
 
+    if (clasp_showHeaderByFILE == pfnHeader &&
+        clasp_showBodyByFILE == pfnBody)
+    {
+        /* With the stock FILE callbacks, header and body are rendered
+         * together, and written to the stream in a single write
+         */
+
+        clasp_diagnostic_context_t const* const ctxt = clasp_diagnostic_context_from_args_(args);
+        clasp_buffer_t_                         buffer;
+        int                                     r;
+
+        clasp_buffer_init_(&buffer, ctxt, CLASP_ALLOC_SITE_USAGE_BUFFER);
+
+        clasp_usage_render_usage_(args, &usageinfo, specifications, &buffer);
+
+        r = clasp_usage_write_buffer_to_FILE_(ctxt, &buffer, (FILE*)param);
+
+        clasp_buffer_uninit_(&buffer);
+
+        return r;
+    }
+
     return clasp_invoke_usage_new_(
         pfnHeader
     ,   pfnBody
@@ -851,6 +920,91 @@ clasp_showUsage(
     );
 }
 
+CLASP_CALL(int)
+clasp_showUsageToBuffer(
+    clasp_arguments_t const*    args
+,   clasp_alias_t const*        specifications
+,   clasp_char_t const*         toolName
+,   clasp_char_t const*         summary
+,   clasp_char_t const*         copyright
+,   clasp_char_t const*         description
+,   clasp_char_t const*         usage
+,   int                         major
+,   int                         minor
+,   int                         revision
+,   int                         flags
+,   int                         consoleWidth
+,   int                         tabSize
+,   int                         blanksBetweenItems
+,   clasp_char_t**              pbuffer
+,   size_t*                     pcchBuffer
+)
+{
+    clasp_usageinfo_t   usageinfo;
+    clasp_buffer_t_     buffer;
+    int                 r;
+    size_t              dummy_;
+
+    CLASP_ASSERT(NULL != args);
+    CLASP_ASSERT(NULL != pbuffer);
+
+    if (NULL == pcchBuffer)
+    {
+        pcchBuffer = &dummy_;
+    }
+
+    *pbuffer    =   NULL;
+    *pcchBuffer =   0;
+
+    usageinfo.version.major         =   major;
+    usageinfo.version.minor         =   minor;
+    usageinfo.version.revision      =   revision;
+    usageinfo.version.build         =   0;
+    usageinfo.toolName              =   toolName;
+    usageinfo.summary               =   summary;
+    usageinfo.copyright             =   copyright;
+    usageinfo.description           =   description;
+    usageinfo.usage                 =   usage;
+    usageinfo.flags                 =   flags;
+    usageinfo.param                 =   NULL;
+    usageinfo.width                 =   consoleWidth;
+    usageinfo.assumedTabWidth       =   tabSize;
+    usageinfo.blanksBetweenItems    =   blanksBetweenItems;
+
+    clasp_buffer_init_(&buffer, clasp_diagnostic_context_from_args_(args), CLASP_ALLOC_SITE_USAGE_BUFFER);
+
+    /* ensure that the result is non-NULL, even if nothing is rendered */
+    clasp_buffer_reserve_(&buffer, 0);
+
+    r = clasp_usage_render_usage_(args, &usageinfo, specifications, &buffer);
+
+    if (0 != r)
+    {
+        clasp_buffer_uninit_(&buffer);
+    }
+    else
+    {
+        *pbuffer    =   buffer.ptr;
+        *pcchBuffer =   buffer.len;
+    }
+
+    return r;
+}
+
+CLASP_CALL(void)
+clasp_releaseUsageBuffer(
+    clasp_arguments_t const*    args
+,   clasp_char_t*               buffer
+)
+{
+    CLASP_ASSERT(NULL != args);
+
+    if (NULL != buffer)
+    {
+        clasp_free_(clasp_diagnostic_context_from_args_(args), CLASP_ALLOC_SITE_USAGE_BUFFER, buffer);
+    }
+}
+
 CLASP_CALL(int)
 clasp_show_usage(
     clasp_diagnostic_context_t const*   ctxt
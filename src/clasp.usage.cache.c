@@ -0,0 +1,719 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/clasp.usage.cache.c
+ *
+ * Purpose: CLASP usage cache facilities.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * Home:    https://github.com/synesissoftware/CLASP/
+ *
+ * Copyright (c) 2026, Matthew Wilson
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer;
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution;
+ * - Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * feature control
+ */
+
+#if !defined(_POSIX_C_SOURCE) && \
+    (   defined(unix) || \
+        defined(UNIX) || \
+        defined(__unix) || \
+        defined(__unix__))
+
+# define _POSIX_C_SOURCE                                    200809L
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include "clasp.internal.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(CLASP_PLATFORM_IS_UNIX) && \
+    !defined(CLASP_PLATFORM_IS_UNIX_EMULATED_ON_WINDOWS)
+
+# define CLASP_USAGE_CACHE_USE_MMAP_
+
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#elif defined(CLASP_PLATFORM_IS_WINDOWS)
+
+# include <process.h>
+# include <windows.h>
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+#define CLASP_USAGE_CACHE_MAGIC_                            "CLASPUC1"
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+typedef struct clasp_usage_cache_entry_t_ clasp_usage_cache_entry_t_;
+
+struct clasp_usage_cache_entry_t_
+{
+    clasp_usage_cache_entry_t_* next;
+    size_t                      fingerprint[2];
+    clasp_char_t const*         text;
+    size_t                      cchText;
+    clasp_char_t*               ownedText;  /* non-NULL if rendered */
+    void*                       mapping;    /* non-NULL if mapped from file */
+    size_t                      cbMapping;
+};
+
+struct clasp_usage_cache_t
+{
+    clasp_diagnostic_context_t  ctxt;
+    char*                       path;       /* NULL if not persisted */
+    clasp_usage_cache_entry_t_* entries;
+};
+
+/* The persisted file comprises this header, followed by cch + 1 characters
+ * of text (including the nul-terminator)
+ */
+typedef struct clasp_usage_cache_file_header_t_ clasp_usage_cache_file_header_t_;
+
+struct clasp_usage_cache_file_header_t_
+{
+    char        magic[8];
+    unsigned    version;
+    unsigned    cbChar;
+    size_t      fingerprint[2];
+    size_t      cch;
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * fingerprinting
+ *
+ * The fingerprint covers every field that can affect the rendered text.
+ */
+
+static
+void
+clasp_usage_fingerprint_(
+    size_t                      fingerprint[2]
+,   clasp_arguments_t const*    args
+,   clasp_usageinfo_t const*    info
+,   clasp_specification_t const specifications[]
+)
+{
+    clasp_fingerprint_init_(fingerprint);
+
+    clasp_fingerprint_int_(fingerprint, info->version.major);
+    clasp_fingerprint_int_(fingerprint, info->version.minor);
+    clasp_fingerprint_int_(fingerprint, info->version.revision);
+    clasp_fingerprint_int_(fingerprint, info->version.build);
+    clasp_fingerprint_string_(fingerprint, info->toolName);
+    clasp_fingerprint_string_(fingerprint, info->summary);
+    clasp_fingerprint_string_(fingerprint, info->copyright);
+    clasp_fingerprint_string_(fingerprint, info->description);
+    clasp_fingerprint_string_(fingerprint, info->usage);
+    clasp_fingerprint_int_(fingerprint, info->flags);
+    clasp_fingerprint_int_(fingerprint, info->width);
+    clasp_fingerprint_int_(fingerprint, info->assumedTabWidth);
+    clasp_fingerprint_int_(fingerprint, info->blanksBetweenItems);
+
+    /* the program name may be substituted into the tool-name and usage */
+    clasp_fingerprint_bytes_(fingerprint, &args->programName.len, sizeof(args->programName.len));
+    clasp_fingerprint_bytes_(fingerprint, args->programName.ptr, sizeof(clasp_char_t) * args->programName.len);
+
+    if (NULL != specifications)
+    {
+        clasp_specification_t const* spec;
+
+        for (spec = specifications; CLASP_ARGTYPE_INVALID != spec->type; ++spec)
+        {
+            clasp_fingerprint_int_(fingerprint, spec->type);
+            clasp_fingerprint_string_(fingerprint, spec->name);
+            clasp_fingerprint_string_(fingerprint, spec->mappedArgument);
+            clasp_fingerprint_string_(fingerprint, spec->help);
+            clasp_fingerprint_string_(fingerprint, spec->valueSet);
+            clasp_fingerprint_int_(fingerprint, spec->bitFlags);
+        }
+    }
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * persistence
+ */
+
+static
+char*
+clasp_usage_cache_resolve_path_(
+    clasp_diagnostic_context_t const*   ctxt
+,   char const*                         cacheFile
+)
+{
+    char const* dir     =   NULL;
+    char const* subdir  =   "";
+
+    if (NULL != strchr(cacheFile, '/')
+#ifdef _WIN32
+        || NULL != strchr(cacheFile, '\\')
+#endif
+        )
+    {
+        ;
+    }
+    else
+    if (NULL != (dir = getenv("XDG_CACHE_HOME")) &&
+        '\0' != dir[0])
+    {
+        ;
+    }
+    else
+    if (NULL != (dir = getenv("HOME")) &&
+        '\0' != dir[0])
+    {
+        subdir = "/.cache";
+    }
+    else
+    {
+        return NULL;
+    }
+
+    {
+        size_t const    cchDir      =   (NULL == dir) ? 0u : strlen(dir);
+        size_t const    cchSubdir   =   strlen(subdir);
+        size_t const    cchFile     =   strlen(cacheFile);
+        char* const     path        =   stlsoft_static_cast(char*, clasp_malloc_(ctxt, CLASP_ALLOC_SITE_USAGE_CACHE, cchDir + cchSubdir + 1 + cchFile + 1));
+
+        if (NULL != path)
+        {
+            char* p = path;
+
+            if (NULL != dir)
+            {
+                memcpy(p, dir, cchDir);
+                p += cchDir;
+                memcpy(p, subdir, cchSubdir);
+                p += cchSubdir;
+                *p++ = '/';
+            }
+            memcpy(p, cacheFile, cchFile + 1);
+        }
+
+        return path;
+    }
+}
+
+static
+clasp_bool_t
+clasp_usage_cache_header_matches_(
+    clasp_usage_cache_file_header_t_ const* header
+,   size_t                                  cbFile
+,   size_t const                            fingerprint[2]
+)
+{
+    return  0 == memcmp(header->magic, CLASP_USAGE_CACHE_MAGIC_, sizeof(header->magic)) &&
+            CLASP_VER == header->version &&
+            sizeof(clasp_char_t) == header->cbChar &&
+            fingerprint[0] == header->fingerprint[0] &&
+            fingerprint[1] == header->fingerprint[1] &&
+            header->cch < cbFile / sizeof(clasp_char_t) &&
+            sizeof(*header) + sizeof(clasp_char_t) * (header->cch + 1) == cbFile;
+}
+
+/* Attempts to load the persisted text, returning an entry for it if it
+ * matches the given fingerprint
+ */
+static
+clasp_usage_cache_entry_t_*
+clasp_usage_cache_load_(
+    clasp_usage_cache_t*    cache
+,   size_t const            fingerprint[2]
+)
+{
+    clasp_usage_cache_entry_t_* entry = NULL;
+
+#ifdef CLASP_USAGE_CACHE_USE_MMAP_
+
+    int const fd = open(cache->path, O_RDONLY);
+
+    if (fd >= 0)
+    {
+        struct stat st;
+
+        if (0 == fstat(fd, &st) &&
+            stlsoft_static_cast(size_t, st.st_size) > sizeof(clasp_usage_cache_file_header_t_))
+        {
+            size_t const    cbFile  =   stlsoft_static_cast(size_t, st.st_size);
+            void* const     pv      =   mmap(NULL, cbFile, PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if (MAP_FAILED != pv)
+            {
+                clasp_usage_cache_file_header_t_ const* const header = stlsoft_static_cast(clasp_usage_cache_file_header_t_ const*, pv);
+
+                if (clasp_usage_cache_header_matches_(header, cbFile, fingerprint) &&
+                    NULL != (entry = stlsoft_static_cast(clasp_usage_cache_entry_t_*, clasp_malloc_(&cache->ctxt, CLASP_ALLOC_SITE_USAGE_CACHE, sizeof(clasp_usage_cache_entry_t_)))))
+                {
+                    entry->text         =   stlsoft_static_cast(clasp_char_t const*, stlsoft_static_cast(void const*, header + 1));
+                    entry->cchText      =   header->cch;
+                    entry->ownedText    =   NULL;
+                    entry->mapping      =   pv;
+                    entry->cbMapping    =   cbFile;
+                }
+                else
+                {
+                    munmap(pv, cbFile);
+                }
+            }
+        }
+
+        close(fd);
+    }
+#else /* ? CLASP_USAGE_CACHE_USE_MMAP_ */
+
+    FILE* const stm = fopen(cache->path, "rb");
+
+    if (NULL != stm)
+    {
+        clasp_usage_cache_file_header_t_ header;
+
+        if (1 == fread(&header, sizeof(header), 1, stm))
+        {
+            size_t const cbFile = sizeof(header) + sizeof(clasp_char_t) * (header.cch + 1);
+
+            if (clasp_usage_cache_header_matches_(&header, cbFile, fingerprint))
+            {
+                clasp_char_t* const text = stlsoft_static_cast(clasp_char_t*, clasp_malloc_(&cache->ctxt, CLASP_ALLOC_SITE_USAGE_CACHE, sizeof(clasp_char_t) * (header.cch + 1)));
+
+                if (NULL != text)
+                {
+                    if (header.cch + 1 == fread(text, sizeof(clasp_char_t), header.cch + 1, stm) &&
+                        '\0' == text[header.cch] &&
+                        NULL != (entry = stlsoft_static_cast(clasp_usage_cache_entry_t_*, clasp_malloc_(&cache->ctxt, CLASP_ALLOC_SITE_USAGE_CACHE, sizeof(clasp_usage_cache_entry_t_)))))
+                    {
+                        entry->text         =   text;
+                        entry->cchText      =   header.cch;
+                        entry->ownedText    =   text;
+                        entry->mapping      =   NULL;
+                        entry->cbMapping    =   0;
+                    }
+                    else
+                    {
+                        clasp_free_(&cache->ctxt, CLASP_ALLOC_SITE_USAGE_CACHE, text);
+                    }
+                }
+            }
+        }
+
+        fclose(stm);
+    }
+#endif /* CLASP_USAGE_CACHE_USE_MMAP_ */
+
+    if (NULL != entry)
+    {
+        entry->fingerprint[0]   =   fingerprint[0];
+        entry->fingerprint[1]   =   fingerprint[1];
+    }
+
+    return entry;
+}
+
+/* Creates, and opens for writing, a temporary file alongside the cache
+ * file, whose name is unique to the process - via mkstemp() on UNIX, or
+ * by the process identifier on Windows - so that concurrent writers never
+ * share a temporary file. The name, which has room for the suffix, is
+ * written into tmpPath. Elsewhere, where no such name can be formed,
+ * returns NULL, and the cache is not persisted.
+ */
+static
+FILE*
+clasp_usage_cache_open_temporary_(
+    char const* path
+,   size_t      cchPath
+,   char*       tmpPath
+)
+{
+    memcpy(tmpPath, path, cchPath);
+
+#if defined(CLASP_USAGE_CACHE_USE_MMAP_)
+
+    memcpy(tmpPath + cchPath, ".XXXXXX", 8);
+
+    {
+        int const fd = mkstemp(tmpPath);
+
+        if (fd < 0)
+        {
+            return NULL;
+        }
+        else
+        {
+            FILE* const stm = fdopen(fd, "wb");
+
+            if (NULL == stm)
+            {
+                close(fd);
+                remove(tmpPath);
+            }
+
+            return stm;
+        }
+    }
+#elif defined(CLASP_PLATFORM_IS_WINDOWS)
+
+    sprintf(tmpPath + cchPath, ".%lu.tmp", stlsoft_static_cast(unsigned long, _getpid()));
+
+    return fopen(tmpPath, "wb");
+#else /* ? platform */
+
+    ((void)path);
+    ((void)cchPath);
+    ((void)tmpPath);
+
+    return NULL;
+#endif /* platform */
+}
+
+/* Replaces the cache file with the temporary file, returning 0 on
+ * success. On Windows, rename() fails if the target exists, and so
+ * MoveFileExA() is used instead
+ */
+static
+int
+clasp_usage_cache_replace_(
+    char const* tmpPath
+,   char const* path
+)
+{
+#if defined(CLASP_PLATFORM_IS_WINDOWS) && \
+    !defined(CLASP_USAGE_CACHE_USE_MMAP_)
+
+    return MoveFileExA(tmpPath, path, MOVEFILE_REPLACE_EXISTING) ? 0 : -1;
+#else /* ? CLASP_PLATFORM_IS_WINDOWS */
+
+    return rename(tmpPath, path);
+#endif /* CLASP_PLATFORM_IS_WINDOWS */
+}
+
+/* Persists the entry, via a (process-unique) temporary file that is then
+ * renamed, so that concurrent readers never see a partially written file
+ */
+static
+void
+clasp_usage_cache_store_(
+    clasp_usage_cache_t*                cache
+,   clasp_usage_cache_entry_t_ const*   entry
+)
+{
+    size_t const    cchPath =   strlen(cache->path);
+    char* const     tmpPath =   stlsoft_static_cast(char*, clasp_malloc_(&cache->ctxt, CLASP_ALLOC_SITE_USAGE_CACHE, cchPath + 32));
+
+    if (NULL != tmpPath)
+    {
+        FILE* const stm = clasp_usage_cache_open_temporary_(cache->path, cchPath, tmpPath);
+
+        if (NULL != stm)
+        {
+            clasp_usage_cache_file_header_t_    header;
+            int                                 ok;
+
+            memset(&header, 0, sizeof(header));
+            memcpy(header.magic, CLASP_USAGE_CACHE_MAGIC_, sizeof(header.magic));
+            header.version          =   CLASP_VER;
+            header.cbChar           =   sizeof(clasp_char_t);
+            header.fingerprint[0]   =   entry->fingerprint[0];
+            header.fingerprint[1]   =   entry->fingerprint[1];
+            header.cch              =   entry->cchText;
+
+            ok  =   1 == fwrite(&header, sizeof(header), 1, stm) &&
+                    entry->cchText + 1 == fwrite(entry->text, sizeof(clasp_char_t), entry->cchText + 1, stm);
+            ok  =   (0 == fclose(stm)) && ok;
+
+            if (!ok ||
+                0 != clasp_usage_cache_replace_(tmpPath, cache->path))
+            {
+                CLASP_LOG_PRINTF(&cache->ctxt, CLASP_SEVIX_DEBUG, CLASP_LITERAL_("could not persist usage cache"));
+
+                remove(tmpPath);
+            }
+        }
+
+        clasp_free_(&cache->ctxt, CLASP_ALLOC_SITE_USAGE_CACHE, tmpPath);
+    }
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+CLASP_CALL(int)
+clasp_createUsageCache(
+    clasp_diagnostic_context_t const*   ctxt
+,   char const*                         cacheFile
+,   clasp_usage_cache_t**               pcache
+)
+{
+    clasp_diagnostic_context_t  ctxt_;
+    clasp_usage_cache_t*        cache;
+    int                         r;
+
+    CLASP_ASSERT(NULL != pcache);
+
+    *pcache = NULL;
+
+    ctxt = clasp_verify_context_(ctxt, &ctxt_, &r);
+    if (NULL == ctxt)
+    {
+        return r;
+    }
+
+    cache = stlsoft_static_cast(clasp_usage_cache_t*, clasp_malloc_(ctxt, CLASP_ALLOC_SITE_USAGE_CACHE, sizeof(clasp_usage_cache_t)));
+
+    if (NULL == cache)
+    {
+        CLASP_LOG_PRINTF(ctxt, CLASP_SEVIX_FATAL, CLASP_LITERAL_("could not allocate memory for usage cache"));
+
+        return ENOMEM;
+    }
+
+    cache->ctxt     =   *ctxt;
+    cache->path     =   NULL;
+    cache->entries  =   NULL;
+
+    if (NULL != cacheFile &&
+        '\0' != cacheFile[0])
+    {
+        /* failure to resolve a path simply means no persistence */
+        cache->path = clasp_usage_cache_resolve_path_(&cache->ctxt, cacheFile);
+    }
+
+    *pcache = cache;
+
+    return 0;
+}
+
+CLASP_CALL(void)
+clasp_destroyUsageCache(
+    clasp_usage_cache_t*    cache
+)
+{
+    if (NULL != cache)
+    {
+        clasp_diagnostic_context_t const    ctxt    =   cache->ctxt;
+        clasp_usage_cache_entry_t_*         entry   =   cache->entries;
+
+        for (; NULL != entry; )
+        {
+            clasp_usage_cache_entry_t_* const next = entry->next;
+
+#ifdef CLASP_USAGE_CACHE_USE_MMAP_
+
+            if (NULL != entry->mapping)
+            {
+                munmap(entry->mapping, entry->cbMapping);
+            }
+#endif /* CLASP_USAGE_CACHE_USE_MMAP_ */
+
+            if (NULL != entry->ownedText)
+            {
+                clasp_free_(&ctxt, CLASP_ALLOC_SITE_USAGE_CACHE, entry->ownedText);
+            }
+
+            clasp_free_(&ctxt, CLASP_ALLOC_SITE_USAGE_CACHE, entry);
+
+            entry = next;
+        }
+
+        if (NULL != cache->path)
+        {
+            clasp_free_(&ctxt, CLASP_ALLOC_SITE_USAGE_CACHE, cache->path);
+        }
+
+        clasp_free_(&ctxt, CLASP_ALLOC_SITE_USAGE_CACHE, cache);
+    }
+}
+
+CLASP_CALL(int)
+clasp_showUsageCached(
+    clasp_usage_cache_t*        cache
+,   clasp_arguments_t const*    args
+,   clasp_alias_t const*        specifications
+,   clasp_char_t const*         toolName
+,   clasp_char_t const*         summary
+,   clasp_char_t const*         copyright
+,   clasp_char_t const*         description
+,   clasp_char_t const*         usage
+,   int                         major
+,   int                         minor
+,   int                         revision
+,   void*                       stm
+,   int                         flags
+,   int                         consoleWidth
+,   int                         tabSize
+,   int                         blanksBetweenItems
+,   clasp_char_t const**        ptext
+,   size_t*                     pcchText
+)
+{
+    clasp_usageinfo_t           usageinfo;
+    size_t                      fingerprint[2];
+    clasp_usage_cache_entry_t_* entry;
+
+    CLASP_ASSERT(NULL != cache);
+    CLASP_ASSERT(NULL != args);
+
+    if (NULL == specifications)
+    {
+        specifications = clasp_getSpecifications(args);
+    }
+
+    usageinfo.version.major         =   major;
+    usageinfo.version.minor         =   minor;
+    usageinfo.version.revision      =   revision;
+    usageinfo.version.build         =   0;
+    usageinfo.toolName              =   toolName;
+    usageinfo.summary               =   summary;
+    usageinfo.copyright             =   copyright;
+    usageinfo.description           =   description;
+    usageinfo.usage                 =   usage;
+    usageinfo.flags                 =   flags;
+    usageinfo.param                 =   NULL;
+    usageinfo.width                 =   consoleWidth;
+    usageinfo.assumedTabWidth       =   tabSize;
+    usageinfo.blanksBetweenItems    =   blanksBetweenItems;
+
+    clasp_usage_fingerprint_(fingerprint, args, &usageinfo, specifications);
+
+    /* 1. search in memory */
+
+    for (entry = cache->entries; NULL != entry; entry = entry->next)
+    {
+        if (fingerprint[0] == entry->fingerprint[0] &&
+            fingerprint[1] == entry->fingerprint[1])
+        {
+            break;
+        }
+    }
+
+    /* 2. search persisted file */
+
+    if (NULL == entry &&
+        NULL != cache->path &&
+        NULL != (entry = clasp_usage_cache_load_(cache, fingerprint)))
+    {
+        CLASP_LOG_PRINTF(&cache->ctxt, CLASP_SEVIX_DEBUG, CLASP_LITERAL_("usage loaded from cache file"));
+
+        entry->next     =   cache->entries;
+        cache->entries  =   entry;
+    }
+
+    /* 3. render, and add to cache */
+
+    if (NULL == entry)
+    {
+        clasp_buffer_t_ buffer;
+        int             r;
+
+        clasp_buffer_init_(&buffer, &cache->ctxt, CLASP_ALLOC_SITE_USAGE_CACHE); /* the text is owned by the entry */
+        clasp_buffer_reserve_(&buffer, 0); /* ensures non-NULL text */
+
+        r = clasp_usage_render_usage_(args, &usageinfo, specifications, &buffer);
+
+        if (0 == r &&
+            NULL == (entry = stlsoft_static_cast(clasp_usage_cache_entry_t_*, clasp_malloc_(&cache->ctxt, CLASP_ALLOC_SITE_USAGE_CACHE, sizeof(clasp_usage_cache_entry_t_)))))
+        {
+            r = ENOMEM;
+        }
+
+        if (0 != r)
+        {
+            CLASP_LOG_PRINTF(&cache->ctxt, CLASP_SEVIX_FATAL, CLASP_LITERAL_("could not allocate memory to render usage"));
+
+            clasp_buffer_uninit_(&buffer);
+
+            return r;
+        }
+
+        entry->fingerprint[0]   =   fingerprint[0];
+        entry->fingerprint[1]   =   fingerprint[1];
+        entry->text             =   buffer.ptr;
+        entry->cchText          =   buffer.len;
+        entry->ownedText        =   buffer.ptr;
+        entry->mapping          =   NULL;
+        entry->cbMapping        =   0;
+
+        entry->next             =   cache->entries;
+        cache->entries          =   entry;
+
+        if (NULL != cache->path)
+        {
+            clasp_usage_cache_store_(cache, entry);
+        }
+    }
+
+    if (NULL != ptext)
+    {
+        *ptext = entry->text;
+    }
+    if (NULL != pcchText)
+    {
+        *pcchText = entry->cchText;
+    }
+
+    if (NULL != stm)
+    {
+        clasp_buffer_t_ view;
+
+        clasp_buffer_init_(&view, &cache->ctxt, CLASP_ALLOC_SITE_USAGE_BUFFER);
+
+        view.ptr    =   stlsoft_const_cast(clasp_char_t*, entry->text);
+        view.len    =   entry->cchText;
+
+        return clasp_usage_write_buffer_to_FILE_(&cache->ctxt, &view, stlsoft_static_cast(FILE*, stm));
+    }
+
+    return 0;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
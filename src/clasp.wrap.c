@@ -0,0 +1,472 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/clasp.wrap.c
+ *
+ * Purpose: CLASP text wrapping facilities.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * Home:    https://github.com/synesissoftware/CLASP/
+ *
+ * Copyright (c) 2026, Matthew Wilson
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer;
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution;
+ * - Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include "clasp.internal.h"
+
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * display width
+ *
+ * Code-points below U+0300 are all one column wide. Above that, the
+ * (sorted) tables of zero-width (combining, and formatting) and of
+ * double-width (East Asian wide and fullwidth) ranges are binary-searched.
+ */
+
+typedef struct clasp_wrap_range_t_ clasp_wrap_range_t_;
+
+struct clasp_wrap_range_t_
+{
+    unsigned long   first;
+    unsigned long   last;
+};
+
+static clasp_wrap_range_t_ const clasp_wrap_zeroWidthRanges_[] =
+{
+    { 0x000300, 0x00036F },
+    { 0x000483, 0x000489 },
+    { 0x000591, 0x0005BD },
+    { 0x0005BF, 0x0005BF },
+    { 0x0005C1, 0x0005C2 },
+    { 0x0005C4, 0x0005C5 },
+    { 0x0005C7, 0x0005C7 },
+    { 0x000610, 0x00061A },
+    { 0x00064B, 0x00065F },
+    { 0x000670, 0x000670 },
+    { 0x0006D6, 0x0006DC },
+    { 0x0006DF, 0x0006E4 },
+    { 0x0006E7, 0x0006E8 },
+    { 0x0006EA, 0x0006ED },
+    { 0x000900, 0x000902 },
+    { 0x00093A, 0x00093A },
+    { 0x00093C, 0x00093C },
+    { 0x000941, 0x000948 },
+    { 0x00094D, 0x00094D },
+    { 0x000951, 0x000957 },
+    { 0x000962, 0x000963 },
+    { 0x000E31, 0x000E31 },
+    { 0x000E34, 0x000E3A },
+    { 0x000E47, 0x000E4E },
+    { 0x001AB0, 0x001AFF },
+    { 0x001DC0, 0x001DFF },
+    { 0x00200B, 0x00200F },
+    { 0x00202A, 0x00202E },
+    { 0x002060, 0x002064 },
+    { 0x0020D0, 0x0020FF },
+    { 0x00302A, 0x00302D },
+    { 0x003099, 0x00309A },
+    { 0x00FE00, 0x00FE0F },
+    { 0x00FE20, 0x00FE2F },
+    { 0x00FEFF, 0x00FEFF },
+    { 0x0E0001, 0x0E0001 },
+    { 0x0E0020, 0x0E007F },
+    { 0x0E0100, 0x0E01EF },
+};
+
+static clasp_wrap_range_t_ const clasp_wrap_doubleWidthRanges_[] =
+{
+    { 0x001100, 0x00115F },
+    { 0x002329, 0x00232A },
+    { 0x002E80, 0x003029 },
+    { 0x00302E, 0x00303E },
+    { 0x003041, 0x003098 },
+    { 0x00309B, 0x00A4CF },
+    { 0x00A960, 0x00A97F },
+    { 0x00AC00, 0x00D7A3 },
+    { 0x00F900, 0x00FAFF },
+    { 0x00FE10, 0x00FE19 },
+    { 0x00FE30, 0x00FE6F },
+    { 0x00FF00, 0x00FF60 },
+    { 0x00FFE0, 0x00FFE6 },
+    { 0x01F300, 0x01F64F },
+    { 0x01F900, 0x01F9FF },
+    { 0x020000, 0x02FFFD },
+    { 0x030000, 0x03FFFD },
+};
+
+static
+int
+clasp_wrap_range_contains_(
+    clasp_wrap_range_t_ const*  ranges
+,   size_t                      numRanges
+,   unsigned long               cp
+)
+{
+    size_t lo = 0;
+    size_t hi = numRanges;
+
+    if (cp < ranges[0].first ||
+        cp > ranges[numRanges - 1].last)
+    {
+        return 0;
+    }
+
+    for (; lo != hi; )
+    {
+        size_t const mid = lo + (hi - lo) / 2;
+
+        if (cp < ranges[mid].first)
+        {
+            hi = mid;
+        }
+        else
+        if (cp > ranges[mid].last)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static
+size_t
+clasp_wrap_codepoint_width_(
+    unsigned long   cp
+)
+{
+    /* as isprint(): control characters - other than the whitespace at
+     * which lines are broken - and DEL occupy no column
+     */
+    if (cp < 0x20)
+    {
+        switch (cp)
+        {
+        case '\t':
+        case '\n':
+        case '\v':
+        case '\f':
+        case '\r':
+
+            return 1;
+        default:
+
+            return 0;
+        }
+    }
+
+    if (cp >= 0x7F && cp < 0xA0)
+    {
+        return 0;
+    }
+
+    if (cp < 0x0300)
+    {
+        return 1;
+    }
+
+    if (clasp_wrap_range_contains_(clasp_wrap_zeroWidthRanges_, CLASP_NUM_ELEMENTS_(clasp_wrap_zeroWidthRanges_), cp))
+    {
+        return 0;
+    }
+
+    if (clasp_wrap_range_contains_(clasp_wrap_doubleWidthRanges_, CLASP_NUM_ELEMENTS_(clasp_wrap_doubleWidthRanges_), cp))
+    {
+        return 2;
+    }
+
+    return 1;
+}
+
+/* Measures the character sequence at p, returning its length (in
+ * characters) and storing its display width in *width. Malformed UTF-8 is
+ * measured a byte at a time, each of one column.
+ */
+static
+size_t
+clasp_wrap_measure_(
+    clasp_char_t const* p
+,   clasp_char_t const* end
+,   size_t*             width
+)
+{
+#ifdef CLASP_USE_WIDE_STRINGS
+
+    unsigned long   cp  =   stlsoft_static_cast(unsigned long, *p);
+    size_t          n   =   1;
+
+    if (2 == sizeof(clasp_char_t) &&
+        cp >= 0xD800 &&
+        cp <= 0xDBFF &&
+        end - p > 1 &&
+        stlsoft_static_cast(unsigned long, p[1]) >= 0xDC00 &&
+        stlsoft_static_cast(unsigned long, p[1]) <= 0xDFFF)
+    {
+        cp  =   0x10000 + ((cp - 0xD800) << 10) + (stlsoft_static_cast(unsigned long, p[1]) - 0xDC00);
+        n   =   2;
+    }
+
+    *width = clasp_wrap_codepoint_width_(cp);
+
+    return n;
+#else /* ? CLASP_USE_WIDE_STRINGS */
+
+    unsigned char const b0  =   stlsoft_static_cast(unsigned char, *p);
+    unsigned long       cp;
+    size_t              n;
+
+    if (b0 < 0x80)
+    {
+        *width = clasp_wrap_codepoint_width_(b0);
+
+        return 1;
+    }
+    else
+    if (b0 >= 0xC2 && b0 <= 0xDF)
+    {
+        cp  =   b0 & 0x1F;
+        n   =   2;
+    }
+    else
+    if (b0 >= 0xE0 && b0 <= 0xEF)
+    {
+        cp  =   b0 & 0x0F;
+        n   =   3;
+    }
+    else
+    if (b0 >= 0xF0 && b0 <= 0xF4)
+    {
+        cp  =   b0 & 0x07;
+        n   =   4;
+    }
+    else
+    {
+        *width = 1;
+
+        return 1;
+    }
+
+    if (stlsoft_static_cast(size_t, end - p) < n)
+    {
+        *width = 1;
+
+        return 1;
+    }
+
+    { size_t i; for (i = 1; i != n; ++i)
+    {
+        unsigned char const b = stlsoft_static_cast(unsigned char, p[i]);
+
+        if (0x80 != (b & 0xC0))
+        {
+            *width = 1;
+
+            return 1;
+        }
+
+        cp = (cp << 6) | (b & 0x3F);
+    }}
+
+    *width = clasp_wrap_codepoint_width_(cp);
+
+    return n;
+#endif /* CLASP_USE_WIDE_STRINGS */
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * scanning helpers
+ */
+
+static
+int
+clasp_wrap_is_space_(
+    clasp_char_t    ch
+)
+{
+    switch (ch)
+    {
+    case ' ':
+    case '\t':
+    case '\n':
+    case '\v':
+    case '\f':
+    case '\r':
+
+        return 1;
+    default:
+
+        return 0;
+    }
+}
+
+#ifndef CLASP_USE_WIDE_STRINGS
+
+/* Evaluates whether all the sizeof(size_t) bytes at p are printable ASCII
+ * - i.e. in the range [0x21, 0x7E] - and so each one column wide and none
+ * a break opportunity, by testing all of them at once, as a single word.
+ */
+static
+int
+clasp_wrap_is_plain_word_(
+    char const* p
+)
+{
+    size_t const    ones    =   ~stlsoft_static_cast(size_t, 0) / 0xFF;
+    size_t          x;
+
+    memcpy(&x, p, sizeof(x));
+
+    /* a byte less than 0x21 borrows into its high bit when 0x21 is
+     * subtracted; DEL (0x7F) carries into its high bit when 1 is added;
+     * and a byte not less than 0x80 already has its high bit set
+     */
+    return 0 == (((x - ones * 0x21) | (x + ones) | x) & (ones * 0x80));
+}
+#endif /* !CLASP_USE_WIDE_STRINGS */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+void
+clasp_wrap_text_(
+    clasp_char_t const*     s
+,   size_t                  len
+,   size_t                  width
+,   clasp_wrap_line_fn_t_   pfn
+,   void*                   param
+)
+{
+    clasp_char_t const* const   end         =   s + len;
+    clasp_char_t const*         p0          =   s;      /* start of current line */
+    clasp_char_t const*         p           =   s;      /* scan position */
+    clasp_char_t const*         sl          =   NULL;   /* last break opportunity in current line */
+    size_t                      col         =   0;      /* display width of [p0, p) */
+    size_t                      colAfterSl  =   0;      /* display width of [p0, sl + 1) */
+    int                         overflowed  =   0;      /* whether current line exceeds width */
+    int                         emitted     =   0;
+
+    CLASP_ASSERT(NULL != s || 0 == len);
+    CLASP_ASSERT(NULL != pfn);
+
+    for (; end != p; )
+    {
+        size_t  n;
+        size_t  w;
+
+#ifndef CLASP_USE_WIDE_STRINGS
+
+        /* fast-path runs of printable ASCII that are known to fit */
+        if (col + sizeof(size_t) <= width &&
+            stlsoft_static_cast(size_t, end - p) >= sizeof(size_t) &&
+            clasp_wrap_is_plain_word_(p))
+        {
+            p   +=  sizeof(size_t);
+            col +=  sizeof(size_t);
+
+            continue;
+        }
+#endif /* !CLASP_USE_WIDE_STRINGS */
+
+        n = clasp_wrap_measure_(p, end, &w);
+
+        if (col + w > width)
+        {
+            if (NULL != sl)
+            {
+                /* break at the last opportunity, and carry over to the
+                 * next line the (already measured) characters after it,
+                 * or skip the whitespace that follows it
+                 */
+
+                (*pfn)(param, p0, stlsoft_static_cast(size_t, sl - p0));
+                emitted = 1;
+
+                if (sl + 1 != p)
+                {
+                    p0  =   sl + 1;
+                    col -=  colAfterSl;
+                }
+                else
+                {
+                    for (; end != p && clasp_wrap_is_space_(*p); ++p)
+                    {}
+
+                    p0  =   p;
+                    col =   0;
+                }
+
+                sl          =   NULL;
+                overflowed  =   0;
+
+                continue;
+            }
+
+            overflowed = 1;
+        }
+
+        if (clasp_wrap_is_space_(*p))
+        {
+            sl          =   p;
+            colAfterSl  =   col + w;
+        }
+
+        p   +=  n;
+        col +=  w;
+    }
+
+    if (overflowed &&
+        NULL != sl)
+    {
+        (*pfn)(param, p0, stlsoft_static_cast(size_t, sl - p0));
+    }
+    else
+    if (end != p0 ||
+        !emitted)
+    {
+        (*pfn)(param, p0, stlsoft_static_cast(size_t, end - p0));
+    }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
@@ -0,0 +1,656 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.suite/entry.cpp
+ *
+ * Purpose: Performance-tests for parsing, lookup, and usage rendering
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#if __cplusplus >= 201103L || \
+    (   defined(_MSVC_LANG) && \
+        _MSVC_LANG >= 201103L)
+# define CLASP_TEST_PERFORMANCE_SUPPORTED
+#endif
+
+#if __cplusplus >= 201703L || \
+    (   defined(_MSVC_LANG) && \
+        _MSVC_LANG >= 201703L)
+# define CLASP_TEST_PERFORMANCE_STRING_VIEW_SUPPORTED
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <clasp/clasp.hpp>
+#ifdef CLASP_TEST_PERFORMANCE_STRING_VIEW_SUPPORTED
+# include <clasp/string_view.hpp>
+#endif /* CLASP_TEST_PERFORMANCE_STRING_VIEW_SUPPORTED */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifdef CLASP_TEST_PERFORMANCE_SUPPORTED
+
+/* Standard C++ header files */
+# include <chrono>
+# include <deque>
+# include <new>
+# include <string>
+# include <vector>
+#endif /* CLASP_TEST_PERFORMANCE_SUPPORTED */
+
+/* Standard C header files */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#ifdef CLASP_TEST_PERFORMANCE_SUPPORTED
+
+/* /////////////////////////////////////////////////////////////////////////
+ * allocation accounting
+ *
+ * All allocations - those made by CLASP, via the diagnostic context, and
+ * those made by the C++ API, via operator new - are counted, so that each
+ * benchmark can report the bytes allocated, and the number of allocations,
+ * per operation
+ */
+
+namespace
+{
+    size_t  s_numAllocations;
+    size_t  s_numBytesAllocated;
+
+    void* CLASP_CALLCONV
+    counting_malloc_(
+        void*   /* context */
+    ,   size_t  cb
+    )
+    {
+        ++s_numAllocations;
+        s_numBytesAllocated += cb;
+
+        return ::malloc(cb);
+    }
+
+    void* CLASP_CALLCONV
+    counting_realloc_(
+        void*   /* context */
+    ,   void*   pv
+    ,   size_t  cb
+    )
+    {
+        ++s_numAllocations;
+        s_numBytesAllocated += cb;
+
+        return ::realloc(pv, cb);
+    }
+
+    /* diagnostics - e.g. of options that are checked more than once - are
+     * discarded
+     */
+    void CLASP_CALLCONV
+    silent_log_(
+        void*               /* context */
+    ,   int                 /* severity */
+    ,   clasp_char_t const* /* fmt */
+    ,   va_list             /* args */
+    )
+    {}
+
+    void CLASP_CALLCONV
+    counting_free_(
+        void*   /* context */
+    ,   void*   pv
+    )
+    {
+        ::free(pv);
+    }
+} // anonymous namespace
+
+void* operator new(size_t cb)
+{
+    ++s_numAllocations;
+    s_numBytesAllocated += cb;
+
+    if (void* const pv = ::malloc(0 == cb ? 1 : cb))
+    {
+        return pv;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pv) noexcept
+{
+    ::free(pv);
+}
+
+void operator delete(void* pv, size_t) noexcept
+{
+    ::free(pv);
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * workloads
+ */
+
+namespace
+{
+    typedef std::basic_string<clasp_char_t>                 string_t;
+
+    string_t
+    widen_(
+        std::string const& s
+    )
+    {
+        return string_t(s.begin(), s.end());
+    }
+
+    std::string
+    to_string_(
+        size_t n
+    )
+    {
+        char    sz[21];
+
+        ::snprintf(sz, sizeof(sz), "%lu", static_cast<unsigned long>(n));
+
+        return sz;
+    }
+
+    /* A linear congruential generator, so that each workload is the same
+     * from run to run
+     */
+    class random_t
+    {
+    public:
+        explicit random_t(unsigned long seed)
+            : m_state(seed)
+        {}
+
+    public:
+        size_t
+        next(size_t n)
+        {
+            m_state = (m_state * 1103515245ul + 12345ul) & 0x7ffffffful;
+
+            return static_cast<size_t>(m_state >> 8) % n;
+        }
+
+        double
+        next_real()
+        {
+            return static_cast<double>(next(1000000)) / 1000000.0;
+        }
+
+    private:
+        unsigned long   m_state;
+    };
+
+    struct workload_parameters_t
+    {
+        size_t  argc;           /* the number of arguments, excluding the program name */
+        size_t  numSpecs;       /* the number of specifications */
+        double  clusterDensity; /* the proportion of arguments that are clusters, e.g. "-abcd" */
+        double  optionRatio;    /* the proportion of the remaining arguments that are options; the rest are split evenly between flags and values */
+    };
+
+    /* Specifications are, alternately, flags - the first 52 of which have
+     * a single-character alias - and options
+     */
+    class workload_t
+    {
+    public:
+        explicit workload_t(workload_parameters_t const& params);
+
+    public:
+        workload_parameters_t const     params;
+        std::vector<clasp_specification_t>  specifications;
+        std::vector<clasp_char_t*>      argv;
+        string_t                        lastOptionName;
+        size_t                          numFlags;
+
+    private:
+        clasp_char_t const* intern_(std::string const& s);
+
+    private:
+        std::deque<string_t>            m_strings;
+    };
+
+    workload_t::workload_t(workload_parameters_t const& params)
+        : params(params)
+        , numFlags(0)
+    {
+        static char const   letters[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+        random_t            random(static_cast<unsigned long>(params.argc * 31 + params.numSpecs));
+        size_t              numShortFlags = 0;
+
+        for (size_t i = 0; i != params.numSpecs; ++i)
+        {
+            clasp_specification_t spec = CLASP_SPECIFICATION_ARRAY_TERMINATOR;
+
+            spec.help = intern_("the help for specification " + to_string_(i));
+
+            if (0 == (i % 2))
+            {
+                spec.type           =   CLASP_ARGTYPE_FLAG;
+                spec.mappedArgument =   intern_("--flag-" + to_string_(i / 2));
+                spec.bitFlags       =   1 << (numFlags % 30);
+
+                if (numShortFlags < 52)
+                {
+                    spec.name = intern_(std::string("-") + letters[numShortFlags++]);
+                }
+
+                ++numFlags;
+            }
+            else
+            {
+                spec.type           =   CLASP_ARGTYPE_OPTION;
+                spec.mappedArgument =   intern_("--opt-" + to_string_(i / 2));
+            }
+
+            specifications.push_back(spec);
+        }
+
+        {
+            clasp_specification_t const terminator = CLASP_SPECIFICATION_ARRAY_TERMINATOR;
+
+            specifications.push_back(terminator);
+        }
+
+        size_t const numOptionSpecs = params.numSpecs / 2;
+
+        argv.reserve(params.argc + 2);
+        argv.push_back(const_cast<clasp_char_t*>(intern_("benchmark")));
+
+        for (size_t i = 0; i != params.argc; ++i)
+        {
+            std::string arg;
+
+            if (0 != numShortFlags &&
+                random.next_real() < params.clusterDensity)
+            {
+                arg = "-";
+
+                for (size_t j = 0; j != 4; ++j)
+                {
+                    arg += letters[random.next(numShortFlags)];
+                }
+            }
+            else
+            {
+                double const r = random.next_real();
+
+                if (0 != numOptionSpecs &&
+                    r < params.optionRatio)
+                {
+                    arg = "--opt-" + to_string_(random.next(numOptionSpecs)) + "=" + to_string_(random.next(1000));
+                }
+                else if (r < params.optionRatio + (1.0 - params.optionRatio) / 2)
+                {
+                    arg = "--flag-" + to_string_(random.next(numFlags));
+                }
+                else
+                {
+                    arg = "value-" + to_string_(i);
+                }
+            }
+
+            argv.push_back(const_cast<clasp_char_t*>(intern_(arg)));
+        }
+
+        argv.push_back(NULL);
+
+        lastOptionName = widen_("--opt-" + to_string_(0 == numOptionSpecs ? 0 : numOptionSpecs - 1));
+    }
+
+    clasp_char_t const*
+    workload_t::intern_(std::string const& s)
+    {
+        m_strings.push_back(widen_(s));
+
+        return m_strings.back().c_str();
+    }
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * harness
+ */
+
+namespace
+{
+    enum format_t
+    {
+        format_csv,
+        format_json,
+    };
+
+    struct harness_t
+    {
+        format_t                    format;
+        std::chrono::nanoseconds    minTime;
+        size_t                      numResults;
+    };
+
+    /* Runs the operation repeatedly - doubling the number of iterations -
+     * until it has taken at least the harness' minimum time, and then
+     * reports the time, and the allocations, per operation
+     */
+    template <typename F>
+    void
+    run_benchmark_(
+        harness_t&                      harness
+    ,   char const*                     name
+    ,   workload_parameters_t const&    params
+    ,   F                               op
+    )
+    {
+        typedef std::chrono::steady_clock   clock_t_;
+
+        size_t                      iterations  =   1;
+        std::chrono::nanoseconds    elapsed;
+        size_t                      numAllocations;
+        size_t                      numBytesAllocated;
+
+        op(); // warm-up
+
+        for (;; iterations *= 2)
+        {
+            s_numAllocations    =   0;
+            s_numBytesAllocated =   0;
+
+            clock_t_::time_point const start = clock_t_::now();
+
+            for (size_t i = 0; i != iterations; ++i)
+            {
+                op();
+            }
+
+            elapsed             =   std::chrono::duration_cast<std::chrono::nanoseconds>(clock_t_::now() - start);
+            numAllocations      =   s_numAllocations;
+            numBytesAllocated   =   s_numBytesAllocated;
+
+            if (elapsed >= harness.minTime)
+            {
+                break;
+            }
+        }
+
+        double const nsPerOp        =   static_cast<double>(elapsed.count()) / iterations;
+        double const bytesPerOp     =   static_cast<double>(numBytesAllocated) / iterations;
+        double const allocsPerOp    =   static_cast<double>(numAllocations) / iterations;
+
+        switch (harness.format)
+        {
+        case format_csv:
+
+            ::printf("%s,%lu,%lu,%.2f,%.2f,%lu,%lu,%.1f,%.1f,%.2f\n"
+            ,   name
+            ,   static_cast<unsigned long>(params.argc)
+            ,   static_cast<unsigned long>(params.numSpecs)
+            ,   params.clusterDensity
+            ,   params.optionRatio
+            ,   static_cast<unsigned long>(sizeof(clasp_char_t))
+            ,   static_cast<unsigned long>(iterations)
+            ,   nsPerOp
+            ,   bytesPerOp
+            ,   allocsPerOp
+            );
+            break;
+        case format_json:
+
+            ::printf("%s\n  { \"benchmark\": \"%s\", \"argc\": %lu, \"specifications\": %lu, \"cluster_density\": %.2f, \"option_ratio\": %.2f, \"char_size\": %lu, \"iterations\": %lu, \"ns_per_op\": %.1f, \"bytes_per_op\": %.1f, \"allocs_per_op\": %.2f }"
+            ,   (0 == harness.numResults) ? "" : ","
+            ,   name
+            ,   static_cast<unsigned long>(params.argc)
+            ,   static_cast<unsigned long>(params.numSpecs)
+            ,   params.clusterDensity
+            ,   params.optionRatio
+            ,   static_cast<unsigned long>(sizeof(clasp_char_t))
+            ,   static_cast<unsigned long>(iterations)
+            ,   nsPerOp
+            ,   bytesPerOp
+            ,   allocsPerOp
+            );
+            break;
+        }
+
+        ::fflush(stdout);
+
+        ++harness.numResults;
+    }
+
+    int
+    run_workload_(
+        harness_t&                          harness
+    ,   workload_parameters_t const&        params
+    ,   clasp_diagnostic_context_t const*   ctxt
+    )
+    {
+        workload_t const                    workload(params);
+        int const                           argc            =   static_cast<int>(workload.argv.size() - 1);
+        clasp_char_t** const                argv            =   const_cast<clasp_char_t**>(&workload.argv[0]);
+        clasp_specification_t const* const  specifications  =   &workload.specifications[0];
+        clasp_specification_index_t const*  index;
+        clasp_arguments_t const*            args;
+        int                                 r;
+
+        r = clasp_createSpecificationIndex(ctxt, specifications, &index);
+
+        if (0 != r)
+        {
+            ::fprintf(stderr, "could not create index: %s\n", ::strerror(r));
+
+            return r;
+        }
+
+        r = clasp_parseArguments(0, argc, argv, specifications, ctxt, &args);
+
+        if (0 != r)
+        {
+            ::fprintf(stderr, "could not parse arguments: %s\n", ::strerror(r));
+
+            clasp_destroySpecificationIndex(index);
+
+            return r;
+        }
+
+        run_benchmark_(harness, "clasp_parseArguments", params, [&]() {
+
+            clasp_arguments_t const* args2;
+
+            if (0 == clasp_parseArguments(0, argc, argv, specifications, ctxt, &args2))
+            {
+                clasp_releaseArguments(args2);
+            }
+        });
+
+        run_benchmark_(harness, "clasp_parseArgumentsWithIndex", params, [&]() {
+
+            clasp_arguments_t const* args2;
+
+            if (0 == clasp_parseArgumentsWithIndex(0, argc, argv, index, ctxt, &args2))
+            {
+                clasp_releaseArguments(args2);
+            }
+        });
+
+        run_benchmark_(harness, "clasp_findFlagOrOption", params, [&]() {
+
+            clasp_findFlagOrOption(args, workload.lastOptionName.c_str(), 0);
+        });
+
+        run_benchmark_(harness, "clasp_checkAllFlags", params, [&]() {
+
+            int bitFlags = 0;
+
+            clasp_checkAllFlags(args, specifications, &bitFlags);
+        });
+
+        run_benchmark_(harness, "clasp::check_option", params, [&]() {
+
+            int value;
+
+            clasp::check_option(args, workload.lastOptionName, &value, 0);
+        });
+
+#ifdef CLASP_TEST_PERFORMANCE_STRING_VIEW_SUPPORTED
+
+        run_benchmark_(harness, "clasp::check_option<int>", params, [&]() {
+
+            clasp::check_option<int>(args, workload.lastOptionName);
+        });
+#endif /* CLASP_TEST_PERFORMANCE_STRING_VIEW_SUPPORTED */
+
+        string_t const  toolName    =   widen_("benchmark");
+        string_t const  summary     =   widen_("CLASP");
+        string_t const  copyright   =   widen_("Copyright");
+        string_t const  description =   widen_("Benchmarks CLASP");
+        string_t const  usage       =   widen_("USAGE: benchmark [ ... options ... ]");
+
+        run_benchmark_(harness, "clasp_showUsage", params, [&]() {
+
+            clasp_char_t*   buffer;
+            size_t          cchBuffer;
+
+            if (0 == clasp_showUsageToBuffer(args, specifications, toolName.c_str(), summary.c_str(), copyright.c_str(), description.c_str(), usage.c_str(), 0, 1, 0, 0, 76, -8, 1, &buffer, &cchBuffer))
+            {
+                clasp_releaseUsageBuffer(args, buffer);
+            }
+        });
+
+        clasp_releaseArguments(args);
+        clasp_destroySpecificationIndex(index);
+
+        return 0;
+    }
+} // anonymous namespace
+
+#endif /* CLASP_TEST_PERFORMANCE_SUPPORTED */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main
+ */
+
+int main(int argc, char **argv)
+{
+#ifdef CLASP_TEST_PERFORMANCE_SUPPORTED
+
+    harness_t   harness     =   { format_csv, std::chrono::milliseconds(20), 0 };
+    bool        full        =   false;
+
+    for (int i = 1; i != argc; ++i)
+    {
+        char const* const arg = argv[i];
+
+        if (0 == ::strcmp(arg, "--format=csv"))
+        {
+            harness.format = format_csv;
+        }
+        else if (0 == ::strcmp(arg, "--format=json"))
+        {
+            harness.format = format_json;
+        }
+        else if (0 == ::strcmp(arg, "--full"))
+        {
+            full = true;
+        }
+        else if (0 == ::strncmp(arg, "--min-time=", 11))
+        {
+            harness.minTime = std::chrono::milliseconds(::atoi(arg + 11));
+        }
+        else
+        {
+            ::fprintf(stderr, "USAGE: %s [ --format={csv|json} ] [ --full ] [ --min-time=<milliseconds> ]\n", argv[0]);
+
+            return EXIT_FAILURE;
+        }
+    }
+
+    /* by default, a quick sweep; with --full, the complete sweep */
+    static size_t const argcsQuick[]        =   { 10, 100, 1000, 10000 };
+    static size_t const argcsFull[]         =   { 10, 100, 1000, 10000, 100000, 1000000 };
+    static size_t const numSpecsQuick[]     =   { 10, 100, 1000 };
+    static size_t const numSpecsFull[]      =   { 10, 100, 1000, 5000 };
+    static double const densitiesQuick[]    =   { 0.0, 0.5 };
+    static double const densitiesFull[]     =   { 0.0, 0.25, 0.5 };
+    static double const ratiosQuick[]       =   { 0.2, 0.8 };
+    static double const ratiosFull[]        =   { 0.1, 0.5, 0.9 };
+
+    std::vector<size_t> const   argcs       =   full ? std::vector<size_t>(argcsFull, argcsFull + STLSOFT_NUM_ELEMENTS(argcsFull)) : std::vector<size_t>(argcsQuick, argcsQuick + STLSOFT_NUM_ELEMENTS(argcsQuick));
+    std::vector<size_t> const   numSpecs    =   full ? std::vector<size_t>(numSpecsFull, numSpecsFull + STLSOFT_NUM_ELEMENTS(numSpecsFull)) : std::vector<size_t>(numSpecsQuick, numSpecsQuick + STLSOFT_NUM_ELEMENTS(numSpecsQuick));
+    std::vector<double> const   densities   =   full ? std::vector<double>(densitiesFull, densitiesFull + STLSOFT_NUM_ELEMENTS(densitiesFull)) : std::vector<double>(densitiesQuick, densitiesQuick + STLSOFT_NUM_ELEMENTS(densitiesQuick));
+    std::vector<double> const   ratios      =   full ? std::vector<double>(ratiosFull, ratiosFull + STLSOFT_NUM_ELEMENTS(ratiosFull)) : std::vector<double>(ratiosQuick, ratiosQuick + STLSOFT_NUM_ELEMENTS(ratiosQuick));
+
+    clasp_diagnostic_context_t  ctxt;
+
+    clasp_init_diagnostic_context(&ctxt, NULL, counting_malloc_, counting_realloc_, counting_free_, silent_log_, NULL, NULL);
+
+    switch (harness.format)
+    {
+    case format_csv:
+
+        ::printf("benchmark,argc,specifications,cluster_density,option_ratio,char_size,iterations,ns_per_op,bytes_per_op,allocs_per_op\n");
+        break;
+    case format_json:
+
+        ::printf("[");
+        break;
+    }
+
+    for (size_t const n : numSpecs)
+    {
+        for (size_t const a : argcs)
+        {
+            for (double const d : densities)
+            {
+                for (double const o : ratios)
+                {
+                    workload_parameters_t const params = { a, n, d, o };
+
+                    if (0 != run_workload_(harness, params, &ctxt))
+                    {
+                        return EXIT_FAILURE;
+                    }
+                }
+            }
+        }
+    }
+
+    if (format_json == harness.format)
+    {
+        ::printf("\n]\n");
+    }
+
+    return EXIT_SUCCESS;
+#else /* ? CLASP_TEST_PERFORMANCE_SUPPORTED */
+
+    ((void)&argc);
+    ((void)&argv);
+
+    ::fprintf(stderr, "the performance tests require C++11 or later\n");
+
+    return EXIT_SUCCESS;
+#endif /* CLASP_TEST_PERFORMANCE_SUPPORTED */
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
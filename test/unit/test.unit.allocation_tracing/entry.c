@@ -0,0 +1,432 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.allocation_tracing/entry.c
+ *
+ * Purpose: Unit-test(s) for the allocation trace function of the
+ *          diagnostic context
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <clasp/clasp.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C header files */
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#if defined(_MSC_VER) && \
+    _MSC_VER >= 1400
+# pragma warning(push)
+# pragma warning(disable : 4996)
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+#define MAX_BLOCKS                                          (64)
+#define MAX_SITES                                           (16)
+
+/* Records the live blocks, by site, and the number of operations, by
+ * site and operation
+ */
+typedef struct tracer_t tracer_t;
+
+struct tracer_t
+{
+  size_t              numBlocks;
+  void*               blocks[MAX_BLOCKS];
+  clasp_alloc_site_t  sites[MAX_BLOCKS];
+  size_t              numMallocs[MAX_SITES];
+  size_t              numFrees[MAX_SITES];
+  size_t              numMismatches;
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * globals
+ */
+
+static clasp_specification_t const Specifications[] =
+{
+    CLASP_FLAG("-v", "--verbose", "verbose"),
+    CLASP_FLAG("-q", "--quiet", "quiet"),
+    CLASP_OPTION("-w", "--width", "width", "|80|120|"),
+
+    CLASP_SPECIFICATION_ARRAY_TERMINATOR
+};
+
+static char const* const Argv[] = { "prog", "-vq", "--wid=10", "abc", NULL };
+
+#define ARGC                                                (STLSOFT_NUM_ELEMENTS(Argv) - 1)
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+static void test_1_0(void);
+static void test_1_1(void);
+static void test_1_2(void);
+static void test_1_3(void);
+static void test_1_4(void);
+static void test_1_5(void);
+static void test_1_6(void);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main
+ */
+
+int main(int argc, char **argv)
+{
+  int retCode = EXIT_SUCCESS;
+  int verbosity = 2;
+
+  XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+  if (XTESTS_START_RUNNER("test.unit.allocation_tracing", verbosity))
+  {
+    XTESTS_RUN_CASE(test_1_0);
+    XTESTS_RUN_CASE(test_1_1);
+    XTESTS_RUN_CASE(test_1_2);
+    XTESTS_RUN_CASE(test_1_3);
+    XTESTS_RUN_CASE(test_1_4);
+    XTESTS_RUN_CASE(test_1_5);
+    XTESTS_RUN_CASE(test_1_6);
+
+    XTESTS_PRINT_RESULTS();
+
+    XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+  }
+
+  return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+static void CLASP_CALLCONV trace_(
+  void*               context
+, clasp_alloc_op_t    op
+, clasp_alloc_site_t  site
+, void*               pvOld
+, void*               pvNew
+, size_t              cb
+)
+{
+  tracer_t* const tracer = (tracer_t*)context;
+  size_t          i;
+
+  ((void)cb);
+
+  if (NULL != pvOld)
+  {
+    for (i = 0; i != tracer->numBlocks; ++i)
+    {
+      if (pvOld == tracer->blocks[i])
+      {
+        if (site != tracer->sites[i])
+        {
+          ++tracer->numMismatches;
+        }
+
+        tracer->blocks[i] = tracer->blocks[tracer->numBlocks - 1];
+        tracer->sites[i] = tracer->sites[tracer->numBlocks - 1];
+        --tracer->numBlocks;
+
+        break;
+      }
+    }
+  }
+
+  if (NULL != pvNew &&
+      tracer->numBlocks != MAX_BLOCKS)
+  {
+    tracer->blocks[tracer->numBlocks] = pvNew;
+    tracer->sites[tracer->numBlocks] = site;
+    ++tracer->numBlocks;
+  }
+
+  switch (op)
+  {
+  case CLASP_ALLOC_OP_MALLOC:
+    ++tracer->numMallocs[site];
+    break;
+  case CLASP_ALLOC_OP_FREE:
+    ++tracer->numFrees[site];
+    break;
+  default:
+    break;
+  }
+}
+
+static void init_context_(
+  clasp_diagnostic_context_t* ctxt
+, tracer_t*                   tracer
+)
+{
+  memset(tracer, 0, sizeof(*tracer));
+
+  clasp_init_diagnostic_context(ctxt, tracer, NULL, NULL, NULL, NULL, NULL, NULL);
+
+  ctxt->pfnTrace = trace_;
+}
+
+static size_t num_live_blocks_(
+  tracer_t const*     tracer
+, clasp_alloc_site_t  site
+)
+{
+  size_t  n = 0;
+  size_t  i;
+
+  for (i = 0; i != tracer->numBlocks; ++i)
+  {
+    n += (site == tracer->sites[i]);
+  }
+
+  return n;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+static void test_1_0(void)
+{
+  clasp_diagnostic_context_t  ctxt;
+  tracer_t                    tracer;
+  clasp_arguments_t const*    args;
+  int                         r;
+
+  init_context_(&ctxt, &tracer);
+
+  r = clasp_parseArguments(0, ARGC, (char**)Argv, Specifications, &ctxt, &args);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    XTESTS_TEST_INTEGER_EQUAL(1u, tracer.numBlocks);
+    XTESTS_TEST_INTEGER_EQUAL(1u, num_live_blocks_(&tracer, CLASP_ALLOC_SITE_ARGUMENTS));
+    XTESTS_TEST_POINTER_EQUAL(args, tracer.blocks[0]);
+
+    clasp_releaseArguments(args);
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, tracer.numBlocks);
+    XTESTS_TEST_INTEGER_EQUAL(1u, tracer.numFrees[CLASP_ALLOC_SITE_ARGUMENTS]);
+    XTESTS_TEST_INTEGER_EQUAL(0u, tracer.numMismatches);
+  }
+}
+
+static void test_1_1(void)
+{
+  clasp_diagnostic_context_t  ctxt;
+  tracer_t                    tracer;
+  clasp_arguments_t const*    args;
+  int                         r;
+
+  init_context_(&ctxt, &tracer);
+
+  r = clasp_parseArguments(CLASP_F_ALLOW_UNIQUE_PREFIXES, ARGC, (char**)Argv, Specifications, &ctxt, &args);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    /* the prefix trie lives only for the duration of the parse */
+    XTESTS_TEST_INTEGER_EQUAL(1u, tracer.numMallocs[CLASP_ALLOC_SITE_PREFIX_TRIE]);
+    XTESTS_TEST_INTEGER_EQUAL(1u, tracer.numFrees[CLASP_ALLOC_SITE_PREFIX_TRIE]);
+    XTESTS_TEST_INTEGER_EQUAL(1u, tracer.numBlocks);
+    XTESTS_TEST_INTEGER_EQUAL(1u, num_live_blocks_(&tracer, CLASP_ALLOC_SITE_ARGUMENTS));
+
+    clasp_releaseArguments(args);
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, tracer.numBlocks);
+    XTESTS_TEST_INTEGER_EQUAL(0u, tracer.numMismatches);
+  }
+}
+
+static void test_1_2(void)
+{
+  clasp_diagnostic_context_t          ctxt;
+  tracer_t                            tracer;
+  clasp_specification_index_t const*  index;
+  int                                 r;
+
+  init_context_(&ctxt, &tracer);
+
+  r = clasp_createSpecificationIndex(&ctxt, Specifications, &index);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    XTESTS_TEST_INTEGER_EQUAL(2u, tracer.numMallocs[CLASP_ALLOC_SITE_INDEX_SCRATCH]);
+    XTESTS_TEST_INTEGER_EQUAL(2u, tracer.numFrees[CLASP_ALLOC_SITE_INDEX_SCRATCH]);
+    XTESTS_TEST_INTEGER_EQUAL(1u, tracer.numBlocks);
+    XTESTS_TEST_INTEGER_EQUAL(1u, num_live_blocks_(&tracer, CLASP_ALLOC_SITE_INDEX));
+
+    clasp_destroySpecificationIndex(index);
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, tracer.numBlocks);
+    XTESTS_TEST_INTEGER_EQUAL(0u, tracer.numMismatches);
+  }
+}
+
+static void test_1_3(void)
+{
+  clasp_diagnostic_context_t  ctxt;
+  tracer_t                    tracer;
+  clasp_arguments_t const*    args;
+  int                         r;
+
+  init_context_(&ctxt, &tracer);
+
+  r = clasp_parseArguments(0, ARGC, (char**)Argv, Specifications, &ctxt, &args);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    char*   buffer;
+    size_t  cchBuffer;
+
+    r = clasp_showUsageToBuffer(args, Specifications, "prog", "summary", "copyright", "description", "usage: prog", 1, 0, 0, 0, 80, 4, 1, &buffer, &cchBuffer);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+    {
+      XTESTS_TEST_INTEGER_NOT_EQUAL(0u, tracer.numMallocs[CLASP_ALLOC_SITE_USAGE_MODEL]);
+      XTESTS_TEST_INTEGER_EQUAL(tracer.numMallocs[CLASP_ALLOC_SITE_USAGE_MODEL], tracer.numFrees[CLASP_ALLOC_SITE_USAGE_MODEL]);
+      XTESTS_TEST_INTEGER_EQUAL(1u, num_live_blocks_(&tracer, CLASP_ALLOC_SITE_USAGE_BUFFER));
+
+      clasp_releaseUsageBuffer(args, buffer);
+
+      XTESTS_TEST_INTEGER_EQUAL(0u, num_live_blocks_(&tracer, CLASP_ALLOC_SITE_USAGE_BUFFER));
+    }
+
+    clasp_releaseArguments(args);
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, tracer.numBlocks);
+    XTESTS_TEST_INTEGER_EQUAL(0u, tracer.numMismatches);
+  }
+}
+
+static void test_1_4(void)
+{
+  clasp_diagnostic_context_t  ctxt;
+  tracer_t                    tracer;
+  clasp_arguments_t const*    args;
+  int                         r;
+
+  init_context_(&ctxt, &tracer);
+
+  r = clasp_parseArguments(0, ARGC, (char**)Argv, Specifications, &ctxt, &args);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    char const* const argv[] = { "-q", "def" };
+
+    r = clasp_appendArguments(&args, 1, 2, (char**)argv);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+    {
+      /* the temporary vector, and the results of the new arguments, are
+       * freed, along with the original results
+       */
+      XTESTS_TEST_INTEGER_EQUAL(1u, tracer.numMallocs[CLASP_ALLOC_SITE_APPEND_VECTOR]);
+      XTESTS_TEST_INTEGER_EQUAL(1u, tracer.numFrees[CLASP_ALLOC_SITE_APPEND_VECTOR]);
+      XTESTS_TEST_INTEGER_EQUAL(3u, tracer.numMallocs[CLASP_ALLOC_SITE_ARGUMENTS]);
+      XTESTS_TEST_INTEGER_EQUAL(2u, tracer.numFrees[CLASP_ALLOC_SITE_ARGUMENTS]);
+      XTESTS_TEST_INTEGER_EQUAL(1u, tracer.numBlocks);
+    }
+
+    clasp_releaseArguments(args);
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, tracer.numBlocks);
+    XTESTS_TEST_INTEGER_EQUAL(0u, tracer.numMismatches);
+  }
+}
+
+
+static void test_1_5(void)
+{
+  clasp_diagnostic_context_t          ctxt;
+  tracer_t                            tracer;
+  clasp_specification_index_t const*  index;
+  int                                 r;
+
+  init_context_(&ctxt, &tracer);
+
+  r = clasp_createSpecificationIndex(&ctxt, Specifications, &index);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    clasp_arguments_t const* args;
+
+    r = clasp_parseArgumentsWithIndex(CLASP_F_ALLOW_UNIQUE_PREFIXES, ARGC, (char**)Argv, index, &ctxt, &args);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+    {
+      /* the prefix trie is that of the index */
+      XTESTS_TEST_INTEGER_EQUAL(0u, tracer.numMallocs[CLASP_ALLOC_SITE_PREFIX_TRIE]);
+      XTESTS_TEST_INTEGER_EQUAL(1u, args->numOptions);
+      XTESTS_TEST_INTEGER_EQUAL(2, args->options[0].aliasIndex);
+
+      clasp_releaseArguments(args);
+    }
+
+    clasp_destroySpecificationIndex(index);
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, tracer.numBlocks);
+    XTESTS_TEST_INTEGER_EQUAL(0u, tracer.numMismatches);
+  }
+}
+static void test_1_6(void)
+{
+  clasp_diagnostic_context_t  ctxt;
+  tracer_t                    tracer;
+  clasp_arguments_t const*    args;
+  int                         r;
+
+  init_context_(&ctxt, &tracer);
+
+  /* a context that does not record its size - as one filled in by hand -
+   * has its context, flags, and trace function ignored
+   */
+  ctxt.cb = 0;
+
+  r = clasp_parseArguments(0, ARGC, (char**)Argv, Specifications, &ctxt, &args);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    XTESTS_TEST_INTEGER_EQUAL(0u, tracer.numMallocs[CLASP_ALLOC_SITE_ARGUMENTS]);
+
+    clasp_releaseArguments(args);
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, tracer.numFrees[CLASP_ALLOC_SITE_ARGUMENTS]);
+  }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
@@ -0,0 +1,185 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.amalgamated/entry.c
+ *
+ * Purpose: Unit-test(s) for the amalgamated library and header-only mode
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <clasp/clasp.h>
+
+#ifndef CLASP_HEADER_ONLY
+# error CLASP_HEADER_ONLY should be defined for users of the amalgamated library
+#endif /* !CLASP_HEADER_ONLY */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C header files */
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#if defined(_MSC_VER) && \
+    _MSC_VER >= 1400
+# pragma warning(push)
+# pragma warning(disable : 4996)
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * globals
+ */
+
+static clasp_specification_t const Specifications[] =
+{
+    CLASP_FLAG("-v", "--verbose", "verbose"),
+    CLASP_OPTION("-w", "--width", "width", NULL),
+
+    CLASP_SPECIFICATION_ARRAY_TERMINATOR
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+static void test_1_0(void);
+static void test_1_1(void);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main
+ */
+
+int main(int argc, char **argv)
+{
+  int retCode = EXIT_SUCCESS;
+  int verbosity = 2;
+
+  XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+  if (XTESTS_START_RUNNER("test.unit.amalgamated", verbosity))
+  {
+    XTESTS_RUN_CASE(test_1_0);
+    XTESTS_RUN_CASE(test_1_1);
+
+    XTESTS_PRINT_RESULTS();
+
+    XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+  }
+
+  return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+static void test_1_0(void)
+{
+  char const* const         argv[] =
+  {
+    "program",
+
+    "-v",
+    "--width=10",
+    "--unknown",
+
+    NULL
+  };
+  int const                 argc = STLSOFT_NUM_ELEMENTS(argv) - 1;
+  clasp_arguments_t const*  args;
+  int const                 cr   = clasp_parseArguments(0, argc, (char**)argv, Specifications, NULL, &args);
+
+  if (0 != cr)
+  {
+    XTESTS_TEST_FAIL_WITH_QUALIFIER("failed to initialise CLASP", strerror(cr));
+  }
+  else
+  {
+    /* the flags set by the inline functions are seen by the library */
+
+    XTESTS_TEST_INTEGER_EQUAL(3u, clasp_reportUnusedFlagsAndOptions(args, NULL, 0));
+    XTESTS_TEST_BOOLEAN_FALSE(clasp_argumentIsUsed(args, &args->flags[0]));
+
+    clasp_useArgument(args, &args->flags[0]);
+
+    XTESTS_TEST_BOOLEAN_TRUE(clasp_argumentIsUsed(args, &args->flags[0]));
+    XTESTS_TEST_INTEGER_EQUAL(2u, clasp_reportUnusedFlagsAndOptions(args, NULL, 0));
+
+    /* and vice versa */
+
+    XTESTS_TEST_BOOLEAN_TRUE(clasp_flagIsSpecified(args, "--verbose"));
+    XTESTS_TEST_INTEGER_EQUAL(2u, clasp_reportUnusedFlagsAndOptions(args, NULL, 0));
+    XTESTS_TEST_POINTER_NOT_EQUAL(NULL, clasp_findFlagOrOption(args, "--width", 0));
+
+    clasp_releaseArguments(args);
+  }
+}
+
+static void test_1_1(void)
+{
+  char const* const         argv[] =
+  {
+    "program",
+
+    "abc",
+    "defg",
+
+    NULL
+  };
+  int const                 argc = STLSOFT_NUM_ELEMENTS(argv) - 1;
+  clasp_arguments_t const*  args;
+  int const                 cr   = clasp_parseArguments(0, argc, (char**)argv, Specifications, NULL, &args);
+
+  if (0 != cr)
+  {
+    XTESTS_TEST_FAIL_WITH_QUALIFIER("failed to initialise CLASP", strerror(cr));
+  }
+  else
+  {
+    clasp_char_t const*     ptr;
+    size_t                  len;
+    clasp_argument_t const* arg;
+
+    XTESTS_TEST_INTEGER_EQUAL(2u, clasp_reportUnusedValues(args, NULL, 0));
+
+    if (XTESTS_TEST_BOOLEAN_TRUE(clasp_checkValue(args, 1, &ptr, &len, &arg)))
+    {
+      XTESTS_TEST_INTEGER_EQUAL(4u, len);
+      XTESTS_TEST_MULTIBYTE_STRING_EQUAL("defg", ptr);
+      XTESTS_TEST_POINTER_EQUAL(&args->values[1], arg);
+    }
+
+    XTESTS_TEST_BOOLEAN_FALSE(clasp_checkValue(args, 2, NULL, NULL, NULL));
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, clasp_reportUnusedValues(args, NULL, 0));
+
+    clasp_releaseArguments(args);
+  }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
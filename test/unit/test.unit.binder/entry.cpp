@@ -0,0 +1,424 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.binder/entry.cpp
+ *
+ * Purpose: Unit-tests for clasp::binder
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <clasp/binder.hpp>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+#include <stlsoft/error/error_desc.hpp>
+#include <stlsoft/smartptr/scoped_handle.hpp>
+
+/* Standard C header files */
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_1_0();
+    static void test_1_1();
+    static void test_1_2();
+    static void test_1_3();
+    static void test_1_4();
+    static void test_1_5();
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * globals
+ */
+
+clasp_diagnostic_context_t const*   s_ctxt;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    struct stub
+    {
+        static void CLASP_CALLCONV function(
+            void*                /* context */
+        ,   int                  /* severity */
+        ,   clasp_char_t const*  /* fmt */
+        ,   va_list              /* args */
+        )
+        {}
+    };
+
+    clasp_diagnostic_context_t  ctxt;
+
+    ctxt.pfnLog = &stub::function;
+
+    s_ctxt = &ctxt;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.binder", verbosity))
+    {
+        XTESTS_RUN_CASE(test_1_0);
+        XTESTS_RUN_CASE(test_1_1);
+        XTESTS_RUN_CASE(test_1_2);
+        XTESTS_RUN_CASE(test_1_3);
+        XTESTS_RUN_CASE(test_1_4);
+        XTESTS_RUN_CASE(test_1_5);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+    using clasp::arguments_t;
+    using clasp::clasp_string_t;
+
+    static clasp::specification_t const Specifications[] =
+    {
+        CLASP_FLAG("-f", "--force", NULL),
+        CLASP_FLAG("-q", "--quiet", NULL),
+        CLASP_OPTION("-l", "--length", NULL, NULL),
+        CLASP_OPTION("-o", "--output", NULL, NULL),
+        CLASP_OPTION("-r", "--ratio", NULL, NULL),
+        CLASP_OPTION_ALIAS("-L", "--length=100"),
+
+        CLASP_SPECIFICATION_ARRAY_TERMINATOR
+    };
+
+    bool
+    parse_colour(
+        void*               /* param */
+    ,   clasp_char_t const* parsedValue
+    ,   int*                result
+    )
+    {
+        if (0 == ::strcmp(parsedValue, "red"))
+        {
+            *result = 1;
+
+            return true;
+        }
+        if (0 == ::strcmp(parsedValue, "green"))
+        {
+            *result = 2;
+
+            return true;
+        }
+
+        return false;
+    }
+
+static void test_1_0()
+{
+    char const* argv[] =
+    {
+        "arg0",
+        NULL,
+    };
+
+    arguments_t const*  args;
+    int r;
+
+    r = clasp::parseArguments(0, STLSOFT_NUM_ELEMENTS(argv) - 1, argv, Specifications, s_ctxt, &args);
+
+    if (0 != r)
+    {
+        XTESTS_TEST_FAIL_WITH_QUALIFIER("could not parse arguments", stlsoft::error_desc(r));
+    }
+    else
+    {
+        stlsoft::scoped_handle<arguments_t const*> scoper(args, clasp::releaseArguments);
+
+        bool            force   =   true;
+        int             length  =   -1;
+        clasp_string_t  output;
+        double          ratio   =   -1.0;
+
+        clasp::binder()
+            .flag("--force", &force)
+            .option("--length", &length, 10)
+            .option("--output", &output, "out.txt")
+            .option("--ratio", &ratio, 0.5)
+            .bind(args);
+
+        XTESTS_TEST_BOOLEAN_FALSE(force);
+        XTESTS_TEST_INTEGER_EQUAL(10, length);
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("out.txt", output);
+        XTESTS_TEST_FLOATINGPOINT_EQUAL(0.5, ratio);
+    }
+}
+
+static void test_1_1()
+{
+    char const* argv[] =
+    {
+        "arg0",
+        "-f",
+        "--length=20",
+        "-o",
+        "result.txt",
+        "--ratio=0.25",
+        "abc",
+        NULL,
+    };
+
+    arguments_t const*  args;
+    int r;
+
+    r = clasp::parseArguments(0, STLSOFT_NUM_ELEMENTS(argv) - 1, argv, Specifications, s_ctxt, &args);
+
+    if (0 != r)
+    {
+        XTESTS_TEST_FAIL_WITH_QUALIFIER("could not parse arguments", stlsoft::error_desc(r));
+    }
+    else
+    {
+        stlsoft::scoped_handle<arguments_t const*> scoper(args, clasp::releaseArguments);
+
+        bool            force;
+        long            length;
+        clasp_string_t  output;
+        float           ratio;
+
+        clasp::binder()
+            .flag("--force", &force)
+            .option("--length", &length, 10)
+            .required_option("--output", &output)
+            .option("--ratio", &ratio, 0.5f)
+            .bind(args);
+
+        XTESTS_TEST_BOOLEAN_TRUE(force);
+        XTESTS_TEST_INTEGER_EQUAL(20, length);
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("result.txt", output);
+        XTESTS_TEST_FLOATINGPOINT_EQUAL(0.25f, ratio);
+
+        XTESTS_TEST_INTEGER_EQUAL(0, clasp_reportUnusedFlagsAndOptions(args, NULL, 0));
+    }
+}
+
+static void test_1_2()
+{
+    char const* argv[] =
+    {
+        "arg0",
+        "-fq",
+        "-L",
+        "--length=3",
+        NULL,
+    };
+
+    enum
+    {
+            TEST_1_2_FORCE  =   0x0001
+        ,   TEST_1_2_QUIET  =   0x0002
+    };
+
+    arguments_t const*  args;
+    int r;
+
+    r = clasp::parseArguments(0, STLSOFT_NUM_ELEMENTS(argv) - 1, argv, Specifications, s_ctxt, &args);
+
+    if (0 != r)
+    {
+        XTESTS_TEST_FAIL_WITH_QUALIFIER("could not parse arguments", stlsoft::error_desc(r));
+    }
+    else
+    {
+        stlsoft::scoped_handle<arguments_t const*> scoper(args, clasp::releaseArguments);
+
+        int         flags = 0;
+        unsigned    length;
+
+        clasp::binder()
+            .flag("--force", &flags, TEST_1_2_FORCE)
+            .flag("--quiet", &flags, TEST_1_2_QUIET)
+            .option("--length", &length, 0u)
+            .bind(args);
+
+        XTESTS_TEST_INTEGER_EQUAL(TEST_1_2_FORCE | TEST_1_2_QUIET, flags);
+        XTESTS_TEST_INTEGER_EQUAL(100u, length);
+
+        // the second --length is left for check_next_option()
+
+        XTESTS_TEST_BOOLEAN_TRUE(clasp::check_next_option(args, "--length", &length, 0u));
+        XTESTS_TEST_INTEGER_EQUAL(3u, length);
+    }
+}
+
+static void test_1_3()
+{
+    char const* argv[] =
+    {
+        "arg0",
+        "--colour=green",
+        NULL,
+    };
+
+    arguments_t const*  args;
+    int r;
+
+    r = clasp::parseArguments(0, STLSOFT_NUM_ELEMENTS(argv) - 1, argv, Specifications, s_ctxt, &args);
+
+    if (0 != r)
+    {
+        XTESTS_TEST_FAIL_WITH_QUALIFIER("could not parse arguments", stlsoft::error_desc(r));
+    }
+    else
+    {
+        stlsoft::scoped_handle<arguments_t const*> scoper(args, clasp::releaseArguments);
+
+        int colour;
+        int shade;
+
+        clasp::binder()
+            .option("--colour", &colour, &parse_colour, NULL, 0)
+            .option("--shade", &shade, &parse_colour, NULL, -1)
+            .bind(args);
+
+        XTESTS_TEST_INTEGER_EQUAL(2, colour);
+        XTESTS_TEST_INTEGER_EQUAL(-1, shade);
+    }
+}
+
+static void test_1_4()
+{
+    char const* argv[] =
+    {
+        "arg0",
+        "--length=abc",
+        "--ratio=1e400",
+        "--colour=blue",
+        "--force=maybe",
+        NULL,
+    };
+
+    arguments_t const*  args;
+    int r;
+
+    r = clasp::parseArguments(0, STLSOFT_NUM_ELEMENTS(argv) - 1, argv, Specifications, s_ctxt, &args);
+
+    if (0 != r)
+    {
+        XTESTS_TEST_FAIL_WITH_QUALIFIER("could not parse arguments", stlsoft::error_desc(r));
+    }
+    else
+    {
+        stlsoft::scoped_handle<arguments_t const*> scoper(args, clasp::releaseArguments);
+
+        bool            force;
+        int             length;
+        double          ratio;
+        int             colour;
+        clasp_string_t  output;
+
+        try
+        {
+            clasp::binder()
+                .flag("--force", &force)
+                .option("--length", &length, 10)
+                .option("--ratio", &ratio, 0.5)
+                .required_option("--colour", &colour, &parse_colour, NULL)
+                .required_option("--output", &output)
+                .bind(args);
+
+            XTESTS_TEST_FAIL("should not get here");
+        }
+        catch (clasp::binding_exception& x)
+        {
+            XTESTS_TEST_INTEGER_EQUAL(5u, x.errors.size());
+
+            XTESTS_TEST_MULTIBYTE_STRING_EQUAL("value is not an integer for option", x.errors[0].message);
+            XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--length", x.errors[0].optionName);
+            XTESTS_TEST_MULTIBYTE_STRING_EQUAL("value is out of range for option", x.errors[1].message);
+            XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--ratio", x.errors[1].optionName);
+            XTESTS_TEST_MULTIBYTE_STRING_EQUAL("invalid value for option", x.errors[2].message);
+            XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--colour", x.errors[2].optionName);
+            XTESTS_TEST_MULTIBYTE_STRING_EQUAL("option value must be a boolean", x.errors[3].message);
+            XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--force", x.errors[3].optionName);
+            XTESTS_TEST_MULTIBYTE_STRING_EQUAL("required option is not found", x.errors[4].message);
+            XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--output", x.errors[4].optionName);
+        }
+    }
+}
+
+static void test_1_5()
+{
+    char const* argv[] =
+    {
+        "arg0",
+        "--output=",
+        NULL,
+    };
+
+    arguments_t const*  args;
+    int r;
+
+    r = clasp::parseArguments(0, STLSOFT_NUM_ELEMENTS(argv) - 1, argv, Specifications, s_ctxt, &args);
+
+    if (0 != r)
+    {
+        XTESTS_TEST_FAIL_WITH_QUALIFIER("could not parse arguments", stlsoft::error_desc(r));
+    }
+    else
+    {
+        stlsoft::scoped_handle<arguments_t const*> scoper(args, clasp::releaseArguments);
+
+        clasp_char_t const* output;
+
+        try
+        {
+            clasp::binder()
+                .required_option("--output", &output)
+                .bind(args);
+
+            XTESTS_TEST_FAIL("should not get here");
+        }
+        catch (clasp::binding_exception& x)
+        {
+            XTESTS_TEST_INTEGER_EQUAL(1u, x.errors.size());
+            XTESTS_TEST_MULTIBYTE_STRING_EQUAL("value is missing for option: --output", x.what());
+        }
+    }
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
@@ -4,7 +4,7 @@
  * Purpose: Unit-tests for CLASP C++ API
  *
  * Created: 16th July 2009
- * Updated: 11th March 2025
+ * Updated: 19th October 2026
  *
  * ////////////////////////////////////////////////////////////////////// */
 
@@ -77,6 +77,11 @@ namespace
     static void test_2_11();
     static void test_2_12();
     static void test_2_13();
+    static void test_2_14();
+    static void test_2_15();
+    static void test_2_16();
+    static void test_2_17();
+    static void test_2_18();
 } // anonymous namespace
 
 
@@ -146,6 +151,11 @@ int main(int argc, char **argv)
         XTESTS_RUN_CASE(test_2_11);
         XTESTS_RUN_CASE(test_2_12);
         XTESTS_RUN_CASE(test_2_13);
+        XTESTS_RUN_CASE(test_2_14);
+        XTESTS_RUN_CASE_THAT_THROWS(test_2_15, clasp::invalid_option_value_exception);
+        XTESTS_RUN_CASE_THAT_THROWS(test_2_16, clasp::invalid_option_value_exception);
+        XTESTS_RUN_CASE(test_2_17);
+        XTESTS_RUN_CASE(test_2_18);
 
         XTESTS_PRINT_RESULTS();
 
@@ -1381,6 +1391,251 @@ static void test_2_13()
     }
 }
 
+static void test_2_14()
+{
+    static clasp::specification_t const Specifications[] =
+    {
+        CLASP_OPTION("-l", "--length", NULL, NULL),
+
+        CLASP_SPECIFICATION_ARRAY_TERMINATOR
+    };
+
+    char const* argv[] =
+    {
+        "arg0",
+        "--length=-32768",
+        "--length=65535",
+        "--length=-2147483648",
+        "--length=0xffffffff",
+        "--length=+0x7fff",
+        NULL,
+    };
+
+    arguments_t const*  args;
+    int r;
+
+    r = clasp::parseArguments(0, STLSOFT_NUM_ELEMENTS(argv) - 1, argv, Specifications, s_ctxt, &args);
+
+    if (0 != r)
+    {
+        XTESTS_TEST_FAIL_WITH_QUALIFIER("could not parse arguments", stlsoft::error_desc(r));
+    }
+    else
+    {
+        short           length_1;
+
+        XTESTS_TEST_BOOLEAN_TRUE(clasp::check_next_option(args, "--length", &length_1, 0));
+        XTESTS_TEST_INTEGER_EQUAL(-32768, length_1);
+
+        unsigned short  length_2;
+
+        XTESTS_TEST_BOOLEAN_TRUE(clasp::check_next_option(args, "--length", &length_2, 0));
+        XTESTS_TEST_INTEGER_EQUAL(65535u, length_2);
+
+        long            length_3;
+
+        XTESTS_TEST_BOOLEAN_TRUE(clasp::check_next_option(args, "--length", &length_3, 0));
+        XTESTS_TEST_INTEGER_EQUAL(-2147483647L - 1, length_3);
+
+        unsigned long   length_4;
+
+        XTESTS_TEST_BOOLEAN_TRUE(clasp::check_next_option(args, "--length", &length_4, 0));
+        XTESTS_TEST_INTEGER_EQUAL(0xffffffffu, length_4);
+
+        int             length_5;
+
+        XTESTS_TEST_BOOLEAN_TRUE(clasp::check_next_option(args, "--length", &length_5, 0));
+        XTESTS_TEST_INTEGER_EQUAL(0x7fff, length_5);
+
+
+        clasp::releaseArguments(args);
+    }
+}
+
+static void test_2_15()
+{
+    static clasp::specification_t const Specifications[] =
+    {
+        CLASP_OPTION("-l", "--length", NULL, NULL),
+
+        CLASP_SPECIFICATION_ARRAY_TERMINATOR
+    };
+
+    char const* argv[] =
+    {
+        "arg0",
+        "--length=65536",
+        NULL,
+    };
+
+    arguments_t const*  args;
+    int r;
+
+    r = clasp::parseArguments(0, STLSOFT_NUM_ELEMENTS(argv) - 1, argv, Specifications, s_ctxt, &args);
+
+    if (0 != r)
+    {
+        XTESTS_TEST_FAIL_WITH_QUALIFIER("could not parse arguments", stlsoft::error_desc(r));
+    }
+    else
+    {
+        stlsoft::scoped_handle<arguments_t const*> scoper(args, clasp::releaseArguments);
+
+        unsigned short  length;
+
+        clasp::check_option(args, "--length", &length, 0);
+    }
+}
+
+static void test_2_16()
+{
+    static clasp::specification_t const Specifications[] =
+    {
+        CLASP_OPTION("-l", "--length", NULL, NULL),
+
+        CLASP_SPECIFICATION_ARRAY_TERMINATOR
+    };
+
+    char const* argv[] =
+    {
+        "arg0",
+        "--length=12abc",
+        NULL,
+    };
+
+    arguments_t const*  args;
+    int r;
+
+    r = clasp::parseArguments(0, STLSOFT_NUM_ELEMENTS(argv) - 1, argv, Specifications, s_ctxt, &args);
+
+    if (0 != r)
+    {
+        XTESTS_TEST_FAIL_WITH_QUALIFIER("could not parse arguments", stlsoft::error_desc(r));
+    }
+    else
+    {
+        stlsoft::scoped_handle<arguments_t const*> scoper(args, clasp::releaseArguments);
+
+        long    length;
+
+        clasp::require_option(args, "--length", &length);
+    }
+}
+
+static void test_2_17()
+{
+    static clasp::specification_t const Specifications[] =
+    {
+        CLASP_OPTION("-l", "--length", NULL, NULL),
+        CLASP_OPTION("-w", "--width", NULL, NULL),
+
+        CLASP_SPECIFICATION_ARRAY_TERMINATOR
+    };
+
+    char const* argv[] =
+    {
+        "arg0",
+        "--length=2.5e-3",
+        "--length=-0.125",
+        "--length=1e39",
+        "--width=1.2345678901234567890e+300",
+        NULL,
+    };
+
+    arguments_t const*  args;
+    int r;
+
+    r = clasp::parseArguments(0, STLSOFT_NUM_ELEMENTS(argv) - 1, argv, Specifications, s_ctxt, &args);
+
+    if (0 != r)
+    {
+        XTESTS_TEST_FAIL_WITH_QUALIFIER("could not parse arguments", stlsoft::error_desc(r));
+    }
+    else
+    {
+        stlsoft::scoped_handle<arguments_t const*> scoper(args, clasp::releaseArguments);
+
+        float   length_1;
+
+        XTESTS_TEST_BOOLEAN_TRUE(clasp::check_next_option(args, "--length", &length_1, 0.0f));
+        XTESTS_TEST_FLOATINGPOINT_EQUAL(2.5e-3f, length_1);
+
+        double  length_2;
+
+        XTESTS_TEST_BOOLEAN_TRUE(clasp::check_next_option(args, "--length", &length_2, 0.0));
+        XTESTS_TEST_FLOATINGPOINT_EQUAL(-0.125, length_2);
+
+        try
+        {
+            float   length_3;
+
+            clasp::check_next_option(args, "--length", &length_3, 0.0f);
+
+            XTESTS_TEST_FAIL("value out of range for float should throw");
+        }
+        catch (clasp::invalid_option_value_exception&)
+        {
+            XTESTS_TEST_PASSED();
+        }
+
+        double  width;
+
+        clasp::require_option(args, "--width", &width);
+        XTESTS_TEST_FLOATINGPOINT_EQUAL(1.2345678901234567890e+300, width);
+    }
+}
+
+static void test_2_18()
+{
+    static clasp::specification_t const Specifications[] =
+    {
+        CLASP_FLAG("-v", "--verbose", NULL),
+        CLASP_FLAG(NULL, "--version", NULL),
+        CLASP_OPTION("-w", "--width", NULL, NULL),
+
+        CLASP_SPECIFICATION_ARRAY_TERMINATOR
+    };
+
+    char const* argv[] =
+    {
+        "arg0",
+        "--verbsoe",
+        "--widht=10",
+        NULL,
+    };
+
+    arguments_t const*  args;
+    int r;
+
+    r = clasp::parseArguments(0, STLSOFT_NUM_ELEMENTS(argv) - 1, argv, Specifications, s_ctxt, &args);
+
+    if (0 != r)
+    {
+        XTESTS_TEST_FAIL_WITH_QUALIFIER("could not parse arguments", stlsoft::error_desc(r));
+    }
+    else
+    {
+        stlsoft::scoped_handle<arguments_t const*> scoper(args, clasp::releaseArguments);
+
+        try
+        {
+            clasp::verify_all_flags_and_options_are_recognised(args, Specifications);
+
+            XTESTS_TEST_FAIL("unrecognised arguments should throw");
+        }
+        catch (clasp::unrecognised_argument_exception& x)
+        {
+            XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--verbsoe", x.optionName);
+            XTESTS_TEST_INTEGER_EQUAL(1u, x.suggestions.size());
+            if (1u == x.suggestions.size())
+            {
+                XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--verbose", x.suggestions[0]);
+            }
+            XTESTS_TEST_MULTIBYTE_STRING_EQUAL("unrecognised argument(s): --verbsoe; did you mean --verbose?", x.what());
+        }
+    }
+}
+
 } // anonymous namespace
 
 
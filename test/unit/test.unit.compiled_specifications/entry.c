@@ -0,0 +1,356 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.compiled_specifications/entry.c
+ *
+ * Purpose: Unit-test(s) for `clasp_parseArgumentsCompiled()` and
+ *          `clasp_showBodyCompiled()`, with specifications compiled by
+ *          `clasp_compile_specifications()`
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <clasp/clasp.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C header files */
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#if defined(_MSC_VER) && \
+    _MSC_VER >= 1400
+# pragma warning(push)
+# pragma warning(disable : 4996)
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * globals
+ */
+
+/* the same specifications as in specs.def */
+static clasp_specification_t const Specifications[] =
+{
+    CLASP_FLAG("-v", "--verbose", "makes output verbose"),
+    CLASP_FLAG("-q", "--quiet", "suppresses output"),
+    CLASP_OPTION("-w", "--width", "the output width", NULL),
+    CLASP_FLAG("-W", "--width=80", "sets the width to 80"),
+
+    CLASP_GAP_SECTION("other:"),
+
+    CLASP_OPTION(NULL, "--colour", "the \"colour\" of the output", "|red|green|blue|"),
+    CLASP_FLAG(NULL, "--verbose", NULL),
+
+    CLASP_TACIT_SECTION(),
+
+    CLASP_FLAG(NULL, "--debug", "not shown"),
+
+    CLASP_SECTION(1),
+
+    CLASP_STOCK_FLAG_HELP,
+    CLASP_STOCK_FLAG_VERSION,
+
+    CLASP_SPECIFICATION_ARRAY_TERMINATOR
+};
+
+CLASP_DECLARE_COMPILED_SPECIFICATIONS(test_specifications);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+static void test_1_0(void);
+static void test_1_1(void);
+static void test_1_2(void);
+static void test_1_3(void);
+static void test_1_4(void);
+static void test_1_5(void);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main
+ */
+
+int main(int argc, char **argv)
+{
+  int retCode = EXIT_SUCCESS;
+  int verbosity = 2;
+
+  XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+  if (XTESTS_START_RUNNER("test.unit.compiled_specifications", verbosity))
+  {
+    XTESTS_RUN_CASE(test_1_0);
+    XTESTS_RUN_CASE(test_1_1);
+    XTESTS_RUN_CASE(test_1_2);
+    XTESTS_RUN_CASE(test_1_3);
+    XTESTS_RUN_CASE(test_1_4);
+    XTESTS_RUN_CASE(test_1_5);
+
+    XTESTS_PRINT_RESULTS();
+
+    XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+  }
+
+  return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+/* Parses argv by both means, and tests the results are identical */
+static void test_against_linear_(int argc, char const* const* argv)
+{
+  clasp_arguments_t const*  args1;
+  clasp_arguments_t const*  args2;
+  int                       cr;
+
+  cr = clasp_parseArguments(0, argc, (char**)argv, Specifications, NULL, &args1);
+
+  if (0 != cr)
+  {
+    XTESTS_TEST_FAIL_WITH_QUALIFIER("failed to initialise CLASP", strerror(cr));
+
+    return;
+  }
+
+  cr = clasp_parseArgumentsCompiled(0, argc, (char**)argv, &test_specifications, NULL, &args2);
+
+  if (0 != cr)
+  {
+    XTESTS_TEST_FAIL_WITH_QUALIFIER("failed to initialise CLASP", strerror(cr));
+  }
+  else
+  {
+    if (XTESTS_TEST_INTEGER_EQUAL(args1->numArguments, args2->numArguments))
+    {
+      size_t i;
+
+      for (i = 0; i != args1->numArguments; ++i)
+      {
+        clasp_argument_t const* const arg1 = &args1->arguments[i];
+        clasp_argument_t const* const arg2 = &args2->arguments[i];
+
+        XTESTS_TEST_INTEGER_EQUAL(arg1->type, arg2->type);
+        XTESTS_TEST_INTEGER_EQUAL(arg1->aliasIndex, arg2->aliasIndex);
+        XTESTS_TEST_INTEGER_EQUAL(arg1->resolvedName.len, arg2->resolvedName.len);
+        XTESTS_TEST_INTEGER_EQUAL(0, strncmp(arg1->resolvedName.ptr, arg2->resolvedName.ptr, arg1->resolvedName.len));
+        XTESTS_TEST_INTEGER_EQUAL(arg1->value.len, arg2->value.len);
+        XTESTS_TEST_INTEGER_EQUAL(0, (0 == arg1->value.len) ? 0 : strncmp(arg1->value.ptr, arg2->value.ptr, arg1->value.len));
+      }
+    }
+
+    clasp_releaseArguments(args2);
+  }
+
+  clasp_releaseArguments(args1);
+}
+
+/* Reads the whole of a stream into a nul-terminated buffer, which must be
+ * freed by the caller
+ */
+static char* read_stream_(FILE* stm)
+{
+  long  n;
+  char* s;
+
+  fflush(stm);
+  n = ftell(stm);
+  rewind(stm);
+
+  s = (char*)malloc((size_t)n + 1);
+  if (NULL != s)
+  {
+    s[fread(s, 1, (size_t)n, stm)] = '\0';
+  }
+
+  return s;
+}
+
+/* Renders usage body by both means, and tests the results are identical */
+static void test_usage_against_linear_(int flags, int consoleWidth, int tabSize, int blanksBetweenItems)
+{
+  char const* const         argv[] =
+  {
+    "program",
+
+    NULL
+  };
+  int const                 argc = STLSOFT_NUM_ELEMENTS(argv) - 1;
+  clasp_arguments_t const*  args;
+  int const                 cr   = clasp_parseArgumentsCompiled(0, argc, (char**)argv, &test_specifications, NULL, &args);
+
+  if (0 != cr)
+  {
+    XTESTS_TEST_FAIL_WITH_QUALIFIER("failed to initialise CLASP", strerror(cr));
+  }
+  else
+  {
+    FILE* const stm1  = tmpfile();
+    FILE* const stm2  = tmpfile();
+
+    if (NULL == stm1 ||
+        NULL == stm2)
+    {
+      XTESTS_TEST_FAIL_WITH_QUALIFIER("could not create temporary file", strerror(errno));
+    }
+    else
+    {
+      char* s1;
+      char* s2;
+
+      clasp_showBody(args, Specifications, clasp_showBodyByFILE, stm1, flags, consoleWidth, tabSize, blanksBetweenItems);
+
+      XTESTS_TEST_INTEGER_EQUAL(0, clasp_showBodyCompiled(args, &test_specifications, stm2, flags, consoleWidth, tabSize, blanksBetweenItems));
+
+      s1 = read_stream_(stm1);
+      s2 = read_stream_(stm2);
+
+      if (XTESTS_TEST_POINTER_NOT_EQUAL(NULL, s1) &&
+          XTESTS_TEST_POINTER_NOT_EQUAL(NULL, s2))
+      {
+        XTESTS_TEST_BOOLEAN_TRUE(0 != strlen(s1));
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(s1, s2);
+      }
+
+      free(s1);
+      free(s2);
+    }
+
+    if (NULL != stm1)
+    {
+      fclose(stm1);
+    }
+    if (NULL != stm2)
+    {
+      fclose(stm2);
+    }
+
+    clasp_releaseArguments(args);
+  }
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+static void test_1_0(void)
+{
+  char const* const         argv[] =
+  {
+    "program",
+
+    "-v",
+    "--quiet",
+    "-w",
+    "10",
+    "--colour=red",
+    "abc",
+    "--debug",
+
+    NULL
+  };
+
+  test_against_linear_(STLSOFT_NUM_ELEMENTS(argv) - 1, argv);
+}
+
+static void test_1_1(void)
+{
+  char const* const         argv[] =
+  {
+    "program",
+
+    "-W",
+    "--width=20",
+    "-vq",
+    "--unknown",
+    "-x",
+    "--",
+    "-v",
+
+    NULL
+  };
+
+  test_against_linear_(STLSOFT_NUM_ELEMENTS(argv) - 1, argv);
+}
+
+static void test_1_2(void)
+{
+  XTESTS_TEST_INTEGER_EQUAL(clasp_countSpecifications(Specifications), clasp_countSpecifications(test_specifications.index.specifications));
+  XTESTS_TEST_POINTER_NOT_EQUAL(NULL, test_specifications.usageBody);
+  XTESTS_TEST_INTEGER_EQUAL(0, test_specifications.usageFlags);
+  XTESTS_TEST_INTEGER_EQUAL(76, test_specifications.consoleWidth);
+  XTESTS_TEST_INTEGER_EQUAL(-2, test_specifications.tabSize);
+  XTESTS_TEST_INTEGER_EQUAL(1, test_specifications.blanksBetweenItems);
+}
+
+static void test_1_3(void)
+{
+  /* the layout with which the body was pre-rendered */
+  test_usage_against_linear_(0, 76, -2, 1);
+}
+
+static void test_1_4(void)
+{
+  /* a different layout, which is rendered at runtime */
+  test_usage_against_linear_(0, 40, 4, 0);
+}
+
+static void test_1_5(void)
+{
+  clasp_specification_index_t const*  index;
+  int const                           r = clasp_createSpecificationIndex(NULL, Specifications, &index);
+
+  if (0 != r)
+  {
+    XTESTS_TEST_FAIL_WITH_QUALIFIER("could not create index", strerror(r));
+  }
+  else
+  {
+    /* the runtime index is identical to the generated one */
+    if (XTESTS_TEST_INTEGER_EQUAL(test_specifications.index.numBuckets, index->numBuckets) &&
+        XTESTS_TEST_INTEGER_EQUAL(test_specifications.index.numSlots, index->numSlots))
+    {
+      XTESTS_TEST_INTEGER_EQUAL(0, memcmp(test_specifications.index.seeds, index->seeds, sizeof(index->seeds[0]) * index->numBuckets));
+      XTESTS_TEST_INTEGER_EQUAL(0, memcmp(test_specifications.index.slots, index->slots, sizeof(index->slots[0]) * index->numSlots));
+      XTESTS_TEST_INTEGER_EQUAL(0, memcmp(test_specifications.index.shortFlags, index->shortFlags, sizeof(index->shortFlags[0]) * CLASP_SHORT_FLAG_TABLE_SIZE));
+      XTESTS_TEST_INTEGER_EQUAL(test_specifications.index.numWideShortFlags, index->numWideShortFlags);
+      if (XTESTS_TEST_INTEGER_EQUAL(test_specifications.index.numTrieNodes, index->numTrieNodes))
+      {
+        XTESTS_TEST_INTEGER_EQUAL(0, memcmp(test_specifications.index.trieNodes, index->trieNodes, sizeof(index->trieNodes[0]) * index->numTrieNodes));
+      }
+    }
+
+    clasp_destroySpecificationIndex(index);
+  }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
@@ -0,0 +1,271 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.completion/entry.c
+ *
+ * Purpose: Unit-test(s) for clasp_completeArguments() and
+ *          clasp_showCompletionScript()
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <clasp/clasp.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C header files */
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#if defined(_MSC_VER) && \
+    _MSC_VER >= 1400
+# pragma warning(push)
+# pragma warning(disable : 4996)
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * globals
+ */
+
+static clasp_specification_t const Specifications[] =
+{
+    CLASP_FLAG("-v", "--verbose", "verbose"),
+    CLASP_FLAG(NULL, "--version", "show version"),
+    CLASP_OPTION("-f", "--format", "output format", "|json|xml|yaml|"),
+    CLASP_FLAG("-j", "--format=json", "JSON output"),
+    CLASP_OPTION("-o", "--output", "output file", NULL),
+
+    CLASP_SPECIFICATION_ARRAY_TERMINATOR
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+static void test_1_0(void);
+static void test_1_1(void);
+static void test_1_2(void);
+static void test_1_3(void);
+static void test_1_4(void);
+static void test_1_5(void);
+static void test_1_6(void);
+static void test_1_7(void);
+static void test_1_8(void);
+static void test_1_9(void);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main
+ */
+
+int main(int argc, char **argv)
+{
+  int retCode = EXIT_SUCCESS;
+  int verbosity = 2;
+
+  XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+  if (XTESTS_START_RUNNER("test.unit.completion", verbosity))
+  {
+    XTESTS_RUN_CASE(test_1_0);
+    XTESTS_RUN_CASE(test_1_1);
+    XTESTS_RUN_CASE(test_1_2);
+    XTESTS_RUN_CASE(test_1_3);
+    XTESTS_RUN_CASE(test_1_4);
+    XTESTS_RUN_CASE(test_1_5);
+    XTESTS_RUN_CASE(test_1_6);
+    XTESTS_RUN_CASE(test_1_7);
+    XTESTS_RUN_CASE(test_1_8);
+    XTESTS_RUN_CASE(test_1_9);
+
+    XTESTS_PRINT_RESULTS();
+
+    XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+  }
+
+  return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+/* Completes the last of the (NULL-terminated) words, and checks that the
+ * candidates are as expected
+ */
+static void check_(
+  char const* const*  argv
+, size_t              expectedNumCandidates
+, char const*         expectedCandidates
+)
+{
+  int       argc;
+  char*     candidates;
+  size_t    cchCandidates;
+  size_t    numCandidates;
+  int       r;
+
+  for (argc = 0; NULL != argv[argc]; ++argc)
+  {}
+
+  r = clasp_completeArguments(0, argc, (char**)argv, argc - 1, Specifications, NULL, &candidates, &cchCandidates, &numCandidates);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    XTESTS_TEST_INTEGER_EQUAL(expectedNumCandidates, numCandidates);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL(expectedCandidates, candidates);
+    XTESTS_TEST_INTEGER_EQUAL(strlen(expectedCandidates), cchCandidates);
+
+    clasp_releaseCompletionBuffer(NULL, candidates);
+  }
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+static void test_1_0(void)
+{
+  char const* const argv[] = { "tool", "--ver", NULL };
+
+  check_(argv, 2u, "--verbose\n--version\n");
+}
+
+static void test_1_1(void)
+{
+  char const* const argv[] = { "tool", "-", NULL };
+
+  check_(argv, 8u, "-v\n--verbose\n--version\n--format\n--output\n-f\n-j\n-o\n");
+}
+
+static void test_1_2(void)
+{
+  /* the value of a (separately given) option */
+  char const* const argv[] = { "tool", "-v", "--format", "", NULL };
+
+  check_(argv, 3u, "json\nxml\nyaml\n");
+}
+
+static void test_1_3(void)
+{
+  /* the value of an option given by its alias */
+  char const* const argv[] = { "tool", "-f", "y", NULL };
+
+  check_(argv, 1u, "yaml\n");
+}
+
+static void test_1_4(void)
+{
+  /* as separated by bash: "--format=x" */
+  char const* const argv1[] = { "tool", "--format", "=", NULL };
+  char const* const argv2[] = { "tool", "--format", "=", "x", NULL };
+
+  check_(argv1, 3u, "json\nxml\nyaml\n");
+  check_(argv2, 1u, "xml\n");
+}
+
+static void test_1_5(void)
+{
+  /* as given by zsh: "--format=j" */
+  char const* const argv[] = { "tool", "--format=j", NULL };
+
+  check_(argv, 1u, "--format=json\n");
+}
+
+static void test_1_6(void)
+{
+  /* no candidates for a value without a value-set, a value, or after "--" */
+  char const* const argv1[] = { "tool", "-o", "", NULL };
+  char const* const argv2[] = { "tool", "-v", "src", NULL };
+  char const* const argv3[] = { "tool", "--", "--ver", NULL };
+
+  check_(argv1, 0u, "");
+  check_(argv2, 0u, "");
+  check_(argv3, 0u, "");
+}
+
+static void test_1_7(void)
+{
+  /* a flag does not take the next word as its value */
+  char const* const argv[] = { "tool", "-j", "--verb", NULL };
+
+  check_(argv, 1u, "--verbose\n");
+}
+
+static void test_1_8(void)
+{
+  char const* const argv[] = { "tool", "--ver", NULL };
+  char*             candidates;
+
+  XTESTS_TEST_INTEGER_EQUAL(EINVAL, clasp_completeArguments(0, 2, (char**)argv, 0, Specifications, NULL, &candidates, NULL, NULL));
+  XTESTS_TEST_INTEGER_EQUAL(EINVAL, clasp_completeArguments(0, 2, (char**)argv, 3, Specifications, NULL, &candidates, NULL, NULL));
+
+  /* the word following the last is empty */
+  if (XTESTS_TEST_INTEGER_EQUAL(0, clasp_completeArguments(0, 2, (char**)argv, 2, Specifications, NULL, &candidates, NULL, NULL)))
+  {
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", candidates);
+
+    clasp_releaseCompletionBuffer(NULL, candidates);
+  }
+
+  XTESTS_TEST_INTEGER_EQUAL(EINVAL, clasp_showCompletionScript("tool", 0, stdout, NULL));
+}
+
+static void test_1_9(void)
+{
+  /* options whose value-sets have no members */
+  static clasp_specification_t const specifications[] =
+  {
+    CLASP_OPTION(NULL, "--empty", "empty value-set", ""),
+    CLASP_OPTION(NULL, "--blank", "blank value-set", "||"),
+
+    CLASP_SPECIFICATION_ARRAY_TERMINATOR
+  };
+  char const* const argv1[] = { "tool", "--empty=", NULL };
+  char const* const argv2[] = { "tool", "--bl", NULL };
+  char*             candidates;
+  size_t            numCandidates;
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, clasp_completeArguments(0, 2, (char**)argv1, 1, specifications, NULL, &candidates, NULL, &numCandidates)))
+  {
+    XTESTS_TEST_INTEGER_EQUAL(0u, numCandidates);
+
+    clasp_releaseCompletionBuffer(NULL, candidates);
+  }
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, clasp_completeArguments(0, 2, (char**)argv2, 1, specifications, NULL, &candidates, NULL, &numCandidates)))
+  {
+    XTESTS_TEST_INTEGER_EQUAL(1u, numCandidates);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--blank\n", candidates);
+
+    clasp_releaseCompletionBuffer(NULL, candidates);
+  }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,442 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.expected/entry.cpp
+ *
+ * Purpose: Unit-tests for clasp/expected.hpp
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#if __cplusplus >= 201703L || \
+    (   defined(_MSVC_LANG) && \
+        _MSVC_LANG >= 201703L)
+# define CLASP_TEST_EXPECTED_SUPPORTED
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#ifdef CLASP_TEST_EXPECTED_SUPPORTED
+# include <clasp/expected.hpp>
+#endif /* CLASP_TEST_EXPECTED_SUPPORTED */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+#include <stlsoft/error/error_desc.hpp>
+#include <stlsoft/smartptr/scoped_handle.hpp>
+
+/* Standard C header files */
+#include <stdlib.h>
+
+
+#ifdef CLASP_TEST_EXPECTED_SUPPORTED
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_1_0();
+    static void test_1_1();
+    static void test_1_2();
+    static void test_1_3();
+    static void test_1_4();
+    static void test_1_5();
+    static void test_1_6();
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * globals
+ */
+
+clasp_diagnostic_context_t const*   s_ctxt;
+
+#endif /* CLASP_TEST_EXPECTED_SUPPORTED */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+#ifdef CLASP_TEST_EXPECTED_SUPPORTED
+
+    struct stub
+    {
+        static void CLASP_CALLCONV function(
+            void*                /* context */
+        ,   int                  /* severity */
+        ,   clasp_char_t const*  /* fmt */
+        ,   va_list              /* args */
+        )
+        {}
+    };
+
+    clasp_diagnostic_context_t  ctxt;
+
+    ctxt.pfnLog = &stub::function;
+
+    s_ctxt = &ctxt;
+#endif /* CLASP_TEST_EXPECTED_SUPPORTED */
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.expected", verbosity))
+    {
+#ifdef CLASP_TEST_EXPECTED_SUPPORTED
+
+        XTESTS_RUN_CASE(test_1_0);
+        XTESTS_RUN_CASE(test_1_1);
+        XTESTS_RUN_CASE(test_1_2);
+        XTESTS_RUN_CASE(test_1_3);
+        XTESTS_RUN_CASE(test_1_4);
+        XTESTS_RUN_CASE(test_1_5);
+        XTESTS_RUN_CASE(test_1_6);
+#endif /* CLASP_TEST_EXPECTED_SUPPORTED */
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+#ifdef CLASP_TEST_EXPECTED_SUPPORTED
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+    using clasp::arguments_t;
+    using clasp::string_view_t;
+
+    static clasp::specification_t const Specifications[] =
+    {
+        CLASP_FLAG("-v", "--verbose", NULL),
+        CLASP_OPTION("-w", "--width", NULL, NULL),
+        CLASP_OPTION(NULL, "--name", NULL, NULL),
+        CLASP_OPTION(NULL, "--depth", NULL, NULL),
+
+        CLASP_SPECIFICATION_ARRAY_TERMINATOR
+    };
+
+    bool slice_equal_(clasp_slice_t const& slice, char const* s)
+    {
+        return clasp::to_string_view(slice) == string_view_t(s);
+    }
+
+static void test_1_0()
+{
+    clasp::argument_errors<2>   errors;
+
+    XTESTS_TEST_BOOLEAN_TRUE(errors.empty());
+    XTESTS_TEST_INTEGER_EQUAL(0u, errors.size());
+
+    clasp_addArgumentError(&errors, CLASP_ARGERR_MISSING_OPTION, -1, "--a", 3);
+    clasp_addArgumentError(&errors, CLASP_ARGERR_UNUSED_ARGUMENT, 2, "--b", 3);
+    clasp_addArgumentError(&errors, CLASP_ARGERR_UNRECOGNISED_ARGUMENT, 3, "--c", 3);
+
+    XTESTS_TEST_BOOLEAN_FALSE(errors.empty());
+    XTESTS_TEST_INTEGER_EQUAL(2u, errors.size());
+    XTESTS_TEST_INTEGER_EQUAL(3u, errors.num_errors());
+    XTESTS_TEST_BOOLEAN_TRUE(errors.overflowed());
+    XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_MISSING_OPTION, errors[0].kind);
+    XTESTS_TEST_INTEGER_EQUAL(-1, errors[0].cmdLineIndex);
+    XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(errors[0].name, "--a"));
+    XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_UNUSED_ARGUMENT, errors[1].kind);
+    XTESTS_TEST_INTEGER_EQUAL(2, errors[1].cmdLineIndex);
+    XTESTS_TEST_INTEGER_EQUAL(2, errors.end() - errors.begin());
+
+    errors.clear();
+
+    XTESTS_TEST_BOOLEAN_TRUE(errors.empty());
+}
+
+static void test_1_1()
+{
+    char const* argv[] =
+    {
+        "arg0",
+        "--width=10",
+        "--name=abc",
+        NULL,
+    };
+    arguments_t const*  args;
+    int const           r = clasp::parseArguments(0, STLSOFT_NUM_ELEMENTS(argv) - 1, argv, Specifications, s_ctxt, &args);
+
+    if (0 != r)
+    {
+        XTESTS_TEST_FAIL_WITH_QUALIFIER("could not parse arguments", stlsoft::error_desc(r));
+    }
+    else
+    {
+        stlsoft::scoped_handle<arguments_t const*> scoper(args, clasp::releaseArguments);
+
+        clasp::argument_errors<4>   errors;
+
+        clasp::expected<int> const              width   =   clasp::require_option<int>(args, "--width", errors);
+        clasp::expected<string_view_t> const    name    =   clasp::require_option(args, "--name", errors);
+        clasp::expected<int> const              depth   =   clasp::check_option(args, "--depth", 3, errors);
+
+        XTESTS_TEST_BOOLEAN_TRUE(errors.empty());
+
+        XTESTS_REQUIRE(XTESTS_TEST_BOOLEAN_TRUE(width.has_value()));
+        XTESTS_TEST_INTEGER_EQUAL(10, *width);
+        XTESTS_REQUIRE(XTESTS_TEST_BOOLEAN_TRUE(name.has_value()));
+        XTESTS_TEST_BOOLEAN_TRUE(string_view_t("abc") == name.value());
+        XTESTS_REQUIRE(XTESTS_TEST_BOOLEAN_TRUE(depth.has_value()));
+        XTESTS_TEST_INTEGER_EQUAL(3, depth.value());
+
+        XTESTS_TEST_BOOLEAN_TRUE(clasp::verify_all_flags_and_options(args, Specifications, errors));
+    }
+}
+
+static void test_1_2()
+{
+    char const* argv[] =
+    {
+        "arg0",
+        "--width=10x",
+        "--name=",
+        "--depth=99999999999",
+        NULL,
+    };
+    arguments_t const*  args;
+    int const           r = clasp::parseArguments(0, STLSOFT_NUM_ELEMENTS(argv) - 1, argv, Specifications, s_ctxt, &args);
+
+    if (0 != r)
+    {
+        XTESTS_TEST_FAIL_WITH_QUALIFIER("could not parse arguments", stlsoft::error_desc(r));
+    }
+    else
+    {
+        stlsoft::scoped_handle<arguments_t const*> scoper(args, clasp::releaseArguments);
+
+        clasp::argument_errors<8>   errors;
+
+        clasp::expected<int> const              width   =   clasp::require_option<int>(args, "--width", errors);
+        clasp::expected<string_view_t> const    name    =   clasp::require_option(args, "--name", errors);
+        clasp::expected<int> const              depth   =   clasp::check_option(args, "--depth", 3, errors);
+        clasp::expected<int> const              height  =   clasp::require_option<int>(args, "--height", errors);
+
+        XTESTS_TEST_BOOLEAN_FALSE(width.has_value());
+        XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_INVALID_OPTION_VALUE, width.error().kind);
+        XTESTS_TEST_INTEGER_EQUAL(1, width.error().cmdLineIndex);
+        XTESTS_TEST_BOOLEAN_FALSE(name.has_value());
+        XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_MISSING_OPTION_VALUE, name.error().kind);
+        XTESTS_TEST_INTEGER_EQUAL(2, name.error().cmdLineIndex);
+        XTESTS_TEST_BOOLEAN_FALSE(depth.has_value());
+        XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_INVALID_OPTION_VALUE, depth.error().kind);
+        XTESTS_TEST_BOOLEAN_FALSE(height.has_value());
+        XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_MISSING_OPTION, height.error().kind);
+        XTESTS_TEST_INTEGER_EQUAL(-1, height.error().cmdLineIndex);
+        XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(height.error().name, "--height"));
+        XTESTS_TEST_INTEGER_EQUAL(17, height.value_or(17));
+
+        XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(4u, errors.size()));
+        XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_INVALID_OPTION_VALUE, errors[0].kind);
+        XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_MISSING_OPTION_VALUE, errors[1].kind);
+        XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_INVALID_OPTION_VALUE, errors[2].kind);
+        XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_MISSING_OPTION, errors[3].kind);
+    }
+}
+
+static void test_1_3()
+{
+    char const* argv[] =
+    {
+        "arg0",
+        "-v",
+        "--unknown",
+        "--width=10",
+        "-x",
+        "--name=abc",
+        NULL,
+    };
+    arguments_t const*  args;
+    int const           r = clasp::parseArguments(0, STLSOFT_NUM_ELEMENTS(argv) - 1, argv, Specifications, s_ctxt, &args);
+
+    if (0 != r)
+    {
+        XTESTS_TEST_FAIL_WITH_QUALIFIER("could not parse arguments", stlsoft::error_desc(r));
+    }
+    else
+    {
+        stlsoft::scoped_handle<arguments_t const*> scoper(args, clasp::releaseArguments);
+
+        clasp::argument_errors<8>   errors;
+
+        XTESTS_TEST_BOOLEAN_TRUE(clasp::require_option<int>(args, "--width", errors).has_value());
+
+        XTESTS_TEST_BOOLEAN_FALSE(clasp::verify_all_flags_and_options(args, NULL, errors));
+
+        /* -v and --name are unused; --unknown and -x are unrecognised */
+        XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(4u, errors.size()));
+
+        size_t numUnused = 0;
+        size_t numUnrecognised = 0;
+
+        for (clasp::argument_error_t const& error : errors)
+        {
+            switch (error.kind)
+            {
+            case CLASP_ARGERR_UNUSED_ARGUMENT:
+
+                ++numUnused;
+                XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(error.name, "-v") || slice_equal_(error.name, "--name"));
+                break;
+            case CLASP_ARGERR_UNRECOGNISED_ARGUMENT:
+
+                ++numUnrecognised;
+                XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(error.name, "--unknown") || slice_equal_(error.name, "-x"));
+                break;
+            default:
+
+                XTESTS_TEST_FAIL("unexpected error kind");
+                break;
+            }
+
+            XTESTS_TEST_BOOLEAN_TRUE(string_view_t(argv[error.cmdLineIndex]).substr(0, error.name.len) == clasp::to_string_view(error.name));
+        }
+
+        XTESTS_TEST_INTEGER_EQUAL(2u, numUnused);
+        XTESTS_TEST_INTEGER_EQUAL(2u, numUnrecognised);
+    }
+}
+
+static void test_1_4()
+{
+    char const* argv[] =
+    {
+        "arg0",
+        "-v",
+        "--unknown",
+        NULL,
+    };
+    arguments_t const*  args;
+    int const           r = clasp::parseArguments(0, STLSOFT_NUM_ELEMENTS(argv) - 1, argv, Specifications, s_ctxt, &args);
+
+    if (0 != r)
+    {
+        XTESTS_TEST_FAIL_WITH_QUALIFIER("could not parse arguments", stlsoft::error_desc(r));
+    }
+    else
+    {
+        stlsoft::scoped_handle<arguments_t const*> scoper(args, clasp::releaseArguments);
+
+        clasp_argument_error_t  storage[1];
+        clasp_argument_errors_t errors;
+
+        clasp_initArgumentErrors(&errors, storage, STLSOFT_NUM_ELEMENTS(storage));
+
+        XTESTS_TEST_INTEGER_EQUAL(1u, clasp_verifyArguments(args, Specifications, CLASP_VERIFY_F_ALL_RECOGNISED, &errors));
+        XTESTS_TEST_INTEGER_EQUAL(1u, errors.numErrors);
+        XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_UNRECOGNISED_ARGUMENT, storage[0].kind);
+        XTESTS_TEST_INTEGER_EQUAL(2, storage[0].cmdLineIndex);
+
+        XTESTS_TEST_INTEGER_EQUAL(2u, clasp_verifyArguments(args, Specifications, CLASP_VERIFY_F_ALL_USED, &errors));
+        XTESTS_TEST_INTEGER_EQUAL(3u, errors.numErrors);
+
+        XTESTS_TEST_INTEGER_EQUAL(2u, clasp_verifyArguments(args, Specifications, CLASP_VERIFY_F_ALL_RECOGNISED | CLASP_VERIFY_F_ALL_USED, NULL));
+        XTESTS_TEST_INTEGER_EQUAL(0u, clasp_verifyArguments(args, Specifications, 0, NULL));
+    }
+}
+
+static void test_1_5()
+{
+    char const* argv[] =
+    {
+        "arg0",
+        "--width=abc",
+        NULL,
+    };
+    arguments_t const*  args;
+    int const           r = clasp::parseArguments(0, STLSOFT_NUM_ELEMENTS(argv) - 1, argv, Specifications, s_ctxt, &args);
+
+    if (0 != r)
+    {
+        XTESTS_TEST_FAIL_WITH_QUALIFIER("could not parse arguments", stlsoft::error_desc(r));
+    }
+    else
+    {
+        stlsoft::scoped_handle<arguments_t const*> scoper(args, clasp::releaseArguments);
+
+        // errors beyond the capacity are counted, and still returned
+
+        clasp::argument_errors<1>       errors;
+        clasp::expected<double> const   width   =   clasp::require_option<double>(args, "--width", errors);
+        clasp::expected<double> const   height  =   clasp::require_option<double>(args, "--height", errors);
+
+        XTESTS_TEST_BOOLEAN_FALSE(width);
+        XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_INVALID_OPTION_VALUE, width.error().kind);
+        XTESTS_TEST_BOOLEAN_FALSE(height);
+        XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_MISSING_OPTION, height.error().kind);
+
+        XTESTS_TEST_INTEGER_EQUAL(1u, errors.size());
+        XTESTS_TEST_INTEGER_EQUAL(2u, errors.num_errors());
+    }
+}
+
+static void test_1_6()
+{
+    char const* argv[] =
+    {
+        "arg0",
+        "--width",
+        NULL,
+    };
+    arguments_t const*  args;
+    int const           r = clasp::parseArguments(0, STLSOFT_NUM_ELEMENTS(argv) - 1, argv, Specifications, s_ctxt, &args);
+
+    if (0 != r)
+    {
+        XTESTS_TEST_FAIL_WITH_QUALIFIER("could not parse arguments", stlsoft::error_desc(r));
+    }
+    else
+    {
+        stlsoft::scoped_handle<arguments_t const*> scoper(args, clasp::releaseArguments);
+
+        // an option without a value takes the default
+
+        clasp::argument_errors<1>       errors;
+        clasp::expected<int> const      width = clasp::check_option(args, "--width", 80, errors);
+
+        XTESTS_TEST_BOOLEAN_TRUE(errors.empty());
+        XTESTS_REQUIRE(XTESTS_TEST_BOOLEAN_TRUE(width.has_value()));
+        XTESTS_TEST_INTEGER_EQUAL(80, *width);
+    }
+}
+} // anonymous namespace
+
+#endif /* CLASP_TEST_EXPECTED_SUPPORTED */
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
@@ -4,7 +4,7 @@
  * Purpose: Unit-tests exceptional inputs
  *
  * Created: 7th March 2013
- * Updated: 10th March 2025
+ * Updated: 19th October 2026
  *
  * ////////////////////////////////////////////////////////////////////// */
 
@@ -76,6 +76,7 @@ namespace
     static void test_1_3();
     static void test_1_4();
     static void test_1_6();
+    static void test_1_7();
 } // anonymous namespace
 
 
@@ -115,6 +116,7 @@ int main(int argc, char **argv)
         XTESTS_RUN_CASE(test_1_3);
         XTESTS_RUN_CASE(test_1_4);
         XTESTS_RUN_CASE(test_1_6);
+        XTESTS_RUN_CASE(test_1_7);
 
         XTESTS_PRINT_RESULTS();
 
@@ -570,6 +572,69 @@ static void test_1_6()
     ,   "program-path-1.6: invalid command-line: value is not a real number for option: --opt-real-2"
     );
 }
+
+static void test_1_7()
+{
+    static char const* const args[] =
+    {
+        "/usr/bin/applet-1.7",
+
+        "--x",
+
+        NULL
+    };
+
+    struct main_
+    {
+        static
+        int
+        fn(
+            clasp::arguments_t const* args
+        )
+        {
+            clasp::verify_all_options_used(args);
+
+            return EXIT_SUCCESS;
+        }
+    };
+
+    static clasp::applet_t const s_applets[] =
+    {
+        CLASP_APPLET("applet-1.6", NULL, &main_::fn),
+        CLASP_APPLET("applet-1.7", NULL, &main_::fn),
+
+        CLASP_APPLET_ARRAY_TERMINATOR
+    };
+
+    clasp_applet_registry_t const* registry;
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(0, ::clasp_createAppletRegistry(NULL, s_applets, &registry)));
+
+    Test_stderr = ::fopen(Test_path, "w");
+
+    XTESTS_REQUIRE(XTESTS_TEST_POINTER_NOT_EQUAL(NULL, Test_stderr));
+
+    int const r = clasp::main::invoke(
+                        int(STLSOFT_NUM_ELEMENTS(args) - 1)
+                    ,   args
+                    ,   registry
+                    ,   0
+                    );
+
+    ::clasp_destroyAppletRegistry(registry);
+
+    XTESTS_TEST_INTEGER_NOT_EQUAL(0, r);
+
+    ::fflush(Test_stderr);
+    ::fclose(Test_stderr);
+
+    platformstl::file_lines     lines(Test_path);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(1u, lines.size()))
+    {
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("applet-1.7: invalid command-line: unused argument: --x", lines[0]);
+    }
+}
 } // anonymous namespace
 
 
@@ -0,0 +1,420 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.parseapi.append/entry.c
+ *
+ * Purpose: Unit-test(s) for clasp_appendArguments()
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <clasp/clasp.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C header files */
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#if defined(_MSC_VER) && \
+    _MSC_VER >= 1400
+# pragma warning(push)
+# pragma warning(disable : 4996)
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * globals
+ */
+
+static clasp_specification_t const Specifications[] =
+{
+    CLASP_FLAG("-v", "--verbose", "verbose"),
+    CLASP_FLAG("-q", "--quiet", "quiet"),
+    CLASP_OPTION("-w", "--width", "width", NULL),
+
+    CLASP_SPECIFICATION_ARRAY_TERMINATOR
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+static void test_1_0(void);
+static void test_1_1(void);
+static void test_1_2(void);
+static void test_1_3(void);
+static void test_1_4(void);
+static void test_1_5(void);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main
+ */
+
+int main(int argc, char **argv)
+{
+  int retCode = EXIT_SUCCESS;
+  int verbosity = 2;
+
+  XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+  if (XTESTS_START_RUNNER("test.unit.parseapi.append", verbosity))
+  {
+    XTESTS_RUN_CASE(test_1_0);
+    XTESTS_RUN_CASE(test_1_1);
+    XTESTS_RUN_CASE(test_1_2);
+    XTESTS_RUN_CASE(test_1_3);
+    XTESTS_RUN_CASE(test_1_4);
+    XTESTS_RUN_CASE(test_1_5);
+
+    XTESTS_PRINT_RESULTS();
+
+    XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+  }
+
+  return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+static int slice_equal_(clasp_slice_t const* slice, char const* s)
+{
+  if (NULL == s)
+  {
+    return 0 == slice->len;
+  }
+  else
+  {
+    return strlen(s) == slice->len && 0 == strncmp(slice->ptr, s, slice->len);
+  }
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+static void test_1_0(void)
+{
+  char const* const         argv[] =
+  {
+    "program",
+
+    "-v",
+    "--width=10",
+    "abc",
+
+    NULL
+  };
+  char const* const         fromEnv[] =
+  {
+    "-q",
+    "--width=20",
+    "def",
+  };
+  int const                 argc = STLSOFT_NUM_ELEMENTS(argv) - 1;
+  clasp_arguments_t const*  args;
+  int                       cr   = clasp_parseArguments(0, argc, (char**)argv, Specifications, NULL, &args);
+
+  if (0 != cr)
+  {
+    XTESTS_TEST_FAIL_WITH_QUALIFIER("failed to initialise CLASP", strerror(cr));
+  }
+  else
+  {
+    cr = clasp_appendArguments(&args, 1, STLSOFT_NUM_ELEMENTS(fromEnv), (char**)fromEnv);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, cr))
+    {
+      XTESTS_TEST_INTEGER_EQUAL(6u, args->numArguments);
+      XTESTS_TEST_INTEGER_EQUAL(argc, args->argc);
+      XTESTS_TEST_POINTER_EQUAL(argv, args->argv);
+      XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(&args->programName, "program"));
+
+      if (XTESTS_TEST_INTEGER_EQUAL(2u, args->numFlags))
+      {
+        XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(&args->flags[0].resolvedName, "--verbose"));
+        XTESTS_TEST_INTEGER_EQUAL(0, args->flags[0].source);
+        XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(&args->flags[1].resolvedName, "--quiet"));
+        XTESTS_TEST_INTEGER_EQUAL(1, args->flags[1].source);
+        XTESTS_TEST_INTEGER_EQUAL(0, args->flags[1].cmdLineIndex);
+      }
+
+      if (XTESTS_TEST_INTEGER_EQUAL(2u, args->numOptions))
+      {
+        XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(&args->options[0].value, "10"));
+        XTESTS_TEST_INTEGER_EQUAL(0, args->options[0].source);
+        XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(&args->options[1].value, "20"));
+        XTESTS_TEST_INTEGER_EQUAL(1, args->options[1].source);
+      }
+
+      if (XTESTS_TEST_INTEGER_EQUAL(2u, args->numValues))
+      {
+        XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(&args->values[0].value, "abc"));
+        XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(&args->values[1].value, "def"));
+        XTESTS_TEST_INTEGER_EQUAL(1, args->values[1].source);
+      }
+
+      XTESTS_TEST_INTEGER_EQUAL(4u, args->numFlagsAndOptions);
+      XTESTS_TEST_POINTER_EQUAL(args->flags, args->flagsAndOptions);
+      XTESTS_TEST_POINTER_EQUAL(args->flags, args->arguments);
+
+      /* the command-line takes precedence */
+      {
+        clasp_argument_t const* const arg = clasp_findFlagOrOption(args, "--width", 0);
+
+        if (XTESTS_TEST_POINTER_NOT_EQUAL(NULL, arg))
+        {
+          XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(&arg->value, "10"));
+        }
+      }
+    }
+
+    clasp_releaseArguments(args);
+  }
+}
+
+static void test_1_1(void)
+{
+  char const* const         argv[] =
+  {
+    "program",
+
+    "-v",
+
+    NULL
+  };
+  char const* const         fromConfig[] =
+  {
+    "-w",
+    "30",
+  };
+  char const* const         fromEnv[] =
+  {
+    "-v",
+    "ghi",
+  };
+  clasp_arguments_t const*  args;
+  int                       cr   = clasp_parseArguments(0, STLSOFT_NUM_ELEMENTS(argv) - 1, (char**)argv, Specifications, NULL, &args);
+
+  if (0 != cr)
+  {
+    XTESTS_TEST_FAIL_WITH_QUALIFIER("failed to initialise CLASP", strerror(cr));
+  }
+  else
+  {
+    clasp_useArgument(args, &args->flags[0]);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, clasp_appendArguments(&args, 1, STLSOFT_NUM_ELEMENTS(fromConfig), (char**)fromConfig)) &&
+        XTESTS_TEST_INTEGER_EQUAL(0, clasp_appendArguments(&args, 2, STLSOFT_NUM_ELEMENTS(fromEnv), (char**)fromEnv)))
+    {
+      if (XTESTS_TEST_INTEGER_EQUAL(2u, args->numFlags))
+      {
+        XTESTS_TEST_INTEGER_EQUAL(0, args->flags[0].source);
+        XTESTS_TEST_BOOLEAN_TRUE(clasp_argumentIsUsed(args, &args->flags[0]));
+        XTESTS_TEST_INTEGER_EQUAL(2, args->flags[1].source);
+        XTESTS_TEST_BOOLEAN_FALSE(clasp_argumentIsUsed(args, &args->flags[1]));
+      }
+
+      if (XTESTS_TEST_INTEGER_EQUAL(1u, args->numOptions))
+      {
+        XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(&args->options[0].resolvedName, "--width"));
+        XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(&args->options[0].givenName, "-w"));
+        XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(&args->options[0].value, "30"));
+        XTESTS_TEST_INTEGER_EQUAL(1, args->options[0].source);
+      }
+
+      if (XTESTS_TEST_INTEGER_EQUAL(1u, args->numValues))
+      {
+        XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(&args->values[0].value, "ghi"));
+        XTESTS_TEST_INTEGER_EQUAL(2, args->values[0].source);
+      }
+
+      XTESTS_TEST_INTEGER_EQUAL(2u, clasp_reportUnusedFlagsAndOptions(args, NULL, 0));
+    }
+
+    clasp_releaseArguments(args);
+  }
+}
+
+static void test_1_2(void)
+{
+  char const* const         argv[] =
+  {
+    "program",
+
+    "-v",
+
+    NULL
+  };
+  clasp_arguments_t const*  args;
+  int                       cr   = clasp_parseArguments(0, STLSOFT_NUM_ELEMENTS(argv) - 1, (char**)argv, Specifications, NULL, &args);
+
+  if (0 != cr)
+  {
+    XTESTS_TEST_FAIL_WITH_QUALIFIER("failed to initialise CLASP", strerror(cr));
+  }
+  else
+  {
+    clasp_arguments_t const* const original = args;
+
+    XTESTS_TEST_INTEGER_EQUAL(0, clasp_appendArguments(&args, 1, 0, NULL));
+    XTESTS_TEST_POINTER_EQUAL(original, args);
+
+    XTESTS_TEST_INTEGER_EQUAL(EINVAL, clasp_appendArguments(&args, 0, 1, (char**)argv));
+    XTESTS_TEST_INTEGER_EQUAL(EINVAL, clasp_appendArguments(&args, 1, -1, (char**)argv));
+    XTESTS_TEST_POINTER_EQUAL(original, args);
+
+    clasp_releaseArguments(args);
+  }
+}
+
+static void test_1_3(void)
+{
+  char const* const         argv[] =
+  {
+    "program",
+
+    "abc",
+    "-v",
+
+    NULL
+  };
+  char const* const         fromEnv[] =
+  {
+    "def",
+    "-q",
+  };
+  clasp_arguments_t const*  args;
+  int                       cr   = clasp_parseArguments(CLASP_F_PRESERVE_ORIGINAL_ARGUMENT_ORDER, STLSOFT_NUM_ELEMENTS(argv) - 1, (char**)argv, Specifications, NULL, &args);
+
+  if (0 != cr)
+  {
+    XTESTS_TEST_FAIL_WITH_QUALIFIER("failed to initialise CLASP", strerror(cr));
+  }
+  else
+  {
+    cr = clasp_appendArguments(&args, 1, STLSOFT_NUM_ELEMENTS(fromEnv), (char**)fromEnv);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, cr) &&
+        XTESTS_TEST_INTEGER_EQUAL(4u, args->numArguments))
+    {
+      XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(&args->arguments[0].value, "abc"));
+      XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(&args->arguments[1].resolvedName, "--verbose"));
+      XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(&args->arguments[2].value, "def"));
+      XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(&args->arguments[3].resolvedName, "--quiet"));
+      XTESTS_TEST_INTEGER_EQUAL(1, args->arguments[3].source);
+      XTESTS_TEST_POINTER_EQUAL(NULL, args->flags);
+    }
+
+    clasp_releaseArguments(args);
+  }
+}
+
+static void test_1_4(void)
+{
+  clasp_specification_index_t const*  index;
+  int                                 r = clasp_createSpecificationIndex(NULL, Specifications, &index);
+
+  if (0 != r)
+  {
+    XTESTS_TEST_FAIL_WITH_QUALIFIER("could not create index", strerror(r));
+  }
+  else
+  {
+    char const* const     argv[] = { "program", "-v", NULL };
+    char** const          argvs[] = { (char**)argv };
+    int const             argcs[] = { 2 };
+    clasp_batch_result_t  results[1];
+
+    r = clasp_parseArgumentsBatch(0, 1, argcs, argvs, index, NULL, results, NULL);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+    {
+      clasp_arguments_t const* args = results[0].args;
+
+      /* results of a batch share one block, and cannot be extended */
+      XTESTS_TEST_INTEGER_EQUAL(EINVAL, clasp_appendArguments(&args, 1, 1, (char**)argv + 1));
+      XTESTS_TEST_POINTER_EQUAL(results[0].args, args);
+
+      clasp_releaseArgumentsBatch(1, results);
+    }
+
+    clasp_destroySpecificationIndex(index);
+  }
+}
+
+static void test_1_5(void)
+{
+  clasp_specification_index_t const*  index;
+  int                                 r = clasp_createSpecificationIndex(NULL, Specifications, &index);
+
+  if (0 != r)
+  {
+    XTESTS_TEST_FAIL_WITH_QUALIFIER("could not create index", strerror(r));
+  }
+  else
+  {
+    char const* const         argv[]    = { "program", "-v", NULL };
+    char const* const         fromEnv[] = { "--qu", "--wid=20" };
+    clasp_arguments_t const*  args;
+
+    /* the appended arguments are parsed via the index of the original
+     * parse, and so with its prefix trie
+     */
+    r = clasp_parseArgumentsWithIndex(CLASP_F_ALLOW_UNIQUE_PREFIXES, 2, (char**)argv, index, NULL, &args);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+    {
+      r = clasp_appendArguments(&args, 1, STLSOFT_NUM_ELEMENTS(fromEnv), (char**)fromEnv);
+
+      if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+      {
+        if (XTESTS_TEST_INTEGER_EQUAL(2u, args->numFlags))
+        {
+          XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(&args->flags[1].resolvedName, "--quiet"));
+          XTESTS_TEST_INTEGER_EQUAL(1, args->flags[1].aliasIndex);
+        }
+
+        if (XTESTS_TEST_INTEGER_EQUAL(1u, args->numOptions))
+        {
+          XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(&args->options[0].resolvedName, "--width"));
+          XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(&args->options[0].value, "20"));
+        }
+      }
+
+      clasp_releaseArguments(args);
+    }
+
+    clasp_destroySpecificationIndex(index);
+  }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
@@ -0,0 +1,353 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.parseapi.applets/entry.c
+ *
+ * Purpose: Unit-test(s) for clasp_createAppletRegistry() and
+ *          clasp_parseApplet()
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <clasp/clasp.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C header files */
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#if defined(_MSC_VER) && \
+    _MSC_VER >= 1400
+# pragma warning(push)
+# pragma warning(disable : 4996)
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+static int ls_main(clasp_arguments_t const* args);
+static int cat_main(clasp_arguments_t const* args);
+
+static void test_1_0(void);
+static void test_1_1(void);
+static void test_1_2(void);
+static void test_1_3(void);
+static void test_1_4(void);
+static void test_1_5(void);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * globals
+ */
+
+static clasp_specification_t const LsSpecifications[] =
+{
+    CLASP_FLAG("-a", "--all", "show all entries"),
+    CLASP_FLAG("-l", "--long", "use long listing format"),
+
+    CLASP_SPECIFICATION_ARRAY_TERMINATOR
+};
+
+static clasp_specification_t const CatSpecifications[] =
+{
+    CLASP_FLAG("-n", "--number", "number all output lines"),
+
+    CLASP_SPECIFICATION_ARRAY_TERMINATOR
+};
+
+static clasp_applet_t const Applets[] =
+{
+    CLASP_APPLET("ls", LsSpecifications, ls_main),
+    CLASP_APPLET("cat", CatSpecifications, cat_main),
+    CLASP_APPLET("true", NULL, NULL),
+
+    CLASP_APPLET_ARRAY_TERMINATOR
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main
+ */
+
+int main(int argc, char **argv)
+{
+  int retCode = EXIT_SUCCESS;
+  int verbosity = 2;
+
+  XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+  if (XTESTS_START_RUNNER("test.unit.parseapi.applets", verbosity))
+  {
+    XTESTS_RUN_CASE(test_1_0);
+    XTESTS_RUN_CASE(test_1_1);
+    XTESTS_RUN_CASE(test_1_2);
+    XTESTS_RUN_CASE(test_1_3);
+    XTESTS_RUN_CASE(test_1_4);
+    XTESTS_RUN_CASE(test_1_5);
+
+    XTESTS_PRINT_RESULTS();
+
+    XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+  }
+
+  return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+static int ls_main(clasp_arguments_t const* args)
+{
+  return (int)args->numFlags;
+}
+
+static int cat_main(clasp_arguments_t const* args)
+{
+  return 100 + (int)args->numValues;
+}
+
+/* Counts the indexes created via the context */
+static size_t s_numIndexes;
+
+static void CLASP_CALLCONV trace_(
+  void*               context
+, clasp_alloc_op_t    op
+, clasp_alloc_site_t  site
+, void*               pvOld
+, void*               pvNew
+, size_t              cb
+)
+{
+  ((void)context);
+  ((void)pvOld);
+  ((void)pvNew);
+  ((void)cb);
+
+  if (CLASP_ALLOC_OP_MALLOC == op &&
+      CLASP_ALLOC_SITE_INDEX == site)
+  {
+    ++s_numIndexes;
+  }
+}
+
+static int parse_(
+  clasp_applet_registry_t const*  registry
+, clasp_diagnostic_context_t const* ctxt
+, char const* const*              argv
+, clasp_applet_t const**          applet
+, clasp_arguments_t const**       args
+)
+{
+  int argc;
+
+  for (argc = 0; NULL != argv[argc]; ++argc)
+  {}
+
+  return clasp_parseApplet(0, argc, (char**)argv, registry, ctxt, applet, args);
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+static void test_1_0(void)
+{
+  clasp_applet_registry_t const*  registry;
+  int                             r = clasp_createAppletRegistry(NULL, Applets, &registry);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    char const* const         argv[] = { "ls", "-la", "dir", NULL };
+    clasp_applet_t const*     applet;
+    clasp_arguments_t const*  args;
+
+    r = parse_(registry, NULL, argv, &applet, &args);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+    {
+      XTESTS_TEST_POINTER_EQUAL(&Applets[0], applet);
+      XTESTS_TEST_MULTIBYTE_STRING_EQUAL("ls", args->programName.ptr);
+      XTESTS_TEST_INTEGER_EQUAL(2u, args->numFlags);
+      XTESTS_TEST_INTEGER_EQUAL(1u, args->numValues);
+      XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--all", args->flags[0].resolvedName.ptr);
+      XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--long", args->flags[1].resolvedName.ptr);
+      XTESTS_TEST_INTEGER_EQUAL(2, applet->pfnMain(args));
+
+      clasp_releaseArguments(args);
+    }
+
+    clasp_destroyAppletRegistry(registry);
+  }
+}
+
+static void test_1_1(void)
+{
+  clasp_applet_registry_t const*  registry;
+  int                             r = clasp_createAppletRegistry(NULL, Applets, &registry);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    /* the applet is named by argv[0] without its directory */
+    char const* const         argv[] = { "/usr/local/bin/cat", "-n", "a.txt", "b.txt", NULL };
+    clasp_applet_t const*     applet;
+    clasp_arguments_t const*  args;
+
+    r = parse_(registry, NULL, argv, &applet, &args);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+    {
+      XTESTS_TEST_POINTER_EQUAL(&Applets[1], applet);
+      XTESTS_TEST_MULTIBYTE_STRING_EQUAL("cat", args->programName.ptr);
+      XTESTS_TEST_INTEGER_EQUAL(1u, args->numFlags);
+      XTESTS_TEST_INTEGER_EQUAL(2u, args->numValues);
+      XTESTS_TEST_INTEGER_EQUAL(102, applet->pfnMain(args));
+
+      clasp_releaseArguments(args);
+    }
+
+    clasp_destroyAppletRegistry(registry);
+  }
+}
+
+static void test_1_2(void)
+{
+  clasp_applet_registry_t const*  registry;
+  int                             r = clasp_createAppletRegistry(NULL, Applets, &registry);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    char const* const         argv[] = { "toolbox", "ls", NULL };
+    clasp_applet_t const*     applet;
+    clasp_arguments_t const*  args;
+
+    r = parse_(registry, NULL, argv, &applet, &args);
+
+    XTESTS_TEST_INTEGER_EQUAL(ENOENT, r);
+    XTESTS_TEST_POINTER_EQUAL(NULL, applet);
+    XTESTS_TEST_POINTER_EQUAL(NULL, args);
+
+    clasp_destroyAppletRegistry(registry);
+  }
+}
+
+static void test_1_3(void)
+{
+  clasp_applet_registry_t const*  registry;
+  int                             r = clasp_createAppletRegistry(NULL, Applets, &registry);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    /* an applet without specifications */
+    char const* const         argv[] = { "true", "--anything", NULL };
+    clasp_applet_t const*     applet;
+    clasp_arguments_t const*  args;
+
+    r = parse_(registry, NULL, argv, &applet, &args);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+    {
+      XTESTS_TEST_POINTER_EQUAL(&Applets[2], applet);
+      XTESTS_TEST_POINTER_EQUAL(NULL, applet->pfnMain);
+      XTESTS_TEST_INTEGER_EQUAL(1u, args->numFlags);
+
+      clasp_releaseArguments(args);
+    }
+
+    clasp_destroyAppletRegistry(registry);
+  }
+}
+
+static void test_1_4(void)
+{
+  /* only the specifications of the selected applet are indexed, once */
+  clasp_diagnostic_context_t      ctxt;
+  clasp_applet_registry_t const*  registry;
+  int                             r;
+
+  clasp_init_diagnostic_context(&ctxt, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+  ctxt.pfnTrace = trace_;
+
+  s_numIndexes = 0;
+
+  r = clasp_createAppletRegistry(&ctxt, Applets, &registry);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    char const* const         argv[] = { "ls", "-l", NULL };
+    clasp_applet_t const*     applet;
+    clasp_arguments_t const*  args;
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, s_numIndexes);
+
+    r = parse_(registry, &ctxt, argv, &applet, &args);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+    {
+      clasp_releaseArguments(args);
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, s_numIndexes);
+
+    r = parse_(registry, &ctxt, argv, &applet, &args);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+    {
+      clasp_releaseArguments(args);
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, s_numIndexes);
+
+    clasp_destroyAppletRegistry(registry);
+  }
+}
+
+static void test_1_5(void)
+{
+  static clasp_applet_t const Duplicates[] =
+  {
+      CLASP_APPLET("ls", LsSpecifications, ls_main),
+      CLASP_APPLET("ls", CatSpecifications, cat_main),
+
+      CLASP_APPLET_ARRAY_TERMINATOR
+  };
+
+  clasp_diagnostic_context_t      ctxt;
+  clasp_applet_registry_t const*  registry;
+  int                             r;
+
+  clasp_init_diagnostic_context(&ctxt, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+
+  r = clasp_createAppletRegistry(&ctxt, Duplicates, &registry);
+
+  XTESTS_TEST_INTEGER_EQUAL(EINVAL, r);
+  XTESTS_TEST_POINTER_EQUAL(NULL, registry);
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
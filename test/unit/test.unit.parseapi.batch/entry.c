@@ -0,0 +1,386 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.parseapi.batch/entry.c
+ *
+ * Purpose: Unit-test(s) for clasp_parseArgumentsBatch()
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <clasp/clasp.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C header files */
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#if defined(_MSC_VER) && \
+    _MSC_VER >= 1400
+# pragma warning(push)
+# pragma warning(disable : 4996)
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * globals
+ */
+
+static clasp_specification_t const Specifications[] =
+{
+    CLASP_FLAG("-v", "--verbose", "verbose"),
+    CLASP_FLAG("-q", "--quiet", "quiet"),
+    CLASP_OPTION("-w", "--width", "width", NULL),
+    CLASP_FLAG("-W", "--width=80", "width 80"),
+
+    CLASP_SPECIFICATION_ARRAY_TERMINATOR
+};
+
+static char const* const argv0[] = { "job0", "-v", "--width=10", "abc", NULL };
+static char const* const argv1[] = { "job1", NULL };
+static char const* const argv2[] = { "job2", "-vqW", "--unknown", "-w", "20", "--", "-v", NULL };
+static char const* const argv3[] = { "job3", "def", "ghi", "-q", NULL };
+
+static char** const JobArgvs[] =
+{
+    (char**)argv0,
+    (char**)argv1,
+    (char**)argv2,
+    (char**)argv3,
+};
+static int const JobArgcs[] =
+{
+    STLSOFT_NUM_ELEMENTS(argv0) - 1,
+    STLSOFT_NUM_ELEMENTS(argv1) - 1,
+    STLSOFT_NUM_ELEMENTS(argv2) - 1,
+    STLSOFT_NUM_ELEMENTS(argv3) - 1,
+};
+
+#define NUM_JOBS                                            STLSOFT_NUM_ELEMENTS(JobArgcs)
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+static void test_1_0(void);
+static void test_1_1(void);
+static void test_1_2(void);
+static void test_1_3(void);
+static void test_1_4(void);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main
+ */
+
+int main(int argc, char **argv)
+{
+  int retCode = EXIT_SUCCESS;
+  int verbosity = 2;
+
+  XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+  if (XTESTS_START_RUNNER("test.unit.parseapi.batch", verbosity))
+  {
+    XTESTS_RUN_CASE(test_1_0);
+    XTESTS_RUN_CASE(test_1_1);
+    XTESTS_RUN_CASE(test_1_2);
+    XTESTS_RUN_CASE(test_1_3);
+    XTESTS_RUN_CASE(test_1_4);
+
+    XTESTS_PRINT_RESULTS();
+
+    XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+  }
+
+  return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+static int slice_equal_(clasp_slice_t const* slice1, clasp_slice_t const* slice2)
+{
+  return slice1->len == slice2->len && (0 == slice1->len || 0 == strncmp(slice1->ptr, slice2->ptr, slice1->len));
+}
+
+/* A pool that runs the jobs in reverse order, and counts them */
+static size_t s_numPoolJobs;
+
+static void CLASP_CALLCONV reverse_for_each_(
+  void*                 context
+, size_t                numJobs
+, clasp_batch_job_fn_t  pfnJob
+, void*                 param
+)
+{
+  ((void)context);
+
+  for (; 0 != numJobs; --numJobs)
+  {
+    ++s_numPoolJobs;
+
+    (*pfnJob)(param, numJobs - 1);
+  }
+}
+
+/* An allocator that fails every allocation */
+static void* CLASP_CALLCONV failing_malloc_(void* context, size_t cb)
+{
+  ((void)context);
+  ((void)cb);
+
+  return NULL;
+}
+static void* CLASP_CALLCONV failing_realloc_(void* context, void* pv, size_t cb)
+{
+  ((void)context);
+  ((void)pv);
+  ((void)cb);
+
+  return NULL;
+}
+static void CLASP_CALLCONV failing_free_(void* context, void* pv)
+{
+  ((void)context);
+
+  free(pv);
+}
+
+/* Tests that each result of the batch is identical to that of parsing its
+ * command-line alone
+ */
+static void test_against_single_(
+  clasp_specification_index_t const*  index
+, clasp_batch_result_t const          results[]
+)
+{
+  size_t i;
+
+  for (i = 0; i != NUM_JOBS; ++i)
+  {
+    clasp_arguments_t const*  args;
+    int const                 cr = clasp_parseArgumentsWithIndex(0, JobArgcs[i], JobArgvs[i], index, NULL, &args);
+
+    XTESTS_TEST_INTEGER_EQUAL(cr, results[i].result);
+
+    if (0 == cr)
+    {
+      clasp_arguments_t const* const args2 = results[i].args;
+
+      if (XTESTS_TEST_POINTER_NOT_EQUAL(NULL, args2) &&
+          XTESTS_TEST_INTEGER_EQUAL(args->numArguments, args2->numArguments))
+      {
+        size_t j;
+
+        XTESTS_TEST_INTEGER_EQUAL(args->numFlags, args2->numFlags);
+        XTESTS_TEST_INTEGER_EQUAL(args->numOptions, args2->numOptions);
+        XTESTS_TEST_INTEGER_EQUAL(args->numValues, args2->numValues);
+        XTESTS_TEST_INTEGER_EQUAL(args->argc, args2->argc);
+        XTESTS_TEST_POINTER_EQUAL(args->argv, args2->argv);
+        XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(&args->programName, &args2->programName));
+
+        for (j = 0; j != args->numArguments; ++j)
+        {
+          clasp_argument_t const* const arg1 = &args->arguments[j];
+          clasp_argument_t const* const arg2 = &args2->arguments[j];
+
+          XTESTS_TEST_INTEGER_EQUAL(arg1->type, arg2->type);
+          XTESTS_TEST_INTEGER_EQUAL(arg1->aliasIndex, arg2->aliasIndex);
+          XTESTS_TEST_INTEGER_EQUAL(arg1->cmdLineIndex, arg2->cmdLineIndex);
+          XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(&arg1->givenName, &arg2->givenName));
+          XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(&arg1->resolvedName, &arg2->resolvedName));
+          XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(&arg1->value, &arg2->value));
+        }
+      }
+
+      clasp_releaseArguments(args);
+    }
+  }
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+static void test_1_0(void)
+{
+  clasp_specification_index_t const*  index;
+  int                                 r = clasp_createSpecificationIndex(NULL, Specifications, &index);
+
+  if (0 != r)
+  {
+    XTESTS_TEST_FAIL_WITH_QUALIFIER("could not create index", strerror(r));
+  }
+  else
+  {
+    r = clasp_parseArgumentsBatch(0, 0, NULL, NULL, index, NULL, NULL, NULL);
+
+    XTESTS_TEST_INTEGER_EQUAL(0, r);
+
+    clasp_releaseArgumentsBatch(0, NULL);
+
+    clasp_destroySpecificationIndex(index);
+  }
+}
+
+static void test_1_1(void)
+{
+  clasp_specification_index_t const*  index;
+  int                                 r = clasp_createSpecificationIndex(NULL, Specifications, &index);
+
+  if (0 != r)
+  {
+    XTESTS_TEST_FAIL_WITH_QUALIFIER("could not create index", strerror(r));
+  }
+  else
+  {
+    clasp_batch_result_t results[NUM_JOBS];
+
+    r = clasp_parseArgumentsBatch(0, NUM_JOBS, JobArgcs, JobArgvs, index, NULL, results, NULL);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+    {
+      test_against_single_(index, results);
+
+      clasp_releaseArgumentsBatch(NUM_JOBS, results);
+    }
+
+    clasp_destroySpecificationIndex(index);
+  }
+}
+
+static void test_1_2(void)
+{
+  clasp_specification_index_t const*  index;
+  int                                 r = clasp_createSpecificationIndex(NULL, Specifications, &index);
+
+  if (0 != r)
+  {
+    XTESTS_TEST_FAIL_WITH_QUALIFIER("could not create index", strerror(r));
+  }
+  else
+  {
+    clasp_batch_pool_t    pool;
+    clasp_batch_result_t  results[NUM_JOBS];
+
+    pool.context    = NULL;
+    pool.pfnForEach = reverse_for_each_;
+
+    s_numPoolJobs = 0;
+
+    r = clasp_parseArgumentsBatch(0, NUM_JOBS, JobArgcs, JobArgvs, index, NULL, results, &pool);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+    {
+      /* one sizing, and one parsing, job per command-line */
+      XTESTS_TEST_INTEGER_EQUAL(2 * NUM_JOBS, s_numPoolJobs);
+
+      test_against_single_(index, results);
+
+      clasp_releaseArgumentsBatch(NUM_JOBS, results);
+    }
+
+    clasp_destroySpecificationIndex(index);
+  }
+}
+
+static void test_1_3(void)
+{
+  clasp_specification_index_t const*  index;
+  int                                 r = clasp_createSpecificationIndex(NULL, Specifications, &index);
+
+  if (0 != r)
+  {
+    XTESTS_TEST_FAIL_WITH_QUALIFIER("could not create index", strerror(r));
+  }
+  else
+  {
+    int const             argcs[] = { JobArgcs[0], 0, JobArgcs[2] };
+    clasp_batch_result_t  results[3];
+
+    r = clasp_parseArgumentsBatch(0, 3, argcs, JobArgvs, index, NULL, results, NULL);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+    {
+      XTESTS_TEST_INTEGER_EQUAL(0, results[0].result);
+      XTESTS_TEST_POINTER_NOT_EQUAL(NULL, results[0].args);
+      XTESTS_TEST_INTEGER_EQUAL(EINVAL, results[1].result);
+      XTESTS_TEST_POINTER_EQUAL(NULL, results[1].args);
+      XTESTS_TEST_INTEGER_EQUAL(0, results[2].result);
+      XTESTS_TEST_POINTER_NOT_EQUAL(NULL, results[2].args);
+
+      if (NULL != results[2].args)
+      {
+        XTESTS_TEST_INTEGER_EQUAL(3u, results[2].args->numFlags);
+        XTESTS_TEST_INTEGER_EQUAL(2u, results[2].args->numOptions);
+        XTESTS_TEST_INTEGER_EQUAL(1u, results[2].args->numValues);
+      }
+
+      clasp_releaseArgumentsBatch(3, results);
+    }
+
+    clasp_destroySpecificationIndex(index);
+  }
+}
+
+static void test_1_4(void)
+{
+  clasp_specification_index_t const*  index;
+  int                                 r = clasp_createSpecificationIndex(NULL, Specifications, &index);
+
+  if (0 != r)
+  {
+    XTESTS_TEST_FAIL_WITH_QUALIFIER("could not create index", strerror(r));
+  }
+  else
+  {
+    clasp_diagnostic_context_t  ctxt;
+    clasp_batch_result_t        results[NUM_JOBS];
+
+    clasp_init_diagnostic_context(&ctxt, NULL, failing_malloc_, failing_realloc_, failing_free_, NULL, NULL, NULL);
+
+    r = clasp_parseArgumentsBatch(0, NUM_JOBS, JobArgcs, JobArgvs, index, &ctxt, results, NULL);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(ENOMEM, r))
+    {
+      size_t i;
+
+      for (i = 0; i != NUM_JOBS; ++i)
+      {
+        XTESTS_TEST_POINTER_EQUAL(NULL, results[i].args);
+      }
+    }
+
+    clasp_destroySpecificationIndex(index);
+  }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
@@ -0,0 +1,347 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.parseapi.flagclusters/entry.c
+ *
+ * Purpose: Unit-test(s) for the parsing of flag clusters, e.g. `-abc`
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <clasp/clasp.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C header files */
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#if defined(_MSC_VER) && \
+    _MSC_VER >= 1400
+# pragma warning(push)
+# pragma warning(disable : 4996)
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * globals
+ */
+
+static clasp_specification_t const Specifications[] =
+{
+    CLASP_FLAG("-a", "--alpha", "alpha"),
+    CLASP_FLAG("-bx", "--bravo", "bravo"),
+    CLASP_FLAG(NULL, "-c", "charlie"),
+    CLASP_OPTION("-w", "--width", "width", NULL),
+    CLASP_FLAG("-W", "--width=80", "width 80"),
+    CLASP_FLAG(NULL, "-d=1", "delta"),
+    CLASP_FLAG(NULL, "--alpha", NULL),
+
+    CLASP_SPECIFICATION_ARRAY_TERMINATOR
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+static void test_1_0(void);
+static void test_1_1(void);
+static void test_1_2(void);
+static void test_1_3(void);
+static void test_1_4(void);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main
+ */
+
+int main(int argc, char **argv)
+{
+  int retCode = EXIT_SUCCESS;
+  int verbosity = 2;
+
+  XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+  if (XTESTS_START_RUNNER("test.unit.parseapi.flagclusters", verbosity))
+  {
+    XTESTS_RUN_CASE(test_1_0);
+    XTESTS_RUN_CASE(test_1_1);
+    XTESTS_RUN_CASE(test_1_2);
+    XTESTS_RUN_CASE(test_1_3);
+    XTESTS_RUN_CASE(test_1_4);
+
+    XTESTS_PRINT_RESULTS();
+
+    XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+  }
+
+  return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+static int slice_equal_(clasp_slice_t const* slice, char const* s)
+{
+  if (NULL == s)
+  {
+    return 0 == slice->len;
+  }
+  else
+  {
+    return strlen(s) == slice->len && 0 == strncmp(slice->ptr, s, slice->len);
+  }
+}
+
+/* Parses the given cluster, with or without the given index, and tests
+ * that the results are identical to those of parsing its flags separately
+ */
+static void test_against_separate_(char const* cluster, clasp_specification_index_t const* index)
+{
+  char const*               argv1[] = { "program", NULL, NULL };
+  char const*               argv2[16];
+  int                       argc2 = 1;
+  clasp_arguments_t const*  args1;
+  clasp_arguments_t const*  args2;
+  char                      flags[16][3];
+  int                       cr1;
+  int                       cr2;
+
+  argv1[1] = cluster;
+  argv2[0] = "program";
+
+  { size_t i; for (i = 1; '\0' != cluster[i]; ++i)
+  {
+    flags[i][0] = '-';
+    flags[i][1] = cluster[i];
+    flags[i][2] = '\0';
+
+    argv2[argc2++] = flags[i];
+  }}
+  argv2[argc2] = NULL;
+
+  if (NULL != index)
+  {
+    cr1 = clasp_parseArgumentsWithIndex(0, 2, (char**)argv1, index, NULL, &args1);
+    cr2 = clasp_parseArgumentsWithIndex(0, argc2, (char**)argv2, index, NULL, &args2);
+  }
+  else
+  {
+    cr1 = clasp_parseArguments(0, 2, (char**)argv1, Specifications, NULL, &args1);
+    cr2 = clasp_parseArguments(0, argc2, (char**)argv2, Specifications, NULL, &args2);
+  }
+
+  if (0 != cr1 ||
+      0 != cr2)
+  {
+    XTESTS_TEST_FAIL_WITH_QUALIFIER("failed to initialise CLASP", strerror((0 != cr1) ? cr1 : cr2));
+  }
+  else
+  {
+    /* the order of flags within a cluster may differ from that of the
+     * separate flags, so each result is sought, rather than compared
+     * by position
+     */
+    if (XTESTS_TEST_INTEGER_EQUAL(args2->numArguments, args1->numArguments))
+    {
+      size_t i;
+
+      for (i = 0; i != args1->numArguments; ++i)
+      {
+        clasp_argument_t const* const arg1    = &args1->arguments[i];
+        size_t                        numSame = 0;
+        size_t                        j;
+
+        for (j = 0; j != args2->numArguments; ++j)
+        {
+          clasp_argument_t const* const arg2 = &args2->arguments[j];
+
+          if (arg1->type == arg2->type &&
+              arg1->aliasIndex == arg2->aliasIndex &&
+              arg1->resolvedName.len == arg2->resolvedName.len &&
+              0 == strncmp(arg1->resolvedName.ptr, arg2->resolvedName.ptr, arg1->resolvedName.len) &&
+              arg1->value.len == arg2->value.len)
+          {
+            ++numSame;
+          }
+        }
+
+        XTESTS_TEST_INTEGER_NOT_EQUAL(0u, numSame);
+      }
+    }
+  }
+
+  if (0 == cr1)
+  {
+    clasp_releaseArguments(args1);
+  }
+  if (0 == cr2)
+  {
+    clasp_releaseArguments(args2);
+  }
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+static void test_1_0(void)
+{
+  char const* const         argv[] =
+  {
+    "program",
+
+    "-abcWdz",
+
+    NULL
+  };
+  int const                 argc = STLSOFT_NUM_ELEMENTS(argv) - 1;
+  clasp_arguments_t const*  args;
+  int const                 cr   = clasp_parseArguments(0, argc, (char**)argv, Specifications, NULL, &args);
+
+  if (0 != cr)
+  {
+    XTESTS_TEST_FAIL_WITH_QUALIFIER("failed to initialise CLASP", strerror(cr));
+  }
+  else
+  {
+    if (XTESTS_TEST_INTEGER_EQUAL(6u, args->numFlagsAndOptions))
+    {
+      clasp_argument_t const* const arguments = args->arguments;
+
+      /* -a => --alpha */
+      XTESTS_TEST_INTEGER_EQUAL(0, arguments[0].aliasIndex);
+      XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(&arguments[0].resolvedName, "--alpha"));
+
+      /* -b => --bravo, since "-b" is a leading part of "-bx" */
+      XTESTS_TEST_INTEGER_EQUAL(1, arguments[1].aliasIndex);
+      XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(&arguments[1].resolvedName, "--bravo"));
+
+      /* -c => -c, by its mapped argument */
+      XTESTS_TEST_INTEGER_EQUAL(2, arguments[2].aliasIndex);
+      XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(&arguments[2].resolvedName, "-c"));
+
+      /* -z is not recognised */
+      XTESTS_TEST_INTEGER_EQUAL(-1, arguments[3].aliasIndex);
+      XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGTYPE_FLAG, arguments[3].type);
+      XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(&arguments[3].resolvedName, "-z"));
+
+      /* -W => --width=80 */
+      XTESTS_TEST_INTEGER_EQUAL(4, arguments[4].aliasIndex);
+      XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGTYPE_OPTION, arguments[4].type);
+      XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(&arguments[4].resolvedName, "--width"));
+      XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(&arguments[4].value, "80"));
+
+      /* -d => -d=1, by its defaulted mapped argument */
+      XTESTS_TEST_INTEGER_EQUAL(5, arguments[5].aliasIndex);
+      XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGTYPE_OPTION, arguments[5].type);
+      XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(&arguments[5].resolvedName, "-d"));
+      XTESTS_TEST_BOOLEAN_TRUE(slice_equal_(&arguments[5].value, "1"));
+    }
+
+    clasp_releaseArguments(args);
+  }
+}
+
+static void test_1_1(void)
+{
+  test_against_separate_("-abcWdz", NULL);
+  test_against_separate_("-zzaa", NULL);
+  test_against_separate_("-w", NULL);
+}
+
+static void test_1_2(void)
+{
+  clasp_specification_index_t const*  index;
+  int const                           r = clasp_createSpecificationIndex(NULL, Specifications, &index);
+
+  if (0 != r)
+  {
+    XTESTS_TEST_FAIL_WITH_QUALIFIER("could not create index", strerror(r));
+  }
+  else
+  {
+    test_against_separate_("-abcWdz", index);
+    test_against_separate_("-zzaa", index);
+
+    clasp_destroySpecificationIndex(index);
+  }
+}
+
+static void test_1_3(void)
+{
+  clasp_specification_index_t const*  index;
+  int const                           r = clasp_createSpecificationIndex(NULL, Specifications, &index);
+
+  if (0 != r)
+  {
+    XTESTS_TEST_FAIL_WITH_QUALIFIER("could not create index", strerror(r));
+  }
+  else
+  {
+    if (XTESTS_TEST_POINTER_NOT_EQUAL(NULL, index->shortFlags))
+    {
+      XTESTS_TEST_INTEGER_EQUAL(0, index->shortFlags['a']);
+      XTESTS_TEST_INTEGER_EQUAL(-1, index->shortFlags['b']); /* names are matched exactly */
+      XTESTS_TEST_INTEGER_EQUAL(2, index->shortFlags['c']);
+      XTESTS_TEST_INTEGER_EQUAL(3, index->shortFlags['w']);
+      XTESTS_TEST_INTEGER_EQUAL(4, index->shortFlags['W']);
+      XTESTS_TEST_INTEGER_EQUAL(5, index->shortFlags['d']);
+      XTESTS_TEST_INTEGER_EQUAL(-1, index->shortFlags['z']);
+    }
+    XTESTS_TEST_INTEGER_EQUAL(0u, index->numWideShortFlags);
+
+    clasp_destroySpecificationIndex(index);
+  }
+}
+
+static void test_1_4(void)
+{
+  /* an index without a direct table behaves identically */
+  clasp_specification_index_t const*  index;
+  int const                           r = clasp_createSpecificationIndex(NULL, Specifications, &index);
+
+  if (0 != r)
+  {
+    XTESTS_TEST_FAIL_WITH_QUALIFIER("could not create index", strerror(r));
+  }
+  else
+  {
+    clasp_specification_index_t index2 = *index;
+
+    index2.shortFlags           =   NULL;
+    index2.numWideShortFlags    =   0;
+    index2.wideShortFlags       =   NULL;
+
+    test_against_separate_("-abcWdz", &index2);
+
+    clasp_destroySpecificationIndex(index);
+  }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
@@ -0,0 +1,597 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.parseapi.schema/entry.c
+ *
+ * Purpose: Unit-test(s) for clasp_parseArgumentsWithSchema() and
+ *          clasp_getTypedValue()
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <clasp/clasp.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C header files */
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+static void test_1_0(void);
+static void test_1_1(void);
+static void test_1_2(void);
+static void test_1_3(void);
+static void test_1_4(void);
+static void test_1_5(void);
+static void test_1_6(void);
+static void test_1_7(void);
+static void test_1_8(void);
+static void test_1_9(void);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * globals
+ */
+
+static clasp_specification_t const Specifications[] =
+{
+    CLASP_FLAG("-v", "--verbose", "makes output verbose"),
+    CLASP_OPTION("-o", "--offset", "the offset", NULL),
+    CLASP_OPTION("-c", "--count", "the count", NULL),
+    CLASP_OPTION(NULL, "--ratio", "the ratio", NULL),
+    CLASP_OPTION(NULL, "--force", "forces", NULL),
+    CLASP_OPTION(NULL, "--buffer-size", "the buffer size", NULL),
+    CLASP_OPTION(NULL, "--timeout", "the timeout", NULL),
+    CLASP_OPTION(NULL, "--colour", "the colour", "|red|green|blue"),
+    CLASP_OPTION(NULL, "--mode", "the mode", "|fast|slow|"),
+    CLASP_OPTION(NULL, "--name", "the name", NULL),
+    CLASP_OPTION_ALIAS("-w", "--width"),
+    CLASP_OPTION_ALIAS("-W", "--width=80"),
+    CLASP_OPTION(NULL, "--width", "the width", NULL),
+
+    CLASP_SPECIFICATION_ARRAY_TERMINATOR
+};
+
+static clasp_value_schema_t const Schema[] =
+{
+    CLASP_VALUE_SCHEMA(CLASP_VALUEKIND_NONE, CLASP_SCHEMA_F_SINGLE),
+    CLASP_VALUE_SCHEMA(CLASP_VALUEKIND_INT, 0),
+    CLASP_VALUE_SCHEMA_RANGE(CLASP_VALUEKIND_UINT, CLASP_SCHEMA_F_SINGLE, 1, 100),
+    CLASP_VALUE_SCHEMA_RANGE(CLASP_VALUEKIND_DOUBLE, 0, 0.0, 1.0),
+    CLASP_VALUE_SCHEMA(CLASP_VALUEKIND_BOOL, 0),
+    CLASP_VALUE_SCHEMA(CLASP_VALUEKIND_SIZE, 0),
+    CLASP_VALUE_SCHEMA_RANGE(CLASP_VALUEKIND_DURATION, 0, 0.001, 3600.0),
+    CLASP_VALUE_SCHEMA(CLASP_VALUEKIND_ENUM, 0),
+    CLASP_VALUE_SCHEMA(CLASP_VALUEKIND_ENUM, 0),
+    CLASP_VALUE_SCHEMA_NONE,
+    CLASP_VALUE_SCHEMA_NONE,
+    CLASP_VALUE_SCHEMA_NONE,
+    CLASP_VALUE_SCHEMA(CLASP_VALUEKIND_UINT, 0),
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main
+ */
+
+int main(int argc, char **argv)
+{
+  int retCode = EXIT_SUCCESS;
+  int verbosity = 2;
+
+  XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+  if (XTESTS_START_RUNNER("test.unit.parseapi.schema", verbosity))
+  {
+    XTESTS_RUN_CASE(test_1_0);
+    XTESTS_RUN_CASE(test_1_1);
+    XTESTS_RUN_CASE(test_1_2);
+    XTESTS_RUN_CASE(test_1_3);
+    XTESTS_RUN_CASE(test_1_4);
+    XTESTS_RUN_CASE(test_1_5);
+    XTESTS_RUN_CASE(test_1_6);
+    XTESTS_RUN_CASE(test_1_7);
+    XTESTS_RUN_CASE(test_1_8);
+    XTESTS_RUN_CASE(test_1_9);
+
+    XTESTS_PRINT_RESULTS();
+
+    XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+  }
+
+  return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+static int parse_(
+  char const* const*          argv
+, clasp_arguments_t const**   args
+)
+{
+  int argc;
+
+  for (argc = 0; NULL != argv[argc]; ++argc)
+  {}
+
+  return clasp_parseArgumentsWithSchema(0, argc, (char**)argv, Specifications, Schema, NULL, args);
+}
+
+/* Obtains the typed value of the first instance of the named flag/option */
+static clasp_typed_value_t const* typed_(
+  clasp_arguments_t const*  args
+, char const*               name
+)
+{
+  clasp_argument_t const* const arg = clasp_findFlagOrOption(args, name, 0);
+
+  return (NULL == arg) ? NULL : clasp_getTypedValue(args, arg);
+}
+
+/* Parses the single argument, and obtains the error, if any, of the typed
+ * value of the named option, which is written into *tv
+ */
+static int decode_(
+  char const*           arg
+, char const*           name
+, clasp_typed_value_t*  tv
+)
+{
+  char const* const         argv[] = { "arg0", arg, NULL };
+  clasp_arguments_t const*  args;
+  int                       r = parse_(argv, &args);
+
+  memset(tv, 0, sizeof(*tv));
+
+  if (0 != r)
+  {
+    return -r;
+  }
+  else
+  {
+    clasp_typed_value_t const* const typedValue = typed_(args, name);
+
+    if (NULL == typedValue)
+    {
+      r = -1;
+    }
+    else
+    {
+      *tv = *typedValue;
+      r   = typedValue->error;
+    }
+
+    clasp_releaseArguments(args);
+
+    return r;
+  }
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+static void test_1_0(void)
+{
+  /* integers, reals, and booleans */
+  char const* const         argv[] = { "arg0", "--offset=-0x10", "--count=42", "--ratio=0.25", "--force=Yes", "abc", NULL };
+  clasp_arguments_t const*  args;
+  int                       r = parse_(argv, &args);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    clasp_typed_value_t const* tv;
+
+    XTESTS_TEST_INTEGER_EQUAL(4u, args->numOptions);
+
+    tv = typed_(args, "--offset");
+    if (XTESTS_TEST_POINTER_NOT_EQUAL(NULL, tv))
+    {
+      XTESTS_TEST_INTEGER_EQUAL(CLASP_VALUEKIND_INT, tv->kind);
+      XTESTS_TEST_INTEGER_EQUAL(0, tv->error);
+      XTESTS_TEST_INTEGER_EQUAL(1, tv->specIndex);
+      XTESTS_TEST_INTEGER_EQUAL(-16, tv->value.integer);
+    }
+
+    tv = typed_(args, "--count");
+    if (XTESTS_TEST_POINTER_NOT_EQUAL(NULL, tv))
+    {
+      XTESTS_TEST_INTEGER_EQUAL(CLASP_VALUEKIND_UINT, tv->kind);
+      XTESTS_TEST_INTEGER_EQUAL(0, tv->error);
+      XTESTS_TEST_INTEGER_EQUAL(42u, tv->value.uinteger);
+    }
+
+    tv = typed_(args, "--ratio");
+    if (XTESTS_TEST_POINTER_NOT_EQUAL(NULL, tv))
+    {
+      XTESTS_TEST_INTEGER_EQUAL(0, tv->error);
+      XTESTS_TEST_FLOATINGPOINT_EQUAL(0.25, tv->value.real);
+    }
+
+    tv = typed_(args, "--force");
+    if (XTESTS_TEST_POINTER_NOT_EQUAL(NULL, tv))
+    {
+      XTESTS_TEST_INTEGER_EQUAL(0, tv->error);
+      XTESTS_TEST_INTEGER_EQUAL(1, tv->value.boolean);
+    }
+
+    /* values are not decoded */
+    XTESTS_TEST_POINTER_EQUAL(NULL, clasp_getTypedValue(args, &args->values[0]));
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, clasp_verifyArguments(args, NULL, CLASP_VERIFY_F_ALL_VALID, NULL));
+
+    clasp_releaseArguments(args);
+  }
+}
+
+static void test_1_1(void)
+{
+  /* integer forms and limits */
+  clasp_typed_value_t tv;
+
+  XTESTS_TEST_INTEGER_EQUAL(0, decode_("--offset=+123", "--offset", &tv));
+  XTESTS_TEST_INTEGER_EQUAL(123, tv.value.integer);
+  XTESTS_TEST_INTEGER_EQUAL(0, decode_("--offset=0XfF", "--offset", &tv));
+  XTESTS_TEST_INTEGER_EQUAL(255, tv.value.integer);
+  XTESTS_TEST_INTEGER_EQUAL(0, decode_("--offset=-0", "--offset", &tv));
+  XTESTS_TEST_INTEGER_EQUAL(0, tv.value.integer);
+
+  XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_INVALID_OPTION_VALUE, decode_("--offset=12a", "--offset", &tv));
+  XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_INVALID_OPTION_VALUE, decode_("--offset=0x", "--offset", &tv));
+  XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_INVALID_OPTION_VALUE, decode_("--offset=-", "--offset", &tv));
+  XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_INVALID_OPTION_VALUE, decode_("--offset=99999999999999999999999", "--offset", &tv));
+  XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_INVALID_OPTION_VALUE, decode_("--count=-1", "--count", &tv));
+  XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_INVALID_OPTION_VALUE, decode_("--ratio=1e", "--ratio", &tv));
+  XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_INVALID_OPTION_VALUE, decode_("--ratio=.", "--ratio", &tv));
+  XTESTS_TEST_INTEGER_EQUAL(0, decode_("--ratio=5e-1", "--ratio", &tv));
+  XTESTS_TEST_FLOATINGPOINT_EQUAL(0.5, tv.value.real);
+
+  XTESTS_TEST_INTEGER_EQUAL(0, decode_("--force=OFF", "--force", &tv));
+  XTESTS_TEST_INTEGER_EQUAL(0, tv.value.boolean);
+  XTESTS_TEST_INTEGER_EQUAL(0, decode_("--force=1", "--force", &tv));
+  XTESTS_TEST_INTEGER_EQUAL(1, tv.value.boolean);
+  XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_INVALID_OPTION_VALUE, decode_("--force=maybe", "--force", &tv));
+}
+
+static void test_1_2(void)
+{
+  /* sizes */
+  clasp_typed_value_t tv;
+
+  XTESTS_TEST_INTEGER_EQUAL(0, decode_("--buffer-size=512", "--buffer-size", &tv));
+  XTESTS_TEST_INTEGER_EQUAL(512u, tv.value.uinteger);
+  XTESTS_TEST_INTEGER_EQUAL(0, decode_("--buffer-size=512B", "--buffer-size", &tv));
+  XTESTS_TEST_INTEGER_EQUAL(512u, tv.value.uinteger);
+  XTESTS_TEST_INTEGER_EQUAL(0, decode_("--buffer-size=64k", "--buffer-size", &tv));
+  XTESTS_TEST_INTEGER_EQUAL(65536u, tv.value.uinteger);
+  XTESTS_TEST_INTEGER_EQUAL(0, decode_("--buffer-size=10MB", "--buffer-size", &tv));
+  XTESTS_TEST_INTEGER_EQUAL(10u * 1024u * 1024u, tv.value.uinteger);
+  XTESTS_TEST_INTEGER_EQUAL(0, decode_("--buffer-size=1GiB", "--buffer-size", &tv));
+  XTESTS_TEST_INTEGER_EQUAL(1024ul * 1024ul * 1024ul, tv.value.uinteger);
+
+  XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_INVALID_OPTION_VALUE, decode_("--buffer-size=10X", "--buffer-size", &tv));
+  XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_INVALID_OPTION_VALUE, decode_("--buffer-size=10Ki", "--buffer-size", &tv));
+  XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_INVALID_OPTION_VALUE, decode_("--buffer-size=10kBB", "--buffer-size", &tv));
+  XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_INVALID_OPTION_VALUE, decode_("--buffer-size=k", "--buffer-size", &tv));
+  XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_INVALID_OPTION_VALUE, decode_("--buffer-size=0x10", "--buffer-size", &tv));
+}
+
+static void test_1_3(void)
+{
+  /* durations */
+  clasp_typed_value_t tv;
+
+  XTESTS_TEST_INTEGER_EQUAL(0, decode_("--timeout=250ms", "--timeout", &tv));
+  XTESTS_TEST_FLOATINGPOINT_EQUAL(0.25, tv.value.real);
+  XTESTS_TEST_INTEGER_EQUAL(0, decode_("--timeout=1.5", "--timeout", &tv));
+  XTESTS_TEST_FLOATINGPOINT_EQUAL(1.5, tv.value.real);
+  XTESTS_TEST_INTEGER_EQUAL(0, decode_("--timeout=2s", "--timeout", &tv));
+  XTESTS_TEST_FLOATINGPOINT_EQUAL(2.0, tv.value.real);
+  XTESTS_TEST_INTEGER_EQUAL(0, decode_("--timeout=2m", "--timeout", &tv));
+  XTESTS_TEST_FLOATINGPOINT_EQUAL(120.0, tv.value.real);
+  XTESTS_TEST_INTEGER_EQUAL(0, decode_("--timeout=1h", "--timeout", &tv));
+  XTESTS_TEST_FLOATINGPOINT_EQUAL(3600.0, tv.value.real);
+
+  /* out of range */
+  XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_INVALID_OPTION_VALUE, decode_("--timeout=1d", "--timeout", &tv));
+  XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_INVALID_OPTION_VALUE, decode_("--timeout=0", "--timeout", &tv));
+
+  XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_INVALID_OPTION_VALUE, decode_("--timeout=-1s", "--timeout", &tv));
+  XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_INVALID_OPTION_VALUE, decode_("--timeout=5 minutes", "--timeout", &tv));
+}
+
+static void test_1_4(void)
+{
+  /* enumerations */
+  clasp_typed_value_t tv;
+
+  XTESTS_TEST_INTEGER_EQUAL(0, decode_("--colour=red", "--colour", &tv));
+  XTESTS_TEST_INTEGER_EQUAL(0, tv.value.index);
+  XTESTS_TEST_INTEGER_EQUAL(0, decode_("--colour=blue", "--colour", &tv));
+  XTESTS_TEST_INTEGER_EQUAL(2, tv.value.index);
+  XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_INVALID_OPTION_VALUE, decode_("--colour=Red", "--colour", &tv));
+  XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_INVALID_OPTION_VALUE, decode_("--colour=bluey", "--colour", &tv));
+
+  /* a trailing separator permits other values */
+  XTESTS_TEST_INTEGER_EQUAL(0, decode_("--mode=slow", "--mode", &tv));
+  XTESTS_TEST_INTEGER_EQUAL(1, tv.value.index);
+  XTESTS_TEST_INTEGER_EQUAL(0, decode_("--mode=medium", "--mode", &tv));
+  XTESTS_TEST_INTEGER_EQUAL(-1, tv.value.index);
+}
+
+static void test_1_5(void)
+{
+  /* errors are collected by clasp_verifyArguments() */
+  char const* const         argv[] =
+  {
+    "arg0",
+    "--count=0",
+    "--ratio",
+    "--verbose",
+    "--offset=3",
+    "-v",
+    "--count=7",
+    NULL
+  };
+  clasp_arguments_t const*  args;
+  int                       r = parse_(argv, &args);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    clasp_argument_error_t  storage[8];
+    clasp_argument_errors_t errors;
+    size_t                  n;
+
+    clasp_initArgumentErrors(&errors, storage, STLSOFT_NUM_ELEMENTS(storage));
+
+    n = clasp_verifyArguments(args, NULL, CLASP_VERIFY_F_ALL_VALID, &errors);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(4u, n))
+    {
+      /* the flags precede the options */
+      XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_REPEATED_ARGUMENT, storage[0].kind);
+      XTESTS_TEST_INTEGER_EQUAL(5, storage[0].cmdLineIndex);
+
+      XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_INVALID_OPTION_VALUE, storage[1].kind);
+      XTESTS_TEST_INTEGER_EQUAL(1, storage[1].cmdLineIndex);
+      XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_MISSING_OPTION_VALUE, storage[2].kind);
+      XTESTS_TEST_INTEGER_EQUAL(2, storage[2].cmdLineIndex);
+      XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGERR_REPEATED_ARGUMENT, storage[3].kind);
+      XTESTS_TEST_INTEGER_EQUAL(6, storage[3].cmdLineIndex);
+    }
+
+    /* the first instance of a single flag is valid */
+    {
+      clasp_typed_value_t const* const tv = typed_(args, "--verbose");
+
+      if (XTESTS_TEST_POINTER_NOT_EQUAL(NULL, tv))
+      {
+        XTESTS_TEST_INTEGER_EQUAL(CLASP_VALUEKIND_NONE, tv->kind);
+        XTESTS_TEST_INTEGER_EQUAL(0, tv->error);
+      }
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, clasp_verifyArguments(args, NULL, 0, NULL));
+
+    clasp_releaseArguments(args);
+  }
+}
+
+static void test_1_6(void)
+{
+  /* an alias defers to the schema of the option it names */
+  char const* const         argv[] = { "arg0", "-w", "120", "-W", "--name=-w", NULL };
+  clasp_arguments_t const*  args;
+  int                       r = parse_(argv, &args);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r) &&
+      XTESTS_TEST_INTEGER_EQUAL(3u, args->numOptions))
+  {
+    clasp_typed_value_t const* tv;
+
+    tv = clasp_getTypedValue(args, &args->options[0]);
+    if (XTESTS_TEST_POINTER_NOT_EQUAL(NULL, tv))
+    {
+      XTESTS_TEST_INTEGER_EQUAL(12, tv->specIndex);
+      XTESTS_TEST_INTEGER_EQUAL(120u, tv->value.uinteger);
+    }
+
+    /* including a default value */
+    tv = clasp_getTypedValue(args, &args->options[1]);
+    if (XTESTS_TEST_POINTER_NOT_EQUAL(NULL, tv))
+    {
+      XTESTS_TEST_INTEGER_EQUAL(12, tv->specIndex);
+      XTESTS_TEST_INTEGER_EQUAL(80u, tv->value.uinteger);
+    }
+
+    /* an option whose schema is none is not decoded */
+    XTESTS_TEST_POINTER_EQUAL(NULL, clasp_getTypedValue(args, &args->options[2]));
+
+    clasp_releaseArguments(args);
+  }
+}
+
+static void test_1_7(void)
+{
+  /* invalid schemas */
+  static clasp_specification_t const specifications[] =
+  {
+    CLASP_FLAG(NULL, "--flag", "a flag"),
+    CLASP_OPTION(NULL, "--option", "an option", NULL),
+
+    CLASP_SPECIFICATION_ARRAY_TERMINATOR
+  };
+  static clasp_value_schema_t const schema0[] =
+  {
+    CLASP_VALUE_SCHEMA(CLASP_VALUEKIND_INT, 0),
+    CLASP_VALUE_SCHEMA_NONE,
+  };
+  static clasp_value_schema_t const schema1[] =
+  {
+    CLASP_VALUE_SCHEMA_NONE,
+    CLASP_VALUE_SCHEMA(CLASP_VALUEKIND_ENUM, 0),
+  };
+  static clasp_value_schema_t const schema2[] =
+  {
+    CLASP_VALUE_SCHEMA_NONE,
+    CLASP_VALUE_SCHEMA_RANGE(CLASP_VALUEKIND_INT, 0, 10, 1),
+  };
+  static clasp_value_schema_t const schema3[] =
+  {
+    CLASP_VALUE_SCHEMA(CLASP_VALUEKIND_NONE, CLASP_SCHEMA_F_SINGLE),
+    CLASP_VALUE_SCHEMA_RANGE(CLASP_VALUEKIND_INT, 0, 1, 1),
+  };
+
+  char* argv[] = { "arg0", "--option=1", NULL };
+  clasp_arguments_t const*  args;
+
+  XTESTS_TEST_INTEGER_EQUAL(EINVAL, clasp_parseArgumentsWithSchema(0, 2, argv, specifications, schema0, NULL, &args));
+  XTESTS_TEST_INTEGER_EQUAL(EINVAL, clasp_parseArgumentsWithSchema(0, 2, argv, specifications, schema1, NULL, &args));
+  XTESTS_TEST_INTEGER_EQUAL(EINVAL, clasp_parseArgumentsWithSchema(0, 2, argv, specifications, schema2, NULL, &args));
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, clasp_parseArgumentsWithSchema(0, 2, argv, specifications, schema3, NULL, &args)))
+  {
+    XTESTS_TEST_INTEGER_EQUAL(1, typed_(args, "--option")->value.integer);
+
+    clasp_releaseArguments(args);
+  }
+}
+
+static void test_1_8(void)
+{
+  /* typed values survive the appending of arguments */
+  char const* const         argv[] = { "arg0", "--count=12", "-o", "-5", NULL };
+  char*                     more[] = { "--count=13", "def", NULL };
+  clasp_arguments_t const*  args;
+  int                       r = parse_(argv, &args);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    r = clasp_appendArguments(&args, 1, 2, more);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r) &&
+        XTESTS_TEST_INTEGER_EQUAL(3u, args->numOptions))
+    {
+      clasp_typed_value_t const* tv;
+
+      tv = clasp_getTypedValue(args, &args->options[0]);
+      if (XTESTS_TEST_POINTER_NOT_EQUAL(NULL, tv))
+      {
+        XTESTS_TEST_INTEGER_EQUAL(12u, tv->value.uinteger);
+      }
+
+      tv = clasp_getTypedValue(args, &args->options[1]);
+      if (XTESTS_TEST_POINTER_NOT_EQUAL(NULL, tv))
+      {
+        XTESTS_TEST_INTEGER_EQUAL(-5, tv->value.integer);
+      }
+
+      /* appended arguments are decoded, as are those of the command-line */
+      tv = clasp_getTypedValue(args, &args->options[2]);
+      if (XTESTS_TEST_POINTER_NOT_EQUAL(NULL, tv))
+      {
+        XTESTS_TEST_INTEGER_EQUAL(13u, tv->value.uinteger);
+        XTESTS_TEST_INTEGER_EQUAL(0, tv->error);
+      }
+    }
+
+    clasp_releaseArguments(args);
+  }
+}
+
+static void test_1_9(void)
+{
+  /* typed values survive serialization and mapping */
+  char const* const         argv[] = { "arg0", "--timeout=2m", "--colour=green", NULL };
+  clasp_arguments_t const*  args;
+  int                       r = parse_(argv, &args);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    size_t  cb = 0;
+    void*   raw;
+
+    XTESTS_TEST_INTEGER_EQUAL(0, clasp_serializeArguments(args, NULL, 0, &cb));
+
+    raw = malloc(cb + 16);
+
+    if (XTESTS_TEST_POINTER_NOT_EQUAL(NULL, raw))
+    {
+      void* const blob = (char*)raw + (16 - ((size_t)raw % 16));
+
+      if (XTESTS_TEST_INTEGER_EQUAL(0, clasp_serializeArguments(args, blob, cb, NULL)))
+      {
+        clasp_arguments_t const* mapped;
+
+        clasp_releaseArguments(args);
+        args = NULL;
+
+        if (XTESTS_TEST_INTEGER_EQUAL(0, clasp_mapArguments(blob, cb, Specifications, NULL, &mapped)))
+        {
+          clasp_typed_value_t const* tv;
+
+          tv = typed_(mapped, "--timeout");
+          if (XTESTS_TEST_POINTER_NOT_EQUAL(NULL, tv))
+          {
+            XTESTS_TEST_FLOATINGPOINT_EQUAL(120.0, tv->value.real);
+          }
+
+          tv = typed_(mapped, "--colour");
+          if (XTESTS_TEST_POINTER_NOT_EQUAL(NULL, tv))
+          {
+            XTESTS_TEST_INTEGER_EQUAL(1, tv->value.index);
+          }
+
+          clasp_unmapArguments(mapped);
+        }
+      }
+
+      free(raw);
+    }
+
+    if (NULL != args)
+    {
+      clasp_releaseArguments(args);
+    }
+  }
+
+  /* results parsed without a schema have no typed values */
+  {
+    clasp_arguments_t const* args2;
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, clasp_parseArguments(0, 3, (char**)argv, Specifications, NULL, &args2)))
+    {
+      XTESTS_TEST_POINTER_EQUAL(NULL, typed_(args2, "--timeout"));
+
+      clasp_releaseArguments(args2);
+    }
+  }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
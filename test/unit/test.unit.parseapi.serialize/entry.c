@@ -0,0 +1,615 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.parseapi.serialize/entry.c
+ *
+ * Purpose: Unit-test(s) for clasp_serializeArguments() and
+ *          clasp_mapArguments()
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <clasp/clasp.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C header files */
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#if defined(_MSC_VER) && \
+    _MSC_VER >= 1400
+# pragma warning(push)
+# pragma warning(disable : 4996)
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * globals
+ */
+
+static clasp_specification_t const Specifications[] =
+{
+    CLASP_FLAG("-v", "--verbose", "verbose"),
+    CLASP_FLAG("-q", "--quiet", "quiet"),
+    CLASP_OPTION("-w", "--width", "width", NULL),
+    CLASP_FLAG("-W", "--width=80", "width 80"),
+
+    CLASP_SPECIFICATION_ARRAY_TERMINATOR
+};
+
+static clasp_specification_t const OtherSpecifications[] =
+{
+    CLASP_FLAG("-v", "--verbose", "verbose"),
+    CLASP_FLAG("-q", "--quiet", "quiet"),
+
+    CLASP_SPECIFICATION_ARRAY_TERMINATOR
+};
+
+static char const* const Argv[] = { "prog", "-vq", "--width=10", "abc", "-W", "--", "-def", NULL };
+
+#define ARGC                                                (STLSOFT_NUM_ELEMENTS(Argv) - 1)
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+static void test_1_0(void);
+static void test_1_1(void);
+static void test_1_2(void);
+static void test_1_3(void);
+static void test_1_4(void);
+static void test_1_5(void);
+static void test_1_6(void);
+static void test_1_7(void);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main
+ */
+
+int main(int argc, char **argv)
+{
+  int retCode = EXIT_SUCCESS;
+  int verbosity = 2;
+
+  XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+  if (XTESTS_START_RUNNER("test.unit.parseapi.serialize", verbosity))
+  {
+    XTESTS_RUN_CASE(test_1_0);
+    XTESTS_RUN_CASE(test_1_1);
+    XTESTS_RUN_CASE(test_1_2);
+    XTESTS_RUN_CASE(test_1_3);
+    XTESTS_RUN_CASE(test_1_4);
+    XTESTS_RUN_CASE(test_1_5);
+    XTESTS_RUN_CASE(test_1_6);
+    XTESTS_RUN_CASE(test_1_7);
+
+    XTESTS_PRINT_RESULTS();
+
+    XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+  }
+
+  return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+/* Memory aligned as required for serialization, standing in for a
+ * mapping of a memfd or of shared memory
+ */
+typedef struct aligned_block_t aligned_block_t;
+
+struct aligned_block_t
+{
+  void*   raw;
+  void*   p;
+};
+
+static int alloc_aligned_(aligned_block_t* block, size_t cb)
+{
+  block->raw  = malloc(cb + 16);
+  block->p    = (NULL == block->raw) ? NULL : (void*)((char*)block->raw + (16 - ((size_t)block->raw % 16)));
+
+  return NULL != block->raw;
+}
+
+static void free_aligned_(aligned_block_t* block)
+{
+  free(block->raw);
+}
+
+/* Serializes the results of parsing Argv with the given flags into a new
+ * block
+ */
+static int serialize_(unsigned flags, aligned_block_t* block, size_t* cb)
+{
+  clasp_arguments_t const*  args;
+  int                       r = clasp_parseArguments(flags, ARGC, (char**)Argv, Specifications, NULL, &args);
+
+  if (0 == r)
+  {
+    r = clasp_serializeArguments(args, NULL, 0, cb);
+
+    if (0 == r)
+    {
+      if (!alloc_aligned_(block, *cb))
+      {
+        r = ENOMEM;
+      }
+      else
+      {
+        r = clasp_serializeArguments(args, block->p, *cb, NULL);
+
+        if (0 != r)
+        {
+          free_aligned_(block);
+        }
+      }
+    }
+
+    clasp_releaseArguments(args);
+  }
+
+  return r;
+}
+
+/* Locates, in a blob serialized at its own address, the copy of the
+ * results of parsing Argv
+ */
+static clasp_arguments_t* find_results_(void* blob, size_t cb)
+{
+  size_t off;
+
+  for (off = 16; off + sizeof(clasp_arguments_t) <= cb; off += 16)
+  {
+    clasp_arguments_t* const args = (clasp_arguments_t*)((char*)blob + off);
+
+    if (6u == args->numArguments &&
+        2u == args->numFlags &&
+        2u == args->numOptions &&
+        2u == args->numValues &&
+        (int)ARGC == args->argc)
+    {
+      return args;
+    }
+  }
+
+  return NULL;
+}
+
+static void check_results_(clasp_arguments_t const* args)
+{
+  XTESTS_TEST_INTEGER_EQUAL(6u, args->numArguments);
+  XTESTS_TEST_INTEGER_EQUAL(4u, args->numFlagsAndOptions);
+  XTESTS_TEST_INTEGER_EQUAL(2u, args->numFlags);
+  XTESTS_TEST_INTEGER_EQUAL(2u, args->numOptions);
+  XTESTS_TEST_INTEGER_EQUAL(2u, args->numValues);
+
+  XTESTS_TEST_INTEGER_EQUAL((int)ARGC, args->argc);
+  XTESTS_TEST_MULTIBYTE_STRING_EQUAL("prog", args->argv[0]);
+  XTESTS_TEST_MULTIBYTE_STRING_EQUAL("-def", args->argv[ARGC - 1]);
+  XTESTS_TEST_POINTER_EQUAL(NULL, args->argv[ARGC]);
+  XTESTS_TEST_MULTIBYTE_STRING_EQUAL("prog", args->programName.ptr);
+
+  XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--quiet", args->flags[0].resolvedName.ptr);
+  XTESTS_TEST_MULTIBYTE_STRING_EQUAL("-vq", args->flags[0].givenName.ptr);
+  XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--verbose", args->flags[1].resolvedName.ptr);
+  XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--width", args->options[0].resolvedName.ptr);
+  XTESTS_TEST_MULTIBYTE_STRING_EQUAL("10", args->options[0].value.ptr);
+  XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", args->values[0].value.ptr);
+  XTESTS_TEST_MULTIBYTE_STRING_EQUAL("-def", args->values[1].value.ptr);
+
+  XTESTS_TEST_POINTER_NOT_EQUAL(NULL, clasp_findFlagOrOption(args, "--quiet", 0));
+  XTESTS_TEST_POINTER_EQUAL(Specifications, clasp_getSpecifications(args));
+  XTESTS_TEST_POINTER_EQUAL(NULL, clasp_getParseStatistics(args));
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+static void test_1_0(void)
+{
+  clasp_arguments_t const*  args;
+  int                       r = clasp_parseArguments(0, ARGC, (char**)Argv, Specifications, NULL, &args);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    size_t          cb = 0;
+    aligned_block_t block;
+
+    XTESTS_TEST_INTEGER_EQUAL(0, clasp_serializeArguments(args, NULL, 0, &cb));
+    XTESTS_TEST_INTEGER_NOT_EQUAL(0u, cb);
+    XTESTS_TEST_INTEGER_EQUAL(0u, cb % 16);
+
+    if (alloc_aligned_(&block, cb))
+    {
+      size_t cb2 = 0;
+
+      XTESTS_TEST_INTEGER_EQUAL(ERANGE, clasp_serializeArguments(args, block.p, cb - 1, &cb2));
+      XTESTS_TEST_INTEGER_EQUAL(cb, cb2);
+
+      XTESTS_TEST_INTEGER_EQUAL(EINVAL, clasp_serializeArguments(args, (char*)block.p + 1, cb - 1, NULL));
+
+      free_aligned_(&block);
+    }
+
+    clasp_releaseArguments(args);
+  }
+}
+
+static void test_1_1(void)
+{
+  aligned_block_t block;
+  size_t          cb;
+  int             r = serialize_(0, &block, &cb);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    clasp_arguments_t const* args;
+
+    r = clasp_mapArguments(block.p, cb, Specifications, NULL, &args);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+    {
+      check_results_(args);
+
+      /* the strings lie within the blob */
+      XTESTS_TEST_BOOLEAN_TRUE((char const*)args->argv[0] > (char const*)block.p);
+      XTESTS_TEST_BOOLEAN_TRUE((char const*)args->argv[0] < (char const*)block.p + cb);
+      XTESTS_TEST_BOOLEAN_TRUE((char const*)args->values[0].value.ptr > (char const*)block.p);
+      XTESTS_TEST_BOOLEAN_TRUE((char const*)args->values[0].value.ptr < (char const*)block.p + cb);
+
+      clasp_unmapArguments(args);
+    }
+
+    free_aligned_(&block);
+  }
+}
+
+static void test_1_2(void)
+{
+  aligned_block_t block;
+  size_t          cb;
+  int             r = serialize_(0, &block, &cb);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    aligned_block_t copy1;
+    aligned_block_t copy2;
+
+    if (alloc_aligned_(&copy1, cb))
+    {
+      if (alloc_aligned_(&copy2, cb))
+      {
+        clasp_arguments_t const* args;
+
+        /* the blob is relocated at each new address, including that of
+         * a copy of a blob that has already been relocated
+         */
+
+        memcpy(copy1.p, block.p, cb);
+        memset(block.p, 0, cb);
+
+        r = clasp_mapArguments(copy1.p, cb, Specifications, NULL, &args);
+
+        if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+        {
+          check_results_(args);
+
+          clasp_unmapArguments(args);
+
+          memcpy(copy2.p, copy1.p, cb);
+          memset(copy1.p, 0, cb);
+
+          r = clasp_mapArguments(copy2.p, cb, Specifications, NULL, &args);
+
+          if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+          {
+            check_results_(args);
+
+            clasp_unmapArguments(args);
+
+            /* mapping again at the same address is harmless */
+            r = clasp_mapArguments(copy2.p, cb, Specifications, NULL, &args);
+
+            if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+            {
+              check_results_(args);
+
+              clasp_unmapArguments(args);
+            }
+          }
+        }
+
+        free_aligned_(&copy2);
+      }
+
+      free_aligned_(&copy1);
+    }
+
+    free_aligned_(&block);
+  }
+}
+
+static void test_1_3(void)
+{
+  aligned_block_t block;
+  size_t          cb;
+  int             r = serialize_(0, &block, &cb);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    clasp_arguments_t const* args = NULL;
+
+    XTESTS_TEST_INTEGER_EQUAL(EINVAL, clasp_mapArguments(block.p, cb, OtherSpecifications, NULL, &args));
+    XTESTS_TEST_POINTER_EQUAL(NULL, args);
+
+    XTESTS_TEST_INTEGER_EQUAL(EINVAL, clasp_mapArguments(block.p, cb, NULL, NULL, &args));
+    XTESTS_TEST_POINTER_EQUAL(NULL, args);
+
+    XTESTS_TEST_INTEGER_EQUAL(EINVAL, clasp_mapArguments(block.p, cb - 16, Specifications, NULL, &args));
+    XTESTS_TEST_POINTER_EQUAL(NULL, args);
+
+    ((char*)block.p)[0] ^= 0x7f;
+
+    XTESTS_TEST_INTEGER_EQUAL(EINVAL, clasp_mapArguments(block.p, cb, Specifications, NULL, &args));
+    XTESTS_TEST_POINTER_EQUAL(NULL, args);
+
+    free_aligned_(&block);
+  }
+}
+
+static void test_1_4(void)
+{
+  aligned_block_t block;
+  size_t          cb;
+  int             r = serialize_(CLASP_F_PRESERVE_ORIGINAL_ARGUMENT_ORDER, &block, &cb);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    aligned_block_t copy;
+
+    if (alloc_aligned_(&copy, cb))
+    {
+      clasp_arguments_t const* args;
+
+      memcpy(copy.p, block.p, cb);
+
+      r = clasp_mapArguments(copy.p, cb, Specifications, NULL, &args);
+
+      if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+      {
+        XTESTS_TEST_INTEGER_EQUAL(6u, args->numArguments);
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--verbose", args->arguments[0].resolvedName.ptr);
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--quiet", args->arguments[1].resolvedName.ptr);
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--width", args->arguments[2].resolvedName.ptr);
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", args->arguments[3].value.ptr);
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("-def", args->arguments[5].value.ptr);
+
+        clasp_unmapArguments(args);
+      }
+
+      free_aligned_(&copy);
+    }
+
+    free_aligned_(&block);
+  }
+}
+
+static void test_1_5(void)
+{
+  aligned_block_t block;
+  size_t          cb;
+  int             r = serialize_(0, &block, &cb);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    clasp_arguments_t const* args;
+
+    r = clasp_mapArguments(block.p, cb, Specifications, NULL, &args);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+    {
+      /* mapped results may themselves be serialized */
+      aligned_block_t block2;
+      size_t          cb2;
+
+      XTESTS_TEST_INTEGER_EQUAL(0, clasp_serializeArguments(args, NULL, 0, &cb2));
+      XTESTS_TEST_INTEGER_EQUAL(cb, cb2);
+
+      if (alloc_aligned_(&block2, cb2))
+      {
+        r = clasp_serializeArguments(args, block2.p, cb2, NULL);
+
+        clasp_unmapArguments(args);
+
+        if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+        {
+          memset(block.p, 0, cb);
+
+          r = clasp_mapArguments(block2.p, cb2, Specifications, NULL, &args);
+
+          if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+          {
+            check_results_(args);
+
+            clasp_unmapArguments(args);
+          }
+        }
+
+        free_aligned_(&block2);
+      }
+      else
+      {
+        clasp_unmapArguments(args);
+      }
+    }
+
+    free_aligned_(&block);
+  }
+}
+
+
+static void test_1_6(void)
+{
+  aligned_block_t block;
+  size_t          cb;
+  int             r = serialize_(0, &block, &cb);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    aligned_block_t copy;
+    aligned_block_t pristine;
+
+    if (alloc_aligned_(&copy, cb))
+    {
+      if (alloc_aligned_(&pristine, cb))
+      {
+        clasp_arguments_t const* args1;
+        clasp_arguments_t const* args2;
+        clasp_arguments_t const* args3;
+
+        memcpy(copy.p, block.p, cb);
+        memcpy(pristine.p, block.p, cb);
+
+        /* one blob may be mapped by several users at once - as by
+         * workers sharing one mapping - at its own address and at others,
+         * without any of them writing into it
+         */
+        r = clasp_mapArguments(copy.p, cb, Specifications, NULL, &args1);
+
+        if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+        {
+          r = clasp_mapArguments(block.p, cb, Specifications, NULL, &args2);
+
+          if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+          {
+            r = clasp_mapArguments(copy.p, cb, Specifications, NULL, &args3);
+
+            if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+            {
+              XTESTS_TEST_POINTER_NOT_EQUAL(args1, args3);
+
+              check_results_(args1);
+              check_results_(args2);
+              check_results_(args3);
+
+              XTESTS_TEST_BOOLEAN_TRUE((char const*)args1->argv[0] > (char const*)copy.p);
+              XTESTS_TEST_BOOLEAN_TRUE((char const*)args1->argv[0] < (char const*)copy.p + cb);
+              XTESTS_TEST_POINTER_EQUAL(args1->argv[0], args3->argv[0]);
+
+              clasp_unmapArguments(args3);
+            }
+
+            clasp_unmapArguments(args2);
+          }
+
+          clasp_unmapArguments(args1);
+        }
+
+        XTESTS_TEST_INTEGER_EQUAL(0, memcmp(pristine.p, block.p, cb));
+        XTESTS_TEST_INTEGER_EQUAL(0, memcmp(pristine.p, copy.p, cb));
+
+        free_aligned_(&pristine);
+      }
+
+      free_aligned_(&copy);
+    }
+
+    free_aligned_(&block);
+  }
+}
+static void test_1_7(void)
+{
+  aligned_block_t block;
+  size_t          cb;
+  int             r = serialize_(0, &block, &cb);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    aligned_block_t copy;
+
+    if (alloc_aligned_(&copy, cb))
+    {
+      clasp_arguments_t const*  args = NULL;
+      clasp_arguments_t*        a;
+      int                       i;
+
+      /* a blob whose counts or offsets - though it is otherwise intact -
+       * lie beyond its end is rejected, rather than followed
+       */
+      for (i = 0; i != 5; ++i)
+      {
+        memcpy(copy.p, block.p, cb);
+
+        a = find_results_(copy.p, cb);
+
+        if (!XTESTS_TEST_POINTER_NOT_EQUAL(NULL, a))
+        {
+          break;
+        }
+
+        /* the blob was serialized at block.p, at which its pointers are
+         * thus relative
+         */
+        switch (i)
+        {
+        case 0:
+          a->numArguments = ~(size_t)0 / 2;
+          break;
+        case 1:
+          a->numValues = 7;
+          break;
+        case 2:
+          a->options = (clasp_argument_t const*)((char const*)block.p + 4 * cb);
+          break;
+        case 3:
+          ((clasp_argument_t*)((char*)copy.p + ((char const*)a->options - (char const*)block.p)))->value.len = 4 * cb;
+          break;
+        case 4:
+          a->argv = (char**)((char*)block.p + cb - sizeof(char*));
+          break;
+        }
+
+        XTESTS_TEST_INTEGER_EQUAL(EINVAL, clasp_mapArguments(copy.p, cb, Specifications, NULL, &args));
+        XTESTS_TEST_POINTER_EQUAL(NULL, args);
+      }
+
+      free_aligned_(&copy);
+    }
+
+    free_aligned_(&block);
+  }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
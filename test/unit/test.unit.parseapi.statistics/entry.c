@@ -0,0 +1,338 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.parseapi.statistics/entry.c
+ *
+ * Purpose: Unit-test(s) for clasp_getParseStatistics()
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <clasp/clasp.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C header files */
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#if defined(_MSC_VER) && \
+    _MSC_VER >= 1400
+# pragma warning(push)
+# pragma warning(disable : 4996)
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * globals
+ */
+
+static clasp_specification_t const Specifications[] =
+{
+    CLASP_FLAG("-v", "--verbose", "verbose"),
+    CLASP_FLAG("-q", "--quiet", "quiet"),
+    CLASP_OPTION("-w", "--width", "width", NULL),
+    CLASP_FLAG("-W", "--width=80", "width 80"),
+
+    CLASP_SPECIFICATION_ARRAY_TERMINATOR
+};
+
+static clasp_value_schema_t const Schema[] =
+{
+    CLASP_VALUE_SCHEMA(CLASP_VALUEKIND_NONE, 0),
+    CLASP_VALUE_SCHEMA(CLASP_VALUEKIND_NONE, 0),
+    CLASP_VALUE_SCHEMA(CLASP_VALUEKIND_UINT, 0),
+    CLASP_VALUE_SCHEMA(CLASP_VALUEKIND_NONE, 0),
+};
+
+static char const* const Argv[] = { "prog", "-vq", "--width=10", "abc", "--verb", "-w", "20", NULL };
+
+#define ARGC                                                (STLSOFT_NUM_ELEMENTS(Argv) - 1)
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+static void test_1_0(void);
+static void test_1_1(void);
+static void test_1_2(void);
+static void test_1_3(void);
+static void test_1_4(void);
+static void test_1_5(void);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main
+ */
+
+int main(int argc, char **argv)
+{
+  int retCode = EXIT_SUCCESS;
+  int verbosity = 2;
+
+  XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+  if (XTESTS_START_RUNNER("test.unit.parseapi.statistics", verbosity))
+  {
+    XTESTS_RUN_CASE(test_1_0);
+    XTESTS_RUN_CASE(test_1_1);
+    XTESTS_RUN_CASE(test_1_2);
+    XTESTS_RUN_CASE(test_1_3);
+    XTESTS_RUN_CASE(test_1_4);
+    XTESTS_RUN_CASE(test_1_5);
+
+    XTESTS_PRINT_RESULTS();
+
+    XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+  }
+
+  return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+/* An allocator that counts its allocations */
+static size_t s_numAllocations;
+static size_t s_numBytesAllocated;
+
+static void* CLASP_CALLCONV counting_malloc_(void* context, size_t cb)
+{
+  ((void)context);
+
+  ++s_numAllocations;
+  s_numBytesAllocated += cb;
+
+  return malloc(cb);
+}
+static void* CLASP_CALLCONV counting_realloc_(void* context, void* pv, size_t cb)
+{
+  ((void)context);
+
+  ++s_numAllocations;
+  s_numBytesAllocated += cb;
+
+  return realloc(pv, cb);
+}
+static void CLASP_CALLCONV counting_free_(void* context, void* pv)
+{
+  ((void)context);
+
+  free(pv);
+}
+
+static void init_context_(clasp_diagnostic_context_t* ctxt)
+{
+  clasp_init_diagnostic_context(ctxt, NULL, counting_malloc_, counting_realloc_, counting_free_, NULL, NULL, NULL);
+
+  ctxt->flags |= CLASP_DC_F_COLLECT_STATISTICS;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+static void test_1_0(void)
+{
+  clasp_arguments_t const*  args;
+  int const                 r = clasp_parseArguments(0, ARGC, (char**)Argv, Specifications, NULL, &args);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    XTESTS_TEST_POINTER_EQUAL(NULL, clasp_getParseStatistics(args));
+
+    clasp_releaseArguments(args);
+  }
+}
+
+static void test_1_1(void)
+{
+  clasp_diagnostic_context_t  ctxt;
+  clasp_arguments_t const*    args;
+  int                         r;
+
+  init_context_(&ctxt);
+
+  r = clasp_parseArguments(0, ARGC, (char**)Argv, Specifications, &ctxt, &args);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    clasp_parse_statistics_t const* const stats = clasp_getParseStatistics(args);
+
+    if (XTESTS_TEST_POINTER_NOT_EQUAL(NULL, stats))
+    {
+      XTESTS_TEST_BOOLEAN_TRUE(stats->nsValidation >= 0.0);
+      XTESTS_TEST_BOOLEAN_TRUE(stats->nsDuplicateChecking >= 0.0);
+      XTESTS_TEST_BOOLEAN_TRUE(stats->nsSizing >= 0.0);
+      XTESTS_TEST_BOOLEAN_TRUE(stats->nsFilling >= 0.0);
+      XTESTS_TEST_BOOLEAN_TRUE(stats->nsSorting >= 0.0);
+      XTESTS_TEST_BOOLEAN_TRUE(stats->nsWildcardExpansion >= 0.0);
+
+      XTESTS_TEST_INTEGER_NOT_EQUAL(0u, stats->numAliasLookups);
+      XTESTS_TEST_INTEGER_NOT_EQUAL(0u, stats->numStringComparisons);
+      XTESTS_TEST_INTEGER_NOT_EQUAL(0u, stats->numAllocations);
+      XTESTS_TEST_INTEGER_NOT_EQUAL(0u, stats->numBytesAllocated);
+    }
+
+    clasp_releaseArguments(args);
+  }
+}
+
+static void test_1_2(void)
+{
+  clasp_specification_index_t const*  index;
+  int                                 r = clasp_createSpecificationIndex(NULL, Specifications, &index);
+
+  if (0 != r)
+  {
+    XTESTS_TEST_FAIL_WITH_QUALIFIER("could not create index", strerror(r));
+  }
+  else
+  {
+    clasp_diagnostic_context_t  ctxt;
+    clasp_arguments_t const*    args1;
+    clasp_arguments_t const*    args2;
+
+    init_context_(&ctxt);
+
+    r = clasp_parseArguments(0, ARGC, (char**)Argv, Specifications, &ctxt, &args1);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+    {
+      r = clasp_parseArgumentsWithIndex(0, ARGC, (char**)Argv, index, &ctxt, &args2);
+
+      if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+      {
+        clasp_parse_statistics_t const* const stats1 = clasp_getParseStatistics(args1);
+        clasp_parse_statistics_t const* const stats2 = clasp_getParseStatistics(args2);
+
+        if (XTESTS_TEST_POINTER_NOT_EQUAL(NULL, stats1) &&
+            XTESTS_TEST_POINTER_NOT_EQUAL(NULL, stats2))
+        {
+          /* the index does the same lookups, in fewer comparisons, and
+           * has no validation to do
+           */
+          XTESTS_TEST_INTEGER_EQUAL(stats1->numAliasLookups, stats2->numAliasLookups);
+          XTESTS_TEST_BOOLEAN_TRUE(stats2->numStringComparisons < stats1->numStringComparisons);
+          XTESTS_TEST_BOOLEAN_TRUE(0.0 == stats2->nsValidation);
+          XTESTS_TEST_BOOLEAN_TRUE(0.0 == stats2->nsDuplicateChecking);
+        }
+
+        clasp_releaseArguments(args2);
+      }
+
+      clasp_releaseArguments(args1);
+    }
+
+    clasp_destroySpecificationIndex(index);
+  }
+}
+
+static void test_1_3(void)
+{
+  clasp_diagnostic_context_t  ctxt;
+  clasp_arguments_t const*    args;
+  int                         r;
+
+  init_context_(&ctxt);
+
+  s_numAllocations    = 0;
+  s_numBytesAllocated = 0;
+
+  r = clasp_parseArguments(CLASP_F_ALLOW_UNIQUE_PREFIXES, ARGC, (char**)Argv, Specifications, &ctxt, &args);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    clasp_parse_statistics_t const* const stats = clasp_getParseStatistics(args);
+
+    if (XTESTS_TEST_POINTER_NOT_EQUAL(NULL, stats))
+    {
+      /* the prefix trie, and the results */
+      XTESTS_TEST_INTEGER_EQUAL(2u, stats->numAllocations);
+      XTESTS_TEST_INTEGER_EQUAL(s_numAllocations, stats->numAllocations);
+      XTESTS_TEST_INTEGER_EQUAL(s_numBytesAllocated, stats->numBytesAllocated);
+    }
+
+    clasp_releaseArguments(args);
+  }
+}
+
+static void test_1_4(void)
+{
+  clasp_diagnostic_context_t  ctxt;
+  clasp_arguments_t const*    args;
+  int                         r;
+
+  init_context_(&ctxt);
+
+  r = clasp_parseArguments(0, ARGC, (char**)Argv, Specifications, &ctxt, &args);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    char const* const argv[] = { "-q" };
+
+    XTESTS_TEST_POINTER_NOT_EQUAL(NULL, clasp_getParseStatistics(args));
+
+    r = clasp_appendArguments(&args, 1, 1, (char**)argv);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+    {
+      XTESTS_TEST_POINTER_EQUAL(NULL, clasp_getParseStatistics(args));
+    }
+
+    clasp_releaseArguments(args);
+  }
+}
+
+static void test_1_5(void)
+{
+  clasp_diagnostic_context_t  ctxt;
+  clasp_arguments_t const*    args;
+  int                         r;
+
+  init_context_(&ctxt);
+
+  r = clasp_parseArgumentsWithSchema(0, ARGC, (char**)Argv, Specifications, Schema, &ctxt, &args);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    clasp_parse_statistics_t const* const stats = clasp_getParseStatistics(args);
+
+    if (XTESTS_TEST_POINTER_NOT_EQUAL(NULL, stats))
+    {
+      /* the specifications are validated, as by clasp_parseArguments() */
+      XTESTS_TEST_BOOLEAN_TRUE(stats->nsValidation + stats->nsDuplicateChecking > 0.0);
+      XTESTS_TEST_INTEGER_NOT_EQUAL(0u, stats->numAliasLookups);
+    }
+
+    clasp_releaseArguments(args);
+  }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
@@ -0,0 +1,519 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.parseapi.subcommands/entry.c
+ *
+ * Purpose: Unit-test(s) for clasp_createSubcommandTable() and
+ *          clasp_parseSubcommand()
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <clasp/clasp.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C header files */
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#if defined(_MSC_VER) && \
+    _MSC_VER >= 1400
+# pragma warning(push)
+# pragma warning(disable : 4996)
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * globals
+ */
+
+static clasp_specification_t const GlobalSpecifications[] =
+{
+    CLASP_FLAG("-v", "--verbose", "verbose"),
+    CLASP_OPTION("-C", "--directory", "directory", NULL),
+    CLASP_OPTION(NULL, "--format", "output format", "|text|json|"),
+    CLASP_OPTION_ALIAS("-j", "--format=json"),
+
+    CLASP_SPECIFICATION_ARRAY_TERMINATOR
+};
+
+static clasp_specification_t const BuildSpecifications[] =
+{
+    CLASP_OPTION("-j", "--jobs", "number of jobs", NULL),
+    CLASP_FLAG("-k", "--keep-going", "keep going"),
+
+    CLASP_SPECIFICATION_ARRAY_TERMINATOR
+};
+
+static clasp_specification_t const DeploySpecifications[] =
+{
+    CLASP_FLAG("-n", "--dry-run", "dry run"),
+
+    CLASP_SPECIFICATION_ARRAY_TERMINATOR
+};
+
+static clasp_subcommand_t const Subcommands[] =
+{
+    CLASP_SUBCOMMAND("build", BuildSpecifications, "builds the project"),
+    CLASP_SUBCOMMAND("deploy", DeploySpecifications, "deploys the project"),
+    CLASP_SUBCOMMAND("help", NULL, "shows help"),
+
+    CLASP_SUBCOMMAND_ARRAY_TERMINATOR
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+static void test_1_0(void);
+static void test_1_1(void);
+static void test_1_2(void);
+static void test_1_3(void);
+static void test_1_4(void);
+static void test_1_5(void);
+static void test_1_6(void);
+static void test_1_7(void);
+static void test_1_8(void);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main
+ */
+
+int main(int argc, char **argv)
+{
+  int retCode = EXIT_SUCCESS;
+  int verbosity = 2;
+
+  XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+  if (XTESTS_START_RUNNER("test.unit.parseapi.subcommands", verbosity))
+  {
+    XTESTS_RUN_CASE(test_1_0);
+    XTESTS_RUN_CASE(test_1_1);
+    XTESTS_RUN_CASE(test_1_2);
+    XTESTS_RUN_CASE(test_1_3);
+    XTESTS_RUN_CASE(test_1_4);
+    XTESTS_RUN_CASE(test_1_5);
+    XTESTS_RUN_CASE(test_1_6);
+    XTESTS_RUN_CASE(test_1_7);
+    XTESTS_RUN_CASE(test_1_8);
+
+    XTESTS_PRINT_RESULTS();
+
+    XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+  }
+
+  return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+/* Counts the indexes created via the context */
+static size_t s_numIndexes;
+
+static void CLASP_CALLCONV trace_(
+  void*               context
+, clasp_alloc_op_t    op
+, clasp_alloc_site_t  site
+, void*               pvOld
+, void*               pvNew
+, size_t              cb
+)
+{
+  ((void)context);
+  ((void)pvOld);
+  ((void)pvNew);
+  ((void)cb);
+
+  if (CLASP_ALLOC_OP_MALLOC == op &&
+      CLASP_ALLOC_SITE_INDEX == site)
+  {
+    ++s_numIndexes;
+  }
+}
+
+static int parse_(
+  clasp_subcommand_table_t const* table
+, char const* const*              argv
+, clasp_subcommand_results_t*     results
+)
+{
+  int argc;
+
+  for (argc = 0; NULL != argv[argc]; ++argc)
+  {}
+
+  return clasp_parseSubcommand(0, argc, (char**)argv, table, NULL, results);
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+static void test_1_0(void)
+{
+  clasp_subcommand_table_t const* table;
+  int                             r = clasp_createSubcommandTable(NULL, GlobalSpecifications, Subcommands, &table);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    char const* const           argv[] = { "tool", "-v", "build", "--jobs=4", "-k", "src", NULL };
+    clasp_subcommand_results_t  results;
+
+    r = parse_(table, argv, &results);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+    {
+      XTESTS_TEST_INTEGER_EQUAL(2, results.verbIndex);
+
+      if (XTESTS_TEST_POINTER_NOT_EQUAL(NULL, results.subcommand))
+      {
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("build", results.subcommand->name);
+      }
+
+      if (XTESTS_TEST_POINTER_NOT_EQUAL(NULL, results.globalArgs))
+      {
+        XTESTS_TEST_INTEGER_EQUAL(1u, results.globalArgs->numArguments);
+        XTESTS_TEST_POINTER_NOT_EQUAL(NULL, clasp_findFlagOrOption(results.globalArgs, "--verbose", 0));
+      }
+
+      if (XTESTS_TEST_POINTER_NOT_EQUAL(NULL, results.args))
+      {
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("build", results.args->programName.ptr);
+        XTESTS_TEST_INTEGER_EQUAL(1u, results.args->numFlags);
+        XTESTS_TEST_INTEGER_EQUAL(1u, results.args->numOptions);
+        XTESTS_TEST_INTEGER_EQUAL(1u, results.args->numValues);
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--keep-going", results.args->flags[0].resolvedName.ptr);
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("4", results.args->options[0].value.ptr);
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("src", results.args->values[0].value.ptr);
+        XTESTS_TEST_POINTER_EQUAL(NULL, clasp_findFlagOrOption(results.args, "--verbose", 0));
+      }
+    }
+
+    clasp_releaseSubcommandResults(&results);
+
+    clasp_destroySubcommandTable(table);
+  }
+}
+
+static void test_1_1(void)
+{
+  clasp_subcommand_table_t const* table;
+  int                             r = clasp_createSubcommandTable(NULL, GlobalSpecifications, Subcommands, &table);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    /* the value of a separately-given global option is not the verb */
+    char const* const           argv[] = { "tool", "-C", "build", "deploy", "-n", NULL };
+    clasp_subcommand_results_t  results;
+
+    r = parse_(table, argv, &results);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+    {
+      XTESTS_TEST_INTEGER_EQUAL(3, results.verbIndex);
+
+      if (XTESTS_TEST_POINTER_NOT_EQUAL(NULL, results.subcommand))
+      {
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("deploy", results.subcommand->name);
+      }
+
+      if (XTESTS_TEST_INTEGER_EQUAL(1u, results.globalArgs->numOptions))
+      {
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--directory", results.globalArgs->options[0].resolvedName.ptr);
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("build", results.globalArgs->options[0].value.ptr);
+      }
+
+      if (XTESTS_TEST_INTEGER_EQUAL(1u, results.args->numFlags))
+      {
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--dry-run", results.args->flags[0].resolvedName.ptr);
+      }
+    }
+
+    clasp_releaseSubcommandResults(&results);
+
+    clasp_destroySubcommandTable(table);
+  }
+}
+
+static void test_1_2(void)
+{
+  clasp_subcommand_table_t const* table;
+  int                             r = clasp_createSubcommandTable(NULL, GlobalSpecifications, Subcommands, &table);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    char const* const           argv[] = { "tool", "-v", NULL };
+    clasp_subcommand_results_t  results;
+
+    r = parse_(table, argv, &results);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+    {
+      XTESTS_TEST_INTEGER_EQUAL(2, results.verbIndex);
+      XTESTS_TEST_POINTER_EQUAL(NULL, results.subcommand);
+      XTESTS_TEST_POINTER_EQUAL(NULL, results.args);
+      XTESTS_TEST_POINTER_NOT_EQUAL(NULL, results.globalArgs);
+    }
+
+    clasp_releaseSubcommandResults(&results);
+
+    clasp_destroySubcommandTable(table);
+  }
+}
+
+static void test_1_3(void)
+{
+  clasp_subcommand_table_t const* table;
+  int                             r = clasp_createSubcommandTable(NULL, GlobalSpecifications, Subcommands, &table);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    char const* const           argv[] = { "tool", "-v", "bulid", "-k", NULL };
+    clasp_subcommand_results_t  results;
+
+    r = parse_(table, argv, &results);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(ENOENT, r))
+    {
+      XTESTS_TEST_INTEGER_EQUAL(2, results.verbIndex);
+      XTESTS_TEST_POINTER_EQUAL(NULL, results.subcommand);
+      XTESTS_TEST_POINTER_EQUAL(NULL, results.args);
+
+      if (XTESTS_TEST_POINTER_NOT_EQUAL(NULL, results.globalArgs))
+      {
+        XTESTS_TEST_INTEGER_EQUAL(1u, results.globalArgs->numFlags);
+      }
+    }
+
+    clasp_releaseSubcommandResults(&results);
+
+    clasp_destroySubcommandTable(table);
+  }
+}
+
+static void test_1_4(void)
+{
+  static clasp_subcommand_t const duplicates[] =
+  {
+    CLASP_SUBCOMMAND("build", BuildSpecifications, NULL),
+    CLASP_SUBCOMMAND("deploy", DeploySpecifications, NULL),
+    CLASP_SUBCOMMAND("build", DeploySpecifications, NULL),
+
+    CLASP_SUBCOMMAND_ARRAY_TERMINATOR
+  };
+  static clasp_subcommand_t const empty[] =
+  {
+    CLASP_SUBCOMMAND("", BuildSpecifications, NULL),
+
+    CLASP_SUBCOMMAND_ARRAY_TERMINATOR
+  };
+
+  clasp_subcommand_table_t const* table = NULL;
+
+  XTESTS_TEST_INTEGER_EQUAL(EINVAL, clasp_createSubcommandTable(NULL, GlobalSpecifications, duplicates, &table));
+  XTESTS_TEST_POINTER_EQUAL(NULL, table);
+
+  XTESTS_TEST_INTEGER_EQUAL(EINVAL, clasp_createSubcommandTable(NULL, GlobalSpecifications, empty, &table));
+  XTESTS_TEST_POINTER_EQUAL(NULL, table);
+}
+
+static void test_1_5(void)
+{
+  clasp_diagnostic_context_t      ctxt;
+  clasp_subcommand_table_t const* table;
+  int                             r;
+
+  clasp_init_diagnostic_context(&ctxt, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+  ctxt.pfnTrace = trace_;
+
+  s_numIndexes = 0;
+
+  r = clasp_createSubcommandTable(&ctxt, GlobalSpecifications, Subcommands, &table);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    char const* const           argv[] = { "tool", "build", "-j", "2", NULL };
+    clasp_subcommand_results_t  results;
+
+    /* only the global specifications are indexed up front ... */
+    XTESTS_TEST_INTEGER_EQUAL(1u, s_numIndexes);
+
+    r = parse_(table, argv, &results);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+    {
+      XTESTS_TEST_MULTIBYTE_STRING_EQUAL("2", results.args->options[0].value.ptr);
+    }
+    clasp_releaseSubcommandResults(&results);
+
+    /* ... those of a subcommand on its first selection ... */
+    XTESTS_TEST_INTEGER_EQUAL(2u, s_numIndexes);
+
+    r = parse_(table, argv, &results);
+
+    XTESTS_TEST_INTEGER_EQUAL(0, r);
+    clasp_releaseSubcommandResults(&results);
+
+    /* ... and only then */
+    XTESTS_TEST_INTEGER_EQUAL(2u, s_numIndexes);
+
+    clasp_destroySubcommandTable(table);
+  }
+}
+
+static void test_1_6(void)
+{
+  clasp_specification_index_t const* index;
+  int                                 r = clasp_createSpecificationIndex(NULL, DeploySpecifications, &index);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    clasp_subcommand_t const subcommands[] =
+    {
+      CLASP_SUBCOMMAND_INDEXED("deploy", NULL, NULL),
+      CLASP_SUBCOMMAND("help", NULL, NULL),
+
+      CLASP_SUBCOMMAND_ARRAY_TERMINATOR
+    };
+    clasp_subcommand_t              subcommands_[STLSOFT_NUM_ELEMENTS(subcommands)];
+    clasp_subcommand_table_t const* table;
+
+    memcpy(subcommands_, subcommands, sizeof(subcommands));
+    subcommands_[0].index = index;
+
+    r = clasp_createSubcommandTable(NULL, NULL, subcommands_, &table);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+    {
+      char const* const           argv1[] = { "tool", "deploy", "--dry-run", NULL };
+      char const* const           argv2[] = { "tool", "help", "build", NULL };
+      clasp_subcommand_results_t  results;
+
+      r = parse_(table, argv1, &results);
+
+      if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+      {
+        XTESTS_TEST_INTEGER_EQUAL(1, results.verbIndex);
+        XTESTS_TEST_INTEGER_EQUAL(0u, results.globalArgs->numArguments);
+        XTESTS_TEST_INTEGER_EQUAL(1u, results.args->numFlags);
+        XTESTS_TEST_INTEGER_EQUAL(0, results.args->flags[0].aliasIndex);
+      }
+      clasp_releaseSubcommandResults(&results);
+
+      r = parse_(table, argv2, &results);
+
+      if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+      {
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("help", results.subcommand->name);
+        XTESTS_TEST_INTEGER_EQUAL(1u, results.args->numValues);
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("build", results.args->values[0].value.ptr);
+      }
+      clasp_releaseSubcommandResults(&results);
+
+      clasp_destroySubcommandTable(table);
+    }
+
+    clasp_destroySpecificationIndex(index);
+  }
+}
+
+static void test_1_7(void)
+{
+  clasp_subcommand_table_t const* table;
+  int                             r = clasp_createSubcommandTable(NULL, GlobalSpecifications, Subcommands, &table);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    /* the global options end at the double-hyphen */
+    char const* const           argv[] = { "tool", "--verbose", "--", "build", "-k", NULL };
+    clasp_subcommand_results_t  results;
+
+    r = parse_(table, argv, &results);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+    {
+      XTESTS_TEST_INTEGER_EQUAL(3, results.verbIndex);
+      XTESTS_TEST_MULTIBYTE_STRING_EQUAL("build", results.subcommand->name);
+      XTESTS_TEST_INTEGER_EQUAL(1u, results.globalArgs->numFlags);
+      XTESTS_TEST_INTEGER_EQUAL(1u, results.args->numFlags);
+    }
+
+    clasp_releaseSubcommandResults(&results);
+
+    clasp_destroySubcommandTable(table);
+  }
+}
+
+
+static void test_1_8(void)
+{
+  clasp_subcommand_table_t const* table;
+  int                             r = clasp_createSubcommandTable(NULL, GlobalSpecifications, Subcommands, &table);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    /* an option alias that carries its own value does not take the next
+     * argument, which is therefore the verb
+     */
+    char const* const           argv[] = { "tool", "-j", "build", "-k", NULL };
+    clasp_subcommand_results_t  results;
+
+    r = parse_(table, argv, &results);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+    {
+      XTESTS_TEST_INTEGER_EQUAL(2, results.verbIndex);
+
+      if (XTESTS_TEST_POINTER_NOT_EQUAL(NULL, results.subcommand))
+      {
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("build", results.subcommand->name);
+      }
+
+      if (XTESTS_TEST_INTEGER_EQUAL(1u, results.globalArgs->numOptions))
+      {
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--format", results.globalArgs->options[0].resolvedName.ptr);
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("json", results.globalArgs->options[0].value.ptr);
+      }
+
+      if (XTESTS_TEST_POINTER_NOT_EQUAL(NULL, results.args))
+      {
+        XTESTS_TEST_INTEGER_EQUAL(1u, results.args->numFlags);
+      }
+    }
+
+    clasp_releaseSubcommandResults(&results);
+
+    clasp_destroySubcommandTable(table);
+  }
+}
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
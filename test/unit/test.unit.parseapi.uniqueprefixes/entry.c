@@ -0,0 +1,270 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.parseapi.uniqueprefixes/entry.c
+ *
+ * Purpose: Unit-test(s) for `CLASP_F_ALLOW_UNIQUE_PREFIXES`
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <clasp/clasp.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C header files */
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#if defined(_MSC_VER) && \
+    _MSC_VER >= 1400
+# pragma warning(push)
+# pragma warning(disable : 4996)
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * globals
+ */
+
+static clasp_specification_t const Specifications[] =
+{
+    CLASP_FLAG("-v", "--verbose", "be verbose"),
+    CLASP_FLAG(NULL, "--version", "show version"),
+    CLASP_OPTION("-o", "--output", "output file", ""),
+
+    CLASP_SPECIFICATION_ARRAY_TERMINATOR
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+static void test_1_0(void);
+static void test_1_1(void);
+static void test_1_2(void);
+static void test_1_3(void);
+static void test_1_4(void);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main
+ */
+
+int main(int argc, char **argv)
+{
+  int retCode = EXIT_SUCCESS;
+  int verbosity = 2;
+
+  XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+  if (XTESTS_START_RUNNER("test.unit.parseapi.uniqueprefixes", verbosity))
+  {
+    XTESTS_RUN_CASE(test_1_0);
+    XTESTS_RUN_CASE(test_1_1);
+    XTESTS_RUN_CASE(test_1_2);
+    XTESTS_RUN_CASE(test_1_3);
+    XTESTS_RUN_CASE(test_1_4);
+
+    XTESTS_PRINT_RESULTS();
+
+    XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+  }
+
+  return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+static void test_1_0(void)
+{
+  char const* const         argv[] =
+  {
+    "program",
+
+    "--verb",
+
+    NULL
+  };
+  int const                 argc = STLSOFT_NUM_ELEMENTS(argv) - 1;
+  clasp_arguments_t const*  args;
+  int const                 cr   = clasp_parseArguments(0, argc, (char**)argv, Specifications, NULL, &args);
+
+  if (0 != cr)
+  {
+    XTESTS_TEST_FAIL_WITH_QUALIFIER("failed to initialise CLASP", strerror(cr));
+  }
+  else
+  {
+    XTESTS_TEST_INTEGER_EQUAL(1u, args->numFlags);
+    XTESTS_TEST_INTEGER_EQUAL(-1, args->flags[0].aliasIndex);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--verb", args->flags[0].resolvedName.ptr);
+
+    clasp_releaseArguments(args);
+  }
+}
+
+static void test_1_1(void)
+{
+  char const* const         argv[] =
+  {
+    "program",
+
+    "--verb",
+
+    NULL
+  };
+  int const                 argc = STLSOFT_NUM_ELEMENTS(argv) - 1;
+  clasp_arguments_t const*  args;
+  int const                 cr   = clasp_parseArguments(CLASP_F_ALLOW_UNIQUE_PREFIXES, argc, (char**)argv, Specifications, NULL, &args);
+
+  if (0 != cr)
+  {
+    XTESTS_TEST_FAIL_WITH_QUALIFIER("failed to initialise CLASP", strerror(cr));
+  }
+  else
+  {
+    XTESTS_TEST_INTEGER_EQUAL(1u, args->numFlags);
+    XTESTS_TEST_ENUM_EQUAL(CLASP_ARGTYPE_FLAG, args->flags[0].type);
+    XTESTS_TEST_INTEGER_EQUAL(0, args->flags[0].aliasIndex);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--verb", args->flags[0].givenName.ptr);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--verbose", args->flags[0].resolvedName.ptr);
+    XTESTS_TEST_BOOLEAN_TRUE(clasp_flagIsSpecified(args, "--verbose"));
+
+    clasp_releaseArguments(args);
+  }
+}
+
+static void test_1_2(void)
+{
+  char const* const         argv[] =
+  {
+    "program",
+
+    "--out=file1",
+    "--outp",
+    "file2",
+
+    NULL
+  };
+  int const                 argc = STLSOFT_NUM_ELEMENTS(argv) - 1;
+  clasp_arguments_t const*  args;
+  int const                 cr   = clasp_parseArguments(CLASP_F_ALLOW_UNIQUE_PREFIXES, argc, (char**)argv, Specifications, NULL, &args);
+
+  if (0 != cr)
+  {
+    XTESTS_TEST_FAIL_WITH_QUALIFIER("failed to initialise CLASP", strerror(cr));
+  }
+  else
+  {
+    XTESTS_TEST_INTEGER_EQUAL(2u, args->numOptions);
+    XTESTS_TEST_INTEGER_EQUAL(0u, args->numValues);
+    XTESTS_TEST_INTEGER_EQUAL(2, args->options[0].aliasIndex);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--out", args->options[0].givenName.ptr);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--output", args->options[0].resolvedName.ptr);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("file1", args->options[0].value.ptr);
+    XTESTS_TEST_INTEGER_EQUAL(2, args->options[1].aliasIndex);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--outp", args->options[1].givenName.ptr);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--output", args->options[1].resolvedName.ptr);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("file2", args->options[1].value.ptr);
+
+    clasp_releaseArguments(args);
+  }
+}
+
+static void test_1_3(void)
+{
+  char const* const         argv[] =
+  {
+    "program",
+
+    "--ver",
+
+    NULL
+  };
+  int const                 argc = STLSOFT_NUM_ELEMENTS(argv) - 1;
+  clasp_arguments_t const*  args;
+  int const                 cr   = clasp_parseArguments(CLASP_F_ALLOW_UNIQUE_PREFIXES, argc, (char**)argv, Specifications, NULL, &args);
+
+  if (0 != cr)
+  {
+    XTESTS_TEST_FAIL_WITH_QUALIFIER("failed to initialise CLASP", strerror(cr));
+  }
+  else
+  {
+    clasp_specification_t const*    candidates[4];
+    size_t const                    numCandidates = clasp_findPrefixCandidates(args, NULL, "--ver", 5, candidates, STLSOFT_NUM_ELEMENTS(candidates));
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, args->numFlags);
+    XTESTS_TEST_INTEGER_EQUAL(-1, args->flags[0].aliasIndex);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--ver", args->flags[0].resolvedName.ptr);
+    XTESTS_TEST_INTEGER_EQUAL(1u, clasp_reportUnrecognisedFlagsAndOptions(args, NULL, NULL, 0));
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(2u, numCandidates));
+    XTESTS_TEST_POINTER_EQUAL(&Specifications[0], candidates[0]);
+    XTESTS_TEST_POINTER_EQUAL(&Specifications[1], candidates[1]);
+
+    clasp_releaseArguments(args);
+  }
+}
+
+static void test_1_4(void)
+{
+  char const* const         argv[] =
+  {
+    "program",
+
+    "--verbose",
+    "--x",
+    "--",
+    "--vers",
+
+    NULL
+  };
+  int const                 argc = STLSOFT_NUM_ELEMENTS(argv) - 1;
+  clasp_arguments_t const*  args;
+  int const                 cr   = clasp_parseArguments(CLASP_F_ALLOW_UNIQUE_PREFIXES, argc, (char**)argv, Specifications, NULL, &args);
+
+  if (0 != cr)
+  {
+    XTESTS_TEST_FAIL_WITH_QUALIFIER("failed to initialise CLASP", strerror(cr));
+  }
+  else
+  {
+    XTESTS_TEST_INTEGER_EQUAL(2u, args->numFlags);
+    XTESTS_TEST_INTEGER_EQUAL(0, args->flags[0].aliasIndex);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--verbose", args->flags[0].givenName.ptr);
+    XTESTS_TEST_INTEGER_EQUAL(-1, args->flags[1].aliasIndex);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--x", args->flags[1].resolvedName.ptr);
+    XTESTS_TEST_INTEGER_EQUAL(1u, args->numValues);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--vers", args->values[0].value.ptr);
+
+    clasp_releaseArguments(args);
+  }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,577 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.parseapi.valuesfromstream/entry.c
+ *
+ * Purpose: Unit-test(s) for clasp_appendValuesFromStream() and
+ *          clasp_forEachStreamedValue()
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <clasp/clasp.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C header files */
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#if defined(_MSC_VER) && \
+    _MSC_VER >= 1400
+# pragma warning(push)
+# pragma warning(disable : 4996)
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+static void test_1_0(void);
+static void test_1_1(void);
+static void test_1_2(void);
+static void test_1_3(void);
+static void test_1_4(void);
+static void test_1_5(void);
+static void test_1_6(void);
+static void test_1_7(void);
+static void test_1_8(void);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * globals
+ */
+
+static char const File1[] = "test.unit.parseapi.valuesfromstream.1.tmp";
+static char const File2[] = "test.unit.parseapi.valuesfromstream.2.tmp";
+
+static clasp_specification_t const Specifications[] =
+{
+    CLASP_FLAG("-v", "--verbose", "makes output verbose"),
+    CLASP_OPTION(NULL, "--files-from", "reads the paths from the given file, or from stdin for '-'", NULL),
+
+    CLASP_SPECIFICATION_ARRAY_TERMINATOR
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main
+ */
+
+int main(int argc, char **argv)
+{
+  int retCode = EXIT_SUCCESS;
+  int verbosity = 2;
+
+  XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+  if (XTESTS_START_RUNNER("test.unit.parseapi.valuesfromstream", verbosity))
+  {
+    XTESTS_RUN_CASE(test_1_0);
+    XTESTS_RUN_CASE(test_1_1);
+    XTESTS_RUN_CASE(test_1_2);
+    XTESTS_RUN_CASE(test_1_3);
+    XTESTS_RUN_CASE(test_1_4);
+    XTESTS_RUN_CASE(test_1_5);
+    XTESTS_RUN_CASE(test_1_6);
+    XTESTS_RUN_CASE(test_1_7);
+    XTESTS_RUN_CASE(test_1_8);
+
+    XTESTS_PRINT_RESULTS();
+
+    XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+  }
+
+  remove(File1);
+  remove(File2);
+
+  return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+static void write_file_(
+  char const* path
+, char const* contents
+, size_t      len
+)
+{
+  FILE* const stm = fopen(path, "wb");
+
+  if (NULL != stm)
+  {
+    fwrite(contents, 1, len, stm);
+    fclose(stm);
+  }
+}
+
+static int parse_(
+  unsigned                          flags
+, char const* const*                argv
+, clasp_diagnostic_context_t const* ctxt
+, clasp_arguments_t const**         args
+)
+{
+  int argc;
+
+  for (argc = 0; NULL != argv[argc]; ++argc)
+  {}
+
+  return clasp_parseArguments(flags, argc, (char**)argv, Specifications, ctxt, args);
+}
+
+static int value_equal_(
+  clasp_argument_t const* arg
+, char const*             expected
+)
+{
+  return  strlen(expected) == arg->value.len &&
+          0 == strncmp(expected, arg->value.ptr, arg->value.len) &&
+          '\0' == arg->value.ptr[arg->value.len];
+}
+
+/* Collects the values delivered to it, stopping after maxValues */
+typedef struct collector_t collector_t;
+
+struct collector_t
+{
+  size_t  numValues;
+  size_t  maxValues;
+  size_t  totalLength;
+  char    first[32];
+};
+
+static int CLASP_CALLCONV collect_(
+  void*       param
+, char const* value
+, size_t      cchValue
+, size_t      index
+)
+{
+  collector_t* const collector = (collector_t*)param;
+
+  if (0 == index)
+  {
+    strncpy(collector->first, value, sizeof(collector->first) - 1);
+  }
+
+  if (index != collector->numValues ||
+      strlen(value) != cchValue)
+  {
+    return -1;
+  }
+
+  ++collector->numValues;
+  collector->totalLength += cchValue;
+
+  return (collector->numValues == collector->maxValues) ? 99 : 0;
+}
+
+/* Counts the chunks allocated and freed */
+static size_t s_numChunksAllocated;
+static size_t s_numChunksFreed;
+
+static void CLASP_CALLCONV trace_(
+  void*               context
+, clasp_alloc_op_t    op
+, clasp_alloc_site_t  site
+, void*               pvOld
+, void*               pvNew
+, size_t              cb
+)
+{
+  ((void)context);
+  ((void)pvOld);
+  ((void)pvNew);
+  ((void)cb);
+
+  if (CLASP_ALLOC_SITE_STREAM_CHUNK == site)
+  {
+    if (CLASP_ALLOC_OP_MALLOC == op)
+    {
+      ++s_numChunksAllocated;
+    }
+    else if (CLASP_ALLOC_OP_FREE == op)
+    {
+      ++s_numChunksFreed;
+    }
+  }
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+static void test_1_0(void)
+{
+  /* newline-delimited, with CRLF, empty lines, and no final newline */
+  static char const Contents[] = "a.txt\nb.txt\r\n\nc.txt";
+
+  char const* const         argv[] = { "arg0", "x.txt", "--files-from=test.unit.parseapi.valuesfromstream.1.tmp", "-v", NULL };
+  clasp_arguments_t const*  args;
+  int                       r;
+
+  write_file_(File1, Contents, sizeof(Contents) - 1);
+
+  r = parse_(0, argv, NULL, &args);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    r = clasp_appendValuesFromStream(&args, "--files-from", 0, 1);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+    {
+      XTESTS_TEST_INTEGER_EQUAL(6u, args->numArguments);
+      XTESTS_TEST_INTEGER_EQUAL(1u, args->numFlags);
+      XTESTS_TEST_INTEGER_EQUAL(1u, args->numOptions);
+
+      if (XTESTS_TEST_INTEGER_EQUAL(4u, args->numValues))
+      {
+        XTESTS_TEST_BOOLEAN_TRUE(value_equal_(&args->values[0], "x.txt"));
+        XTESTS_TEST_INTEGER_EQUAL(0, args->values[0].source);
+        XTESTS_TEST_BOOLEAN_TRUE(value_equal_(&args->values[1], "a.txt"));
+        XTESTS_TEST_INTEGER_EQUAL(1, args->values[1].source);
+        XTESTS_TEST_INTEGER_EQUAL(0, args->values[1].cmdLineIndex);
+        XTESTS_TEST_BOOLEAN_TRUE(value_equal_(&args->values[2], "b.txt"));
+        XTESTS_TEST_INTEGER_EQUAL(1, args->values[2].cmdLineIndex);
+        XTESTS_TEST_BOOLEAN_TRUE(value_equal_(&args->values[3], "c.txt"));
+        XTESTS_TEST_INTEGER_EQUAL(2, args->values[3].cmdLineIndex);
+        XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGTYPE_VALUE, args->values[3].type);
+      }
+
+      /* the option has been used */
+      XTESTS_TEST_BOOLEAN_TRUE(clasp_argumentIsUsed(args, &args->options[0]));
+      XTESTS_TEST_INTEGER_EQUAL(0u, clasp_reportUnusedOptions(args, NULL, 0));
+    }
+
+    clasp_releaseArguments(args);
+  }
+}
+
+static void test_1_1(void)
+{
+  /* NUL-delimited, in which newlines are part of a value */
+  static char const Contents[] = "a b.txt\0c\nd.txt\0\0e.txt";
+
+  char const* const         argv[] = { "arg0", "--files-from=test.unit.parseapi.valuesfromstream.1.tmp", NULL };
+  clasp_arguments_t const*  args;
+  int                       r;
+
+  write_file_(File1, Contents, sizeof(Contents) - 1);
+
+  r = parse_(0, argv, NULL, &args);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    r = clasp_appendValuesFromStream(&args, "--files-from", CLASP_STREAM_F_NUL_DELIMITED, 1);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r) &&
+        XTESTS_TEST_INTEGER_EQUAL(3u, args->numValues))
+    {
+      XTESTS_TEST_BOOLEAN_TRUE(value_equal_(&args->values[0], "a b.txt"));
+      XTESTS_TEST_BOOLEAN_TRUE(value_equal_(&args->values[1], "c\nd.txt"));
+      XTESTS_TEST_BOOLEAN_TRUE(value_equal_(&args->values[2], "e.txt"));
+    }
+
+    clasp_releaseArguments(args);
+  }
+}
+
+static void test_1_2(void)
+{
+  /* a list much larger than a chunk, whose values straddle the chunks */
+  enum { NUM_VALUES = 40000 };
+
+  FILE* const stm = fopen(File1, "wb");
+
+  if (XTESTS_TEST_POINTER_NOT_EQUAL(NULL, stm))
+  {
+    char const* const         argv[] = { "arg0", "--files-from=test.unit.parseapi.valuesfromstream.1.tmp", NULL };
+    clasp_arguments_t const*  args;
+    int                       r;
+    unsigned                  i;
+
+    for (i = 0; i != NUM_VALUES; ++i)
+    {
+      fprintf(stm, "dir-%u/file-%05u.txt%c", i % 7, i, '\0');
+    }
+    fclose(stm);
+
+    r = parse_(0, argv, NULL, &args);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+    {
+      r = clasp_appendValuesFromStream(&args, "--files-from", CLASP_STREAM_F_NUL_DELIMITED, 1);
+
+      if (XTESTS_TEST_INTEGER_EQUAL(0, r) &&
+          XTESTS_TEST_INTEGER_EQUAL((size_t)NUM_VALUES, args->numValues))
+      {
+        for (i = 0; i != NUM_VALUES; ++i)
+        {
+          char expected[32];
+
+          sprintf(expected, "dir-%u/file-%05u.txt", i % 7, i);
+
+          if (!XTESTS_TEST_BOOLEAN_TRUE(value_equal_(&args->values[i], expected)))
+          {
+            break;
+          }
+        }
+      }
+
+      clasp_releaseArguments(args);
+    }
+  }
+}
+
+static void test_1_3(void)
+{
+  /* each instance of the option is read, in order */
+  char const* const         argv[] =
+  {
+    "arg0",
+    "--files-from=test.unit.parseapi.valuesfromstream.2.tmp",
+    "y.txt",
+    "--files-from=test.unit.parseapi.valuesfromstream.1.tmp",
+    NULL
+  };
+  clasp_arguments_t const*  args;
+  int                       r;
+
+  write_file_(File1, "a.txt\nb.txt\n", 12);
+  write_file_(File2, "c.txt\n", 6);
+
+  r = parse_(0, argv, NULL, &args);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    r = clasp_appendValuesFromStream(&args, "--files-from", 0, 2);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r) &&
+        XTESTS_TEST_INTEGER_EQUAL(4u, args->numValues))
+    {
+      XTESTS_TEST_BOOLEAN_TRUE(value_equal_(&args->values[0], "y.txt"));
+      XTESTS_TEST_BOOLEAN_TRUE(value_equal_(&args->values[1], "c.txt"));
+      XTESTS_TEST_BOOLEAN_TRUE(value_equal_(&args->values[2], "a.txt"));
+      XTESTS_TEST_BOOLEAN_TRUE(value_equal_(&args->values[3], "b.txt"));
+      XTESTS_TEST_INTEGER_EQUAL(2, args->values[3].source);
+      XTESTS_TEST_INTEGER_EQUAL(2, args->values[3].cmdLineIndex);
+    }
+
+    clasp_releaseArguments(args);
+  }
+}
+
+static void test_1_4(void)
+{
+  /* failures leave the results unchanged */
+  char const* const         argv[] = { "arg0", "--files-from=test.unit.parseapi.valuesfromstream.none.tmp", "x.txt", NULL };
+  clasp_arguments_t const*  args;
+  int                       r;
+
+  r = parse_(0, argv, NULL, &args);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    clasp_arguments_t const* const original = args;
+
+    XTESTS_TEST_INTEGER_EQUAL(ENOENT, clasp_appendValuesFromStream(&args, "--files-from", 0, 1));
+    XTESTS_TEST_POINTER_EQUAL(original, args);
+    XTESTS_TEST_INTEGER_EQUAL(1u, args->numValues);
+
+    XTESTS_TEST_INTEGER_EQUAL(EINVAL, clasp_appendValuesFromStream(&args, "--files-from", 0, 0));
+    XTESTS_TEST_POINTER_EQUAL(original, args);
+
+    /* an option not given has no values */
+    XTESTS_TEST_INTEGER_EQUAL(0, clasp_appendValuesFromStream(&args, "--paths-from", 0, 1));
+    XTESTS_TEST_POINTER_EQUAL(original, args);
+
+    clasp_releaseArguments(args);
+  }
+}
+
+static void test_1_5(void)
+{
+  /* values are delivered to the callback, which may stop them */
+  enum { NUM_VALUES = 20000 };
+
+  FILE* const stm = fopen(File1, "wb");
+
+  if (XTESTS_TEST_POINTER_NOT_EQUAL(NULL, stm))
+  {
+    char const* const         argv[] = { "arg0", "--files-from=test.unit.parseapi.valuesfromstream.1.tmp", NULL };
+    clasp_arguments_t const*  args;
+    int                       r;
+    unsigned                  i;
+
+    for (i = 0; i != NUM_VALUES; ++i)
+    {
+      fprintf(stm, "file-%05u.txt\n", i);
+    }
+    fclose(stm);
+
+    r = parse_(0, argv, NULL, &args);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+    {
+      collector_t collector;
+
+      memset(&collector, 0, sizeof(collector));
+
+      r = clasp_forEachStreamedValue(args, "--files-from", 0, collect_, &collector);
+
+      XTESTS_TEST_INTEGER_EQUAL(0, r);
+      XTESTS_TEST_INTEGER_EQUAL((size_t)NUM_VALUES, collector.numValues);
+      XTESTS_TEST_INTEGER_EQUAL(14u * NUM_VALUES, collector.totalLength);
+      XTESTS_TEST_MULTIBYTE_STRING_EQUAL("file-00000.txt", collector.first);
+
+      /* the values are not appended */
+      XTESTS_TEST_INTEGER_EQUAL(0u, args->numValues);
+
+      memset(&collector, 0, sizeof(collector));
+      collector.maxValues = 3;
+
+      r = clasp_forEachStreamedValue(args, "--files-from", 0, collect_, &collector);
+
+      XTESTS_TEST_INTEGER_EQUAL(99, r);
+      XTESTS_TEST_INTEGER_EQUAL(3u, collector.numValues);
+
+      clasp_releaseArguments(args);
+    }
+  }
+}
+
+static void test_1_6(void)
+{
+  /* with the original argument order, the values follow all arguments */
+  char const* const         argv[] = { "arg0", "x.txt", "--files-from=test.unit.parseapi.valuesfromstream.1.tmp", "-v", NULL };
+  clasp_arguments_t const*  args;
+  int                       r;
+
+  write_file_(File1, "a.txt\n", 6);
+
+  r = parse_(CLASP_F_PRESERVE_ORIGINAL_ARGUMENT_ORDER, argv, NULL, &args);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    r = clasp_appendValuesFromStream(&args, "--files-from", 0, 1);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r) &&
+        XTESTS_TEST_INTEGER_EQUAL(4u, args->numArguments))
+    {
+      XTESTS_TEST_BOOLEAN_TRUE(value_equal_(&args->arguments[0], "x.txt"));
+      XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGTYPE_OPTION, args->arguments[1].type);
+      XTESTS_TEST_INTEGER_EQUAL(CLASP_ARGTYPE_FLAG, args->arguments[2].type);
+      XTESTS_TEST_BOOLEAN_TRUE(value_equal_(&args->arguments[3], "a.txt"));
+    }
+
+    clasp_releaseArguments(args);
+  }
+}
+
+static void test_1_7(void)
+{
+  /* streamed values survive further appending, but not serialization */
+  char const* const         argv[] = { "arg0", "--files-from=test.unit.parseapi.valuesfromstream.1.tmp", NULL };
+  char*                     more[] = { "z.txt", NULL };
+  clasp_arguments_t const*  args;
+  int                       r;
+
+  write_file_(File1, "a.txt\nb.txt\n", 12);
+
+  r = parse_(0, argv, NULL, &args);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    size_t cbRequired;
+
+    r = clasp_appendValuesFromStream(&args, "--files-from", 0, 1);
+
+    XTESTS_TEST_INTEGER_EQUAL(0, r);
+
+    r = clasp_appendArguments(&args, 2, 1, more);
+
+    if (XTESTS_TEST_INTEGER_EQUAL(0, r) &&
+        XTESTS_TEST_INTEGER_EQUAL(3u, args->numValues))
+    {
+      XTESTS_TEST_BOOLEAN_TRUE(value_equal_(&args->values[0], "a.txt"));
+      XTESTS_TEST_BOOLEAN_TRUE(value_equal_(&args->values[1], "b.txt"));
+      XTESTS_TEST_BOOLEAN_TRUE(value_equal_(&args->values[2], "z.txt"));
+      XTESTS_TEST_INTEGER_EQUAL(2, args->values[2].source);
+    }
+
+    {
+      /* aligned on a 16-byte boundary */
+      double buffer[256];
+
+      XTESTS_TEST_INTEGER_EQUAL(EINVAL, clasp_serializeArguments(args, buffer, sizeof(buffer), &cbRequired));
+    }
+
+    clasp_releaseArguments(args);
+  }
+}
+
+static void test_1_8(void)
+{
+  /* the chunks are held with, and released with, the results */
+  clasp_diagnostic_context_t  ctxt;
+  char const* const           argv[] = { "arg0", "--files-from=test.unit.parseapi.valuesfromstream.1.tmp", NULL };
+  clasp_arguments_t const*    args;
+  int                         r;
+
+  write_file_(File1, "a.txt\nb.txt\n", 12);
+
+  clasp_init_diagnostic_context(&ctxt, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+  ctxt.pfnTrace = trace_;
+
+  s_numChunksAllocated  = 0;
+  s_numChunksFreed      = 0;
+
+  r = parse_(0, argv, &ctxt, &args);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    r = clasp_appendValuesFromStream(&args, "--files-from", 0, 1);
+
+    XTESTS_TEST_INTEGER_EQUAL(0, r);
+    XTESTS_TEST_INTEGER_EQUAL(2u, args->numValues);
+
+    /* one chunk, and the (temporary) path */
+    XTESTS_TEST_INTEGER_EQUAL(2u, s_numChunksAllocated);
+    XTESTS_TEST_INTEGER_EQUAL(1u, s_numChunksFreed);
+
+    clasp_releaseArguments(args);
+
+    XTESTS_TEST_INTEGER_EQUAL(2u, s_numChunksFreed);
+  }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
@@ -0,0 +1,505 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.static_specifications/entry.cpp
+ *
+ * Purpose: Unit-tests for clasp::static_specifications
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#if __cplusplus >= 201703L || \
+    (   defined(_MSVC_LANG) && \
+        _MSVC_LANG >= 201703L)
+# define CLASP_TEST_STATIC_SPECIFICATIONS_SUPPORTED
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#ifdef CLASP_TEST_STATIC_SPECIFICATIONS_SUPPORTED
+# include <clasp/static_specifications.hpp>
+#endif /* CLASP_TEST_STATIC_SPECIFICATIONS_SUPPORTED */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+#include <stlsoft/error/error_desc.hpp>
+#include <stlsoft/smartptr/scoped_handle.hpp>
+
+/* Standard C header files */
+#include <stdlib.h>
+#include <string.h>
+
+
+#ifdef CLASP_TEST_STATIC_SPECIFICATIONS_SUPPORTED
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_1_0();
+    static void test_1_1();
+    static void test_1_2();
+    static void test_1_3();
+    static void test_1_4();
+    static void test_1_5();
+    static void test_1_6();
+    static void test_1_7();
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * globals
+ */
+
+clasp_diagnostic_context_t const*   s_ctxt;
+
+#endif /* CLASP_TEST_STATIC_SPECIFICATIONS_SUPPORTED */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+#ifdef CLASP_TEST_STATIC_SPECIFICATIONS_SUPPORTED
+
+    struct stub
+    {
+        static void CLASP_CALLCONV function(
+            void*                /* context */
+        ,   int                  /* severity */
+        ,   clasp_char_t const*  /* fmt */
+        ,   va_list              /* args */
+        )
+        {}
+    };
+
+    clasp_diagnostic_context_t  ctxt;
+
+    ctxt.pfnLog = &stub::function;
+
+    s_ctxt = &ctxt;
+#endif /* CLASP_TEST_STATIC_SPECIFICATIONS_SUPPORTED */
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.static_specifications", verbosity))
+    {
+#ifdef CLASP_TEST_STATIC_SPECIFICATIONS_SUPPORTED
+
+        XTESTS_RUN_CASE(test_1_0);
+        XTESTS_RUN_CASE(test_1_1);
+        XTESTS_RUN_CASE(test_1_2);
+        XTESTS_RUN_CASE(test_1_3);
+        XTESTS_RUN_CASE(test_1_4);
+        XTESTS_RUN_CASE(test_1_5);
+        XTESTS_RUN_CASE(test_1_6);
+        XTESTS_RUN_CASE(test_1_7);
+#endif /* CLASP_TEST_STATIC_SPECIFICATIONS_SUPPORTED */
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+#ifdef CLASP_TEST_STATIC_SPECIFICATIONS_SUPPORTED
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+    using clasp::arguments_t;
+
+    static constexpr clasp::specification_t Specifications[] =
+    {
+        CLASP_FLAG("-v", "--verbose", NULL),
+        CLASP_FLAG("-q", "--quiet", NULL),
+        CLASP_OPTION("-w", "--width", NULL, NULL),
+        CLASP_FLAG("-W", "--width=80", NULL),
+
+        CLASP_GAP_SECTION("other:"),
+
+        CLASP_OPTION(NULL, "--colour", NULL, NULL),
+        CLASP_FLAG(NULL, "--verbose", NULL),
+
+        CLASP_SPECIFICATION_ARRAY_TERMINATOR
+    };
+
+    static constexpr clasp::static_specifications StaticSpecifications(Specifications);
+
+    static_assert(StaticSpecifications.index().slots == StaticSpecifications.index().slots, "index must be a constant expression");
+    static_assert(clasp::ximpl::static_specifications_hash_("--width", 7, 0) == clasp::ximpl::static_specifications_hash_("--width", 7, 0), "hash must be a constant expression");
+
+    /* A large array - of options "--opt-0000" to "--opt-0999", the first
+     * 52 of which also have the short names "-a" to "-Z" - the index of
+     * which must be computable within the compiler's constexpr limits
+     */
+    static constexpr size_t NumManySpecifications = 1000;
+
+    struct many_names_t
+    {
+        char    longNames[NumManySpecifications][11];
+        char    shortNames[52][3];
+
+        constexpr
+        many_names_t()
+            : longNames()
+            , shortNames()
+        {
+            for (size_t i = 0; NumManySpecifications != i; ++i)
+            {
+                char const  prefix[] = "--opt-";
+                size_t      n = i;
+
+                for (size_t j = 0; 6 != j; ++j)
+                {
+                    longNames[i][j] = prefix[j];
+                }
+                for (size_t j = 10; 6 != j; --j, n /= 10)
+                {
+                    longNames[i][j - 1] = static_cast<char>('0' + n % 10);
+                }
+            }
+
+            for (size_t i = 0; 52 != i; ++i)
+            {
+                shortNames[i][0] = '-';
+                shortNames[i][1] = static_cast<char>((i < 26) ? ('a' + i) : ('A' + (i - 26)));
+            }
+        }
+    };
+
+    struct many_specifications_t
+    {
+        clasp::specification_t  specifications[NumManySpecifications + 1];
+    };
+
+    static constexpr many_names_t ManyNames;
+
+    constexpr
+    many_specifications_t
+    make_many_specifications_()
+    {
+        many_specifications_t r{};
+
+        for (size_t i = 0; NumManySpecifications != i; ++i)
+        {
+            r.specifications[i] = clasp::specification_t CLASP_OPTION((i < 52) ? ManyNames.shortNames[i] : nullptr, ManyNames.longNames[i], nullptr, nullptr);
+        }
+
+        r.specifications[NumManySpecifications] = clasp::specification_t CLASP_SPECIFICATION_ARRAY_TERMINATOR;
+
+        return r;
+    }
+
+    static constexpr many_specifications_t ManySpecifications = make_many_specifications_();
+
+    static constexpr clasp::static_specifications ManyStaticSpecifications(ManySpecifications.specifications);
+
+    static_assert(ManyStaticSpecifications.index().slots == ManyStaticSpecifications.index().slots, "index must be a constant expression");
+
+    /* Parses argv by both means, and tests the results are identical */
+    void
+    test_against_linear_(
+        int         argc
+    ,   char const* argv[]
+    )
+    {
+        arguments_t const*  args1;
+        arguments_t const*  args2;
+        int                 r;
+
+        r = clasp::parseArguments(0, argc, argv, Specifications, s_ctxt, &args1);
+
+        if (0 != r)
+        {
+            XTESTS_TEST_FAIL_WITH_QUALIFIER("could not parse arguments", stlsoft::error_desc(r));
+
+            return;
+        }
+
+        stlsoft::scoped_handle<arguments_t const*> scoper1(args1, clasp::releaseArguments);
+
+        r = clasp::parseArguments(0, argc, argv, StaticSpecifications, s_ctxt, &args2);
+
+        if (0 != r)
+        {
+            XTESTS_TEST_FAIL_WITH_QUALIFIER("could not parse arguments", stlsoft::error_desc(r));
+
+            return;
+        }
+
+        stlsoft::scoped_handle<arguments_t const*> scoper2(args2, clasp::releaseArguments);
+
+        XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(args1->numArguments, args2->numArguments));
+
+        for (size_t i = 0; i != args1->numArguments; ++i)
+        {
+            clasp::argument_t const& arg1 = args1->arguments[i];
+            clasp::argument_t const& arg2 = args2->arguments[i];
+
+            XTESTS_TEST_INTEGER_EQUAL(arg1.type, arg2.type);
+            XTESTS_TEST_INTEGER_EQUAL(arg1.aliasIndex, arg2.aliasIndex);
+            XTESTS_TEST_MULTIBYTE_STRING_EQUAL(arg1.resolvedName, arg2.resolvedName);
+            XTESTS_TEST_MULTIBYTE_STRING_EQUAL(arg1.value, arg2.value);
+        }
+    }
+
+static void test_1_0()
+{
+    char const* argv[] =
+    {
+        "arg0",
+        "-v",
+        "--quiet",
+        "-w",
+        "10",
+        "--colour=red",
+        "abc",
+        NULL,
+    };
+
+    test_against_linear_(STLSOFT_NUM_ELEMENTS(argv) - 1, argv);
+}
+
+static void test_1_1()
+{
+    char const* argv[] =
+    {
+        "arg0",
+        "-W",
+        "--width=20",
+        "--verbose",
+        NULL,
+    };
+
+    test_against_linear_(STLSOFT_NUM_ELEMENTS(argv) - 1, argv);
+}
+
+static void test_1_2()
+{
+    char const* argv[] =
+    {
+        "arg0",
+        "-vq",
+        "--unknown",
+        "-x",
+        "--colour",
+        "blue",
+        NULL,
+    };
+
+    test_against_linear_(STLSOFT_NUM_ELEMENTS(argv) - 1, argv);
+
+    arguments_t const*  args;
+    int const           r = clasp::parseArguments(0, STLSOFT_NUM_ELEMENTS(argv) - 1, argv, StaticSpecifications, s_ctxt, &args);
+
+    if (0 != r)
+    {
+        XTESTS_TEST_FAIL_WITH_QUALIFIER("could not parse arguments", stlsoft::error_desc(r));
+    }
+    else
+    {
+        stlsoft::scoped_handle<arguments_t const*> scoper(args, clasp::releaseArguments);
+
+        XTESTS_TEST_INTEGER_EQUAL(2u, clasp_reportUnrecognisedFlagsAndOptions(args, Specifications, NULL, 0));
+    }
+}
+
+static void test_1_3()
+{
+    XTESTS_TEST_INTEGER_EQUAL(clasp_hashSpecificationKey("--width", 7, 0), clasp::ximpl::static_specifications_hash_("--width", 7, 0));
+    XTESTS_TEST_INTEGER_EQUAL(clasp_hashSpecificationKey("-v", 2, 1), clasp::ximpl::static_specifications_hash_("-v", 2, 1));
+    XTESTS_TEST_INTEGER_EQUAL(clasp_hashSpecificationKey("", 0, 3), clasp::ximpl::static_specifications_hash_("", 0, 3));
+}
+
+static void test_1_4()
+{
+    clasp::specification_index_t const index = StaticSpecifications.index();
+
+    XTESTS_TEST_POINTER_EQUAL(Specifications, index.specifications);
+    XTESTS_TEST_INTEGER_EQUAL(0u, index.numBuckets & (index.numBuckets - 1));
+    XTESTS_TEST_INTEGER_EQUAL(0u, index.numSlots & (index.numSlots - 1));
+
+    /* keys: -v, -q, -w, -W, --verbose, --quiet, --colour, --width */
+    size_t numOccupied = 0;
+
+    for (size_t i = 0; i != index.numSlots; ++i)
+    {
+        if (index.slots[i] >= 0)
+        {
+            ++numOccupied;
+
+            XTESTS_TEST_INTEGER_LESS(static_cast<int>(STLSOFT_NUM_ELEMENTS(Specifications) - 1), index.slots[i]);
+        }
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(8u, numOccupied);
+}
+
+static void test_1_5()
+{
+    clasp::specification_index_t const index = StaticSpecifications.index();
+
+    XTESTS_REQUIRE(XTESTS_TEST_POINTER_NOT_EQUAL(NULL, index.shortFlags));
+
+    XTESTS_TEST_INTEGER_EQUAL(0, index.shortFlags['v']);
+    XTESTS_TEST_INTEGER_EQUAL(1, index.shortFlags['q']);
+    XTESTS_TEST_INTEGER_EQUAL(2, index.shortFlags['w']);
+    XTESTS_TEST_INTEGER_EQUAL(3, index.shortFlags['W']);
+    XTESTS_TEST_INTEGER_EQUAL(-1, index.shortFlags['x']);
+    XTESTS_TEST_INTEGER_EQUAL(0u, index.numWideShortFlags);
+
+    char const* argv[] =
+    {
+        "arg0",
+        "-vqWx",
+        NULL,
+    };
+
+    test_against_linear_(STLSOFT_NUM_ELEMENTS(argv) - 1, argv);
+}
+
+static void test_1_6()
+{
+    clasp::specification_index_t const  index = StaticSpecifications.index();
+    clasp::specification_index_t const* index2;
+    int                                 r;
+
+    r = clasp_createSpecificationIndex(NULL, Specifications, &index2);
+
+    if (0 != r)
+    {
+        XTESTS_TEST_FAIL_WITH_QUALIFIER("could not create index", stlsoft::error_desc(r));
+    }
+    else
+    {
+        stlsoft::scoped_handle<clasp::specification_index_t const*> scoper(index2, clasp_destroySpecificationIndex);
+
+        /* the baked prefix trie is identical to the runtime one */
+        if (XTESTS_TEST_INTEGER_EQUAL(index2->numTrieNodes, index.numTrieNodes))
+        {
+            XTESTS_TEST_INTEGER_EQUAL(0, ::memcmp(index2->trieNodes, index.trieNodes, sizeof(index.trieNodes[0]) * index.numTrieNodes));
+        }
+    }
+
+    arguments_t const*  args;
+    char const*         argv[] =
+    {
+        "arg0",
+        "--verb",
+        "--col=red",
+        NULL,
+    };
+
+    r = clasp::parseArguments(CLASP_F_ALLOW_UNIQUE_PREFIXES, STLSOFT_NUM_ELEMENTS(argv) - 1, argv, StaticSpecifications, s_ctxt, &args);
+
+    if (0 != r)
+    {
+        XTESTS_TEST_FAIL_WITH_QUALIFIER("could not parse arguments", stlsoft::error_desc(r));
+    }
+    else
+    {
+        stlsoft::scoped_handle<arguments_t const*> scoper(args, clasp::releaseArguments);
+
+        XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(1u, args->numFlags));
+        XTESTS_TEST_INTEGER_EQUAL(0, args->flags[0].aliasIndex);
+        XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(1u, args->numOptions));
+        XTESTS_TEST_INTEGER_EQUAL(5, args->options[0].aliasIndex);
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("red", args->options[0].value);
+    }
+}
+
+static void test_1_7()
+{
+    clasp::specification_index_t const  index = ManyStaticSpecifications.index();
+    clasp::specification_index_t const* index2;
+    int                                 r;
+
+    r = clasp_createSpecificationIndex(NULL, ManySpecifications.specifications, &index2);
+
+    if (0 != r)
+    {
+        XTESTS_TEST_FAIL_WITH_QUALIFIER("could not create index", stlsoft::error_desc(r));
+    }
+    else
+    {
+        stlsoft::scoped_handle<clasp::specification_index_t const*> scoper(index2, clasp_destroySpecificationIndex);
+
+        /* the baked index is identical to the runtime one */
+        XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(index2->numBuckets, index.numBuckets));
+        XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(index2->numSlots, index.numSlots));
+        XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(index2->numTrieNodes, index.numTrieNodes));
+        XTESTS_TEST_INTEGER_EQUAL(0, ::memcmp(index2->seeds, index.seeds, sizeof(index.seeds[0]) * index.numBuckets));
+        XTESTS_TEST_INTEGER_EQUAL(0, ::memcmp(index2->slots, index.slots, sizeof(index.slots[0]) * index.numSlots));
+        XTESTS_TEST_INTEGER_EQUAL(0, ::memcmp(index2->shortFlags, index.shortFlags, sizeof(index.shortFlags[0]) * CLASP_SHORT_FLAG_TABLE_SIZE));
+        XTESTS_TEST_INTEGER_EQUAL(0, ::memcmp(index2->trieNodes, index.trieNodes, sizeof(index.trieNodes[0]) * index.numTrieNodes));
+    }
+
+    arguments_t const*  args;
+    char const*         argv[] =
+    {
+        "arg0",
+        "-Z",
+        "x",
+        "--opt-0999=y",
+        "-a",
+        "z",
+        NULL,
+    };
+
+    r = clasp::parseArguments(0, STLSOFT_NUM_ELEMENTS(argv) - 1, argv, ManyStaticSpecifications, s_ctxt, &args);
+
+    if (0 != r)
+    {
+        XTESTS_TEST_FAIL_WITH_QUALIFIER("could not parse arguments", stlsoft::error_desc(r));
+    }
+    else
+    {
+        stlsoft::scoped_handle<arguments_t const*> scoper(args, clasp::releaseArguments);
+
+        XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(3u, args->numOptions));
+        XTESTS_TEST_INTEGER_EQUAL(51, args->options[0].aliasIndex);
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--opt-0051", args->options[0].resolvedName);
+        XTESTS_TEST_INTEGER_EQUAL(999, args->options[1].aliasIndex);
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("y", args->options[1].value);
+        XTESTS_TEST_INTEGER_EQUAL(0, args->options[2].aliasIndex);
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("z", args->options[2].value);
+    }
+}
+} // anonymous namespace
+
+#endif /* CLASP_TEST_STATIC_SPECIFICATIONS_SUPPORTED */
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
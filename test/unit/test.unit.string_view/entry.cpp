@@ -0,0 +1,427 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.string_view/entry.cpp
+ *
+ * Purpose: Unit-tests for clasp/string_view.hpp
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#if __cplusplus >= 201703L || \
+    (   defined(_MSVC_LANG) && \
+        _MSVC_LANG >= 201703L)
+# define CLASP_TEST_STRING_VIEW_SUPPORTED
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#ifdef CLASP_TEST_STRING_VIEW_SUPPORTED
+# include <clasp/string_view.hpp>
+#endif /* CLASP_TEST_STRING_VIEW_SUPPORTED */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+#include <stlsoft/error/error_desc.hpp>
+#include <stlsoft/smartptr/scoped_handle.hpp>
+
+/* Standard C++ header files */
+#include <new>
+
+/* Standard C header files */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#ifdef CLASP_TEST_STRING_VIEW_SUPPORTED
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_1_0();
+    static void test_1_1();
+    static void test_1_2();
+    static void test_1_3();
+    static void test_1_4();
+    static void test_1_5();
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * globals
+ */
+
+clasp_diagnostic_context_t const*   s_ctxt;
+size_t                              s_numAllocations;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * allocation counting
+ */
+
+void* operator new(size_t cb)
+{
+    ++s_numAllocations;
+
+    void* const pv = ::malloc(0 == cb ? 1 : cb);
+
+    if (NULL == pv)
+    {
+        throw std::bad_alloc();
+    }
+
+    return pv;
+}
+
+void operator delete(void* pv) noexcept
+{
+    ::free(pv);
+}
+
+void operator delete(void* pv, size_t) noexcept
+{
+    ::free(pv);
+}
+
+#endif /* CLASP_TEST_STRING_VIEW_SUPPORTED */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+#ifdef CLASP_TEST_STRING_VIEW_SUPPORTED
+
+    struct stub
+    {
+        static void CLASP_CALLCONV function(
+            void*                /* context */
+        ,   int                  /* severity */
+        ,   clasp_char_t const*  /* fmt */
+        ,   va_list              /* args */
+        )
+        {}
+    };
+
+    clasp_diagnostic_context_t  ctxt;
+
+    ctxt.pfnLog = &stub::function;
+
+    s_ctxt = &ctxt;
+#endif /* CLASP_TEST_STRING_VIEW_SUPPORTED */
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.string_view", verbosity))
+    {
+#ifdef CLASP_TEST_STRING_VIEW_SUPPORTED
+
+        XTESTS_RUN_CASE(test_1_0);
+        XTESTS_RUN_CASE(test_1_1);
+        XTESTS_RUN_CASE(test_1_2);
+        XTESTS_RUN_CASE(test_1_3);
+        XTESTS_RUN_CASE(test_1_4);
+        XTESTS_RUN_CASE(test_1_5);
+#endif /* CLASP_TEST_STRING_VIEW_SUPPORTED */
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+#ifdef CLASP_TEST_STRING_VIEW_SUPPORTED
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+    using clasp::arguments_t;
+    using clasp::string_view_t;
+
+    static clasp::specification_t const Specifications[] =
+    {
+        CLASP_FLAG("-v", "--verbose", NULL),
+        CLASP_OPTION("-w", "--width", NULL, NULL),
+
+        CLASP_SPECIFICATION_ARRAY_TERMINATOR
+    };
+
+static void test_1_0()
+{
+    char const* argv[] =
+    {
+        "path/to/program",
+        "-v",
+        "--width=10",
+        "abc",
+        "def",
+        NULL,
+    };
+    arguments_t const*  args;
+    int const           r = clasp::parseArguments(0, STLSOFT_NUM_ELEMENTS(argv) - 1, argv, Specifications, s_ctxt, &args);
+
+    if (0 != r)
+    {
+        XTESTS_TEST_FAIL_WITH_QUALIFIER("could not parse arguments", stlsoft::error_desc(r));
+    }
+    else
+    {
+        stlsoft::scoped_handle<arguments_t const*> scoper(args, clasp::releaseArguments);
+
+        XTESTS_TEST_BOOLEAN_TRUE(string_view_t("program") == clasp::program_name(args));
+
+        XTESTS_TEST_INTEGER_EQUAL(4u, clasp::arguments(args).size());
+        XTESTS_TEST_INTEGER_EQUAL(2u, clasp::flags_and_options(args).size());
+        XTESTS_TEST_INTEGER_EQUAL(1u, clasp::flags(args).size());
+        XTESTS_TEST_INTEGER_EQUAL(1u, clasp::options(args).size());
+        XTESTS_TEST_INTEGER_EQUAL(2u, clasp::values(args).size());
+
+        XTESTS_TEST_BOOLEAN_TRUE(string_view_t("-v") == clasp::given_name(clasp::flags(args).front()));
+        XTESTS_TEST_BOOLEAN_TRUE(string_view_t("--verbose") == clasp::resolved_name(clasp::flags(args).front()));
+        XTESTS_TEST_BOOLEAN_TRUE(string_view_t("10") == clasp::value(clasp::options(args)[0]));
+
+        size_t n = 0;
+
+        for (clasp::argument_t const& arg : clasp::values(args))
+        {
+            XTESTS_TEST_BOOLEAN_TRUE((0 == n ? string_view_t("abc") : string_view_t("def")) == clasp::value(arg));
+
+            ++n;
+        }
+
+        XTESTS_TEST_INTEGER_EQUAL(2u, n);
+        XTESTS_TEST_BOOLEAN_TRUE(clasp::values(args).back().value.ptr == clasp::value(clasp::values(args)[1]).data());
+    }
+}
+
+static void test_1_1()
+{
+    char const* argv[] =
+    {
+        "arg0",
+        "-v",
+        "--width=10",
+        NULL,
+    };
+    arguments_t const*  args;
+    int const           r = clasp::parseArguments(0, STLSOFT_NUM_ELEMENTS(argv) - 1, argv, Specifications, s_ctxt, &args);
+
+    if (0 != r)
+    {
+        XTESTS_TEST_FAIL_WITH_QUALIFIER("could not parse arguments", stlsoft::error_desc(r));
+    }
+    else
+    {
+        stlsoft::scoped_handle<arguments_t const*> scoper(args, clasp::releaseArguments);
+
+        XTESTS_TEST_BOOLEAN_TRUE(clasp::check_flag(args, "--verbose"));
+        XTESTS_TEST_BOOLEAN_FALSE(clasp::check_flag(args, "--quiet"));
+
+        std::optional<string_view_t> const width = clasp::check_option(args, "--width");
+
+        XTESTS_REQUIRE(XTESTS_TEST_BOOLEAN_TRUE(width.has_value()));
+        XTESTS_TEST_BOOLEAN_TRUE(string_view_t("10") == *width);
+
+        XTESTS_TEST_BOOLEAN_FALSE(clasp::check_option(args, "--height").has_value());
+        XTESTS_TEST_BOOLEAN_FALSE(clasp::check_option(args, "--widt").has_value());
+
+        XTESTS_TEST_INTEGER_EQUAL(0, clasp_reportUnusedFlagsAndOptions(args, NULL, 0));
+    }
+}
+
+static void test_1_2()
+{
+    char const* argv[] =
+    {
+        "arg0",
+        "--int=-123",
+        "--ul=4000000000",
+        "--dbl=1.5",
+        "--bool=yes",
+        "--str=abc",
+        NULL,
+    };
+    arguments_t const*  args;
+    int const           r = clasp::parseArguments(0, STLSOFT_NUM_ELEMENTS(argv) - 1, argv, NULL, s_ctxt, &args);
+
+    if (0 != r)
+    {
+        XTESTS_TEST_FAIL_WITH_QUALIFIER("could not parse arguments", stlsoft::error_desc(r));
+    }
+    else
+    {
+        stlsoft::scoped_handle<arguments_t const*> scoper(args, clasp::releaseArguments);
+
+        XTESTS_TEST_INTEGER_EQUAL(-123, clasp::check_option<int>(args, "--int").value());
+        XTESTS_TEST_INTEGER_EQUAL(4000000000ul, clasp::check_option<unsigned long>(args, "--ul").value());
+        XTESTS_TEST_FLOATINGPOINT_EQUAL(1.5, clasp::check_option<double>(args, "--dbl").value());
+        XTESTS_TEST_BOOLEAN_TRUE(clasp::check_option<bool>(args, "--bool").value());
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", clasp::check_option<char const*>(args, "--str").value());
+
+        XTESTS_TEST_BOOLEAN_FALSE(clasp::check_option<int>(args, "--missing").has_value());
+    }
+}
+
+static void test_1_3()
+{
+    char const* argv[] =
+    {
+        "arg0",
+        "--int=12x",
+        "--short=40000",
+        NULL,
+    };
+    arguments_t const*  args;
+    int const           r = clasp::parseArguments(0, STLSOFT_NUM_ELEMENTS(argv) - 1, argv, NULL, s_ctxt, &args);
+
+    if (0 != r)
+    {
+        XTESTS_TEST_FAIL_WITH_QUALIFIER("could not parse arguments", stlsoft::error_desc(r));
+    }
+    else
+    {
+        stlsoft::scoped_handle<arguments_t const*> scoper(args, clasp::releaseArguments);
+
+        try
+        {
+            clasp::check_option<int>(args, "--int");
+
+            XTESTS_TEST_FAIL("should not get here");
+        }
+        catch (clasp::invalid_option_value_exception& x)
+        {
+            XTESTS_TEST_MULTIBYTE_STRING_EQUAL("value is not an integer for option: --int", x.what());
+            XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--int", x.optionName);
+        }
+
+        try
+        {
+            clasp::check_option<short>(args, "--short");
+
+            XTESTS_TEST_FAIL("should not get here");
+        }
+        catch (clasp::invalid_option_value_exception& x)
+        {
+            XTESTS_TEST_MULTIBYTE_STRING_EQUAL("value is out of range for option: --short", x.what());
+        }
+    }
+}
+
+static void test_1_4()
+{
+    char const* argv[] =
+    {
+        "arg0",
+        "--name=first",
+        "--name=second",
+        NULL,
+    };
+    arguments_t const*  args;
+    int const           r = clasp::parseArguments(0, STLSOFT_NUM_ELEMENTS(argv) - 1, argv, NULL, s_ctxt, &args);
+
+    if (0 != r)
+    {
+        XTESTS_TEST_FAIL_WITH_QUALIFIER("could not parse arguments", stlsoft::error_desc(r));
+    }
+    else
+    {
+        stlsoft::scoped_handle<arguments_t const*> scoper(args, clasp::releaseArguments);
+
+        XTESTS_TEST_BOOLEAN_TRUE(string_view_t("first") == clasp::check_next_option(args, "--name").value());
+        XTESTS_TEST_BOOLEAN_TRUE(string_view_t("second") == clasp::check_next_option(args, "--name").value());
+        XTESTS_TEST_BOOLEAN_FALSE(clasp::check_next_option(args, "--name").has_value());
+        XTESTS_TEST_BOOLEAN_TRUE(string_view_t("first") == clasp::check_option(args, "--name").value());
+    }
+}
+
+static void test_1_5()
+{
+    // Extracting 50 string (and 50 integer) options allocates no memory
+
+    enum { NUM_OPTIONS = 50 };
+
+    char                names[NUM_OPTIONS][20];
+    char                options[NUM_OPTIONS][30];
+    char const*         argv[2 + NUM_OPTIONS];
+
+    argv[0] = "arg0";
+    { for (int i = 0; i != NUM_OPTIONS; ++i)
+    {
+        ::snprintf(names[i], sizeof(names[i]), "--option-%d", i);
+        ::snprintf(options[i], sizeof(options[i]), "%s=%d", names[i], i);
+
+        argv[1 + i] = options[i];
+    }}
+    argv[1 + NUM_OPTIONS] = NULL;
+
+    arguments_t const*  args;
+    int const           r = clasp::parseArguments(0, 1 + NUM_OPTIONS, argv, NULL, s_ctxt, &args);
+
+    if (0 != r)
+    {
+        XTESTS_TEST_FAIL_WITH_QUALIFIER("could not parse arguments", stlsoft::error_desc(r));
+    }
+    else
+    {
+        stlsoft::scoped_handle<arguments_t const*> scoper(args, clasp::releaseArguments);
+
+        string_view_t   views[NUM_OPTIONS];
+        int             ints[NUM_OPTIONS];
+        size_t const    numAllocationsBefore = s_numAllocations;
+
+        { for (int i = 0; i != NUM_OPTIONS; ++i)
+        {
+            views[i]    =   clasp::check_option(args, names[i]).value_or(string_view_t());
+            ints[i]     =   clasp::check_option<int>(args, names[i]).value_or(-1);
+        }}
+
+        size_t const    numAllocationsAfter = s_numAllocations;
+
+        XTESTS_TEST_INTEGER_EQUAL(numAllocationsBefore, numAllocationsAfter);
+
+        { for (int i = 0; i != NUM_OPTIONS; ++i)
+        {
+            XTESTS_TEST_INTEGER_EQUAL(i, ints[i]);
+            XTESTS_TEST_BOOLEAN_TRUE(string_view_t(::strchr(options[i], '=') + 1) == views[i]);
+        }}
+    }
+}
+} // anonymous namespace
+
+#endif /* CLASP_TEST_STRING_VIEW_SUPPORTED */
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
@@ -0,0 +1,467 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.suggestions/entry.c
+ *
+ * Purpose: Unit-test(s) for clasp_findSuggestions()
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <clasp/clasp.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C header files */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#if defined(_MSC_VER) && \
+    _MSC_VER >= 1400
+# pragma warning(push)
+# pragma warning(disable : 4996)
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+static void test_1_0(void);
+static void test_1_1(void);
+static void test_1_2(void);
+static void test_1_3(void);
+static void test_1_4(void);
+static void test_1_5(void);
+static void test_1_6(void);
+static void test_1_7(void);
+static void test_1_8(void);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * globals
+ */
+
+static clasp_specification_t const Specifications[] =
+{
+    CLASP_FLAG("-v", "--verbose", "makes output verbose"),
+    CLASP_FLAG(NULL, "--version", "shows version and terminates"),
+    CLASP_OPTION("-w", "--width", "the width", NULL),
+    CLASP_FLAG("-j", "--format=json", "formats output as JSON"),
+    CLASP_OPTION("-f", "--format", "the output format", "|json|text|"),
+    CLASP_OPTION("-k", "--keys", "the keys", NULL),
+
+    CLASP_SPECIFICATION_ARRAY_TERMINATOR
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main
+ */
+
+int main(int argc, char **argv)
+{
+  int retCode = EXIT_SUCCESS;
+  int verbosity = 2;
+
+  XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+  if (XTESTS_START_RUNNER("test.unit.suggestions", verbosity))
+  {
+    XTESTS_RUN_CASE(test_1_0);
+    XTESTS_RUN_CASE(test_1_1);
+    XTESTS_RUN_CASE(test_1_2);
+    XTESTS_RUN_CASE(test_1_3);
+    XTESTS_RUN_CASE(test_1_4);
+    XTESTS_RUN_CASE(test_1_5);
+    XTESTS_RUN_CASE(test_1_6);
+    XTESTS_RUN_CASE(test_1_7);
+    XTESTS_RUN_CASE(test_1_8);
+
+    XTESTS_PRINT_RESULTS();
+
+    XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+  }
+
+  return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+static size_t find_(
+  clasp_specification_t const specifications[]
+, char const*                 name
+, size_t                      maxDistance
+, clasp_suggestion_t*         suggestions
+, size_t                      maxSuggestions
+)
+{
+  return clasp_findSuggestions(NULL, specifications, name, strlen(name), maxDistance, suggestions, maxSuggestions);
+}
+
+/* The reference (classic DP) edit distance */
+static size_t distance_(
+  char const* s1
+, char const* s2
+)
+{
+  size_t const  n1 = strlen(s1);
+  size_t const  n2 = strlen(s2);
+  size_t        row[64];
+  size_t        i;
+  size_t        j;
+
+  for (i = 0; i <= n1; ++i)
+  {
+    row[i] = i;
+  }
+
+  for (j = 0; j != n2; ++j)
+  {
+    size_t diag = row[0];
+
+    row[0] = j + 1;
+
+    for (i = 0; i != n1; ++i)
+    {
+      size_t const  up  = row[i + 1];
+      size_t        d   = diag + (s1[i] != s2[j]);
+
+      if (d > up + 1)
+      {
+        d = up + 1;
+      }
+      if (d > row[i] + 1)
+      {
+        d = row[i] + 1;
+      }
+
+      diag        = up;
+      row[i + 1]  = d;
+    }
+  }
+
+  return row[n1];
+}
+
+/* Counts the working rows allocated and freed */
+static size_t s_numRowsAllocated;
+static size_t s_numRowsFreed;
+
+static void CLASP_CALLCONV trace_(
+  void*               context
+, clasp_alloc_op_t    op
+, clasp_alloc_site_t  site
+, void*               pvOld
+, void*               pvNew
+, size_t              cb
+)
+{
+  ((void)context);
+  ((void)pvOld);
+  ((void)pvNew);
+  ((void)cb);
+
+  if (CLASP_ALLOC_SITE_SUGGESTIONS == site)
+  {
+    if (CLASP_ALLOC_OP_MALLOC == op)
+    {
+      ++s_numRowsAllocated;
+    }
+    else if (CLASP_ALLOC_OP_FREE == op)
+    {
+      ++s_numRowsFreed;
+    }
+  }
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+static void test_1_0(void)
+{
+  /* a transposition is two edits, within a third of "verbsoe" */
+  clasp_suggestion_t  suggestions[4];
+  size_t const        n = find_(Specifications, "--verbsoe", 0, suggestions, STLSOFT_NUM_ELEMENTS(suggestions));
+
+  if (XTESTS_TEST_INTEGER_EQUAL(1u, n))
+  {
+    XTESTS_TEST_POINTER_EQUAL(&Specifications[0], suggestions[0].specification);
+    XTESTS_TEST_INTEGER_EQUAL(9u, suggestions[0].name.len);
+    XTESTS_TEST_POINTER_EQUAL(Specifications[0].mappedArgument, suggestions[0].name.ptr);
+    XTESTS_TEST_INTEGER_EQUAL(2u, suggestions[0].distance);
+  }
+}
+
+static void test_1_1(void)
+{
+  /* any value is ignored */
+  clasp_suggestion_t  suggestions[4];
+  size_t const        n = find_(Specifications, "--widht=10", 0, suggestions, STLSOFT_NUM_ELEMENTS(suggestions));
+
+  if (XTESTS_TEST_INTEGER_EQUAL(1u, n))
+  {
+    XTESTS_TEST_POINTER_EQUAL(&Specifications[2], suggestions[0].specification);
+    XTESTS_TEST_INTEGER_EQUAL(7u, suggestions[0].name.len);
+    XTESTS_TEST_INTEGER_EQUAL(2u, suggestions[0].distance);
+  }
+}
+
+static void test_1_2(void)
+{
+  /* ordered by distance, and then by specification */
+  clasp_suggestion_t  suggestions[4];
+  size_t const        n = find_(Specifications, "--versio", 4, suggestions, STLSOFT_NUM_ELEMENTS(suggestions));
+
+  if (XTESTS_TEST_INTEGER_EQUAL(3u, n))
+  {
+    XTESTS_TEST_POINTER_EQUAL(&Specifications[1], suggestions[0].specification);
+    XTESTS_TEST_INTEGER_EQUAL(1u, suggestions[0].distance);
+    XTESTS_TEST_POINTER_EQUAL(&Specifications[0], suggestions[1].specification);
+    XTESTS_TEST_INTEGER_EQUAL(4u, suggestions[1].distance);
+    XTESTS_TEST_POINTER_EQUAL(&Specifications[5], suggestions[2].specification);
+    XTESTS_TEST_INTEGER_EQUAL(4u, suggestions[2].distance);
+  }
+}
+
+static void test_1_3(void)
+{
+  /* the long name of an alias with a value is that of the option */
+  clasp_suggestion_t  suggestions[4];
+  size_t const        n = find_(Specifications, "--fromat", 0, suggestions, STLSOFT_NUM_ELEMENTS(suggestions));
+
+  if (XTESTS_TEST_INTEGER_EQUAL(1u, n))
+  {
+    XTESTS_TEST_POINTER_EQUAL(&Specifications[4], suggestions[0].specification);
+    XTESTS_TEST_INTEGER_EQUAL(8u, suggestions[0].name.len);
+    XTESTS_TEST_POINTER_EQUAL(Specifications[4].mappedArgument, suggestions[0].name.ptr);
+  }
+}
+
+static void test_1_4(void)
+{
+  /* aliases are suggested */
+  clasp_suggestion_t  suggestions[8];
+  size_t              n;
+
+  /* no suggestions for a single character, by default */
+  XTESTS_TEST_INTEGER_EQUAL(0u, find_(Specifications, "-x", 0, suggestions, STLSOFT_NUM_ELEMENTS(suggestions)));
+
+  n = find_(Specifications, "-x", 1, suggestions, STLSOFT_NUM_ELEMENTS(suggestions));
+
+  if (XTESTS_TEST_INTEGER_EQUAL(5u, n))
+  {
+    XTESTS_TEST_POINTER_EQUAL(&Specifications[0], suggestions[0].specification);
+    XTESTS_TEST_POINTER_EQUAL(Specifications[0].name, suggestions[0].name.ptr);
+    XTESTS_TEST_POINTER_EQUAL(&Specifications[2], suggestions[1].specification);
+    XTESTS_TEST_POINTER_EQUAL(&Specifications[3], suggestions[2].specification);
+    XTESTS_TEST_POINTER_EQUAL(Specifications[3].name, suggestions[2].name.ptr);
+    XTESTS_TEST_POINTER_EQUAL(&Specifications[4], suggestions[3].specification);
+    XTESTS_TEST_POINTER_EQUAL(&Specifications[5], suggestions[4].specification);
+  }
+
+  /* all are counted, and only the best are held */
+  n = find_(Specifications, "-x", 1, suggestions, 2);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(5u, n))
+  {
+    XTESTS_TEST_POINTER_EQUAL(&Specifications[0], suggestions[0].specification);
+    XTESTS_TEST_POINTER_EQUAL(&Specifications[2], suggestions[1].specification);
+  }
+
+  XTESTS_TEST_INTEGER_EQUAL(5u, find_(Specifications, "-x", 1, NULL, 0));
+}
+
+static void test_1_5(void)
+{
+  /* a large, generated, specification array */
+  enum { NUM_SPECS = 5000 };
+
+  static char                   names[NUM_SPECS][20];
+  static clasp_specification_t  specifications[NUM_SPECS + 1];
+
+  clasp_suggestion_t  suggestions[4];
+  size_t              n;
+  size_t              i;
+
+  for (i = 0; i != NUM_SPECS; ++i)
+  {
+    clasp_specification_t const flag = CLASP_FLAG(NULL, NULL, NULL);
+
+    sprintf(names[i], "--option-%04u", (unsigned)i);
+
+    specifications[i]                 = flag;
+    specifications[i].mappedArgument  = names[i];
+  }
+  memset(&specifications[NUM_SPECS], 0, sizeof(specifications[NUM_SPECS]));
+
+  n = find_(specifications, "--option-4321x", 1, suggestions, STLSOFT_NUM_ELEMENTS(suggestions));
+
+  if (XTESTS_TEST_INTEGER_EQUAL(1u, n))
+  {
+    XTESTS_TEST_POINTER_EQUAL(&specifications[4321], suggestions[0].specification);
+    XTESTS_TEST_INTEGER_EQUAL(1u, suggestions[0].distance);
+  }
+
+  /* one substitution in any of the four digits */
+  n = find_(specifications, "--option-4321", 1, suggestions, STLSOFT_NUM_ELEMENTS(suggestions));
+
+  if (XTESTS_TEST_INTEGER_EQUAL(1u + 4u * 9u - 1u * 5u, n))
+  {
+    XTESTS_TEST_POINTER_EQUAL(&specifications[4321], suggestions[0].specification);
+    XTESTS_TEST_INTEGER_EQUAL(0u, suggestions[0].distance);
+    XTESTS_TEST_INTEGER_EQUAL(1u, suggestions[1].distance);
+  }
+}
+
+static void test_1_6(void)
+{
+  /* a name longer than the bit-parallel word */
+  static char const LongName[] = "--an-option-whose-name-is-much-much-longer-than-the-bits-of-a-word";
+
+  static clasp_specification_t const specifications[] =
+  {
+    CLASP_FLAG(NULL, "--an-option-whose-name-is-much-much-longer-than-the-bits-of-a-word", NULL),
+    CLASP_FLAG(NULL, "--an-option", NULL),
+
+    CLASP_SPECIFICATION_ARRAY_TERMINATOR
+  };
+
+  clasp_diagnostic_context_t  ctxt;
+  clasp_arguments_t const*    args;
+  char const* const           argv[] = { "arg0", "--an-option-whose-name-is-much-much-longer-than-the-bits-of-a-wrod", NULL };
+  int                         r;
+
+  clasp_init_diagnostic_context(&ctxt, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+  ctxt.pfnTrace = trace_;
+
+  r = clasp_parseArguments(0, 2, (char**)argv, specifications, &ctxt, &args);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    clasp_suggestion_t  suggestions[4];
+    size_t              n;
+
+    s_numRowsAllocated  = 0;
+    s_numRowsFreed      = 0;
+
+    n = clasp_findSuggestions(args, NULL, argv[1], strlen(argv[1]), 0, suggestions, STLSOFT_NUM_ELEMENTS(suggestions));
+
+    if (XTESTS_TEST_INTEGER_EQUAL(1u, n))
+    {
+      XTESTS_TEST_POINTER_EQUAL(&specifications[0], suggestions[0].specification);
+      XTESTS_TEST_INTEGER_EQUAL(strlen(LongName), suggestions[0].name.len);
+      XTESTS_TEST_INTEGER_EQUAL(2u, suggestions[0].distance);
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, s_numRowsAllocated);
+    XTESTS_TEST_INTEGER_EQUAL(1u, s_numRowsFreed);
+
+    clasp_releaseArguments(args);
+  }
+}
+
+static void test_1_7(void)
+{
+  /* the specifications of the parse are used */
+  clasp_arguments_t const*  args;
+  char const* const         argv[] = { "arg0", "-v", "--keyz=a,b", NULL };
+  int                       r;
+
+  r = clasp_parseArguments(0, 3, (char**)argv, Specifications, NULL, &args);
+
+  if (XTESTS_TEST_INTEGER_EQUAL(0, r))
+  {
+    clasp_argument_t const* arg;
+
+    if (XTESTS_TEST_INTEGER_EQUAL(1u, clasp_reportUnrecognisedFlagsAndOptions(args, NULL, &arg, 0)))
+    {
+      clasp_suggestion_t  suggestions[4];
+      size_t const        n = clasp_findSuggestions(args, NULL, arg->givenName.ptr, arg->givenName.len, 0, suggestions, STLSOFT_NUM_ELEMENTS(suggestions));
+
+      if (XTESTS_TEST_INTEGER_EQUAL(1u, n))
+      {
+        XTESTS_TEST_POINTER_EQUAL(&Specifications[5], suggestions[0].specification);
+        XTESTS_TEST_INTEGER_EQUAL(1u, suggestions[0].distance);
+      }
+    }
+
+    clasp_releaseArguments(args);
+  }
+}
+
+static void test_1_8(void)
+{
+  /* the bit-parallel distance agrees with the classic DP */
+  static char const Alphabet[] = "ab-c";
+
+  char                    word[24];
+  char                    name[24];
+  clasp_specification_t   specifications[2];
+  clasp_suggestion_t      suggestion;
+  unsigned                seed = 1;
+  int                     i;
+
+  memset(specifications, 0, sizeof(specifications));
+  specifications[0].type  = CLASP_ARGTYPE_FLAG;
+  specifications[0].name  = word;
+
+  for (i = 0; i != 2000; ++i)
+  {
+    size_t const  cchWord = 1 + i % 20;
+    size_t const  cchName = (i / 20) % 21;
+    size_t        j;
+    size_t        n;
+
+    for (j = 0; j != cchWord; ++j)
+    {
+      seed = seed * 1103515245u + 12345u;
+      word[j] = Alphabet[(seed >> 16) % 4];
+    }
+    word[cchWord] = '\0';
+
+    for (j = 0; j != cchName; ++j)
+    {
+      seed = seed * 1103515245u + 12345u;
+      name[j] = Alphabet[(seed >> 16) % 4];
+    }
+    name[cchName] = '\0';
+
+    n = clasp_findSuggestions(NULL, specifications, name, cchName, 100, &suggestion, 1);
+
+    if (!XTESTS_TEST_INTEGER_EQUAL(1u, n) ||
+        !XTESTS_TEST_INTEGER_EQUAL(distance_(name, word), suggestion.distance))
+    {
+      break;
+    }
+  }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
@@ -4,7 +4,7 @@
  * Purpose: Unit-tests usage-width functionality
  *
  * Created: 3rd April 2014
- * Updated: 11th March 2025
+ * Updated: 19th October 2026
  *
  * ////////////////////////////////////////////////////////////////////// */
 
@@ -74,6 +74,12 @@ namespace
     static void TEST_clasp_showUsage_AND_clasp_show_usage_MULTILINE_USAGE_AND_ZERO_TABS_AND_NO_BLANK_LINES();
     static void TEST_clasp_showUsage_AND_clasp_show_usage_PROGRAMNAME_INFERRED_IN_USAGE_AND_ZERO_TABS_AND_NO_BLANK_LINES();
     static void TEST_clasp_showUsage_AND_clasp_show_usage_TOOLNAME_INFERRED_FROM_PROCESS_AND_ZERO_TABS_AND_NO_BLANK_LINES();
+
+    static void TEST_clasp_showUsageToBuffer_NORMAL_AND_ZERO_TABS_AND_NO_BLANK_LINES();
+    static void TEST_clasp_showUsageToBuffer_ALIASES_AND_VALUESETS();
+    static void TEST_clasp_showUsageToBuffer_UTF8_HELP_WRAPPED_BY_DISPLAY_WIDTH();
+
+    static void TEST_clasp_showUsageCached_MEMORY_ONLY();
 } // anonymous namespace
 
 
@@ -131,6 +137,12 @@ int main(int argc, char **argv)
         XTESTS_RUN_CASE(TEST_clasp_showUsage_AND_clasp_show_usage_PROGRAMNAME_INFERRED_IN_USAGE_AND_ZERO_TABS_AND_NO_BLANK_LINES);
         XTESTS_RUN_CASE(TEST_clasp_showUsage_AND_clasp_show_usage_TOOLNAME_INFERRED_FROM_PROCESS_AND_ZERO_TABS_AND_NO_BLANK_LINES);
 
+        XTESTS_RUN_CASE(TEST_clasp_showUsageToBuffer_NORMAL_AND_ZERO_TABS_AND_NO_BLANK_LINES);
+        XTESTS_RUN_CASE(TEST_clasp_showUsageToBuffer_ALIASES_AND_VALUESETS);
+        XTESTS_RUN_CASE(TEST_clasp_showUsageToBuffer_UTF8_HELP_WRAPPED_BY_DISPLAY_WIDTH);
+
+        XTESTS_RUN_CASE(TEST_clasp_showUsageCached_MEMORY_ONLY);
+
         XTESTS_PRINT_RESULTS();
 
         XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
@@ -539,6 +551,85 @@ namespace
         }
     }
 
+    static
+    strings_t
+    get_showUsageToBuffer_lines(
+        clasp_specification_t const specifications[]
+    ,   clasp_char_t const*         toolName
+    ,   clasp_char_t const*         summary
+    ,   clasp_char_t const*         copyright
+    ,   clasp_char_t const*         description
+    ,   clasp_char_t const*         usage
+    ,   int                         major
+    ,   int                         minor
+    ,   int                         revision
+    ,   int                         flags
+    ,   int                         consoleWidth
+    ,   int                         tabSize
+    ,   int                         blanksBetweenItems
+    )
+    {
+        clasp::arguments_t const* args;
+
+        if (0 != get_args_from_empty_cmd_line_(specifications, &args))
+        {
+            throw std::runtime_error("could not parse arguments");
+        }
+
+        stlsoft::scoped_handle<clasp::arguments_t const*> scoper_0(args, clasp::releaseArguments);
+
+        clasp_char_t*   buffer;
+        size_t          cchBuffer;
+        int const       r = clasp_showUsageToBuffer(
+                                args
+                            ,   specifications
+                            ,   toolName
+                            ,   summary
+                            ,   copyright
+                            ,   description
+                            ,   usage
+                            ,   major, minor, revision
+                            ,   flags
+                            ,   consoleWidth
+                            ,   tabSize
+                            ,   blanksBetweenItems
+                            ,   &buffer
+                            ,   &cchBuffer
+                            );
+
+        if (0 != r)
+        {
+            throw std::runtime_error("could not render usage");
+        }
+        else
+        {
+            strings_t       lines;
+            string_t const  text(buffer, cchBuffer);
+
+            clasp_releaseUsageBuffer(args, buffer);
+
+            for (string_t::size_type b = 0; b != text.size(); )
+            {
+                string_t::size_type const e = text.find('\n', b);
+
+                if (string_t::npos == e)
+                {
+                    lines.push_back(text.substr(b));
+
+                    break;
+                }
+                else
+                {
+                    lines.push_back(text.substr(b, e - b));
+
+                    b = e + 1;
+                }
+            }
+
+            return lines;
+        }
+    }
+
     static
     strings_t
     get_show_usage_lines(
@@ -1764,6 +1855,192 @@ static void TEST_clasp_showUsage_AND_clasp_show_usage_TOOLNAME_INFERRED_FROM_PRO
         TEST_MS_EQ("this is an option", lines[12]);
     }
 }
+
+static void TEST_clasp_showUsageToBuffer_NORMAL_AND_ZERO_TABS_AND_NO_BLANK_LINES()
+{
+    clasp_specification_t const specifications[] =
+    {
+        CLASP_FLAG(NULL, "--flag1", "this is a flag"),
+        CLASP_OPTION(NULL, "--option1", "this is an option", ""),
+
+        CLASP_SPECIFICATION_ARRAY_TERMINATOR
+    };
+    clasp_char_t const* const   toolName            =   "myapp";
+    clasp_char_t const* const   summary             =   "My tools";
+    clasp_char_t const* const   copyright           =   "Copyright (c) Me! 2025";
+    clasp_char_t const* const   description         =   "This app does things";
+    clasp_char_t const* const   usage               =   "USAGE: :program: [ ... flags / options ...] <value-1> [ ... <value-N> ]";
+    int const                   major               =   1;
+    int const                   minor               =   2;
+    int const                   revision            =   3;
+    int const                   flags               =   0;
+    int const                   consoleWidth        =   2000;
+    int const                   tabSize             =   0;
+    int const                   blanksBetweenItems  =   0;
+
+    strings_t lines = get_showUsageToBuffer_lines(
+        specifications
+    ,   toolName
+    ,   summary
+    ,   copyright
+    ,   description
+    ,   usage
+    ,   major
+    ,   minor
+    ,   revision
+    ,   flags
+    ,   consoleWidth
+    ,   tabSize
+    ,   blanksBetweenItems
+    );
+
+    REQUIRE(TEST_INTEGER_EQUAL(13u, lines.size()));
+    TEST_MS_EQ("My tools", lines[0]);
+    TEST_MS_EQ("myapp version 1.2.3.0", lines[1]);
+    TEST_MS_EQ("Copyright (c) Me! 2025", lines[2]);
+    TEST_MS_EQ("This app does things", lines[3]);
+    TEST_MS_EQ("", lines[4]);
+    TEST_MS_EQ("USAGE: myapp [ ... flags / options ...] <value-1> [ ... <value-N> ]", lines[5]);
+    TEST_MS_EQ("", lines[6]);
+    TEST_MS_EQ("Flags and options:", lines[7]);
+    TEST_MS_EQ("", lines[8]);
+    TEST_MS_EQ("--flag1", lines[9]);
+    TEST_MS_EQ("this is a flag", lines[10]);
+    TEST_MS_EQ("--option1=<value>", lines[11]);
+    TEST_MS_EQ("this is an option", lines[12]);
+}
+
+static void TEST_clasp_showUsageToBuffer_ALIASES_AND_VALUESETS()
+{
+    clasp_specification_t const specifications[] =
+    {
+        CLASP_OPTION("-m", "--mode", "the mode", "|fast|slow|"),
+        CLASP_FLAG("-f", "--mode=fast", NULL),
+        CLASP_OPTION("-b", "--braces", "the braces", "|{x}|[y]"),
+        CLASP_FLAG("-v", "--verbose", NULL),
+        CLASP_FLAG(NULL, "--verbose", "be verbose"),
+
+        CLASP_SPECIFICATION_ARRAY_TERMINATOR
+    };
+
+    strings_t lines = get_showUsageToBuffer_lines(
+        specifications
+    ,   "myapp"
+    ,   NULL
+    ,   NULL
+    ,   NULL
+    ,   "myapp"
+    ,   1, 0, -1
+    ,   0
+    ,   2000
+    ,   0
+    ,   0
+    );
+
+    REQUIRE(TEST_INTEGER_EQUAL(16u, lines.size()));
+    TEST_MS_EQ("myapp version 1.0", lines[0]);
+    TEST_MS_EQ("", lines[1]);
+    TEST_MS_EQ("myapp", lines[2]);
+    TEST_MS_EQ("", lines[3]);
+    TEST_MS_EQ("Flags and options:", lines[4]);
+    TEST_MS_EQ("", lines[5]);
+    TEST_MS_EQ("-f => --mode=fast", lines[6]);
+    TEST_MS_EQ("-m <value>", lines[7]);
+    TEST_MS_EQ("--mode=<value> as one of {fast|slow|} or any other value", lines[8]);
+    TEST_MS_EQ("the mode", lines[9]);
+    TEST_MS_EQ("-b <value>", lines[10]);
+    TEST_MS_EQ("--braces=<value> as one of <{x}|[y]>", lines[11]);
+    TEST_MS_EQ("the braces", lines[12]);
+    TEST_MS_EQ("-v", lines[13]);
+    TEST_MS_EQ("--verbose", lines[14]);
+    TEST_MS_EQ("be verbose", lines[15]);
+}
+
+static void TEST_clasp_showUsageToBuffer_UTF8_HELP_WRAPPED_BY_DISPLAY_WIDTH()
+{
+    /* "αβγ δεζ ηθι" - 2 bytes, 1 column, per letter; and
+     * "日本語 テキスト" - 3 bytes, 2 columns, per character
+     */
+    clasp_specification_t const specifications[] =
+    {
+        CLASP_FLAG(NULL, "--greek", "\xce\xb1\xce\xb2\xce\xb3 \xce\xb4\xce\xb5\xce\xb6 \xce\xb7\xce\xb8\xce\xb9"),
+        CLASP_FLAG(NULL, "--cjk", "\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e \xe3\x83\x86\xe3\x82\xad\xe3\x82\xb9\xe3\x83\x88"),
+
+        CLASP_SPECIFICATION_ARRAY_TERMINATOR
+    };
+
+    /* width of 12, with indent of 4, leaves 8 columns for help */
+    strings_t lines = get_showUsageToBuffer_lines(
+        specifications
+    ,   "myapp"
+    ,   NULL
+    ,   NULL
+    ,   NULL
+    ,   "myapp"
+    ,   1, 0, -1
+    ,   0
+    ,   12
+    ,   -2
+    ,   0
+    );
+
+    REQUIRE(TEST_INTEGER_EQUAL(12u, lines.size()));
+    TEST_MS_EQ("  --greek", lines[6]);
+    TEST_MS_EQ("    \xce\xb1\xce\xb2\xce\xb3 \xce\xb4\xce\xb5\xce\xb6", lines[7]);
+    TEST_MS_EQ("    \xce\xb7\xce\xb8\xce\xb9", lines[8]);
+    TEST_MS_EQ("  --cjk", lines[9]);
+    TEST_MS_EQ("    \xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e", lines[10]);
+    TEST_MS_EQ("    \xe3\x83\x86\xe3\x82\xad\xe3\x82\xb9\xe3\x83\x88", lines[11]);
+}
+
+static void TEST_clasp_showUsageCached_MEMORY_ONLY()
+{
+    clasp_specification_t const specifications[] =
+    {
+        CLASP_FLAG(NULL, "--flag1", "this is a flag"),
+        CLASP_OPTION(NULL, "--option1", "this is an option", ""),
+
+        CLASP_SPECIFICATION_ARRAY_TERMINATOR
+    };
+
+    clasp::arguments_t const* args;
+
+    REQUIRE(TEST_INTEGER_EQUAL(0, get_args_from_empty_cmd_line_(specifications, &args)));
+
+    stlsoft::scoped_handle<clasp::arguments_t const*> scoper_0(args, clasp::releaseArguments);
+
+    clasp_usage_cache_t* cache;
+
+    REQUIRE(TEST_INTEGER_EQUAL(0, clasp_createUsageCache(NULL, NULL, &cache)));
+
+    stlsoft::scoped_handle<clasp_usage_cache_t*> scoper_1(cache, clasp_destroyUsageCache);
+
+    clasp_char_t const* text1;
+    size_t              cchText1;
+    clasp_char_t const* text2;
+    size_t              cchText2;
+    clasp_char_t const* text3;
+    size_t              cchText3;
+
+    REQUIRE(TEST_INTEGER_EQUAL(0, clasp_showUsageCached(cache, args, specifications, "myapp", NULL, NULL, NULL, "USAGE: myapp", 1, 2, 3, NULL, 0, 2000, 0, 0, &text1, &cchText1)));
+    REQUIRE(TEST_INTEGER_EQUAL(0, clasp_showUsageCached(cache, args, specifications, "myapp", NULL, NULL, NULL, "USAGE: myapp", 1, 2, 3, NULL, 0, 2000, 0, 0, &text2, &cchText2)));
+    REQUIRE(TEST_INTEGER_EQUAL(0, clasp_showUsageCached(cache, args, specifications, "myapp", NULL, NULL, NULL, "USAGE: myapp", 1, 2, 3, NULL, 0, 2000, 4, 0, &text3, &cchText3)));
+
+    TEST_BOOLEAN_TRUE(text1 == text2);
+    TEST_INTEGER_EQUAL(cchText1, cchText2);
+    TEST_BOOLEAN_FALSE(text1 == text3);
+
+    clasp_char_t*   buffer;
+    size_t          cchBuffer;
+
+    REQUIRE(TEST_INTEGER_EQUAL(0, clasp_showUsageToBuffer(args, specifications, "myapp", NULL, NULL, NULL, "USAGE: myapp", 1, 2, 3, 0, 2000, 0, 0, &buffer, &cchBuffer)));
+
+    string_t const expected(buffer, cchBuffer);
+
+    clasp_releaseUsageBuffer(args, buffer);
+
+    TEST_MS_EQ(expected, string_t(text1, cchText1));
+}
 } // anonymous namespace
 
 
@@ -0,0 +1,1529 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    tools/clasp.specc/clasp.specc.c
+ *
+ * Purpose: Build-time compiler of CLASP specifications.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * Home:    https://github.com/synesissoftware/CLASP/
+ *
+ * Copyright (c) 2026, Matthew Wilson
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer;
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution;
+ * - Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * overview
+ *
+ * Reads a specifications description - a file containing the entries of a
+ * specifications array, one per line, written using the CLASP macros, e.g.
+ *
+ *   // my-tool.def
+ *   CLASP_GAP_SECTION("behaviour:")
+ *   CLASP_FLAG("-v", "--verbose", "makes output verbose")
+ *   CLASP_OPTION("-w", "--width", "the output width", NULL)
+ *   CLASP_STOCK_FLAG_HELP
+ *
+ * and writes a C source file defining a clasp_compiled_specifications_t
+ * instance that holds the array, its perfect-hash index (including the
+ * direct table of single-character flags), and its usage body
+ * pre-rendered for a given layout. Any line beginning with '#' is
+ * passed through unchanged, so that the expressions given to
+ * CLASP_BIT_FLAG() may be defined in an included header.
+ */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <clasp/main.h>
+
+#include <assert.h>
+#include <ctype.h>
+#include <errno.h>
+#include <limits.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#ifdef CLASP_USE_WIDE_STRINGS
+# error clasp.specc generates multibyte-string specifications only
+#endif /* CLASP_USE_WIDE_STRINGS */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+#define PROGRAM_NAME                                        "clasp.specc"
+
+#define PROGRAM_VER_MAJOR                                   0
+#define PROGRAM_VER_MINOR                                   1
+#define PROGRAM_VER_PATCH                                   0
+#define PROGRAM_VER_ARGLIST                                 PROGRAM_VER_MAJOR, PROGRAM_VER_MINOR, PROGRAM_VER_PATCH
+
+#define SPECC_DEFAULT_USAGE_FLAGS                           0
+#define SPECC_DEFAULT_CONSOLE_WIDTH                         76
+#define SPECC_DEFAULT_TAB_SIZE                              -2
+#define SPECC_DEFAULT_BLANKS_BETWEEN_ITEMS                  1
+
+#define SPECC_MAX_PARAMS_                                   4
+
+enum
+{
+        SPECC_KIND_FLAG_
+    ,   SPECC_KIND_BIT_FLAG_
+    ,   SPECC_KIND_FLAG_ALIAS_
+    ,   SPECC_KIND_OPTION_
+    ,   SPECC_KIND_OPTION_ALIAS_
+    ,   SPECC_KIND_SECTION_
+    ,   SPECC_KIND_TACIT_SECTION_
+    ,   SPECC_KIND_GAP_SECTION_
+    ,   SPECC_KIND_STOCK_FLAG_HELP_
+    ,   SPECC_KIND_STOCK_FLAG_VERSION_
+    ,   SPECC_KIND_TERMINATOR_
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * typedefs
+ */
+
+/* Describes a macro that may appear in a description */
+typedef struct specc_macro_t_       specc_macro_t_;
+struct specc_macro_t_
+{
+    char const* name;
+    int         kind;
+    char const* params; /* 's' => string or NULL, 'i' => integer, 'r' => raw expression; NULL => no parentheses */
+};
+
+/* An entry read from a description */
+typedef struct specc_entry_t_       specc_entry_t_;
+struct specc_entry_t_
+{
+    specc_macro_t_ const*   macro;
+    char*                   args[SPECC_MAX_PARAMS_];  /* decoded string, or raw expression; NULL for NULL */
+    long                    integer;
+};
+
+/* A growable character buffer */
+typedef struct specc_buffer_t_      specc_buffer_t_;
+struct specc_buffer_t_
+{
+    char*   ptr;
+    size_t  len;
+    size_t  capacity;
+};
+
+/* The state of the reading of a description */
+typedef struct specc_scanner_t_     specc_scanner_t_;
+struct specc_scanner_t_
+{
+    char const* path;
+    char const* p;
+    unsigned    line;
+};
+
+/* The result of reading a description */
+typedef struct specc_description_t_ specc_description_t_;
+struct specc_description_t_
+{
+    specc_entry_t_*     entries;
+    size_t              numEntries;
+    specc_buffer_t_     passthrough;
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * globals
+ */
+
+static specc_macro_t_ const s_macros[] =
+{
+        { "CLASP_FLAG",                             SPECC_KIND_FLAG_,               "sss"   }
+    ,   { "CLASP_BIT_FLAG",                         SPECC_KIND_BIT_FLAG_,           "ssrs"  }
+    ,   { "CLASP_FLAG_ALIAS",                       SPECC_KIND_FLAG_ALIAS_,         "ss"    }
+    ,   { "CLASP_OPTION",                           SPECC_KIND_OPTION_,             "ssss"  }
+    ,   { "CLASP_OPTION_ALIAS",                     SPECC_KIND_OPTION_ALIAS_,       "ss"    }
+    ,   { "CLASP_SECTION",                          SPECC_KIND_SECTION_,            "i"     }
+    ,   { "CLASP_TACIT_SECTION",                    SPECC_KIND_TACIT_SECTION_,      ""      }
+    ,   { "CLASP_GAP_SECTION",                      SPECC_KIND_GAP_SECTION_,        "s"     }
+    ,   { "CLASP_STOCK_FLAG_HELP",                  SPECC_KIND_STOCK_FLAG_HELP_,    NULL    }
+    ,   { "CLASP_STOCK_FLAG_VERSION",               SPECC_KIND_STOCK_FLAG_VERSION_, NULL    }
+    ,   { "CLASP_SPECIFICATION_ARRAY_TERMINATOR",   SPECC_KIND_TERMINATOR_,         NULL    }
+};
+
+static clasp_specification_t const Specifications[] =
+{
+    CLASP_GAP_SECTION("generation:"),
+
+    CLASP_OPTION("-n", "--name", "the name of the generated clasp_compiled_specifications_t instance; defaults to the stem of <specs-file>, as a C identifier, followed by '_specifications'", NULL),
+
+    CLASP_GAP_SECTION("usage layout:"),
+
+    CLASP_OPTION(NULL, "--usage-flags", "the flags with which the usage body is rendered; defaults to 0", NULL),
+    CLASP_OPTION(NULL, "--console-width", "the console width with which the usage body is rendered; defaults to 76", NULL),
+    CLASP_OPTION(NULL, "--tab-size", "the tab size with which the usage body is rendered; defaults to -2", NULL),
+    CLASP_OPTION(NULL, "--blanks-between-items", "the number of blank lines between items with which the usage body is rendered; defaults to 1", NULL),
+
+    CLASP_GAP_SECTION("standard flags:"),
+
+    CLASP_STOCK_FLAG_HELP,
+    CLASP_STOCK_FLAG_VERSION,
+
+    CLASP_SPECIFICATION_ARRAY_TERMINATOR
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions - buffer
+ */
+
+static
+int
+specc_buffer_append_(
+    specc_buffer_t_*    buffer
+,   char const*         s
+,   size_t              n
+)
+{
+    if (buffer->len + n + 1 > buffer->capacity)
+    {
+        size_t const    capacity    =   (buffer->len + n + 1) * 2;
+        char* const     ptr         =   (char*)realloc(buffer->ptr, capacity);
+
+        if (NULL == ptr)
+        {
+            return ENOMEM;
+        }
+
+        buffer->ptr         =   ptr;
+        buffer->capacity    =   capacity;
+    }
+
+    memcpy(buffer->ptr + buffer->len, s, n);
+    buffer->len += n;
+    buffer->ptr[buffer->len] = '\0';
+
+    return 0;
+}
+
+static
+int
+specc_buffer_append_char_(
+    specc_buffer_t_*    buffer
+,   char                ch
+)
+{
+    return specc_buffer_append_(buffer, &ch, 1);
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions - reading
+ */
+
+static
+int
+specc_fail_(
+    specc_scanner_t_ const* sc
+,   char const*             fmt
+,   ...
+)
+{
+    va_list args;
+
+    fprintf(stderr, "%s(%u): error: ", sc->path, sc->line);
+
+    va_start(args, fmt);
+    vfprintf(stderr, fmt, args);
+    va_end(args);
+
+    fputc('\n', stderr);
+
+    return EINVAL;
+}
+
+static
+int
+specc_read_file_(
+    char const*         path
+,   specc_buffer_t_*    contents
+)
+{
+    FILE* const stm = fopen(path, "r");
+    int         r   = 0;
+
+    if (NULL == stm)
+    {
+        return errno;
+    }
+    else
+    {
+        char    chunk[4096];
+        size_t  n;
+
+        for (; 0 == r && 0 != (n = fread(chunk, 1, sizeof(chunk), stm)); )
+        {
+            r = specc_buffer_append_(contents, chunk, n);
+        }
+
+        if (0 == r)
+        {
+            if (ferror(stm))
+            {
+                r = EIO;
+            }
+            else
+            {
+                r = specc_buffer_append_(contents, "", 0);
+            }
+        }
+
+        fclose(stm);
+    }
+
+    return r;
+}
+
+/* skips whitespace and comments */
+static
+int
+specc_skip_space_(
+    specc_scanner_t_*   sc
+)
+{
+    for (;;)
+    {
+        char const ch = *sc->p;
+
+        if ('\n' == ch)
+        {
+            ++sc->line;
+            ++sc->p;
+        }
+        else if (isspace((unsigned char)ch))
+        {
+            ++sc->p;
+        }
+        else if ('/' == ch && '/' == sc->p[1])
+        {
+            for (; '\0' != *sc->p && '\n' != *sc->p; ++sc->p)
+            {}
+        }
+        else if ('/' == ch && '*' == sc->p[1])
+        {
+            char const* const end = strstr(sc->p + 2, "*/");
+
+            if (NULL == end)
+            {
+                return specc_fail_(sc, "unterminated comment");
+            }
+
+            for (; sc->p != end + 2; ++sc->p)
+            {
+                if ('\n' == *sc->p)
+                {
+                    ++sc->line;
+                }
+            }
+        }
+        else
+        {
+            return 0;
+        }
+    }
+}
+
+/* reads an identifier, returning its length, which is 0 if none */
+static
+size_t
+specc_read_identifier_(
+    specc_scanner_t_*   sc
+)
+{
+    char const* const   start = sc->p;
+
+    if ('_' == *sc->p ||
+        isalpha((unsigned char)*sc->p))
+    {
+        for (++sc->p; '_' == *sc->p || isalnum((unsigned char)*sc->p); ++sc->p)
+        {}
+    }
+
+    return (size_t)(sc->p - start);
+}
+
+/* reads a preprocessor line, including any continuations */
+static
+int
+specc_read_directive_(
+    specc_scanner_t_*   sc
+,   specc_buffer_t_*    passthrough
+)
+{
+    char const* const   start = sc->p;
+
+    for (; '\0' != *sc->p; ++sc->p)
+    {
+        if ('\n' == *sc->p)
+        {
+            if (sc->p != start &&
+                '\\' == sc->p[-1])
+            {
+                ++sc->line;
+            }
+            else
+            {
+                break;
+            }
+        }
+    }
+
+    {
+        size_t n = (size_t)(sc->p - start);
+
+        for (; 0 != n && '\r' == start[n - 1]; --n)
+        {}
+
+        if (0 != specc_buffer_append_(passthrough, start, n) ||
+            0 != specc_buffer_append_char_(passthrough, '\n'))
+        {
+            return ENOMEM;
+        }
+    }
+
+    return 0;
+}
+
+/* reads one or more adjacent string literals, decoding their escapes */
+static
+int
+specc_read_string_(
+    specc_scanner_t_*   sc
+,   char**              pstr
+)
+{
+    specc_buffer_t_ str = { NULL, 0, 0 };
+    int             r   = 0;
+
+    do
+    {
+        for (++sc->p; 0 == r; )
+        {
+            char ch = *sc->p++;
+
+            if ('\0' == ch ||
+                '\n' == ch)
+            {
+                free(str.ptr);
+
+                --sc->p;
+
+                return specc_fail_(sc, "unterminated string literal");
+            }
+
+            if ('"' == ch)
+            {
+                break;
+            }
+
+            if ('\\' == ch)
+            {
+                ch = *sc->p++;
+
+                switch (ch)
+                {
+                case    'a':    ch = '\a'; break;
+                case    'b':    ch = '\b'; break;
+                case    'f':    ch = '\f'; break;
+                case    'n':    ch = '\n'; break;
+                case    'r':    ch = '\r'; break;
+                case    't':    ch = '\t'; break;
+                case    'v':    ch = '\v'; break;
+                case    '\\':
+                case    '\'':
+                case    '"':
+                case    '?':
+                    break;
+                case    'x':
+                    {
+                        char*   end;
+                        long    v;
+
+                        if (!isxdigit((unsigned char)*sc->p))
+                        {
+                            free(str.ptr);
+
+                            return specc_fail_(sc, "invalid hexadecimal escape sequence");
+                        }
+
+                        v = strtol(sc->p, &end, 16);
+                        sc->p = end;
+                        ch = (char)v;
+                    }
+                    break;
+                default:
+                    if (ch >= '0' &&
+                        ch <= '7')
+                    {
+                        int v = ch - '0';
+                        int i;
+
+                        for (i = 1; i != 3 && *sc->p >= '0' && *sc->p <= '7'; ++i)
+                        {
+                            v = (v * 8) + (*sc->p++ - '0');
+                        }
+
+                        ch = (char)v;
+                    }
+                    else
+                    {
+                        free(str.ptr);
+
+                        return specc_fail_(sc, "unrecognised escape sequence '\\%c'", ch);
+                    }
+                    break;
+                }
+            }
+
+            r = specc_buffer_append_char_(&str, ch);
+        }
+
+        if (0 == r)
+        {
+            r = specc_skip_space_(sc);
+        }
+    }
+    while (0 == r && '"' == *sc->p);
+
+    if (0 == r)
+    {
+        r = specc_buffer_append_(&str, "", 0);
+    }
+
+    if (0 != r)
+    {
+        free(str.ptr);
+    }
+    else
+    {
+        *pstr = str.ptr;
+    }
+
+    return r;
+}
+
+/* reads a raw expression, up to the next top-level ',' or ')' */
+static
+int
+specc_read_raw_(
+    specc_scanner_t_*   sc
+,   char**              pstr
+)
+{
+    char const* const   start = sc->p;
+    int                 depth = 0;
+    size_t              n;
+
+    for (; '\0' != *sc->p; ++sc->p)
+    {
+        if ('(' == *sc->p)
+        {
+            ++depth;
+        }
+        else if (')' == *sc->p)
+        {
+            if (0 == depth--)
+            {
+                break;
+            }
+        }
+        else if (',' == *sc->p &&
+                 0 == depth)
+        {
+            break;
+        }
+        else if ('\n' == *sc->p)
+        {
+            ++sc->line;
+        }
+    }
+
+    for (n = (size_t)(sc->p - start); 0 != n && isspace((unsigned char)start[n - 1]); --n)
+    {}
+
+    if (0 == n)
+    {
+        return specc_fail_(sc, "expected an expression");
+    }
+
+    *pstr = (char*)malloc(n + 1);
+    if (NULL == *pstr)
+    {
+        return ENOMEM;
+    }
+
+    memcpy(*pstr, start, n);
+    (*pstr)[n] = '\0';
+
+    return 0;
+}
+
+static
+int
+specc_read_arguments_(
+    specc_scanner_t_*   sc
+,   specc_entry_t_*     entry
+)
+{
+    char const* const   params  =   entry->macro->params;
+    int                 r;
+
+    if (NULL == params)
+    {
+        return 0;
+    }
+
+    if ('(' != *sc->p)
+    {
+        return specc_fail_(sc, "expected '(' after %s", entry->macro->name);
+    }
+    ++sc->p;
+
+    { size_t i; for (i = 0; '\0' != params[i]; ++i)
+    {
+        r = specc_skip_space_(sc);
+        if (0 != r)
+        {
+            return r;
+        }
+
+        if (0 != i)
+        {
+            if (',' != *sc->p)
+            {
+                return specc_fail_(sc, "expected ',' - %s takes %u arguments", entry->macro->name, (unsigned)strlen(params));
+            }
+            ++sc->p;
+
+            r = specc_skip_space_(sc);
+            if (0 != r)
+            {
+                return r;
+            }
+        }
+
+        switch (params[i])
+        {
+        case    's':
+            if ('"' == *sc->p)
+            {
+                r = specc_read_string_(sc, &entry->args[i]);
+            }
+            else
+            {
+                char const* const   start   =   sc->p;
+                size_t const        n       =   specc_read_identifier_(sc);
+
+                if (4 != n ||
+                    0 != strncmp(start, "NULL", 4))
+                {
+                    r = specc_fail_(sc, "expected a string literal or NULL");
+                }
+                else
+                {
+                    r = specc_skip_space_(sc);
+                }
+            }
+            break;
+        case    'i':
+            {
+                char* end;
+
+                entry->integer = strtol(sc->p, &end, 0);
+
+                if (end == sc->p)
+                {
+                    r = specc_fail_(sc, "expected an integer");
+                }
+                else
+                {
+                    sc->p = end;
+
+                    r = specc_skip_space_(sc);
+                }
+            }
+            break;
+        default:
+
+            assert('r' == params[i]);
+
+            r = specc_read_raw_(sc, &entry->args[i]);
+            break;
+        }
+
+        if (0 != r)
+        {
+            return r;
+        }
+    }}
+
+    r = specc_skip_space_(sc);
+    if (0 != r)
+    {
+        return r;
+    }
+
+    if (')' != *sc->p)
+    {
+        return specc_fail_(sc, "expected ')' - %s takes %u arguments", entry->macro->name, (unsigned)strlen(params));
+    }
+    ++sc->p;
+
+    return 0;
+}
+
+static
+void
+specc_release_description_(
+    specc_description_t_*   description
+)
+{
+    { size_t i; for (i = 0; i != description->numEntries; ++i)
+    {
+        { size_t j; for (j = 0; j != SPECC_MAX_PARAMS_; ++j)
+        {
+            free(description->entries[i].args[j]);
+        }}
+    }}
+
+    free(description->entries);
+    free(description->passthrough.ptr);
+}
+
+static
+int
+specc_read_description_(
+    specc_scanner_t_*       sc
+,   specc_description_t_*   description
+)
+{
+    size_t  capacity = 0;
+    int     r;
+
+    for (;;)
+    {
+        specc_macro_t_ const*   macro = NULL;
+        char const*             start;
+        size_t                  n;
+
+        r = specc_skip_space_(sc);
+        if (0 != r)
+        {
+            return r;
+        }
+
+        if ('\0' == *sc->p)
+        {
+            return 0;
+        }
+
+        if ('#' == *sc->p)
+        {
+            r = specc_read_directive_(sc, &description->passthrough);
+            if (0 != r)
+            {
+                return r;
+            }
+
+            continue;
+        }
+
+        start   =   sc->p;
+        n       =   specc_read_identifier_(sc);
+
+        { size_t i; for (i = 0; i != sizeof(s_macros) / sizeof(s_macros[0]); ++i)
+        {
+            if (n == strlen(s_macros[i].name) &&
+                0 == strncmp(start, s_macros[i].name, n))
+            {
+                macro = &s_macros[i];
+
+                break;
+            }
+        }}
+
+        if (NULL == macro)
+        {
+            sc->p = start;
+
+            return specc_fail_(sc, "expected a CLASP specification macro");
+        }
+
+        if (SPECC_KIND_TERMINATOR_ == macro->kind)
+        {
+            r = specc_skip_space_(sc);
+            if (0 != r)
+            {
+                return r;
+            }
+
+            if (',' == *sc->p)
+            {
+                ++sc->p;
+
+                r = specc_skip_space_(sc);
+                if (0 != r)
+                {
+                    return r;
+                }
+            }
+
+            if ('\0' != *sc->p)
+            {
+                return specc_fail_(sc, "unexpected content after %s", macro->name);
+            }
+
+            return 0;
+        }
+
+        if (description->numEntries == capacity)
+        {
+            size_t const            newCapacity =   (0 == capacity) ? 16 : (capacity * 2);
+            specc_entry_t_* const   entries     =   (specc_entry_t_*)realloc(description->entries, sizeof(specc_entry_t_) * newCapacity);
+
+            if (NULL == entries)
+            {
+                return ENOMEM;
+            }
+
+            description->entries    =   entries;
+            capacity                =   newCapacity;
+        }
+
+        {
+            specc_entry_t_* const entry = &description->entries[description->numEntries++];
+
+            memset(entry, 0, sizeof(*entry));
+            entry->macro = macro;
+
+            r = specc_skip_space_(sc);
+            if (0 == r)
+            {
+                r = specc_read_arguments_(sc, entry);
+            }
+            if (0 == r)
+            {
+                r = specc_skip_space_(sc);
+            }
+            if (0 != r)
+            {
+                return r;
+            }
+        }
+
+        if (',' == *sc->p)
+        {
+            ++sc->p;
+        }
+    }
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions - generation
+ */
+
+static
+void
+specc_make_specification_(
+    specc_entry_t_ const*   entry
+,   clasp_specification_t*  spec
+)
+{
+    static clasp_specification_t const stockHelp    =   CLASP_STOCK_FLAG_HELP;
+    static clasp_specification_t const stockVersion =   CLASP_STOCK_FLAG_VERSION;
+
+    memset(spec, 0, sizeof(*spec));
+
+    switch (entry->macro->kind)
+    {
+    case    SPECC_KIND_FLAG_:
+    case    SPECC_KIND_FLAG_ALIAS_:
+        spec->type              =   CLASP_ARGTYPE_FLAG;
+        spec->name              =   entry->args[0];
+        spec->mappedArgument    =   entry->args[1];
+        spec->help              =   entry->args[2];
+        break;
+    case    SPECC_KIND_BIT_FLAG_:
+        spec->type              =   CLASP_ARGTYPE_FLAG;
+        spec->name              =   entry->args[0];
+        spec->mappedArgument    =   entry->args[1];
+        spec->help              =   entry->args[3];
+        /* the expression is reproduced verbatim in the generated array,
+         * and its value plays no part in the index or the usage
+         */
+        spec->bitFlags          =   (int)strtol(entry->args[2], NULL, 0);
+        break;
+    case    SPECC_KIND_OPTION_:
+    case    SPECC_KIND_OPTION_ALIAS_:
+        spec->type              =   CLASP_ARGTYPE_OPTION;
+        spec->name              =   entry->args[0];
+        spec->mappedArgument    =   entry->args[1];
+        spec->help              =   entry->args[2];
+        spec->valueSet          =   entry->args[3];
+        break;
+    case    SPECC_KIND_SECTION_:
+        spec->type              =   CLASP_ARGTYPE_CAST_(entry->integer);
+        break;
+    case    SPECC_KIND_TACIT_SECTION_:
+        spec->type              =   CLASP_ARGTYPE_TACIT_;
+        break;
+    case    SPECC_KIND_GAP_SECTION_:
+        spec->type              =   CLASP_ARGTYPE_GAP_;
+        spec->help              =   entry->args[0];
+        break;
+    case    SPECC_KIND_STOCK_FLAG_HELP_:
+        *spec = stockHelp;
+        break;
+    default:
+
+        assert(SPECC_KIND_STOCK_FLAG_VERSION_ == entry->macro->kind);
+
+        *spec = stockVersion;
+        break;
+    }
+}
+
+static
+int
+specc_render_usage_body_(
+    clasp_arguments_t const*    args
+,   clasp_specification_t const specifications[]
+,   int                         flags
+,   int                         consoleWidth
+,   int                         tabSize
+,   int                         blanksBetweenItems
+,   specc_buffer_t_*            body
+)
+{
+    FILE* const stm = tmpfile();
+    int         r   = 0;
+
+    if (NULL == stm)
+    {
+        return errno;
+    }
+
+    clasp_showBody(args, specifications, clasp_showBodyByFILE, stm, flags, consoleWidth, tabSize, blanksBetweenItems);
+
+    if (0 != fflush(stm) ||
+        ferror(stm))
+    {
+        r = EIO;
+    }
+    else
+    {
+        char    chunk[4096];
+        size_t  n;
+
+        rewind(stm);
+
+        for (; 0 == r && 0 != (n = fread(chunk, 1, sizeof(chunk), stm)); )
+        {
+            r = specc_buffer_append_(body, chunk, n);
+        }
+    }
+
+    fclose(stm);
+
+    return r;
+}
+
+static
+void
+specc_write_string_literal_(
+    FILE*       stm
+,   char const* s
+)
+{
+    if (NULL == s)
+    {
+        fputs("NULL", stm);
+    }
+    else
+    {
+        char prev = '\0';
+
+        fputc('"', stm);
+
+        for (; '\0' != *s; prev = *s++)
+        {
+            switch (*s)
+            {
+            case    '"':    fputs("\\\"", stm); break;
+            case    '\\':   fputs("\\\\", stm); break;
+            case    '\n':   fputs("\\n", stm); break;
+            case    '\t':   fputs("\\t", stm); break;
+            case    '?':    fputs(('?' == prev) ? "\\?" : "?", stm); break;
+            default:
+                if (isprint((unsigned char)*s))
+                {
+                    fputc(*s, stm);
+                }
+                else
+                {
+                    fprintf(stm, "\\%03o", (unsigned char)*s);
+                }
+                break;
+            }
+        }
+
+        fputc('"', stm);
+    }
+}
+
+static
+void
+specc_write_char_literal_(
+    FILE*   stm
+,   char    ch
+)
+{
+    switch (ch)
+    {
+    case    '\'':   fputs("'\\''", stm); break;
+    case    '\\':   fputs("'\\\\'", stm); break;
+    case    '\n':   fputs("'\\n'", stm); break;
+    case    '\t':   fputs("'\\t'", stm); break;
+    default:
+        if (isprint((unsigned char)ch))
+        {
+            fprintf(stm, "'%c'", ch);
+        }
+        else
+        {
+            fprintf(stm, "'\\%03o'", (unsigned char)ch);
+        }
+        break;
+    }
+}
+
+static
+int
+specc_write_output_(
+    char const*                         path
+,   char const*                         specsPath
+,   char const*                         name
+,   specc_description_t_ const*         description
+,   clasp_specification_index_t const*  index
+,   specc_buffer_t_ const*              body
+,   int                                 flags
+,   int                                 consoleWidth
+,   int                                 tabSize
+,   int                                 blanksBetweenItems
+)
+{
+    FILE* const stm = fopen(path, "w");
+
+    if (NULL == stm)
+    {
+        return errno;
+    }
+
+    fprintf(stm, "/* Generated by " PROGRAM_NAME " from %s - do not edit */\n", specsPath);
+    fputs("\n", stm);
+    fputs("#include <clasp/clasp.h>\n", stm);
+    if (0 != description->passthrough.len)
+    {
+        fputs("\n", stm);
+        fputs(description->passthrough.ptr, stm);
+    }
+    fputs("\n", stm);
+    fputs("#ifdef CLASP_USE_WIDE_STRINGS\n", stm);
+    fprintf(stm, "# error %s was generated for multibyte strings\n", name);
+    fputs("#endif /* CLASP_USE_WIDE_STRINGS */\n", stm);
+    fputs("\n", stm);
+
+    /* specifications */
+    fprintf(stm, "static clasp_specification_t const %s_array_[] =\n{\n", name);
+    { size_t i; for (i = 0; i != description->numEntries; ++i)
+    {
+        specc_entry_t_ const* const entry   =   &description->entries[i];
+        char const* const           params  =   entry->macro->params;
+
+        fprintf(stm, "    %s", entry->macro->name);
+
+        if (NULL != params)
+        {
+            fputc('(', stm);
+
+            { size_t j; for (j = 0; '\0' != params[j]; ++j)
+            {
+                if (0 != j)
+                {
+                    fputs(", ", stm);
+                }
+
+                switch (params[j])
+                {
+                case    's':    specc_write_string_literal_(stm, entry->args[j]); break;
+                case    'i':    fprintf(stm, "%ld", entry->integer); break;
+                default:        fputs(entry->args[j], stm); break;
+                }
+            }}
+
+            fputc(')', stm);
+        }
+
+        fputs(",\n", stm);
+    }}
+    fputs("\n    CLASP_SPECIFICATION_ARRAY_TERMINATOR\n};\n\n", stm);
+
+    /* index */
+    fprintf(stm, "static unsigned long const %s_seeds_[] =\n{", name);
+    { size_t i; for (i = 0; i != index->numBuckets; ++i)
+    {
+        fprintf(stm, "%s%s%lu", (0 == i) ? "" : ",", (0 == i % 8) ? "\n    " : " ", index->seeds[i]);
+    }}
+    fputs("\n};\n\n", stm);
+
+    fprintf(stm, "static int const %s_slots_[] =\n{", name);
+    { size_t i; for (i = 0; i != index->numSlots; ++i)
+    {
+        fprintf(stm, "%s%s%d", (0 == i) ? "" : ",", (0 == i % 16) ? "\n    " : " ", index->slots[i]);
+    }}
+    fputs("\n};\n\n", stm);
+
+    /* short flags; as the tool is multibyte-only, there are no wide short
+     * flags
+     */
+    assert(0 == index->numWideShortFlags);
+
+    fprintf(stm, "static int const %s_short_flags_[CLASP_SHORT_FLAG_TABLE_SIZE] =\n{", name);
+    { size_t i; for (i = 0; i != CLASP_SHORT_FLAG_TABLE_SIZE; ++i)
+    {
+        fprintf(stm, "%s%s%d", (0 == i) ? "" : ",", (0 == i % 16) ? "\n    " : " ", index->shortFlags[i]);
+    }}
+    fputs("\n};\n\n", stm);
+
+    /* prefix trie */
+    fprintf(stm, "static clasp_prefix_trie_node_t const %s_trie_nodes_[] =\n{", name);
+    { size_t i; for (i = 0; i != index->numTrieNodes; ++i)
+    {
+        clasp_prefix_trie_node_t const* const node = &index->trieNodes[i];
+
+        fprintf(
+            stm
+        ,   "%s\n    { %d, %d, %d, %d, %d, %d, %d, %d, %d }"
+        ,   (0 == i) ? "" : ","
+        ,   node->labelSpecIndex, node->labelOffset, node->labelLength
+        ,   node->parent, node->firstChild, node->nextSibling
+        ,   node->specIndex, node->numNames, node->anySpecIndex
+        );
+    }}
+    fputs("\n};\n\n", stm);
+
+    /* usage body, as characters rather than as a string literal, so as not
+     * to be limited by the maximum length of the latter; each rendered line
+     * is on its own line
+     */
+    if (NULL != body)
+    {
+        fprintf(stm, "static char const %s_usage_body_[] =\n{\n   ", name);
+        { size_t i; for (i = 0; i != body->len; ++i)
+        {
+            fputc(' ', stm);
+            specc_write_char_literal_(stm, body->ptr[i]);
+            fputs(",", stm);
+            if ('\n' == body->ptr[i])
+            {
+                fputs("\n   ", stm);
+            }
+        }}
+        fputs(" '\\0'\n};\n\n", stm);
+    }
+
+    /* bundle */
+    fprintf(stm, "CLASP_DECLARE_COMPILED_SPECIFICATIONS(%s);\n\n", name);
+    fprintf(stm, "clasp_compiled_specifications_t const %s =\n{\n", name);
+    fputs("    {\n", stm);
+    fprintf(stm, "        %s_array_\n", name);
+    fprintf(stm, "    ,   %lu\n", (unsigned long)index->numBuckets);
+    fprintf(stm, "    ,   %s_seeds_\n", name);
+    fprintf(stm, "    ,   %lu\n", (unsigned long)index->numSlots);
+    fprintf(stm, "    ,   %s_slots_\n", name);
+    fprintf(stm, "    ,   %s_short_flags_\n", name);
+    fputs("    ,   0\n", stm);
+    fputs("    ,   NULL\n", stm);
+    fprintf(stm, "    ,   %lu\n", (unsigned long)index->numTrieNodes);
+    fprintf(stm, "    ,   %s_trie_nodes_\n", name);
+    fputs("    }\n", stm);
+    if (NULL != body)
+    {
+        fprintf(stm, ",   %s_usage_body_\n", name);
+        fprintf(stm, ",   %lu\n", (unsigned long)body->len);
+    }
+    else
+    {
+        fputs(",   NULL\n", stm);
+        fputs(",   0\n", stm);
+    }
+    fprintf(stm, ",   %d\n", flags);
+    fprintf(stm, ",   %d\n", consoleWidth);
+    fprintf(stm, ",   %d\n", tabSize);
+    fprintf(stm, ",   %d\n", blanksBetweenItems);
+    fputs("};\n", stm);
+
+    if (ferror(stm))
+    {
+        fclose(stm);
+
+        return EIO;
+    }
+
+    return (0 != fclose(stm)) ? EIO : 0;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions - options
+ */
+
+static
+int
+specc_get_integer_option_(
+    clasp_arguments_t const*    args
+,   char const*                 name
+,   int                         defaultValue
+,   int*                        value
+)
+{
+    clasp_argument_t const* const arg = clasp_findFlagOrOption(args, name, 0);
+
+    *value = defaultValue;
+
+    if (NULL != arg)
+    {
+        char*   end = NULL;
+        long    v   = 0;
+
+        errno = 0;
+
+        if (0 != arg->value.len)
+        {
+            v = strtol(arg->value.ptr, &end, 0);
+        }
+
+        if (0 == arg->value.len ||
+            end != arg->value.ptr + arg->value.len ||
+            ERANGE == errno ||
+            v < INT_MIN ||
+            v > INT_MAX)
+        {
+            fprintf(stderr, PROGRAM_NAME ": invalid value '%.*s' for option %s; use --help for usage\n", (int)arg->value.len, arg->value.ptr, name);
+
+            return EINVAL;
+        }
+
+        *value = (int)v;
+    }
+
+    return 0;
+}
+
+static
+char*
+specc_make_default_name_(
+    char const* specsPath
+)
+{
+    static char const   suffix[]    =   "_specifications";
+    char const*         stem        =   specsPath;
+    char const*         end;
+    char*               name;
+
+    { char const* p; for (p = specsPath; '\0' != *p; ++p)
+    {
+        if ('/' == *p ||
+            '\\' == *p)
+        {
+            stem = p + 1;
+        }
+    }}
+
+    end = strchr(stem, '.');
+    if (NULL == end)
+    {
+        end = stem + strlen(stem);
+    }
+
+    name = (char*)malloc(1 + (size_t)(end - stem) + sizeof(suffix));
+    if (NULL != name)
+    {
+        char* p = name;
+
+        if (stem == end ||
+            isdigit((unsigned char)*stem))
+        {
+            *p++ = '_';
+        }
+
+        for (; stem != end; ++stem)
+        {
+            *p++ = isalnum((unsigned char)*stem) ? *stem : '_';
+        }
+
+        memcpy(p, suffix, sizeof(suffix));
+    }
+
+    return name;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+static
+int
+main1(
+    clasp_arguments_t const* args
+)
+{
+    clasp_argument_t const*             arg;
+    clasp_char_t const*                 specsPath;
+    clasp_char_t const*                 outputPath;
+    char*                               name;
+    int                                 flags;
+    int                                 consoleWidth;
+    int                                 tabSize;
+    int                                 blanksBetweenItems;
+    specc_buffer_t_                     contents    =   { NULL, 0, 0 };
+    specc_description_t_                description;
+    specc_scanner_t_                    sc;
+    clasp_specification_t*              specifications;
+    clasp_specification_index_t const*  index;
+    specc_buffer_t_                     body        =   { NULL, 0, 0 };
+    int                                 haveBody;
+    int                                 r;
+
+    if (clasp_flagIsSpecified(args, "--help"))
+    {
+        clasp_showUsage(
+            args
+        ,   Specifications
+        ,   PROGRAM_NAME
+        ,   "CLASP (http://github.com/synesissoftware/CLASP)"
+        ,   "Copyright Matthew Wilson and Synesis Information Systems"
+        ,   "compiles a CLASP specifications description into C source"
+        ,   ":program: [ ... options ... ] <specs-file> <output-file>"
+        ,   PROGRAM_VER_ARGLIST
+        ,   clasp_showHeaderByFILE, clasp_showBodyByFILE, stdout
+        ,   0  /* flags */
+        ,   76 /* console width */
+        ,   -2 /* indent size */
+        ,   1  /* blank line between args */
+        );
+
+        return EXIT_SUCCESS;
+    }
+
+    if (clasp_flagIsSpecified(args, "--version"))
+    {
+        clasp_showVersion(
+            args
+        ,   PROGRAM_NAME
+        ,   PROGRAM_VER_ARGLIST
+        ,   clasp_showVersionByFILE, stdout
+        ,   0 /* flags */
+        );
+
+        return EXIT_SUCCESS;
+    }
+
+    if (0 != clasp_reportUnrecognisedFlagsAndOptions(args, Specifications, &arg, 0))
+    {
+        fprintf(stderr, PROGRAM_NAME ": unrecognised argument: %s; use --help for usage\n", args->argv[arg->cmdLineIndex]);
+
+        return EXIT_FAILURE;
+    }
+
+    if (2 != args->numValues)
+    {
+        fprintf(stderr, PROGRAM_NAME ": %s; use --help for usage\n", (args->numValues < 2) ? "specifications file and output file must be specified" : "too many arguments");
+
+        return EXIT_FAILURE;
+    }
+
+    specsPath   =   args->values[0].value.ptr;
+    outputPath  =   args->values[1].value.ptr;
+
+    if (0 != specc_get_integer_option_(args, "--usage-flags", SPECC_DEFAULT_USAGE_FLAGS, &flags) ||
+        0 != specc_get_integer_option_(args, "--console-width", SPECC_DEFAULT_CONSOLE_WIDTH, &consoleWidth) ||
+        0 != specc_get_integer_option_(args, "--tab-size", SPECC_DEFAULT_TAB_SIZE, &tabSize) ||
+        0 != specc_get_integer_option_(args, "--blanks-between-items", SPECC_DEFAULT_BLANKS_BETWEEN_ITEMS, &blanksBetweenItems))
+    {
+        return EXIT_FAILURE;
+    }
+
+    arg = clasp_findFlagOrOption(args, "--name", 0);
+    if (NULL != arg)
+    {
+        name = (char*)malloc(arg->value.len + 1);
+        if (NULL != name)
+        {
+            memcpy(name, arg->value.ptr, arg->value.len);
+            name[arg->value.len] = '\0';
+        }
+    }
+    else
+    {
+        name = specc_make_default_name_(specsPath);
+    }
+    if (NULL == name)
+    {
+        fprintf(stderr, PROGRAM_NAME ": out of memory\n");
+
+        return EXIT_FAILURE;
+    }
+
+    /* read */
+    r = specc_read_file_(specsPath, &contents);
+    if (0 != r)
+    {
+        fprintf(stderr, PROGRAM_NAME ": could not read '%s': %s\n", specsPath, strerror(r));
+
+        free(contents.ptr);
+        free(name);
+
+        return EXIT_FAILURE;
+    }
+
+    memset(&description, 0, sizeof(description));
+
+    sc.path =   specsPath;
+    sc.p    =   contents.ptr;
+    sc.line =   1;
+
+    r = specc_read_description_(&sc, &description);
+
+    free(contents.ptr);
+
+    if (0 != r)
+    {
+        if (ENOMEM == r)
+        {
+            fprintf(stderr, PROGRAM_NAME ": out of memory\n");
+        }
+
+        specc_release_description_(&description);
+        free(name);
+
+        return EXIT_FAILURE;
+    }
+
+    /* validate and index */
+    specifications = (clasp_specification_t*)calloc(description.numEntries + 1, sizeof(clasp_specification_t));
+    if (NULL == specifications)
+    {
+        fprintf(stderr, PROGRAM_NAME ": out of memory\n");
+
+        specc_release_description_(&description);
+        free(name);
+
+        return EXIT_FAILURE;
+    }
+
+    { size_t i; for (i = 0; i != description.numEntries; ++i)
+    {
+        specc_make_specification_(&description.entries[i], &specifications[i]);
+    }}
+    specifications[description.numEntries].type = CLASP_ARGTYPE_INVALID;
+
+    r = clasp_createSpecificationIndex(NULL, specifications, &index);
+    if (0 != r)
+    {
+        fprintf(stderr, PROGRAM_NAME ": could not index the specifications in '%s': %s\n", specsPath, strerror(r));
+
+        free(specifications);
+        specc_release_description_(&description);
+        free(name);
+
+        return EXIT_FAILURE;
+    }
+
+    /* render: failure is not fatal, since the generated bundle then
+     * renders its usage at runtime
+     */
+    r = specc_render_usage_body_(args, specifications, flags, consoleWidth, tabSize, blanksBetweenItems, &body);
+    if (0 != r)
+    {
+        fprintf(stderr, PROGRAM_NAME ": warning: could not pre-render usage: %s\n", strerror(r));
+    }
+    haveBody = (0 == r);
+
+    /* generate */
+    r = specc_write_output_(outputPath, specsPath, name, &description, index, haveBody ? &body : NULL, flags, consoleWidth, tabSize, blanksBetweenItems);
+    if (0 != r)
+    {
+        fprintf(stderr, PROGRAM_NAME ": could not write '%s': %s\n", outputPath, strerror(r));
+
+        remove(outputPath);
+    }
+
+    free(body.ptr);
+    clasp_destroySpecificationIndex(index);
+    free(specifications);
+    specc_release_description_(&description);
+    free(name);
+
+    return (0 == r) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int main(int argc, char** argv)
+{
+    unsigned const cflags = 0;
+
+    return clasp_main_invoke(argc, argv, main1, PROGRAM_NAME, Specifications, cflags, NULL);
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+